@@ -0,0 +1,426 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file BatchSimulator.cpp
+/// \brief Plays many complete games back to back without console narration
+///        and reports summary statistics.
+///
+/// \date   17 Oct 2026  0925
+///
+/// \note
+/// - Usage:
+///     BatchSimulator [--games N] [--players P] [--seed S] [--max-turns T]
+///                    [--threads W] [--layout FILE]
+///                    [--search-seat K]... [--search-iterations I]
+///                    [--search-ms M] [--search-threads X]
+///                    [--search-mode shared|root] [--accuse-confidence C]
+///                    [--replay-log LOG] [--stats-csv CSV]
+///                    [--stats-json JSON] [--trace TRACE]
+///                    [--trace-every K]
+/// - P must be in [3, 6]; seats are filled by characters in enumeration order.
+/// - FILE describes board layout (see BoardLayout.h); classic board when
+///   omitted.  Layout is loaded once and shared by every game.
+/// - W of 0 (default) uses one worker per hardware thread.  Results depend
+///   only on the seed, not on the number of workers.
+/// - Each --search-seat K (zero-based, below P, repeatable) seats a player
+///   searching (see IsmctsStrategy) I iterations (default 1000) and/or M milliseconds
+///   per turn choice.  A time budget makes results depend on machine load.
+/// - Each search runs on X threads (default 1; 0 for one per hardware
+///   thread), sharing one tree or growing one tree each (see
+///   IsmctsSearch::ParallelMode).  More than one thread sharing a tree makes
+///   results depend on thread timing.
+/// - C in [1, 100] is the chance (percent) of being right at which players
+///   accuse before deducing the Case File (see
+///   Player::isReadyToMakeAccusation()); 100 (default) waits for deduction.
+/// - LOG receives every game's replay record (see ReplayLogFile.h), to be
+///   examined and played again with ReplayInspector.
+/// - CSV and JSON receive the summary statistics, with turns-to-win
+///   histogram, suggestion counts, and 95% intervals of rates (see
+///   SimulationSummary::reportCsv(), reportJson()); replaced if present.
+/// - TRACE receives timed spans of every game -- each turn, decision, move,
+///   suggestion, and notebook update, by worker thread -- as a Chrome
+///   trace-event file (see TraceWriter.h), to be opened in Perfetto or
+///   chrome://tracing; replaced if present.  K above 1 (default 1) traces
+///   only every Kth game (0, K, 2K, ...), an even sample of the batch for a
+///   smaller file.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "../Clueless/BoardLayout.h"
+#include "../Clueless/GameSimulator.h"
+#include "../Clueless/ReplayLogFile.h"
+#include "../Clueless/SimulationPool.h"
+#include "../Clueless/SimulationSummary.h"
+#include "../Clueless/TraceWriter.h"
+
+#include <chrono>			//for std::chrono::steady_clock use
+#include <cstdlib>			//for std::strtoul use
+#include <cstring>			//for std::strcmp use
+#include <fstream>			//for std::ifstream, std::ofstream use
+#include <iostream>			//for std::cout use
+#include <memory>			//for std::unique_ptr use
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::exception use
+#include <string>			//for std::string use
+#include <vector>			//for std::vector use
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Parses unsigned value following command line option.
+/// \param int: index of option within argument list
+/// \param int: number of arguments
+/// \param char*[]: argument list
+/// \return unsigned long: parsed value
+/// \throw
+/// - INSUFFICIENT_DATA when option has no value.
+/// - INCONSISTENT_DATA when value not a non-negative integer.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static unsigned long
+parseOptionValue(
+	int option_index, //i - index of option within argument list
+	int argc, //i - number of arguments
+	const char* argv[]) //i - argument list
+{
+	if( option_index + 1 >= argc )
+	{
+		std::ostringstream msg;
+		msg << "parseOptionValue()\n"
+			<< "  INSUFFICIENT_DATA\n"
+			<< "  missing value for option " << argv[option_index];
+		throw std::logic_error( msg.str() );
+	}
+
+	const char* text( argv[option_index + 1] );
+	char* text_end( nullptr );
+	unsigned long value( std::strtoul(text, &text_end, 10) );
+
+	if( (text == text_end) || ('\0' != *text_end) || ('-' == *text) )
+	{
+		std::ostringstream msg;
+		msg << "parseOptionValue()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  invalid value for option " << argv[option_index]
+			<< ": " << text;
+		throw std::logic_error( msg.str() );
+	}
+
+	return value;
+
+} //end routine parseOptionValue()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Writes report to file.
+/// \param char*: path of file; replaced if present
+/// \param string: report text
+/// \return None
+/// \throw
+/// - INSUFFICIENT_DATA when file cannot be written.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static void
+writeReport(
+	const char* path, //i - path of file
+	const std::string& text) //i - report text
+{
+	std::ofstream file( path, std::ios::binary | std::ios::trunc );
+	file << text;
+	file.close();
+
+	if( ! file )
+	{
+		std::ostringstream msg;
+		msg << "writeReport()\n"
+			<< "  INSUFFICIENT_DATA\n"
+			<< "  cannot write report " << path;
+		throw std::logic_error( msg.str() );
+	}
+
+} //end routine writeReport()
+
+
+int main( int argc, const char* argv[] )
+{
+	try
+	{
+		unsigned long num_games( 1000 );
+		unsigned long num_players( 3 );
+		unsigned long seed( 5489 ); //MersenneTwister default
+		unsigned long max_num_turns( GameSimulator::DEFAULT_MAX_NUM_TURNS );
+		unsigned long num_threads( 0 ); //one per hardware thread
+		const char* layout_file( nullptr ); //classic board
+		std::vector<unsigned long> search_seat_list; //as given; checked once P known
+		unsigned long search_seats( 0 ); //bit per seat
+		IsmctsSearch::Budget search_budget;
+		unsigned long accusation_confidence( 100 ); //percent
+		const char* replay_log_file( nullptr ); //no replay log
+		const char* csv_file( nullptr ); //no CSV report
+		const char* json_file( nullptr ); //no JSON report
+		const char* trace_file( nullptr ); //no trace
+		unsigned long trace_interval( 1 ); //every game traced
+
+		//----------------------------------------------------------------------
+		// Command Line Options
+		//----------------------------------------------------------------------
+		for(int arg_index(1); arg_index < argc; ++arg_index)
+		{
+			if( 0 == std::strcmp(argv[arg_index], "--games") )
+			{
+				num_games = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--players") )
+			{
+				num_players = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--seed") )
+			{
+				seed = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--max-turns") )
+			{
+				max_num_turns = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--threads") )
+			{
+				num_threads = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( (0 == std::strcmp(argv[arg_index], "--layout")) &&
+				(arg_index + 1 < argc) )
+			{
+				layout_file = argv[++arg_index];
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--search-seat") )
+			{
+				search_seat_list.push_back( parseOptionValue( arg_index++, argc, argv ) );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--search-iterations") )
+			{
+				search_budget._maxNumIterations = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--search-ms") )
+			{
+				search_budget._maxNumMilliseconds = (double)parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--search-threads") )
+			{
+				search_budget._numThreads = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( (0 == std::strcmp(argv[arg_index], "--search-mode")) &&
+				(arg_index + 1 < argc) &&
+				((0 == std::strcmp(argv[arg_index + 1], "shared")) ||
+				 (0 == std::strcmp(argv[arg_index + 1], "root"))) )
+			{
+				search_budget._parallelMode = (0 == std::strcmp(argv[++arg_index], "root"))
+					? IsmctsSearch::ROOT_PARALLEL
+					: IsmctsSearch::SHARED_TREE;
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--accuse-confidence") )
+			{
+				accusation_confidence = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( (0 == std::strcmp(argv[arg_index], "--replay-log")) &&
+				(arg_index + 1 < argc) )
+			{
+				replay_log_file = argv[++arg_index];
+			}
+			else if( (0 == std::strcmp(argv[arg_index], "--stats-csv")) &&
+				(arg_index + 1 < argc) )
+			{
+				csv_file = argv[++arg_index];
+			}
+			else if( (0 == std::strcmp(argv[arg_index], "--stats-json")) &&
+				(arg_index + 1 < argc) )
+			{
+				json_file = argv[++arg_index];
+			}
+			else if( (0 == std::strcmp(argv[arg_index], "--trace")) &&
+				(arg_index + 1 < argc) )
+			{
+				trace_file = argv[++arg_index];
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--trace-every") )
+			{
+				trace_interval = parseOptionValue( arg_index++, argc, argv );
+			}
+			else
+			{
+				std::cout << "usage: " << argv[0]
+					<< " [--games N] [--players 3-6] [--seed S] [--max-turns T]"
+					<< " [--threads W] [--layout FILE]"
+					<< " [--search-seat K]... [--search-iterations I] [--search-ms M]"
+					<< " [--search-threads X] [--search-mode shared|root]"
+					<< " [--accuse-confidence C] [--replay-log LOG]"
+					<< " [--stats-csv CSV] [--stats-json JSON]"
+					<< " [--trace TRACE] [--trace-every K]\n"
+					<< "  (K: trace every Kth game; default 1, every game)\n";
+				return 1;
+			}
+
+		} //end for (each argument)
+
+		//----------------------------------------------------------------------
+		// Board Layout
+		//----------------------------------------------------------------------
+		std::unique_ptr<BoardLayout> layout;
+		if( layout_file )
+		{
+			std::ifstream description( layout_file );
+			if( ! description )
+			{
+				std::ostringstream msg;
+				msg << "main()\n"
+					<< "  INSUFFICIENT_DATA\n"
+					<< "  cannot open layout file " << layout_file;
+				throw std::logic_error( msg.str() );
+			}
+
+			layout.reset( new BoardLayout(description) );
+		}
+
+		GameSimulator simulator( num_players, (unsigned int)max_num_turns, layout.get() );
+
+		for(size_t list_index(0); list_index < search_seat_list.size(); ++list_index)
+		{
+			if( num_players <= search_seat_list[list_index] )
+			{
+				std::ostringstream msg;
+				msg << "main()\n"
+					<< "  INCONSISTENT_DATA\n"
+					<< "  search seat must be in [0, " << (num_players - 1)
+					<< "], not " << search_seat_list[list_index];
+				throw std::logic_error( msg.str() );
+			}
+
+			search_seats |= (1ul << search_seat_list[list_index]);
+		}
+
+		simulator.setSearchSeats( (unsigned int)search_seats, search_budget );
+
+		if( (1 > accusation_confidence) ||
+			(100 < accusation_confidence) )
+		{
+			std::ostringstream msg;
+			msg << "main()\n"
+				<< "  INCONSISTENT_DATA\n"
+				<< "  accusation confidence must be in [1, 100], not "
+				<< accusation_confidence;
+			throw std::logic_error( msg.str() );
+		}
+
+		simulator.setAccusationConfidence( (float)accusation_confidence / 100.0f );
+		SimulationPool pool( num_threads );
+
+		//----------------------------------------------------------------------
+		// Replay Log
+		//----------------------------------------------------------------------
+		std::unique_ptr<ReplayLogWriter> replay_log;
+		if( replay_log_file )
+		{
+			ReplayLogHeader header;
+			header._numPlayers = num_players;
+			header._maxNumTurns = max_num_turns;
+			header._batchSeed = seed;
+			header._searchSeats = search_seats;
+			header._searchIterations = (unsigned long)search_budget._maxNumIterations;
+			header._searchMilliseconds = (unsigned long)search_budget._maxNumMilliseconds;
+			header._searchThreads = (unsigned long)search_budget._numThreads;
+			header._searchMode = search_budget._parallelMode;
+			header._accusationPercent = accusation_confidence;
+			header._isCustomLayout = layout ? 1 : 0;
+			header._isSimulated = 1;
+
+			replay_log.reset( new ReplayLogWriter(replay_log_file, header) );
+		}
+
+		std::unique_ptr<TraceWriter> trace;
+		if( trace_file )
+		{
+			trace.reset( new TraceWriter(trace_file, trace_interval) );
+		}
+
+		//----------------------------------------------------------------------
+		// Play Games
+		//----------------------------------------------------------------------
+		std::chrono::steady_clock::time_point start_time(
+			std::chrono::steady_clock::now() );
+
+		SimulationSummary summary(
+			pool.run(simulator, num_games, seed, replay_log.get(), trace.get()) );
+
+		if( replay_log )
+		{
+			replay_log->close();
+		}
+
+		if( trace )
+		{
+			trace->close();
+		}
+
+		std::chrono::duration<double> elapsed(
+			std::chrono::steady_clock::now() - start_time );
+
+		std::cout << "Players: " << num_players
+			<< "  Seed: " << seed
+			<< "  Max turns: " << max_num_turns
+			<< "  Threads: " << pool.getNumThreads() << "\n";
+
+		if( 0 != search_seats )
+		{
+			std::cout << "Search seats:";
+			for(unsigned long seat(0); seat < num_players; ++seat)
+			{
+				if( 0 != (search_seats & (1ul << seat)) )
+				{
+					std::cout << " " << (seat + 1);
+				}
+			}
+			std::cout << "  Iterations: " << search_budget._maxNumIterations
+				<< "  Milliseconds: " << search_budget._maxNumMilliseconds
+				<< "  Threads: " << search_budget._numThreads
+				<< ((IsmctsSearch::ROOT_PARALLEL == search_budget._parallelMode) ? " (root)" : " (shared)") << "\n";
+		}
+
+		if( 100 > accusation_confidence )
+		{
+			std::cout << "Accusation confidence: " << accusation_confidence << "%\n";
+		}
+
+		if( replay_log )
+		{
+			std::cout << "Replay log: " << replay_log_file
+				<< " (" << replay_log->getNumGames() << " games)\n";
+		}
+
+		if( trace )
+		{
+			std::cout << "Trace: " << trace_file << " ("
+				<< ((0 < num_games) ? ((num_games - 1) / trace_interval + 1) : 0)
+				<< " games)\n";
+		}
+
+		std::cout << summary.report( elapsed.count() ).str();
+
+		if( csv_file )
+		{
+			writeReport( csv_file, summary.reportCsv(elapsed.count()).str() );
+		}
+
+		if( json_file )
+		{
+			writeReport( json_file, summary.reportJson(elapsed.count()).str() );
+		}
+	}
+	catch(const std::exception& error)
+	{
+		std::cout << error.what() << "\n\n";
+		return 1;
+	}
+
+	return 0;
+
+} //end routine main
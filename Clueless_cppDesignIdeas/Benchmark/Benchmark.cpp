@@ -0,0 +1,919 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file Benchmark.cpp
+/// \brief Times the engine routines on the turn pipeline and counts heap
+///        allocations, for regression numbers before and after engine
+///        changes.
+///
+/// \date   17 Oct 2026  1530
+///
+/// \note
+/// - Usage:
+///     Benchmark [--scale S] [--seed S]
+/// - Scale multiplies the number of operations timed per benchmark (default
+///   1).  Each benchmark reports operations timed, nanoseconds per operation,
+///   and heap allocations per operation.
+/// - Fixtures (games, players, decks) are built outside the timed sections;
+///   allocations are counted only inside them.
+/// - Single-threaded, except searches on all hardware threads (timed per
+///   iteration of wall clock, so they show throughput); run on a quiet
+///   machine and compare runs with the same seed and scale.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "../Clueless/Board.h"
+#include "../Clueless/Card.h"
+#include "../Clueless/CardDeck.h"
+#include "../Clueless/CaseFileHypotheses.h"
+#include "../Clueless/DealSampler.h"
+#include "../Clueless/DeductionMatrix.h"
+#include "../Clueless/Game.h"
+#include "../Clueless/GameSimulator.h"
+#include "../Clueless/GameState.h"
+#include "../Clueless/IsmctsSearch.h"
+#include "../Clueless/Location.h"
+#include "../Clueless/MoveOptionSet.h"
+#include "../Clueless/Player.h"
+#include "../Clueless/SolutionCardSet.h"
+
+#include "../Clueless/CluelessEnums.h"
+#include "../Clueless/mersenneTwister.h"
+
+#include <chrono>			//for std::chrono::steady_clock use
+#include <cstdlib>			//for std::malloc, std::free, std::strtoul use
+#include <cstring>			//for std::strcmp use
+#include <iomanip>			//for std::setw use
+#include <iostream>			//for std::cout use
+#include <list>				//for std::list use
+#include <new>				//for std::bad_alloc use
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::exception use
+#include <string>			//for std::string use
+
+
+//------------------------------------------------------------------------------
+// Allocation Counting
+//------------------------------------------------------------------------------
+/// \note benchmark is single-threaded, so plain counter suffices
+static size_t s_numAllocations( 0 );
+
+void*
+operator new(
+	std::size_t num_bytes)
+{
+	++s_numAllocations;
+
+	void* memory( std::malloc(num_bytes ? num_bytes : 1) );
+	if( ! memory )
+	{
+		throw std::bad_alloc();
+	}
+
+	return memory;
+
+} //end routine operator new()
+
+
+void*
+operator new[](
+	std::size_t num_bytes)
+{
+	return operator new( num_bytes );
+
+} //end routine operator new[]()
+
+
+void
+operator delete(
+	void* memory) noexcept
+{
+	std::free( memory );
+
+} //end routine operator delete()
+
+
+void
+operator delete[](
+	void* memory) noexcept
+{
+	std::free( memory );
+
+} //end routine operator delete[]()
+
+
+void
+operator delete(
+	void* memory,
+	std::size_t) noexcept
+{
+	std::free( memory );
+
+} //end routine operator delete()
+
+
+void
+operator delete[](
+	void* memory,
+	std::size_t) noexcept
+{
+	std::free( memory );
+
+} //end routine operator delete[]()
+
+
+//------------------------------------------------------------------------------
+// Measurement
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Accumulates time and allocations over timed sections.
+/// \note
+/// - Bracket each timed section with start() and stop().
+////////////////////////////////////////////////////////////////////////////////
+struct Measurement
+{
+	Measurement()
+		: _numOps( 0 )
+		, _elapsedNs( 0.0 )
+		, _numAllocations( 0 )
+		, _allocationsAtStart( 0 )
+	{
+	}
+
+	void
+	start()
+	{
+		_allocationsAtStart = s_numAllocations;
+		_startTime = std::chrono::steady_clock::now();
+	}
+
+	void
+	stop(
+		size_t num_ops) //i - operations performed in timed section
+	{
+		std::chrono::steady_clock::time_point stop_time( std::chrono::steady_clock::now() );
+
+		_elapsedNs += std::chrono::duration<double, std::nano>( stop_time - _startTime ).count();
+		_numAllocations += s_numAllocations - _allocationsAtStart;
+		_numOps += num_ops;
+	}
+
+	size_t _numOps;
+	double _elapsedNs;
+	size_t _numAllocations;
+
+	size_t _allocationsAtStart;
+	std::chrono::steady_clock::time_point _startTime;
+
+}; //end struct Measurement defn
+
+
+/// \note results folded in here so optimizer cannot discard timed calls
+static size_t s_sink( 0 );
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Reports one benchmark as single table row.
+/// \param string: benchmark name
+/// \param Measurement: accumulated measurement
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static void
+reportMeasurement(
+	const std::string& name, //i - benchmark name
+	const Measurement& measurement) //i - accumulated measurement
+{
+	double num_ops( measurement._numOps ? (double)measurement._numOps : 1.0 );
+
+	std::cout << std::left << std::setw(50) << name << std::right
+		<< std::setw(10) << measurement._numOps
+		<< std::setw(12) << std::fixed << std::setprecision(1)
+		<< (measurement._elapsedNs / num_ops)
+		<< std::setw(12) << std::setprecision(2)
+		<< ((double)measurement._numAllocations / num_ops) << "\n";
+
+} //end routine reportMeasurement()
+
+
+//------------------------------------------------------------------------------
+// Fixtures
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Game with players, set up and optionally played for a few rounds.
+/// \note
+/// - Game does not own players; fixture deletes them.
+////////////////////////////////////////////////////////////////////////////////
+struct GameFixture
+{
+	GameFixture(
+		unsigned long seed, //i - seed for game's random number generator
+		size_t num_players, //i - number of players
+		unsigned int num_rounds) //i - rounds to play before use
+		: _game( seed )
+	{
+		for(size_t seat(0); seat < num_players; ++seat)
+		{
+			std::ostringstream name;
+			name << "Player " << (seat + 1);
+
+			_players.push_back(
+				new Player(name.str(), GameSimulator::determineSeatCharacter(seat), (0 == seat)) );
+		}
+
+		_game.setup( &_players );
+
+		for(unsigned int round(0); (round < num_rounds) && ! isOver(); ++round)
+		{
+			std::list<Player*>::const_iterator player_iter( _players.begin() );
+			while( ! isOver() &&
+				(_players.end() != player_iter) )
+			{
+				_game.executePlayerTurn( *player_iter );
+				++player_iter;
+			}
+		}
+	}
+
+	~GameFixture()
+	{
+		std::list<Player*>::iterator player_iter( _players.begin() );
+		for(player_iter  = _players.begin();
+			player_iter != _players.end();
+			++player_iter)
+		{
+			delete *player_iter;
+		}
+	}
+
+	bool
+	isOver()
+	const
+	{
+		return( _game.hasWinner() ||
+			(_game._numFalseAccusers >= _players.size()) );
+	}
+
+	Game _game;
+	std::list<Player*> _players;
+
+}; //end struct GameFixture defn
+
+
+//------------------------------------------------------------------------------
+// Benchmarks
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Times complete player turns, game after game.
+////////////////////////////////////////////////////////////////////////////////
+static Measurement
+benchmarkExecutePlayerTurn(
+	size_t num_ops, //i - turns to time
+	unsigned long seed) //i - seed of first game
+{
+	Measurement measurement;
+
+	while( measurement._numOps < num_ops )
+	{
+		GameFixture fixture( seed++, 4, 0 );
+
+		unsigned int turn_number( 0 );
+		while( ! fixture.isOver() &&
+			(GameSimulator::DEFAULT_MAX_NUM_TURNS > turn_number) )
+		{
+			std::list<Player*>::const_iterator player_iter( fixture._players.begin() );
+			while( ! fixture.isOver() &&
+				(fixture._players.end() != player_iter) )
+			{
+				measurement.start();
+				fixture._game.executePlayerTurn( *player_iter );
+				measurement.stop( 1 );
+
+				++player_iter;
+			}
+
+			++turn_number;
+		}
+	}
+
+	return measurement;
+
+} //end routine benchmarkExecutePlayerTurn()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Times move choice from each player's current location.
+////////////////////////////////////////////////////////////////////////////////
+static Measurement
+benchmarkProvideMovePreference(
+	size_t num_ops, //i - move choices to time
+	unsigned long seed) //i - game seed
+{
+	Measurement measurement;
+
+	GameFixture fixture( seed, 6, 2 );
+
+	//move options of every player with any
+	std::list<MoveOptionSet> options;
+	std::list<const Player*> choosers;
+
+	std::list<Player*>::const_iterator player_iter( fixture._players.begin() );
+	for(player_iter  = fixture._players.begin();
+		player_iter != fixture._players.end();
+		++player_iter)
+	{
+		MoveOptionSet move_options( (*player_iter)->getLocation()->getMoveOptions() );
+		if( ! move_options.isEmpty() )
+		{
+			options.push_back( move_options );
+			choosers.push_back( *player_iter );
+		}
+	}
+
+	if( choosers.empty() )
+	{
+		return measurement;
+	}
+
+	const size_t BATCH_SIZE( 64 );
+	while( measurement._numOps < num_ops )
+	{
+		std::list<MoveOptionSet>::iterator options_iter( options.begin() );
+		std::list<const Player*>::const_iterator chooser_iter( choosers.begin() );
+
+		measurement.start();
+		for(size_t op(0); op < BATCH_SIZE; ++op)
+		{
+			s_sink += (size_t)(*chooser_iter)->provideMovePreference( &*options_iter );
+
+			if( choosers.end() == ++chooser_iter )
+			{
+				chooser_iter = choosers.begin();
+				options_iter = options.begin();
+			}
+			else
+			{
+				++options_iter;
+			}
+		}
+		measurement.stop( BATCH_SIZE );
+	}
+
+	return measurement;
+
+} //end routine benchmarkProvideMovePreference()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Times choice of counter-evidence card to show each opponent.
+////////////////////////////////////////////////////////////////////////////////
+static Measurement
+benchmarkDecideWhichCardToShowOpponent(
+	size_t num_ops, //i - decisions to time
+	unsigned long seed) //i - game seed
+{
+	Measurement measurement;
+
+	GameFixture fixture( seed, 4, 2 );
+
+	const Player* refuter( fixture._players.front() );
+	const Card* hand[clueless::NUM_CARDS];
+	const size_t num_cards( refuter->getNumCardsInHand() );
+	for(size_t pos_index(0); pos_index < num_cards; ++pos_index)
+	{
+		hand[pos_index] = refuter->getCardInHand( pos_index );
+	}
+
+	const size_t BATCH_SIZE( 64 );
+	while( measurement._numOps < num_ops )
+	{
+		measurement.start();
+		for(size_t op(0); op < BATCH_SIZE; ++op)
+		{
+			clueless::PersonType opponent(
+				GameSimulator::determineSeatCharacter(1 + op % (fixture._players.size() - 1)) );
+
+			s_sink += (size_t)refuter->_notebook.decideWhichCardToShowOpponent( hand, num_cards, opponent );
+		}
+		measurement.stop( BATCH_SIZE );
+	}
+
+	return measurement;
+
+} //end routine benchmarkDecideWhichCardToShowOpponent()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Times reweighing of Case File hypotheses from a notebook's
+///  deductions partway through a game.
+////////////////////////////////////////////////////////////////////////////////
+static Measurement
+benchmarkCaseFileHypothesesUpdate(
+	size_t num_ops, //i - updates to time
+	unsigned long seed) //i - game seed
+{
+	Measurement measurement;
+
+	GameFixture fixture( seed, 4, 3 );
+
+	const DeductionMatrix& deductions( fixture._players.front()->_notebook.getDeductions() );
+	CaseFileHypotheses hypotheses;
+
+	const size_t BATCH_SIZE( 64 );
+	while( measurement._numOps < num_ops )
+	{
+		measurement.start();
+		for(size_t op(0); op < BATCH_SIZE; ++op)
+		{
+			hypotheses.update( deductions );
+		}
+		measurement.stop( BATCH_SIZE );
+
+		s_sink += hypotheses.findMostLikely()._person;
+	}
+
+	return measurement;
+
+} //end routine benchmarkCaseFileHypothesesUpdate()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Deals sampler for first player's notebook partway through a game.
+////////////////////////////////////////////////////////////////////////////////
+static DealSampler
+buildDealSampler(
+	const GameFixture& fixture) //i - game in progress
+{
+	const Player* observer( fixture._players.front() );
+
+	unsigned int hand( 0 );
+	for(size_t pos_index(0); pos_index < observer->getNumCardsInHand(); ++pos_index)
+	{
+		hand |= (1u << observer->getCardInHand(pos_index)->getIndex());
+	}
+
+	return DealSampler( observer->_notebook.getDeductions(), observer->getCharacter(), hand );
+
+} //end routine buildDealSampler()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Times counting of deals consistent with a notebook.
+////////////////////////////////////////////////////////////////////////////////
+static Measurement
+benchmarkDealSamplerConstruction(
+	size_t num_ops, //i - samplers to build
+	unsigned long seed) //i - game seed
+{
+	Measurement measurement;
+
+	GameFixture fixture( seed, 4, 3 );
+
+	while( measurement._numOps < num_ops )
+	{
+		measurement.start();
+		DealSampler sampler( buildDealSampler(fixture) );
+		measurement.stop( 1 );
+
+		s_sink += (size_t)sampler.getNumDeals();
+	}
+
+	return measurement;
+
+} //end routine benchmarkDealSamplerConstruction()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Times drawing of deals consistent with a notebook.
+////////////////////////////////////////////////////////////////////////////////
+static Measurement
+benchmarkDealSamplerSample(
+	size_t num_ops, //i - deals to draw
+	unsigned long seed) //i - game seed
+{
+	Measurement measurement;
+
+	GameFixture fixture( seed, 4, 3 );
+	const DealSampler sampler( buildDealSampler(fixture) );
+
+	MersenneTwister rng( seed );
+	unsigned int cards_by_holder[DeductionMatrix::NUM_HOLDERS];
+
+	const size_t BATCH_SIZE( 64 );
+	while( measurement._numOps < num_ops )
+	{
+		measurement.start();
+		for(size_t op(0); op < BATCH_SIZE; ++op)
+		{
+			s_sink += (size_t)sampler.sample( rng, cards_by_holder );
+		}
+		measurement.stop( BATCH_SIZE );
+
+		s_sink += cards_by_holder[DeductionMatrix::CASE_FILE];
+	}
+
+	return measurement;
+
+} //end routine benchmarkDealSamplerSample()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Times search of opponents for counter-evidence, cycling through
+///  every possible suggestion.
+////////////////////////////////////////////////////////////////////////////////
+static Measurement
+benchmarkRequestCounterEvidence(
+	size_t num_ops, //i - requests to time
+	unsigned long seed) //i - game seed
+{
+	Measurement measurement;
+
+	GameFixture fixture( seed, 4, 2 );
+
+	const Player* suggestor( fixture._players.front() );
+
+	size_t person_index( 0 );
+	size_t weapon_index( 0 );
+	size_t room_index( 0 );
+
+	const size_t BATCH_SIZE( 64 );
+	while( measurement._numOps < num_ops )
+	{
+		measurement.start();
+		for(size_t op(0); op < BATCH_SIZE; ++op)
+		{
+			SolutionCardSet suggestion(
+				clueless::PersonType(clueless::UNKNOWN_PERSON + 1 + person_index),
+				clueless::WeaponType(clueless::UNKNOWN_WEAPON + 1 + weapon_index),
+				clueless::RoomType(clueless::UNKNOWN_ROOM + 1 + room_index) );
+
+			clueless::PersonType refuter( clueless::UNKNOWN_PERSON );
+			s_sink += (size_t)fixture._game.requestCounterEvidenceToPlayerSuggestion(
+				suggestor, &suggestion, refuter );
+
+			//next suggestion
+			person_index = (person_index + 1) % clueless::getNumPersonTypes();
+			if( 0 == person_index )
+			{
+				weapon_index = (weapon_index + 1) % clueless::getNumWeaponTypes();
+				if( 0 == weapon_index )
+				{
+					room_index = (room_index + 1) % clueless::getNumRoomTypes();
+				}
+			}
+		}
+		measurement.stop( BATCH_SIZE );
+	}
+
+	return measurement;
+
+} //end routine benchmarkRequestCounterEvidence()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Times dealing of a fresh deck to fresh players.
+/// \note
+/// - Includes deck construction (cards, Case File choice), which setup
+///   depends on.
+////////////////////////////////////////////////////////////////////////////////
+static Measurement
+benchmarkCardDeckSetup(
+	size_t num_ops, //i - deals to time
+	unsigned long seed) //i - seed for random number generator
+{
+	Measurement measurement;
+
+	MersenneTwister rng( seed );
+
+	while( measurement._numOps < num_ops )
+	{
+		Player* players[4];
+		for(size_t seat(0); seat < 4; ++seat)
+		{
+			players[seat] =
+				new Player("Player", GameSimulator::determineSeatCharacter(seat), (0 == seat));
+		}
+
+		{
+			measurement.start();
+
+			CardDeck cards( &rng );
+			cards.setup( players, 4 );
+
+			measurement.stop( 1 );
+
+			s_sink += players[0]->getNumCardsInHand();
+
+			//hands reference deck's cards; players go before deck
+			for(size_t seat(0); seat < 4; ++seat)
+			{
+				delete players[seat];
+			}
+		}
+	}
+
+	return measurement;
+
+} //end routine benchmarkCardDeckSetup()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Times distance lookup from every location to every room.
+////////////////////////////////////////////////////////////////////////////////
+static Measurement
+benchmarkFetchDistanceToRoom(
+	size_t num_ops, //i - lookups to time
+	unsigned long seed) //i - seed for random number generator
+{
+	Measurement measurement;
+
+	MersenneTwister rng( seed );
+	Board board( &rng, BoardLayout::classic() );
+
+	std::list<const Location*> starts;
+	for(size_t loc_id(0); loc_id < board.getLayout()->getNumLocations(); ++loc_id)
+	{
+		starts.push_back( board.getLocation(loc_id) );
+	}
+
+	while( measurement._numOps < num_ops )
+	{
+		measurement.start();
+
+		std::list<const Location*>::const_iterator start_iter( starts.begin() );
+		for(start_iter  = starts.begin();
+			start_iter != starts.end();
+			++start_iter)
+		{
+			for(size_t room_index(clueless::STUDY); room_index <= clueless::KITCHEN; ++room_index)
+			{
+				size_t distance( 0 );
+				s_sink += (size_t)board.fetchDistanceToRoom( *start_iter, (clueless::RoomType)room_index, distance );
+				s_sink += distance;
+			}
+		}
+
+		measurement.stop( starts.size() * clueless::getNumRoomTypes() );
+	}
+
+	return measurement;
+
+} //end routine benchmarkFetchDistanceToRoom()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Times snapshot of game in progress.
+////////////////////////////////////////////////////////////////////////////////
+static Measurement
+benchmarkSnapshot(
+	size_t num_ops, //i - snapshots to time
+	unsigned long seed) //i - game seed
+{
+	Measurement measurement;
+
+	GameFixture fixture( seed, 6, 2 );
+	const Player* turn_taker( fixture._players.front() );
+
+	while( measurement._numOps < num_ops )
+	{
+		measurement.start();
+		GameState state( fixture._game.snapshot(turn_taker) );
+		measurement.stop( 1 );
+
+		s_sink += state._turnSeat;
+	}
+
+	return measurement;
+
+} //end routine benchmarkSnapshot()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Times copying a snapshot and stepping it by first option of turn.
+/// \note
+/// - Steps one line of play from snapshot, starting over once game ends.
+////////////////////////////////////////////////////////////////////////////////
+static Measurement
+benchmarkGameStateStep(
+	size_t num_ops, //i - steps to time
+	unsigned long seed) //i - game seed
+{
+	Measurement measurement;
+
+	GameFixture fixture( seed, 6, 2 );
+	const BoardLayout& layout( *fixture._game._board.getLayout() );
+
+	const GameState initial( fixture._game.snapshot(fixture._players.front()) );
+	GameState state( initial );
+
+	unsigned char destinations[GameState::MAX_NUM_MOVE_OPTIONS];
+
+	while( measurement._numOps < num_ops )
+	{
+		if( state.isOver() )
+		{
+			state = initial;
+		}
+
+		//choose outside timed section
+		unsigned int options( state.determineTurnOptions(layout) );
+		GameState::Action action;
+
+		if( 0 != (options & (1u << clueless::MAKE_ACCUSATION)) )
+		{
+			action = GameState::Action::accuse( state.determineAccusation(state._turnSeat) );
+		}
+		else if( 0 != (options & (1u << clueless::MOVE)) )
+		{
+			state.determineMoveOptions( layout, destinations );
+			action = GameState::Action::move( destinations[0] );
+		}
+		else if( 0 != (options & (1u << clueless::MAKE_SUGGESTION)) )
+		{
+			action = GameState::Action::suggest(
+				clueless::PersonType(1 + measurement._numOps % clueless::PROFESSOR_PLUM),
+				clueless::WeaponType(1 + measurement._numOps % clueless::WRENCH) );
+		}
+
+		measurement.start();
+		state = GameState::step( state, action, layout );
+		measurement.stop( 1 );
+	}
+
+	s_sink += state._numRounds;
+
+	return measurement;
+
+} //end routine benchmarkGameStateStep()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Times search iterations from snapshot of game in progress.
+/// \note
+/// - One operation is one iteration; searches of 1000 iterations are timed
+///   whole, thread start-up included.
+////////////////////////////////////////////////////////////////////////////////
+static Measurement
+benchmarkIsmctsSearch(
+	size_t num_ops, //i - iterations to time
+	unsigned long seed, //i - game seed
+	size_t num_threads, //i - threads per search (0 for all)
+	IsmctsSearch::ParallelMode mode) //i - how threads share search
+{
+	Measurement measurement;
+
+	GameFixture fixture( seed, 6, 2 );
+	const BoardLayout& layout( *fixture._game._board.getLayout() );
+	const GameState root( fixture._game.snapshot(fixture._players.front()) );
+
+	IsmctsSearch::Budget budget( 1000, 0 );
+	budget._numThreads = num_threads;
+	budget._parallelMode = mode;
+
+	IsmctsSearch search;
+	MersenneTwister rng( seed );
+
+	while( measurement._numOps < num_ops )
+	{
+		measurement.start();
+		GameState::Action action( search.run(root, layout, budget, rng) );
+		measurement.stop( search.getNumIterations() ? search.getNumIterations() : 1 );
+
+		s_sink += action._choice;
+	}
+
+	return measurement;
+
+} //end routine benchmarkIsmctsSearch()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Parses unsigned value following command line option.
+/// \param int: index of option within argument list
+/// \param int: number of arguments
+/// \param char*[]: argument list
+/// \return unsigned long: parsed value
+/// \throw
+/// - INSUFFICIENT_DATA when option has no value.
+/// - INCONSISTENT_DATA when value not a non-negative integer.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static unsigned long
+parseOptionValue(
+	int option_index, //i - index of option within argument list
+	int argc, //i - number of arguments
+	const char* argv[]) //i - argument list
+{
+	if( option_index + 1 >= argc )
+	{
+		std::ostringstream msg;
+		msg << "parseOptionValue()\n"
+			<< "  INSUFFICIENT_DATA\n"
+			<< "  missing value for option " << argv[option_index];
+		throw std::logic_error( msg.str() );
+	}
+
+	const char* text( argv[option_index + 1] );
+	char* text_end( nullptr );
+	unsigned long value( std::strtoul(text, &text_end, 10) );
+
+	if( (text == text_end) || ('\0' != *text_end) || ('-' == *text) )
+	{
+		std::ostringstream msg;
+		msg << "parseOptionValue()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  invalid value for option " << argv[option_index]
+			<< ": " << text;
+		throw std::logic_error( msg.str() );
+	}
+
+	return value;
+
+} //end routine parseOptionValue()
+
+
+int main( int argc, const char* argv[] )
+{
+	try
+	{
+		unsigned long scale( 1 );
+		unsigned long seed( 5489 ); //MersenneTwister default
+
+		//----------------------------------------------------------------------
+		// Command Line Options
+		//----------------------------------------------------------------------
+		for(int arg_index(1); arg_index < argc; ++arg_index)
+		{
+			if( 0 == std::strcmp(argv[arg_index], "--scale") )
+			{
+				scale = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--seed") )
+			{
+				seed = parseOptionValue( arg_index++, argc, argv );
+			}
+			else
+			{
+				std::cout << "usage: " << argv[0] << " [--scale S] [--seed S]\n";
+				return 1;
+			}
+
+		} //end for (each argument)
+
+		//----------------------------------------------------------------------
+		// Run Benchmarks
+		//----------------------------------------------------------------------
+		std::cout << "Scale: " << scale << "  Seed: " << seed << "\n"
+			<< std::left << std::setw(50) << "benchmark" << std::right
+			<< std::setw(10) << "ops"
+			<< std::setw(12) << "ns/op"
+			<< std::setw(12) << "allocs/op" << "\n";
+
+		reportMeasurement( "Game::executePlayerTurn",
+			benchmarkExecutePlayerTurn(20000 * scale, seed) );
+		reportMeasurement( "Player::provideMovePreference",
+			benchmarkProvideMovePreference(200000 * scale, seed) );
+		reportMeasurement( "DetectiveNotebook::decideWhichCardToShowOpponent",
+			benchmarkDecideWhichCardToShowOpponent(200000 * scale, seed) );
+		reportMeasurement( "CaseFileHypotheses::update",
+			benchmarkCaseFileHypothesesUpdate(200000 * scale, seed) );
+		reportMeasurement( "DealSampler construction",
+			benchmarkDealSamplerConstruction(2000 * scale, seed) );
+		reportMeasurement( "DealSampler::sample",
+			benchmarkDealSamplerSample(200000 * scale, seed) );
+		reportMeasurement( "Game::requestCounterEvidenceToPlayerSuggestion",
+			benchmarkRequestCounterEvidence(200000 * scale, seed) );
+		reportMeasurement( "CardDeck::setup",
+			benchmarkCardDeckSetup(20000 * scale, seed) );
+		reportMeasurement( "Board::fetchDistanceToRoom",
+			benchmarkFetchDistanceToRoom(2000000 * scale, seed) );
+		reportMeasurement( "Game::snapshot",
+			benchmarkSnapshot(200000 * scale, seed) );
+		reportMeasurement( "GameState::step",
+			benchmarkGameStateStep(2000000 * scale, seed) );
+		reportMeasurement( "IsmctsSearch iteration (1 thread)",
+			benchmarkIsmctsSearch(20000 * scale, seed, 1, IsmctsSearch::SHARED_TREE) );
+		reportMeasurement( "IsmctsSearch iteration (shared, all threads)",
+			benchmarkIsmctsSearch(20000 * scale, seed, 0, IsmctsSearch::SHARED_TREE) );
+		reportMeasurement( "IsmctsSearch iteration (root, all threads)",
+			benchmarkIsmctsSearch(20000 * scale, seed, 0, IsmctsSearch::ROOT_PARALLEL) );
+
+		//keep folded results observable
+		if( 1 == s_sink )
+		{
+			std::cout << "\n";
+		}
+	}
+	catch(const std::exception& error)
+	{
+		std::cout << error.what() << "\n\n";
+		return 1;
+	}
+
+	return 0;
+
+} //end routine main
@@ -0,0 +1,293 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file BinaryEventSink.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  1135
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "BinaryEventSink.h"
+
+#include "Card.h"
+#include "Location.h"
+#include "Player.h"
+#include "SolutionCardSet.h"
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Default constructor
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - Reserves room for a typical game so recording rarely reallocates.
+////////////////////////////////////////////////////////////////////////////////
+BinaryEventSink::BinaryEventSink()
+{
+	_records.reserve( 1024 );
+
+} //end routine constructor
+
+
+//------------------------------------------------------------------------------
+// Game Events
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Records Case File and each player's starting position and hand.
+/// \param list<Player>: all players
+/// \param Board: game board (not recorded; layout is fixed)
+/// \param SolutionCardSet: Case File
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::gameSetUp(
+	const std::list<Player*>& players, //i - all players
+	const Board&, //i - game board
+	const SolutionCardSet& case_file) //i - Case File
+{
+	_records.push_back( (unsigned char)GAME_SET_UP );
+	appendSolution( case_file );
+	_records.push_back( (unsigned char)players.size() );
+
+	std::list<Player*>::const_iterator player_iter( players.begin() );
+	for(player_iter  = players.begin();
+		player_iter != players.end();
+		++player_iter )
+	{
+		const size_t num_cards( (*player_iter)->getNumCardsInHand() );
+
+		_records.push_back( (unsigned char)(*player_iter)->getCharacter() );
+		_records.push_back( (unsigned char)(*player_iter)->getLocation()->getId() );
+		_records.push_back( (unsigned char)num_cards );
+
+		for(size_t pos_index(0); pos_index < num_cards; ++pos_index)
+		{
+			appendCard( (*player_iter)->getCardInHand(pos_index) );
+
+		} //end for (each card in hand)
+
+	} //end for (each player)
+
+} //end routine gameSetUp()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::turnStarted(
+	const Player* player) //i - turn taker
+{
+	appendPlayerEvent( TURN_STARTED, player );
+
+} //end routine turnStarted()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::turnSkipped(
+	const Player* false_accuser) //i - false accuser
+{
+	appendPlayerEvent( TURN_SKIPPED, false_accuser );
+
+} //end routine turnSkipped()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::noPermissibleMoves(
+	const Player* player) //i - turn taker
+{
+	appendPlayerEvent( NO_PERMISSIBLE_MOVES, player );
+
+} //end routine noPermissibleMoves()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::stayInRoomAllowed(
+	const Player* player) //i - turn taker
+{
+	appendPlayerEvent( STAY_IN_ROOM_ALLOWED, player );
+
+} //end routine stayInRoomAllowed()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::turnOptionChosen(
+	const Player* player, //i - turn taker
+	clueless::TurnOptionType choice) //i - turn option chosen
+{
+	appendPlayerEvent( TURN_OPTION_CHOSEN, player );
+	_records.push_back( (unsigned char)choice );
+
+} //end routine turnOptionChosen()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::playerMoved(
+	const Player* player, //i - turn taker
+	const Location* destination, //i - new location
+	bool was_random_choice) //i - whether game chose among move options
+{
+	appendPlayerEvent( PLAYER_MOVED, player );
+	_records.push_back( (unsigned char)destination->getId() );
+	_records.push_back( was_random_choice ? 1 : 0 );
+
+} //end routine playerMoved()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::suggestionMade(
+	const Player* suggestor, //i - suggestor
+	const SolutionCardSet& suggestion) //i - suggestion
+{
+	appendPlayerEvent( SUGGESTION_MADE, suggestor );
+	appendSolution( suggestion );
+
+} //end routine suggestionMade()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::personTokenMovedForSuggestion(
+	clueless::PersonType person, //i - person token moved
+	clueless::RoomType room) //i - new location
+{
+	_records.push_back( (unsigned char)PERSON_TOKEN_MOVED );
+	_records.push_back( (unsigned char)person );
+	_records.push_back( (unsigned char)room );
+
+} //end routine personTokenMovedForSuggestion()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::weaponTokenMovedForSuggestion(
+	clueless::WeaponType weapon, //i - weapon token moved
+	clueless::RoomType room) //i - new location
+{
+	_records.push_back( (unsigned char)WEAPON_TOKEN_MOVED );
+	_records.push_back( (unsigned char)weapon );
+	_records.push_back( (unsigned char)room );
+
+} //end routine weaponTokenMovedForSuggestion()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::counterEvidenceShown(
+	const Player* refuter, //i - player showing card
+	const Player* suggestor, //i - player shown card
+	const Card* counter_evidence) //i - card shown
+{
+	appendPlayerEvent( COUNTER_EVIDENCE_SHOWN, refuter );
+	_records.push_back( (unsigned char)suggestor->getCharacter() );
+	appendCard( counter_evidence );
+
+} //end routine counterEvidenceShown()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::suggestionRefuted(
+	clueless::PersonType refuter) //i - refuter's character
+{
+	_records.push_back( (unsigned char)SUGGESTION_REFUTED );
+	_records.push_back( (unsigned char)refuter );
+
+} //end routine suggestionRefuted()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::suggestionUnrefuted(
+	const Player* suggestor) //i - suggestor
+{
+	appendPlayerEvent( SUGGESTION_UNREFUTED, suggestor );
+
+} //end routine suggestionUnrefuted()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \note Not recorded; marks a phase boundary only (no state changes).
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::notebooksUpdated(
+	const Player*) //i - suggestor
+{
+} //end routine notebooksUpdated()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::gameWon(
+	const Player* winner, //i - game winner
+	const SolutionCardSet& case_file) //i - Case File
+{
+	appendPlayerEvent( GAME_WON, winner );
+	appendSolution( case_file );
+
+} //end routine gameWon()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::falseAccusationMade(
+	const Player* false_accuser, //i - false accuser
+	const SolutionCardSet& accusation) //i - accusation
+{
+	appendPlayerEvent( FALSE_ACCUSATION_MADE, false_accuser );
+	appendSolution( accusation );
+
+} //end routine falseAccusationMade()
+
+
+//------------------------------------------------------------------------------
+// Record Encoding
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::appendPlayerEvent(
+	EventType event, //i - event being recorded
+	const Player* player) //i - player event concerns
+{
+	_records.push_back( (unsigned char)event );
+	_records.push_back( (unsigned char)player->getCharacter() );
+
+} //end routine appendPlayerEvent()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::appendSolution(
+	const SolutionCardSet& solution) //i - suggestion, accusation, or Case File
+{
+	_records.push_back( (unsigned char)solution.getPersonType() );
+	_records.push_back( (unsigned char)solution.getWeaponType() );
+	_records.push_back( (unsigned char)solution.getRoomType() );
+
+} //end routine appendSolution()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+BinaryEventSink::appendCard(
+	const Card* card) //i - card
+{
+	_records.push_back( (unsigned char)card->_type );
+	_records.push_back( (unsigned char)CardOrder::determineSubtype(card) );
+
+} //end routine appendCard()
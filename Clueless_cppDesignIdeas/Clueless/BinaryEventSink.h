@@ -0,0 +1,149 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file BinaryEventSink.h
+/// \brief Records game play events as compact binary records for replay.
+///
+/// \date   17 Oct 2026  1130
+///
+/// \note
+/// - Each record is one EventType byte followed by fixed payload bytes:
+///   - characters, weapons, rooms, turn options: enum value (1 byte)
+///   - locations: Location id (1 byte)
+///   - cards: ElementType, then person/weapon/room enum value (2 bytes)
+/// - Payload by event:
+///   - GAME_SET_UP: case file person, weapon, room; number of players; then
+///     per player: character, location, hand size, cards
+///   - TURN_STARTED, TURN_SKIPPED, NO_PERMISSIBLE_MOVES, STAY_IN_ROOM_ALLOWED,
+///     SUGGESTION_UNREFUTED: character
+///   - TURN_OPTION_CHOSEN: character, turn option
+///   - PLAYER_MOVED: character, location, was random choice (0 / 1)
+///   - SUGGESTION_MADE: character, person, weapon, room
+///   - PERSON_TOKEN_MOVED: person, room
+///   - WEAPON_TOKEN_MOVED: weapon, room
+///   - COUNTER_EVIDENCE_SHOWN: refuter character, suggestor character, card
+///   - SUGGESTION_REFUTED: refuter character
+///   - GAME_WON: character, case file person, weapon, room
+///   - FALSE_ACCUSATION_MADE: character, accused person, weapon, room
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BinaryEventSink_h
+#define BinaryEventSink_h
+
+#include "GameEventSink.h"
+
+#include <vector>	//for std::vector use
+
+
+class BinaryEventSink : public GameEventSink
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Enumerated Types
+	//--------------------------------------------------------------------------
+public:
+	enum EventType
+	{
+		GAME_SET_UP = 1,
+		TURN_STARTED,
+		TURN_SKIPPED,
+		NO_PERMISSIBLE_MOVES,
+		STAY_IN_ROOM_ALLOWED,
+		TURN_OPTION_CHOSEN,
+		PLAYER_MOVED,
+		SUGGESTION_MADE,
+		PERSON_TOKEN_MOVED,
+		WEAPON_TOKEN_MOVED,
+		COUNTER_EVIDENCE_SHOWN,
+		SUGGESTION_REFUTED,
+		SUGGESTION_UNREFUTED,
+		GAME_WON,
+		FALSE_ACCUSATION_MADE
+
+	}; //end enum EventType defn
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+	BinaryEventSink();
+
+	virtual ~BinaryEventSink()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	const std::vector<unsigned char>& getRecords() const;
+
+	void clear();
+
+	//--------------------------------------------------------------------------
+	// Game Events
+	//--------------------------------------------------------------------------
+	virtual void gameSetUp(const std::list<Player*>& players,
+		const Board& board,
+		const SolutionCardSet& caseFile) override;
+
+	virtual void turnStarted(const Player* player) override;
+	virtual void turnSkipped(const Player* falseAccuser) override;
+	virtual void noPermissibleMoves(const Player* player) override;
+	virtual void stayInRoomAllowed(const Player* player) override;
+	virtual void turnOptionChosen(const Player* player, clueless::TurnOptionType choice) override;
+	virtual void playerMoved(const Player* player,
+		const Location* destination,
+		bool wasRandomChoice) override;
+
+	virtual void suggestionMade(const Player* suggestor, const SolutionCardSet& suggestion) override;
+	virtual void personTokenMovedForSuggestion(clueless::PersonType person, clueless::RoomType room) override;
+	virtual void weaponTokenMovedForSuggestion(clueless::WeaponType weapon, clueless::RoomType room) override;
+	virtual void counterEvidenceShown(const Player* refuter,
+		const Player* suggestor,
+		const Card* counterEvidence) override;
+	virtual void suggestionRefuted(clueless::PersonType refuter) override;
+	virtual void suggestionUnrefuted(const Player* suggestor) override;
+	virtual void notebooksUpdated(const Player* suggestor) override;
+
+	virtual void gameWon(const Player* winner, const SolutionCardSet& caseFile) override;
+	virtual void falseAccusationMade(const Player* falseAccuser, const SolutionCardSet& accusation) override;
+
+protected:
+	void appendPlayerEvent(EventType event, const Player* player);
+	void appendSolution(const SolutionCardSet& solution);
+	void appendCard(const Card* card);
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	std::vector<unsigned char> _records;
+
+}; //end class BinaryEventSink defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline const std::vector<unsigned char>&
+BinaryEventSink::getRecords()
+const
+{
+	return _records;
+
+} //end routine getRecords()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline void
+BinaryEventSink::clear()
+{
+	_records.clear();
+
+} //end routine clear()
+
+
+#endif //BinaryEventSink_h defn
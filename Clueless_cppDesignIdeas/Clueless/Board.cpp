@@ -17,13 +17,16 @@
 
 #include "Card.h"			//for RoomCard use
 #include "GamePiece.h"
+#include "Instrumentation.h"	//for CLUELESS_TIME_SCOPE use
 #include "Location.h"
 #include "Room.h"
 
 #include "CluelessEnums.h"	//for RoomType use
 #include "mersenneTwister.h"
 
-#include <iostream>			//for std::cout use
+#include <climits>			//for UINT_MAX use
+#include <cmath>			//for std::floor use
+#include <ostream>			//for std::ostream use
 #include <sstream>			//for std::ostringstream use
 #include <stdexcept>		//for std::logic_error use
 
@@ -31,40 +34,32 @@
 // Constructors / Destructor
 //------------------------------------------------------------------------------
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Default constructor
-/// \param None
+/// \brief Extended constructor
+/// \param MersenneTwister: random number generator of owning game
+/// \param BoardLayout: connections between locations (not owned)
 /// \return None
 /// \throw None
-/// \note  None
-////////////////////////////////////////////////////////////////////////////////
-Board::Board()
-	: _study( nullptr )
-	, _hall( nullptr )
-	, _lounge( nullptr )
-	, _library( nullptr )
-	, _billiardRoom( nullptr )
-	, _diningRoom( nullptr )
-	, _conservatory( nullptr )
-	, _ballroom( nullptr )
-	, _kitchen( nullptr )
-	, _missScarlet( nullptr )
-	, _colonelMustard( nullptr )
-	, _mrsWhite( nullptr )
-	, _mrGreen( nullptr )
-	, _mrsPeacock( nullptr )
-	, _professorPlum( nullptr )
-	, _leadPipe( nullptr )
-	, _knife( nullptr )
-	, _rope( nullptr )
-	, _candlestick( nullptr )
-	, _revolver( nullptr )
-	, _wrench( nullptr )
+/// \note
+/// - Layout must outlive board.
+////////////////////////////////////////////////////////////////////////////////
+Board::Board(
+	MersenneTwister* rng, //i - random number generator of owning game
+	const BoardLayout* layout) //i - connections between locations
+	: _personTokens()
+	, _weaponTokens()
+	, _rng( rng )
+	, _layout( layout )
+	, _roomsByType()
 {
+	_locationsById.assign( _layout->getNumLocations(), nullptr );
+
 	createRooms();
 
 	createPersonTokens();
 	createConnectingHallways();
 
+	connectLocations(); //exits per layout
+
 	createWeaponTokens();
 	randomlyDistributeWeapons(); //amongst rooms
 
@@ -80,46 +75,26 @@ Board::Board()
 ////////////////////////////////////////////////////////////////////////////////
 Board::~Board()
 {
-	//delete all room objects
-	std::set<Location*>::iterator room_iter( _rooms.begin() );
-	Location* curr_room( nullptr );
-
-	while( room_iter != _rooms.end() )
+	//delete all locations
+	for(size_t loc_id(0); loc_id < _locationsById.size(); ++loc_id)
 	{
-		curr_room = *room_iter;
-		_rooms.erase( room_iter );
-		delete curr_room;
-
-		room_iter = _rooms.begin();
+		delete _locationsById[loc_id];
+		_locationsById[loc_id] = nullptr;
 	}
 
 	//delete all person tokens
-	std::map<clueless::PersonType, PersonPiece*>::iterator person_iter( _personTokens.begin() );
-	PersonPiece* curr_person_token( nullptr );
-
-	while( person_iter != _personTokens.end() )
+	for(size_t person(clueless::MISS_SCARLET); person <= clueless::PROFESSOR_PLUM; ++person)
 	{
-		curr_person_token = person_iter->second;
-		_personTokens.erase( person_iter );
-		delete curr_person_token;
-
-		person_iter = _personTokens.begin();
-
-	} //end while (more person tokens)
+		delete _personTokens[person];
+		_personTokens[person] = nullptr;
+	}
 
 	//delete all weapon tokens
-	std::map<clueless::WeaponType, WeaponPiece*>::iterator wpn_iter( _weaponTokens.begin() );
-	WeaponPiece* curr_wpn_token( nullptr );
-
-	while( wpn_iter != _weaponTokens.end() )
+	for(size_t wpn(clueless::CANDLESTICK); wpn <= clueless::WRENCH; ++wpn)
 	{
-		curr_wpn_token = wpn_iter->second;
-		_weaponTokens.erase( wpn_iter );
-		delete curr_wpn_token;
-
-		wpn_iter = _weaponTokens.begin();
-
-	} //end while (more weapon tokens)
+		delete _weaponTokens[wpn];
+		_weaponTokens[wpn] = nullptr;
+	}
 
 } //end routine destructor
 
@@ -129,141 +104,29 @@ Board::~Board()
 //------------------------------------------------------------------------------
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Lists all rooms on board.
-/// \param None
+/// \param ostream: destination for list
 /// \return None
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
 void
-Board::listRooms()
+Board::listRooms(
+	std::ostream& out) //o - destination for list
 const
 {
-	std::cout << _rooms.size() << " Rooms: ";
+	out << size_t(clueless::KITCHEN) << " Rooms: ";
 
-	std::set<Location*>::const_iterator room_iter( _rooms.begin() );
-	if( 0 < _rooms.size() ) //at least one room
+	for(size_t room_index(clueless::STUDY); room_index <= clueless::KITCHEN; ++room_index)
 	{
-		std::cout << (*room_iter)->getName();
-		++room_iter;
+		out << ((clueless::STUDY == room_index) ? "" : ", ")
+			<< _roomsByType[room_index]->getName();
 	}
 
-	while( _rooms.end() != room_iter )
-	{
-		std::cout << ", " << (*room_iter)->getName();
-		++room_iter;
-
-	} //end while (more rooms)
-
-	std::cout << "\n";
+	out << "\n";
 
 } //end routine listRooms()
 
 
-////////////////////////////////////////////////////////////////////////////////
-/// \brief Returns person token of type specified.
-/// \param PersonType: person type
-/// \return PersonPiece: corresponding person token
-/// \throw None
-/// \note  None
-////////////////////////////////////////////////////////////////////////////////
-PersonPiece*
-Board::fetchPersonToken(
-	clueless::PersonType person) //i - person type
-const
-{
-	PersonPiece* token( nullptr );
-
-	std::map<clueless::PersonType, PersonPiece*>::const_iterator token_iter(
-		_personTokens.find(person) );
-
-	if( _personTokens.end() != token_iter ) //found token
-	{
-		token = token_iter->second;
-	}
-
-	return token;
-
-} //end routine fetchPersonToken()
-
-
-////////////////////////////////////////////////////////////////////////////////
-/// \brief Returns weapon token of type specified.
-/// \param WeaponType: weapon type
-/// \return WeaponPiece: corresponding weapon token
-/// \throw None
-/// \note  None
-////////////////////////////////////////////////////////////////////////////////
-WeaponPiece*
-Board::fetchWeaponToken(
-	clueless::WeaponType wpn) //i - weapon type
-const
-{
-	WeaponPiece* token( nullptr );
-
-	std::map<clueless::WeaponType, WeaponPiece*>::const_iterator token_iter(
-		_weaponTokens.find(wpn) );
-
-	if( _weaponTokens.end() != token_iter ) //found token
-	{
-		token = token_iter->second;
-	}
-
-	return token;
-
-} //end routine fetchWeaponToken()
-
-
-////////////////////////////////////////////////////////////////////////////////
-/// \brief Returns room of type specified.
-/// \param None
-/// \return None
-/// \throw None
-/// \note  None
-////////////////////////////////////////////////////////////////////////////////
-Room*
-Board::fetchRoom(
-	clueless::RoomType type) //i - room type
-const
-{
-	switch( type )
-	{
-	case clueless::STUDY:
-		return _study;
-
-	case clueless::HALL:
-		return _hall;
-
-	case clueless::LOUNGE:
-		return _lounge;
-
-	case clueless::LIBRARY:
-		return _library;
-
-	case clueless::BILLIARD_ROOM:
-		return _billiardRoom;
-
-	case clueless::DINING_ROOM:
-		return _diningRoom;
-
-	case clueless::CONSERVATORY:
-		return _conservatory;
-
-	case clueless::BALLROOM:
-		return _ballroom;
-
-	case clueless::KITCHEN:
-		return _kitchen;
-
-	default:
-		;
-		
-	} //end switch (on room type)
-
-	return nullptr;
-
-} //end routine fetchRoom()
-
-
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Determines distance from location to room with next location on
 ///  shortest path.
@@ -281,23 +144,52 @@ Board::getDistanceToRoom(
 	size_t& distance)
 const
 {
-	Location* next_location_on_path( nullptr );
+	return fetchDistanceToRoom(curr_location, destination->_type, distance);
+
+} //end routine getDistanceToRoom()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Determines distance from location to room with next location on
+///  shortest path.
+/// \param Location: starting point
+/// \param RoomType: destination room
+/// \param size_t: distance from location to room (in number of moves)
+/// \return Location: next location on shortest path; nullptr when already in
+///  destination or no path
+/// \throw None
+/// \note
+/// - Distance is UINT_MAX when no path.
+////////////////////////////////////////////////////////////////////////////////
+Location*
+Board::fetchDistanceToRoom(
+	const Location* start_loc, //i - starting point
+	clueless::RoomType destination, //i - destination
+	size_t& distance) // o- distance (number of moves)
+const
+{
+	distance = UINT_MAX;
 
-	std::pair<const Location*, const Room*> location_room;
-	location_room = std::make_pair(curr_location, destination);
+	if( ! start_loc ||
+		(clueless::UNKNOWN_ROOM == destination) )
+	{
+		return nullptr;
+	}
 
-	std::map<std::pair<const Location*, const Room*>, std::pair<size_t, Location*>>::const_iterator
-		chart_iter( _roomDistanceChart.find(location_room) );
+	size_t start_id( start_loc->getId() );
+	size_t dest_id( BoardLayout::determineRoomId(destination) );
 
-	if( _roomDistanceChart.end() != chart_iter )
+	unsigned char path_distance( _layout->getDistance(start_id, dest_id) );
+	if( BoardLayout::NO_PATH != path_distance )
 	{
-		distance = chart_iter->second.first;
-		next_location_on_path = chart_iter->second.second;
+		distance = path_distance;
 	}
 
-	return next_location_on_path;
+	unsigned char next_id( _layout->getNextStep(start_id, dest_id) );
 
-} //end routine getDistanceToRoom()
+	return( (BoardLayout::NO_PATH == next_id) ? nullptr : _locationsById[next_id] );
+
+} //end routine fetchDistanceToRoom()
 
 
 //------------------------------------------------------------------------------
@@ -325,17 +217,11 @@ const
 
 	//} //end while (more rooms)
 
-	/// \note prefer specific order to mimic board schematic
-	report
-		<< _study->report().str() << "\n"
-		<< _hall->report().str() << "\n"
-		<< _lounge->report().str() << "\n"
-		<< _library->report().str() << "\n"
-		<< _billiardRoom->report().str() << "\n"
-		<< _diningRoom->report().str() << "\n"
-		<< _conservatory->report().str() << "\n"
-		<< _ballroom->report().str() << "\n"
-		<< _kitchen->report().str() << "\n";
+	/// \note prefer room type order to mimic board schematic
+	for(size_t room_index(clueless::STUDY); room_index <= clueless::KITCHEN; ++room_index)
+	{
+		report << _roomsByType[room_index]->report().str() << "\n";
+	}
 
 	return report;
 
@@ -343,7 +229,7 @@ const
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Creates all rooms for board with default types.
+/// \brief Creates all rooms for board, with secret passages per layout.
 /// \param None
 /// \return None
 /// \throw None
@@ -352,53 +238,37 @@ const
 void
 Board::createRooms()
 {
-	using clueless::RoomType;
-
-	_study = new Room( RoomType::STUDY );
-	_rooms.insert( _study );
-
-	_hall = new Room( RoomType::HALL );
-	_rooms.insert( _hall );
-
-	_lounge = new Room( RoomType::LOUNGE );
-	_rooms.insert( _lounge );
-
-	_library = new Room( RoomType::LIBRARY );
-	_rooms.insert( _library );
-
-	_billiardRoom = new Room( RoomType::BILLIARD_ROOM );
-	_rooms.insert( _billiardRoom );
-
-	_diningRoom = new Room( RoomType::DINING_ROOM );
-	_rooms.insert( _diningRoom );
-
-	_conservatory = new Room( RoomType::CONSERVATORY );
-	_rooms.insert( _conservatory );
+	for(size_t room_index(clueless::STUDY); room_index <= clueless::KITCHEN; ++room_index)
+	{
+		clueless::RoomType type( (clueless::RoomType)room_index );
 
-	_ballroom = new Room( RoomType::BALLROOM );
-	_rooms.insert( _ballroom );
+		Room* room( new Room(type) );
+		room->expectHallways( _layout->countHallwaysAdjacentTo(type) );
 
-	_kitchen = new Room( RoomType::KITCHEN );
-	_rooms.insert( _kitchen );
+		_locationsById[room->getId()] = room;
+		_roomsByType[type] = room;
 
-	//provide secret passage access between opposite corners (both directions)
-	//study-kitchen
-	_study->createSecretPassageTo( _kitchen );
-	_kitchen->createSecretPassageTo( _study );
+	} //end for (each room type)
 
-	populateDistanceChart_studyKitchen();
+	//provide secret passage access (both directions, listed once per room)
+	for(size_t room_index(clueless::STUDY); room_index <= clueless::KITCHEN; ++room_index)
+	{
+		clueless::RoomType destination(
+			_layout->getSecretPassageDestination((clueless::RoomType)room_index) );
 
-	//lounge-conservatory
-	_lounge->createSecretPassageTo( _conservatory );
-	_conservatory->createSecretPassageTo( _lounge );
+		if( clueless::UNKNOWN_ROOM != destination )
+		{
+			_roomsByType[room_index]->createSecretPassageTo( fetchRoom(destination) );
+		}
 
-	populateDistanceChart_loungeConservatory();
+	} //end for (each room)
 
 } //end routine createRooms()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Creates hallways, building connections between rooms.
+/// \brief Creates hallways and person homes per layout, building connections
+///  between rooms.
 /// \param None
 /// \return None
 /// \throw None
@@ -408,95 +278,78 @@ Board::createRooms()
 void
 Board::createConnectingHallways()
 {
-	using clueless::PersonType;
-	std::pair<const Location*, const Room*> location_room;
-	std::pair<size_t, Location*> distance_nextLocation;
-
-	// 1: study-hall
-	Hallway* hallway = new Hallway(_study, _hall);
-	_hallways.insert( hallway );
-
-	populateDistanceChart_hallwayStudyHall( hallway );
-
-	// 2: hall-lounge + Miss Scarlet starting place
-	hallway = new Hallway(_hall, _lounge);
-	_hallways.insert( hallway );
-
-	_personHomes.insert( new HomeLocation(_missScarlet, hallway) );
-
-	populateDistanceChart_hallwayHallLounge( hallway );
-
-	// 3: study-library
-	hallway = new Hallway(_study, _library);
-	_hallways.insert( hallway );
-
-	_personHomes.insert( new HomeLocation(_professorPlum, hallway) );
-
-	populateDistanceChart_hallwayStudyLibrary( hallway );
-
-	// 4: hall-billiard room
-	hallway = new Hallway(_hall, _billiardRoom);
-	_hallways.insert( hallway );
+	const std::vector<BoardLayout::HallwaySpec>& hallway_specs( _layout->getHallways() );
+	std::vector<Hallway*> hallways( hallway_specs.size() );
 
-	populateDistanceChart_hallwayHallBilliardRoom( hallway );
-
-	// 5: lounge-dining room
-	hallway = new Hallway(_lounge, _diningRoom);
-	_hallways.insert( hallway );
-
-	_personHomes.insert( new HomeLocation(_colonelMustard, hallway) );
-
-	populateDistanceChart_hallwayLoungeDiningRoom( hallway );
-
-	// 6: library-billiard room
-	hallway = new Hallway(_library, _billiardRoom);
-	_hallways.insert( hallway );
-
-	populateDistanceChart_hallwayLibraryBilliardRoom( hallway );
-
-	// 7: billiard room-dining room
-	hallway = new Hallway(_billiardRoom, _diningRoom);
-	_hallways.insert( hallway );
+	for(size_t hallway_index(0); hallway_index < hallway_specs.size(); ++hallway_index)
+	{
+		const BoardLayout::HallwaySpec& spec( hallway_specs[hallway_index] );
 
-	populateDistanceChart_hallwayBilliardRoomDiningRoom( hallway );
+		hallways[hallway_index] = new Hallway(
+			fetchRoom(spec._room1),
+			fetchRoom(spec._room2),
+			spec._id);
+		_locationsById[spec._id] = hallways[hallway_index];
 
-	// 8: library-conservatory
-	hallway = new Hallway(_library, _conservatory);
-	_hallways.insert( hallway );
+	} //end for (each hallway)
 
-	_personHomes.insert( new HomeLocation(_mrsPeacock, hallway) );
+	const std::vector<BoardLayout::HomeSpec>& home_specs( _layout->getHomes() );
+	for(size_t home_index(0); home_index < home_specs.size(); ++home_index)
+	{
+		const BoardLayout::HomeSpec& spec( home_specs[home_index] );
 
-	populateDistanceChart_hallwayLibraryConservatory( hallway );
+		_locationsById[spec._id] =
+			new HomeLocation(
+				fetchPersonToken(spec._character),
+				hallways[spec._hallwayIndex],
+				spec._id);
 
-	// 9: billiard room-ballroom
-	hallway = new Hallway(_billiardRoom, _ballroom);
-	_hallways.insert( hallway );
+	} //end for (each person home)
 
-	populateDistanceChart_hallwayBilliardRoomBallroom( hallway );
+} //end routine createConnectingHallways()
 
-	//10: dining room-kitchen
-	hallway = new Hallway(_diningRoom, _kitchen);
-	_hallways.insert( hallway );
 
-	populateDistanceChart_hallwayDiningRoomKitchen( hallway );
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Connects every location to its exits per layout.
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - Assumes all locations created.
+/// - Exits of each location are contiguous within one table and in
+///   identifier order, mirroring BoardLayout::getConnections().
+////////////////////////////////////////////////////////////////////////////////
+void
+Board::connectLocations()
+{
+	size_t num_locations( _locationsById.size() );
 
-	//11: conservatory-ballroom
-	hallway = new Hallway(_conservatory, _ballroom);
-	_hallways.insert( hallway );
+	size_t num_exits( 0 );
+	for(size_t loc_id(0); loc_id < num_locations; ++loc_id)
+	{
+		num_exits += _layout->getNumConnections( loc_id );
+	}
 
-	_personHomes.insert( new HomeLocation(_mrGreen, hallway) );
+	//sized once, so locations may point into table
+	_exits.assign( num_exits, nullptr );
 
-	populateDistanceChart_hallwayConservatoryBallroom( hallway );
+	size_t first_exit( 0 );
+	for(size_t loc_id(0); loc_id < num_locations; ++loc_id)
+	{
+		size_t num_connections( _layout->getNumConnections(loc_id) );
+		const unsigned char* connections( _layout->getConnections(loc_id) );
 
-	//12: ballroom-kitchen
-	hallway = new Hallway(_ballroom, _kitchen);
-	_hallways.insert( hallway );
+		for(size_t conn_index(0); conn_index < num_connections; ++conn_index)
+		{
+			_exits[first_exit + conn_index] = _locationsById[connections[conn_index]];
+		}
 
-	_personHomes.insert( new HomeLocation(_mrsWhite, hallway) );
+		_locationsById[loc_id]->setExits( _exits.data() + first_exit, num_connections );
+		first_exit += num_connections;
 
-	populateDistanceChart_hallwayBallroomKitchen( hallway );
+	} //end for (each location)
 
-} //end routine createConnectingHallways()
+} //end routine connectLocations()
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -509,25 +362,10 @@ Board::createConnectingHallways()
 void
 Board::createPersonTokens()
 {
-	using clueless::PersonType;
-
-	_missScarlet = new PersonPiece( PersonType::MISS_SCARLET );
-	_personTokens[PersonType::MISS_SCARLET] = _missScarlet;
-
-	_colonelMustard = new PersonPiece( PersonType::COLONEL_MUSTARD );
-	_personTokens[PersonType::COLONEL_MUSTARD] = _colonelMustard;
-
-	_mrsWhite = new PersonPiece( PersonType::MRS_WHITE );
-	_personTokens[PersonType::MRS_WHITE] = _mrsWhite;
-
-	_mrGreen = new PersonPiece( PersonType::MR_GREEN );
-	_personTokens[PersonType::MR_GREEN] = _mrGreen;
-
-	_mrsPeacock = new PersonPiece( PersonType::MRS_PEACOCK );
-	_personTokens[PersonType::MRS_PEACOCK] = _mrsPeacock;
-
-	_professorPlum = new PersonPiece( PersonType::PROFESSOR_PLUM );
-	_personTokens[PersonType::PROFESSOR_PLUM] = _professorPlum;
+	for(size_t person(clueless::MISS_SCARLET); person <= clueless::PROFESSOR_PLUM; ++person)
+	{
+		_personTokens[person] = new PersonPiece( (clueless::PersonType)person );
+	}
 
 } //end routine createPersonTokens()
 
@@ -542,25 +380,10 @@ Board::createPersonTokens()
 void
 Board::createWeaponTokens()
 {
-	using clueless::WeaponType;
-
-	_leadPipe = new WeaponPiece( WeaponType::LEAD_PIPE );
-	_weaponTokens[WeaponType::LEAD_PIPE] = _leadPipe;
-
-	_knife = new WeaponPiece( WeaponType::KNIFE );
-	_weaponTokens[WeaponType::KNIFE] = _knife;
-
-	_rope = new WeaponPiece( WeaponType::ROPE );
-	_weaponTokens[WeaponType::ROPE] = _rope;
-
-	_candlestick = new WeaponPiece( WeaponType::CANDLESTICK );
-	_weaponTokens[WeaponType::CANDLESTICK] = _candlestick;
-
-	_revolver = new WeaponPiece( WeaponType::REVOLVER );
-	_weaponTokens[WeaponType::REVOLVER] = _revolver;
-
-	_wrench = new WeaponPiece( WeaponType::WRENCH );
-	_weaponTokens[WeaponType::WRENCH] = _wrench;
+	for(size_t wpn(clueless::CANDLESTICK); wpn <= clueless::WRENCH; ++wpn)
+	{
+		_weaponTokens[wpn] = new WeaponPiece( (clueless::WeaponType)wpn );
+	}
 
 } //end routine createWeaponTokens()
 
@@ -569,85 +392,97 @@ Board::createWeaponTokens()
 /// \brief Distributes each weapon token to a unique room.
 /// \param None
 /// \return None
-/// \throw None
-/// \note  None
+/// \throw
+/// - INSUFFICIENT_DATA when more weapons than rooms
+/// \note
+/// - Weapons placed in type order, each drawn uniformly amongst rooms still
+///   empty (in identifier order).
 ////////////////////////////////////////////////////////////////////////////////
 void
 Board::randomlyDistributeWeapons()
 {
-	//local copy of rooms so can remove as place weapons
-	std::set<Location*> rooms = _rooms;
-	std::set<Location*>::iterator room_iter( rooms.begin() );
-	Location* chosen_room( nullptr );
-	
-	std::map<clueless::WeaponType, WeaponPiece*>::iterator wpn_iter( _weaponTokens.begin() );
-	WeaponPiece* wpn_token( nullptr );
-	while( _weaponTokens.end() != wpn_iter )
+	//rooms not yet holding a weapon, in identifier order
+	Room* rooms[clueless::KITCHEN];
+	size_t num_rooms( 0 );
+
+	for(size_t room_index(clueless::STUDY); room_index <= clueless::KITCHEN; ++room_index)
+	{
+		rooms[num_rooms++] = _roomsByType[room_index];
+	}
+
+	for(size_t wpn(clueless::CANDLESTICK); wpn <= clueless::WRENCH; ++wpn)
 	{
-		chosen_room = chooseLocation(&rooms);
-		wpn_token = wpn_iter->second;
+		if( 0 == num_rooms ) //no rooms from which to choose
+		{
+			std::ostringstream msg;
+			msg << "Board::randomlyDistributeWeapons()\n"
+				<< "  INSUFFICIENT_DATA\n"
+				<< "  no rooms from which to choose";
+			throw std::logic_error( msg.str() );
+		}
+
+		//create position based on floor of random draw in [0, num rooms)
+		size_t zero_based_pos( 0 );
+		if( 1 < num_rooms )
+		{
+			zero_based_pos = size_t(std::floor( _rng->drawReal2(0, (double)num_rooms) ));
+		}
+
+		Room* chosen_room( rooms[zero_based_pos] );
+		WeaponPiece* wpn_token( _weaponTokens[wpn] );
 
 		//update room occupants and game piece location
 		chosen_room->addOccupant( wpn_token );
 		wpn_token->_location = chosen_room;
 
-		//remove room from list of options (so unique per weapon)
-		room_iter = rooms.find( chosen_room );
-		rooms.erase( room_iter );
-		
-		++wpn_iter; //next weapon
-	}
+		//remove room from options (so unique per weapon)
+		for(size_t pos_index(zero_based_pos); pos_index + 1 < num_rooms; ++pos_index)
+		{
+			rooms[pos_index] = rooms[pos_index + 1];
+		}
+		--num_rooms;
+
+	} //end for (each weapon)
 
 } //end routine randomlyDistributeWeapons()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Chooses room from specified container with uniform random draw.
-/// \param set<Room>: collection of rooms
-/// \return Room: choosen room
+/// \brief Chooses move destination with uniform random draw.
+/// \param MoveOptionSet: move options
+/// \return Location: chosen destination
 /// \throw
-/// - INSUFFICIENT_DATA when empty collection of rooms
-/// \note  None
+/// - INSUFFICIENT_DATA when no move options
+/// \note
+/// - Same draw as for a set holding the same locations.
 ////////////////////////////////////////////////////////////////////////////////
 Location* const
 Board::chooseLocation(
-	std::set<Location*>* rooms) //i - rooms to choose amongst
+	MoveOptionSet* move_options) //i - move options to choose amongst
 const
 {
-	Location* choice( nullptr );
+	size_t num_options( move_options->getNumOptions() );
 
-	if( rooms->empty() ) //no rooms from which to choose
+	if( 0 == num_options ) //no options from which to choose
 	{
 		std::ostringstream msg;
-		msg << "Board::chooseRoom()\n"
+		msg << "Board::chooseLocation()\n"
 			<< "  INSUFFICIENT_DATA\n"
-			<< "  no rooms from which to choose";
+			<< "  no move options from which to choose";
 		throw std::logic_error( msg.str() );
 	}
-	else if( 1 == rooms->size() )
+	else if( 1 == num_options )
 	{
 		//only one choice
-		choice = *(rooms->begin());
+		return move_options->getOption( 0 );
 	}
-	else //more than one room
-	{
-		//create position based on floor of random draw in [0, num cards)
-		size_t zero_based_pos( size_t(std::floor( MersenneTwister::drawReal2(0, (double)(rooms->size())) )) );
 
-		std::set<Location*>::const_iterator room_iter( rooms->begin() );
-		for(size_t pos_index(0);
-			pos_index < zero_based_pos;
-			++pos_index)
-		{
-			++room_iter;
-		}
+	//create position based on floor of random draw in [0, num options)
+	size_t zero_based_pos( size_t(std::floor( _rng->drawReal2(0, (double)num_options) )) );
 
-		choice = *room_iter;
-	}
+	return move_options->getOption( zero_based_pos );
 
-	return choice;
-
-} //end routine chooseRoom()
+} //end routine chooseLocation()
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -686,16 +521,16 @@ Board::recognizePlayerCharacterAssignments(
 ////////////////////////////////////////////////////////////////////////////////
 void
 Board::buildRoomRelationshipsWithCards(
-	const std::set<Card*> cards) //i - room cards
+	const std::set<const Card*, CardOrder> cards) //i - room cards
 {
-	std::set<Card*>::const_iterator card_iter( cards.begin() );
-	RoomCard* room_card( nullptr );
+	std::set<const Card*, CardOrder>::const_iterator card_iter( cards.begin() );
+	const RoomCard* room_card( nullptr );
 	Room* room( nullptr );
 
 	while( cards.end() != card_iter )
 	{
 		//hold card as room card
-		room_card = (RoomCard*)(*card_iter);
+		room_card = (const RoomCard*)(*card_iter);
 
 		//find room for card's room type
 		room = fetchRoom( room_card->_room );
@@ -721,7 +556,7 @@ Board::buildRoomRelationshipsWithCards(
 /// - INSUFFICIENT_DATA when starting point object dne
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
-//std::set<Location*>
+//std::set<Location*, LocationOrder>
 //Board::getMoveOptionsFrom(
 //	const Location* const startingPoint) //i - starting location
 //const
@@ -755,6 +590,8 @@ Board::movePlayerTo(
 	Player* const player,
 	Location* const destination)
 {
+	CLUELESS_TIME_SCOPE( MOVE_PLAYER );
+
 	if( ! player )
 	{
 		std::ostringstream msg;
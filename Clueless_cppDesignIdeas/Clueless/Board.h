@@ -13,25 +13,32 @@
 /// - The Board owns all of the Location objects (Rooms, Hallways, Starting spots
 ///   for person tokens).  Therefore, it is responsible for Location object
 ///   deletion.
+/// - Locations are held in one table indexed by layout identifier, with each
+///   location's exits pointing into a table of connections grouped by location
+///   (as BoardLayout holds them).  Rooms and tokens are held in arrays indexed
+///   by type, so finding a room or token is a lookup.
 ///
 ////////////////////////////////////////////////////////////////////////////////
 
 #ifndef Board_h
 #define Board_h
 
+#include "BoardLayout.h"
 #include "Location.h"
 
 #include "CluelessEnums.h"	//for PersonType, WeaponType use
 
 #include <list>		//for std::list use
-#include <map>		//for std::map use
+#include <ostream>	//for std::ostream use
 #include <set>		//for std::set use
 #include <string>	//for std::string use
-#include <tuple>	//for std::pair use
+#include <vector>	//for std::vector use
 
 
 //forward declarations
+class MersenneTwister;
 struct Card;
+struct CardOrder;
 struct PersonPiece;
 struct WeaponPiece;
 class Player;
@@ -43,14 +50,24 @@ public:
 	//--------------------------------------------------------------------------
 	// Constructors / Destructor
 	//--------------------------------------------------------------------------
-	Board();
+	Board(MersenneTwister* randomNumberGenerator, const BoardLayout* layout);
 
 	virtual ~Board();
 
+private:
+	/// \brief Default constructor
+	/// \note private scope to force use of extended constructor
+	Board();
+
+public:
+
 	//--------------------------------------------------------------------------
 	// Accessors and Mutators
 	//--------------------------------------------------------------------------
-	void listRooms() const;
+	void listRooms(std::ostream& out) const;
+
+	const BoardLayout* getLayout() const;
+	const Location* getLocation(size_t locationId) const;
 
 	const Location* getDistanceToRoom(
 		const Location* currentLocation,
@@ -60,7 +77,7 @@ public:
 	Location* fetchDistanceToRoom(
 		const Location* startingPoint,
 		clueless::RoomType destination,
-		size_t& distance);
+		size_t& distance) const;
 
 
 	//--------------------------------------------------------------------------
@@ -69,9 +86,9 @@ public:
 	std::ostringstream report() const;
 
 	void recognizePlayerCharacterAssignments(std::list<Player*>* allPlayers);
-	void buildRoomRelationshipsWithCards(const std::set<Card*> roomCards);
+	void buildRoomRelationshipsWithCards(const std::set<const Card*, CardOrder> roomCards);
 
-	//std::set<Location*> getMoveOptionsFrom(const Location* const startingPoint) const;
+	//std::set<Location*, LocationOrder> getMoveOptionsFrom(const Location* const startingPoint) const;
 	bool movePlayerTo(Player* const player, Location* const destination);
 	bool movePersonTokenToRoom(clueless::PersonType character, clueless::RoomType);
 	bool moveWeaponTokenToRoom(clueless::WeaponType weapon, clueless::RoomType);
@@ -98,76 +115,92 @@ private:
 	void createWeaponTokens();
 
 public: /// \resolve Should scope be private? -- 07 Mar 2019, mem
-	Location* const chooseLocation(std::set<Location*>* rooms) const;
+	Location* const chooseLocation(MoveOptionSet* moveOptions) const;
 
 	//--------------------------------------------------------------------------
 	// Data Members
 	//--------------------------------------------------------------------------
 public:
-	std::set<Location*> _rooms;
-	std::set<Location*> _hallways;
-	std::set<Location*> _personHomes;
-
-	std::map<clueless::PersonType, PersonPiece*> _personTokens;
-	std::map<clueless::WeaponType, WeaponPiece*> _weaponTokens;
+	PersonPiece* _personTokens[clueless::PROFESSOR_PLUM + 1]; //by PersonType; unknown slot empty
+	WeaponPiece* _weaponTokens[clueless::WRENCH + 1];         //by WeaponType; unknown slot empty
 
 private:
-	/// \note for ease of access... use rooms collection for deletion
-	Room* _study;
-	Room* _hall;
-	Room* _lounge;
-	Room* _library;
-	Room* _billiardRoom;
-	Room* _diningRoom;
-	Room* _conservatory;
-	Room* _ballroom;
-	Room* _kitchen;
-
-	PersonPiece* _missScarlet;
-	PersonPiece* _colonelMustard;
-	PersonPiece* _mrsWhite;
-	PersonPiece* _mrGreen;
-	PersonPiece* _mrsPeacock;
-	PersonPiece* _professorPlum;
-
-	WeaponPiece* _leadPipe;
-	WeaponPiece* _knife;
-	WeaponPiece* _rope;
-	WeaponPiece* _candlestick;
-	WeaponPiece* _revolver;
-	WeaponPiece* _wrench;
-
-	//location to room distance chart with next location on shortest path
-	std::map<std::pair<const Location*, const Room*>, std::pair<size_t, Location*>> _roomDistanceChart;
-
-	void addDataToDistanceChart(
-		const Location* startingLocation,
-		const Room* destination,
-		size_t distanceInNumberOfMoves,
-		Location* nextStepShortestPath);
+	MersenneTwister* _rng; //random draws for owning game (not owned)
 
-	Location* fetchDistanceToRoom(
-		const Location* startingPoint,
-		const Room* destination,
-		size_t& distance);
-
-	void populateDistanceChart_studyKitchen();
-	void populateDistanceChart_loungeConservatory();
-
-	void populateDistanceChart_hallwayStudyHall(Hallway* hallway);
-	void populateDistanceChart_hallwayHallLounge(Hallway* hallway);
-	void populateDistanceChart_hallwayStudyLibrary(Hallway* hallway);
-	void populateDistanceChart_hallwayHallBilliardRoom(Hallway* hallway);
-	void populateDistanceChart_hallwayLoungeDiningRoom(Hallway* hallway);
-	void populateDistanceChart_hallwayLibraryBilliardRoom(Hallway* hallway);
-	void populateDistanceChart_hallwayBilliardRoomDiningRoom(Hallway* hallway);
-	void populateDistanceChart_hallwayLibraryConservatory(Hallway* hallway);
-	void populateDistanceChart_hallwayBilliardRoomBallroom(Hallway* hallway);
-	void populateDistanceChart_hallwayDiningRoomKitchen(Hallway* hallway);
-	void populateDistanceChart_hallwayConservatoryBallroom(Hallway* hallway);
-	void populateDistanceChart_hallwayBallroomKitchen(Hallway* hallway);
+	const BoardLayout* _layout; //connections and shortest paths (not owned)
+
+	std::vector<Location*> _locationsById; //every location (owned)
+	std::vector<Location*> _exits;         //connections, grouped by location
+
+	/// \note for ease of access... use location table for deletion
+	Room* _roomsByType[clueless::KITCHEN + 1]; //unknown slot empty
+
+	void connectLocations();
 
 }; //end class Board defn
 
 
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline const BoardLayout*
+Board::getLayout()
+const
+{
+	return _layout;
+
+} //end routine getLayout()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline const Location*
+Board::getLocation(
+	size_t loc_id) //i - location identifier
+const
+{
+	return _locationsById[loc_id];
+
+} //end routine getLocation()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns person token of type specified; nullptr if unknown person.
+////////////////////////////////////////////////////////////////////////////////
+inline PersonPiece*
+Board::fetchPersonToken(
+	clueless::PersonType person) //i - person type
+const
+{
+	return _personTokens[person];
+
+} //end routine fetchPersonToken()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns weapon token of type specified; nullptr if unknown weapon.
+////////////////////////////////////////////////////////////////////////////////
+inline WeaponPiece*
+Board::fetchWeaponToken(
+	clueless::WeaponType wpn) //i - weapon type
+const
+{
+	return _weaponTokens[wpn];
+
+} //end routine fetchWeaponToken()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns room of type specified; nullptr if unknown room.
+////////////////////////////////////////////////////////////////////////////////
+inline Room*
+Board::fetchRoom(
+	clueless::RoomType type) //i - room type
+const
+{
+	return _roomsByType[type];
+
+} //end routine fetchRoom()
+
+
 #endif //Board_h
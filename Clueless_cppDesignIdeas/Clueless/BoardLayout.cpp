@@ -0,0 +1,560 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file BoardLayout.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  1440
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "BoardLayout.h"
+
+#include <algorithm>		//for std::sort use
+#include <cctype>			//for std::tolower use
+#include <sstream>			//for std::istringstream, std::ostringstream use
+#include <stdexcept>		//for std::logic_error use
+
+//------------------------------------------------------------------------------
+// File-Scoped Constants
+//------------------------------------------------------------------------------
+/// \brief Classic Clue-Less board: 3x3 rooms, 12 hallways, corner passages.
+/// \note order reproduces location identifiers of original hard-coded board
+static const char* const CLASSIC_DESCRIPTION =
+	"# classic Clue-Less board\n"
+	"hallway study hall\n"
+	"hallway hall lounge\n"
+	"home miss_scarlet\n"
+	"hallway study library\n"
+	"home professor_plum\n"
+	"hallway hall billiard_room\n"
+	"hallway lounge dining_room\n"
+	"home colonel_mustard\n"
+	"hallway library billiard_room\n"
+	"hallway billiard_room dining_room\n"
+	"hallway library conservatory\n"
+	"home mrs_peacock\n"
+	"hallway billiard_room ballroom\n"
+	"hallway dining_room kitchen\n"
+	"hallway conservatory ballroom\n"
+	"home mr_green\n"
+	"hallway ballroom kitchen\n"
+	"home mrs_white\n"
+	"passage study kitchen\n"
+	"passage lounge conservatory\n";
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Converts display text to layout name (e.g. "Mrs. White" to
+///  "mrs_white").
+/// \param string: display text
+/// \return string: layout name
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static std::string
+convertToLayoutName(
+	const std::string& text) //i - display text
+{
+	std::string name;
+
+	for(size_t char_index(0); char_index < text.size(); ++char_index)
+	{
+		char curr_char( text[char_index] );
+
+		if( ' ' == curr_char )
+		{
+			name += '_';
+		}
+		else if( '.' != curr_char )
+		{
+			name += (char)std::tolower( (unsigned char)curr_char );
+		}
+	}
+
+	return name;
+
+} //end routine convertToLayoutName()
+
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param istream: layout description
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when description malformed, or gives room more than
+///   MAX_NUM_EXITS exits.
+/// - INSUFFICIENT_DATA when room has no hallway or character has no home.
+/// \note
+/// - Parses description, then computes shortest paths between every pair of
+///   locations.
+////////////////////////////////////////////////////////////////////////////////
+BoardLayout::BoardLayout(
+	std::istream& description) //i - layout description
+	: _numLocations( clueless::getNumRoomTypes() )
+{
+	for(size_t room_index(0); room_index <= clueless::KITCHEN; ++room_index)
+	{
+		_secretPassages[room_index] = clueless::UNKNOWN_ROOM;
+	}
+
+	parse( description );
+	validate();
+
+	computeShortestPaths();
+
+} //end routine extended constructor
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns classic board layout.
+/// \param None
+/// \return BoardLayout: classic layout
+/// \throw None
+/// \note
+/// - Parsed on first use; initialization of function-local static is
+///   thread-safe.
+////////////////////////////////////////////////////////////////////////////////
+const BoardLayout*
+BoardLayout::classic()
+{
+	static std::istringstream description( CLASSIC_DESCRIPTION );
+	static const BoardLayout CLASSIC( description );
+
+	return &CLASSIC;
+
+} //end routine classic()
+
+
+//------------------------------------------------------------------------------
+// Accessors and Mutators
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns number of hallways adjacent to room.
+/// \param RoomType: room of interest
+/// \return size_t: number of adjacent hallways
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+size_t
+BoardLayout::countHallwaysAdjacentTo(
+	clueless::RoomType room) //i - room of interest
+const
+{
+	size_t num_hallways( 0 );
+
+	for(size_t hallway_index(0); hallway_index < _hallways.size(); ++hallway_index)
+	{
+		if( (room == _hallways[hallway_index]._room1) ||
+			(room == _hallways[hallway_index]._room2) )
+		{
+			++num_hallways;
+		}
+	}
+
+	return num_hallways;
+
+} //end routine countHallwaysAdjacentTo()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns number of exits from room: adjacent hallways and secret
+///  passage.
+/// \param RoomType: room of interest
+/// \return size_t: number of exits
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+size_t
+BoardLayout::countExits(
+	clueless::RoomType room) //i - room of interest
+const
+{
+	return( countHallwaysAdjacentTo(room) +
+		((clueless::UNKNOWN_ROOM != _secretPassages[room]) ? 1 : 0) );
+
+} //end routine countExits()
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Reads hallways, homes, and secret passages from description.
+/// \param istream: layout description
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when line malformed, home precedes every hallway,
+///   character has more than one home, room has more than one secret
+///   passage, room has more than MAX_NUM_EXITS exits, or too many
+///   locations.
+/// \note
+/// - Exits are counted as each hallway or passage is read, so the error
+///   names the line adding one exit too many.
+////////////////////////////////////////////////////////////////////////////////
+void
+BoardLayout::parse(
+	std::istream& description) //i - layout description
+{
+	std::string line;
+	size_t line_number( 0 );
+
+	while( std::getline(description, line) )
+	{
+		++line_number;
+
+		//ignore comment
+		size_t comment_pos( line.find('#') );
+		if( std::string::npos != comment_pos )
+		{
+			line.erase( comment_pos );
+		}
+
+		std::istringstream fields( line );
+		std::string keyword;
+		if( ! (fields >> keyword) )
+		{
+			continue; //blank line
+		}
+
+		std::string arg1;
+		std::string arg2;
+		std::string extra;
+		fields >> arg1 >> arg2 >> extra;
+
+		std::ostringstream problem;
+		clueless::RoomType exit_rooms[2] = { clueless::UNKNOWN_ROOM, clueless::UNKNOWN_ROOM }; //rooms gaining exit
+
+		if( "hallway" == keyword )
+		{
+			HallwaySpec hallway;
+			hallway._room1 = parseRoom( arg1, line_number );
+			hallway._room2 = parseRoom( arg2, line_number );
+			hallway._id = (unsigned int)_numLocations++;
+
+			if( hallway._room1 == hallway._room2 )
+			{
+				problem << "hallway must connect two different rooms";
+			}
+
+			_hallways.push_back( hallway );
+
+			exit_rooms[0] = hallway._room1;
+			exit_rooms[1] = hallway._room2;
+		}
+		else if( "home" == keyword )
+		{
+			HomeSpec home;
+			home._character = parseCharacter( arg1, line_number );
+			home._hallwayIndex = _hallways.size() - 1;
+			home._id = (unsigned int)_numLocations++;
+
+			if( _hallways.empty() )
+			{
+				problem << "home must follow hallway it enters";
+			}
+			else if( ! arg2.empty() )
+			{
+				problem << "unexpected \'" << arg2 << "\'";
+			}
+
+			for(size_t home_index(0); home_index < _homes.size(); ++home_index)
+			{
+				if( home._character == _homes[home_index]._character )
+				{
+					problem << arg1 << " already has home";
+				}
+			}
+
+			_homes.push_back( home );
+		}
+		else if( "passage" == keyword )
+		{
+			clueless::RoomType room1( parseRoom(arg1, line_number) );
+			clueless::RoomType room2( parseRoom(arg2, line_number) );
+
+			if( room1 == room2 )
+			{
+				problem << "secret passage must connect two different rooms";
+			}
+			else if(
+				(clueless::UNKNOWN_ROOM != _secretPassages[room1]) ||
+				(clueless::UNKNOWN_ROOM != _secretPassages[room2]) )
+			{
+				problem << "room already has secret passage";
+			}
+
+			_secretPassages[room1] = room2;
+			_secretPassages[room2] = room1;
+
+			exit_rooms[0] = room1;
+			exit_rooms[1] = room2;
+		}
+		else
+		{
+			problem << "unknown keyword \'" << keyword << "\'";
+		}
+
+		if( ! extra.empty() )
+		{
+			problem << "unexpected \'" << extra << "\'";
+		}
+		else if( MAX_NUM_LOCATIONS < _numLocations )
+		{
+			problem << "more than " << MAX_NUM_LOCATIONS << " locations";
+		}
+
+		for(size_t room_pos(0); problem.str().empty() && (room_pos < 2); ++room_pos)
+		{
+			if( (clueless::UNKNOWN_ROOM != exit_rooms[room_pos]) &&
+				(MAX_NUM_EXITS < countExits(exit_rooms[room_pos])) )
+			{
+				problem << clueless::translateRoomTypeToText(exit_rooms[room_pos])
+					<< " has more than " << MAX_NUM_EXITS << " exits (hallways and secret passage)";
+			}
+		}
+
+		if( ! problem.str().empty() )
+		{
+			std::ostringstream msg;
+			msg << "BoardLayout::parse()\n"
+				<< "  INCONSISTENT_DATA\n"
+				<< "  line " << line_number << ": " << problem.str();
+			throw std::logic_error( msg.str() );
+		}
+
+	} //end while (more lines)
+
+} //end routine parse()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Confirms every room can be entered and left, and every character
+///  has a home.
+/// \param None
+/// \return None
+/// \throw
+/// - INSUFFICIENT_DATA when room has no hallway or character has no home.
+/// \note
+/// - Exits per room already bounded while parsing (see parse()).
+////////////////////////////////////////////////////////////////////////////////
+void
+BoardLayout::validate()
+const
+{
+	for(size_t room_index(clueless::STUDY); room_index <= clueless::KITCHEN; ++room_index)
+	{
+		clueless::RoomType room( (clueless::RoomType)room_index );
+
+		if( 0 == countHallwaysAdjacentTo(room) )
+		{
+			std::ostringstream msg;
+			msg << "BoardLayout::validate()\n"
+				<< "  INSUFFICIENT_DATA\n"
+				<< "  " << clueless::translateRoomTypeToText(room) << " has no hallway";
+			throw std::logic_error( msg.str() );
+		}
+	}
+
+	for(size_t person_index(clueless::MISS_SCARLET); person_index <= clueless::PROFESSOR_PLUM; ++person_index)
+	{
+		clueless::PersonType character( (clueless::PersonType)person_index );
+
+		bool has_home( false );
+		for(size_t home_index(0); home_index < _homes.size(); ++home_index)
+		{
+			has_home |= (character == _homes[home_index]._character);
+		}
+
+		if( ! has_home )
+		{
+			std::ostringstream msg;
+			msg << "BoardLayout::validate()\n"
+				<< "  INSUFFICIENT_DATA\n"
+				<< "  " << clueless::translatePersonTypeToText(character) << " has no home";
+			throw std::logic_error( msg.str() );
+		}
+	}
+
+} //end routine validate()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Computes distance and first step of shortest path between every
+///  pair of locations.
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - Breadth-first search from every location.  Connections match those of
+///   board locations: room to adjacent hallways and secret passage, hallway
+///   to its rooms, home to its hallway.
+/// - Connections visited in identifier order, so ties between equally short
+///   paths always resolve the same way.
+/// - Connections kept (see getConnections()) for search over game states
+///   without board objects.
+////////////////////////////////////////////////////////////////////////////////
+void
+BoardLayout::computeShortestPaths()
+{
+	//gather connections of every location
+	std::vector<std::vector<unsigned char>> connections( _numLocations );
+
+	for(size_t hallway_index(0); hallway_index < _hallways.size(); ++hallway_index)
+	{
+		const HallwaySpec& hallway( _hallways[hallway_index] );
+		unsigned int room1_id( determineRoomId(hallway._room1) );
+		unsigned int room2_id( determineRoomId(hallway._room2) );
+
+		connections[hallway._id].push_back( (unsigned char)room1_id );
+		connections[hallway._id].push_back( (unsigned char)room2_id );
+		connections[room1_id].push_back( (unsigned char)hallway._id );
+		connections[room2_id].push_back( (unsigned char)hallway._id );
+	}
+
+	for(size_t home_index(0); home_index < _homes.size(); ++home_index)
+	{
+		const HomeSpec& home( _homes[home_index] );
+		connections[home._id].push_back( (unsigned char)_hallways[home._hallwayIndex]._id );
+	}
+
+	for(size_t room_index(clueless::STUDY); room_index <= clueless::KITCHEN; ++room_index)
+	{
+		if( clueless::UNKNOWN_ROOM != _secretPassages[room_index] )
+		{
+			connections[determineRoomId((clueless::RoomType)room_index)].push_back(
+				(unsigned char)determineRoomId(_secretPassages[room_index]) );
+		}
+	}
+
+	//keep flattened, in identifier order per location
+	_firstConnection.assign( _numLocations + 1, 0 );
+	_connections.clear();
+
+	for(size_t loc_id(0); loc_id < _numLocations; ++loc_id)
+	{
+		std::sort( connections[loc_id].begin(), connections[loc_id].end() );
+
+		_firstConnection[loc_id] = _connections.size();
+		_connections.insert( _connections.end(), connections[loc_id].begin(), connections[loc_id].end() );
+	}
+	_firstConnection[_numLocations] = _connections.size();
+
+	_distance.assign( _numLocations * _numLocations, (unsigned char)NO_PATH );
+	_nextStep.assign( _numLocations * _numLocations, (unsigned char)NO_PATH );
+
+	std::vector<unsigned char> queue( _numLocations );
+
+	//breadth-first search from each location
+	for(size_t start_id(0); start_id < _numLocations; ++start_id)
+	{
+		unsigned char* distance( &_distance[start_id * _numLocations] );
+		unsigned char* next_step( &_nextStep[start_id * _numLocations] );
+
+		distance[start_id] = 0;
+
+		size_t queue_head( 0 );
+		size_t queue_tail( 0 );
+		queue[queue_tail++] = (unsigned char)start_id;
+
+		while( queue_head < queue_tail )
+		{
+			size_t curr_id( queue[queue_head++] );
+
+			for(size_t conn_pos(_firstConnection[curr_id]); conn_pos < _firstConnection[curr_id + 1]; ++conn_pos)
+			{
+				size_t conn_id( _connections[conn_pos] );
+				if( NO_PATH != distance[conn_id] )
+				{
+					continue; //already reached by path no longer than this one
+				}
+
+				distance[conn_id] = (unsigned char)(distance[curr_id] + 1);
+
+				//first step is connection itself when leaving start; otherwise
+				//same first step as path to current location
+				next_step[conn_id] = (start_id == curr_id)
+					? (unsigned char)conn_id
+					: next_step[curr_id];
+
+				queue[queue_tail++] = (unsigned char)conn_id;
+
+			} //end for (each connection)
+
+		} //end while (more locations to expand)
+
+	} //end for (each starting location)
+
+} //end routine computeShortestPaths()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns room type with specified layout name.
+/// \param string: layout name (e.g. billiard_room)
+/// \param size_t: line number within description
+/// \return RoomType: room type
+/// \throw
+/// - INCONSISTENT_DATA when no room has name.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+clueless::RoomType
+BoardLayout::parseRoom(
+	const std::string& name, //i - layout name
+	size_t line_number) //i - line number within description
+{
+	for(size_t room_index(clueless::STUDY); room_index <= clueless::KITCHEN; ++room_index)
+	{
+		clueless::RoomType room( (clueless::RoomType)room_index );
+		if( name == convertToLayoutName(clueless::translateRoomTypeToText(room)) )
+		{
+			return room;
+		}
+	}
+
+	std::ostringstream msg;
+	msg << "BoardLayout::parseRoom()\n"
+		<< "  INCONSISTENT_DATA\n"
+		<< "  line " << line_number << ": unknown room \'" << name << "\'";
+	throw std::logic_error( msg.str() );
+
+} //end routine parseRoom()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns character with specified layout name.
+/// \param string: layout name (e.g. mrs_white)
+/// \param size_t: line number within description
+/// \return PersonType: character
+/// \throw
+/// - INCONSISTENT_DATA when no character has name.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+clueless::PersonType
+BoardLayout::parseCharacter(
+	const std::string& name, //i - layout name
+	size_t line_number) //i - line number within description
+{
+	for(size_t person_index(clueless::MISS_SCARLET); person_index <= clueless::PROFESSOR_PLUM; ++person_index)
+	{
+		clueless::PersonType character( (clueless::PersonType)person_index );
+		if( name == convertToLayoutName(clueless::translatePersonTypeToText(character)) )
+		{
+			return character;
+		}
+	}
+
+	std::ostringstream msg;
+	msg << "BoardLayout::parseCharacter()\n"
+		<< "  INCONSISTENT_DATA\n"
+		<< "  line " << line_number << ": unknown character \'" << name << "\'";
+	throw std::logic_error( msg.str() );
+
+} //end routine parseCharacter()
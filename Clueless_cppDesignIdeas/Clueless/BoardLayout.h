@@ -0,0 +1,257 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file BoardLayout.h
+/// \brief Describes how rooms, hallways, secret passages, and person homes
+///        connect, with shortest paths between every pair of locations.
+///
+/// \date   17 Oct 2026  1430
+///
+/// \note
+/// - Layout is read from a line-oriented text description:
+///     # comment
+///     hallway <room> <room>    hallway connecting two rooms
+///     home <character>         start location entering most recent hallway
+///     passage <room> <room>    secret passage (both directions)
+///   Names are lowercase with spaces as underscores and no periods
+///   (e.g. billiard_room, mrs_white).
+/// - Every room type is on every board (the deck holds a card for each), so
+///   rooms are implicit.  Each character needs exactly one home.
+/// - A room has at most MAX_NUM_EXITS hallways and secret passage together,
+///   so move options fit in a fixed-size array (see MoveOptionSet); a
+///   description giving a room more is rejected, naming the line.
+/// - Location identifiers: rooms follow room type (study is zero); hallways
+///   and homes continue in order of appearance.
+/// - A layout is parsed and its paths computed once, then shared (read only)
+///   by every board built from it.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BoardLayout_h
+#define BoardLayout_h
+
+#include "CluelessEnums.h"	//for PersonType, RoomType use
+
+#include <istream>	//for std::istream use
+#include <string>	//for std::string use
+#include <vector>	//for std::vector use
+
+
+class BoardLayout
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const unsigned char NO_PATH = 0xFF; //unreachable, or no location
+	static const size_t MAX_NUM_LOCATIONS = NO_PATH; //identifiers fit below NO_PATH
+	static const size_t MAX_NUM_EXITS = 5; //per room: four hallways and a secret passage
+
+	//--------------------------------------------------------------------------
+	// Class-Scoped Types
+	//--------------------------------------------------------------------------
+public:
+	/// \brief Hallway connecting two rooms.
+	struct HallwaySpec
+	{
+		clueless::RoomType _room1;
+		clueless::RoomType _room2;
+		unsigned int _id;
+	};
+
+	/// \brief Start location of character, entering hallway.
+	struct HomeSpec
+	{
+		clueless::PersonType _character;
+		size_t _hallwayIndex; //position within hallways
+		unsigned int _id;
+	};
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	/// \note private scope to force use of extended constructor
+	BoardLayout();
+
+public:
+	BoardLayout(std::istream& description);
+
+	virtual ~BoardLayout()
+	{
+	}
+
+	static const BoardLayout* classic();
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	const std::vector<HallwaySpec>& getHallways() const;
+	const std::vector<HomeSpec>& getHomes() const;
+	clueless::RoomType getSecretPassageDestination(clueless::RoomType room) const;
+	size_t countHallwaysAdjacentTo(clueless::RoomType room) const;
+	size_t countExits(clueless::RoomType room) const;
+
+	size_t getNumLocations() const;
+	static unsigned int determineRoomId(clueless::RoomType room);
+
+	static bool isRoomId(size_t locationId);
+
+	size_t getNumConnections(size_t locationId) const;
+	const unsigned char* getConnections(size_t locationId) const;
+
+	unsigned char getDistance(size_t startId, size_t destinationId) const;
+	unsigned char getNextStep(size_t startId, size_t destinationId) const;
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+protected:
+	void parse(std::istream& description);
+	void validate() const;
+	void computeShortestPaths();
+
+	static clueless::RoomType parseRoom(const std::string& name, size_t lineNumber);
+	static clueless::PersonType parseCharacter(const std::string& name, size_t lineNumber);
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	std::vector<HallwaySpec> _hallways;
+	std::vector<HomeSpec> _homes;
+	clueless::RoomType _secretPassages[1 + clueless::KITCHEN]; //destination, per room type
+
+	size_t _numLocations;
+
+	/// \note connections of location in [first, first of next location);
+	///       one extra entry ends the last location's connections
+	std::vector<unsigned char> _connections; //identifiers, grouped by location
+	std::vector<size_t> _firstConnection;    //position within connections, per location
+
+	std::vector<unsigned char> _distance; //number of moves, [start * num locations + destination]
+	std::vector<unsigned char> _nextStep; //identifier of first step, same indexing
+
+}; //end class BoardLayout defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline const std::vector<BoardLayout::HallwaySpec>&
+BoardLayout::getHallways()
+const
+{
+	return _hallways;
+
+} //end routine getHallways()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline const std::vector<BoardLayout::HomeSpec>&
+BoardLayout::getHomes()
+const
+{
+	return _homes;
+
+} //end routine getHomes()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline clueless::RoomType
+BoardLayout::getSecretPassageDestination(
+	clueless::RoomType room) //i - room of interest
+const
+{
+	return _secretPassages[room];
+
+} //end routine getSecretPassageDestination()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+BoardLayout::getNumLocations()
+const
+{
+	return _numLocations;
+
+} //end routine getNumLocations()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned int
+BoardLayout::determineRoomId(
+	clueless::RoomType room) //i - room type
+{
+	return( (unsigned int)room - 1 );
+
+} //end routine determineRoomId()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline bool
+BoardLayout::isRoomId(
+	size_t loc_id) //i - location of interest
+{
+	return( loc_id < (size_t)clueless::KITCHEN );
+
+} //end routine isRoomId()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+BoardLayout::getNumConnections(
+	size_t loc_id) //i - location of interest
+const
+{
+	return( _firstConnection[loc_id + 1] - _firstConnection[loc_id] );
+
+} //end routine getNumConnections()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns identifiers of locations one move away, in identifier order.
+/// \note
+/// - Homes are reached from no location; a hallway may be occupied (see
+///   Room::getMoveOptions()).
+////////////////////////////////////////////////////////////////////////////////
+inline const unsigned char*
+BoardLayout::getConnections(
+	size_t loc_id) //i - location of interest
+const
+{
+	return( _connections.data() + _firstConnection[loc_id] );
+
+} //end routine getConnections()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned char
+BoardLayout::getDistance(
+	size_t start_id, //i - starting location
+	size_t dest_id) //i - destination location
+const
+{
+	return _distance[start_id * _numLocations + dest_id];
+
+} //end routine getDistance()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned char
+BoardLayout::getNextStep(
+	size_t start_id, //i - starting location
+	size_t dest_id) //i - destination location
+const
+{
+	return _nextStep[start_id * _numLocations + dest_id];
+
+} //end routine getNextStep()
+
+
+#endif //BoardLayout_h defn
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file Card.cpp
+/// \brief Flyweight card instances and name table.
+///
+/// \date   17 Oct 2026  1515
+///
+/// \note
+/// - Names match clueless::translate*TypeToText().
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Card.h"
+
+//------------------------------------------------------------------------------
+// Class-Scoped Constants
+//------------------------------------------------------------------------------
+const char* const Card::NAMES[clueless::NUM_CARDS] =
+{
+	//people
+	"Miss Scarlet",
+	"Colonel Mustard",
+	"Mrs. White",
+	"Mr. Green",
+	"Mrs. Peacock",
+	"Professor Plum",
+
+	//weapons
+	"candlestick",
+	"knife",
+	"lead pipe",
+	"revolver",
+	"rope",
+	"wrench",
+
+	//rooms
+	"study",
+	"hall",
+	"lounge",
+	"library",
+	"billiard room",
+	"dining room",
+	"conservatory",
+	"ballroom",
+	"kitchen"
+};
+
+
+const PersonCard PersonCard::ALL_CARDS[clueless::PROFESSOR_PLUM] =
+{
+	PersonCard( clueless::MISS_SCARLET ),
+	PersonCard( clueless::COLONEL_MUSTARD ),
+	PersonCard( clueless::MRS_WHITE ),
+	PersonCard( clueless::MR_GREEN ),
+	PersonCard( clueless::MRS_PEACOCK ),
+	PersonCard( clueless::PROFESSOR_PLUM )
+};
+
+
+const WeaponCard WeaponCard::ALL_CARDS[clueless::WRENCH] =
+{
+	WeaponCard( clueless::CANDLESTICK ),
+	WeaponCard( clueless::KNIFE ),
+	WeaponCard( clueless::LEAD_PIPE ),
+	WeaponCard( clueless::REVOLVER ),
+	WeaponCard( clueless::ROPE ),
+	WeaponCard( clueless::WRENCH )
+};
+
+
+const RoomCard RoomCard::ALL_CARDS[clueless::KITCHEN] =
+{
+	RoomCard( clueless::STUDY ),
+	RoomCard( clueless::HALL ),
+	RoomCard( clueless::LOUNGE ),
+	RoomCard( clueless::LIBRARY ),
+	RoomCard( clueless::BILLIARD_ROOM ),
+	RoomCard( clueless::DINING_ROOM ),
+	RoomCard( clueless::CONSERVATORY ),
+	RoomCard( clueless::BALLROOM ),
+	RoomCard( clueless::KITCHEN )
+};
@@ -9,7 +9,11 @@
 ///
 /// \date   26 Feb 2019  1200
 ///
-/// \note None
+/// \note
+/// - Cards are flyweights: exactly one immutable instance per card exists
+///   (see Card::fetch()), identified by its dense card index in
+///   [0, NUM_CARDS).  Names come from a static table, so comparing, copying
+///   references to, and naming cards never allocates.
 ///
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -19,10 +23,6 @@
 
 #include "CluelessEnums.h"	//for ElementType, PersonType, WeaponType, RoomType use
 
-#include <sstream>		//for std::ostringstream use
-#include <stdexcept>	//for std::logic_error use
-#include <string>		//for std::string use
-
 
 //forward declarations
 // - none
@@ -41,54 +41,50 @@ struct Card
 private:
 	/// \brief Default constructor
 	/// \note private scope to force use of extended constructor by children
-	Card()
-		: _type( clueless::PERSON )
-	{
-	}
+	Card();
 
 protected:
-	/// \brief Copy constructor
-	Card(const Card& source)
-		: _type( source._type )
-		, _name( source._name )
-	{
-	}
-
 	/// \brief Extended constructor
 	/// \param CardType: card type (person, weapon, room)
+	/// \param size_t: card index
 	/// \note protected scope to force construction of child class
-	Card(clueless::ElementType type)
+	Card(clueless::ElementType type, size_t index)
 		: _type( type )
+		, _index( (unsigned char)index )
 	{
 	}
 
 public:
-	/// \brief Destructor
-	virtual ~Card()
-	{
-	}
+	static const Card* fetch(size_t cardIndex);
 
 	//--------------------------------------------------------------------------
 	// Overloaded Operators
 	//--------------------------------------------------------------------------
-	virtual bool operator==(const Card& other) const
+	bool operator==(const Card& other) const
+	{
+		return( _index == other._index );
+	}
+
+	bool operator!=(const Card& other) const
 	{
-		return(
-			(_type == other._type) &&
-			(0 == _name.compare( other._name )) );
+		return( _index != other._index );
 	}
 
 	//--------------------------------------------------------------------------
 	// Accessors and Mutators
 	//--------------------------------------------------------------------------
-	std::string getName() const;
-	void rename(const std::string& newName);
+	const char* getName() const;
+
+	size_t getIndex() const;
 
 	//--------------------------------------------------------------------------
 	// Data Members
 	//--------------------------------------------------------------------------
 	clueless::ElementType _type;
-	std::string _name;
+	unsigned char _index; //see clueless::determineCardIndex()
+
+private:
+	static const char* const NAMES[clueless::NUM_CARDS]; //by card index
 
 }; //end struct Card defn
 
@@ -99,74 +95,27 @@ struct PersonCard
 	//--------------------------------------------------------------------------
 	// Constructors / Destructor
 	//--------------------------------------------------------------------------
-protected:
-	/// \brief Default constructor
-	/// \note protected scope to force use of extended constructor
-	PersonCard()
-		: Card(clueless::PERSON )
-		, _person( clueless::UNKNOWN_PERSON )
-	{
-	}
-
-	/// \brief Copy constructor accepting base class
-	PersonCard(const Card& source)
-		: Card( source ) //performs base class member copy
-	{
-		if(clueless::PERSON != source._type )
-		{
-			std::ostringstream msg;
-			msg << "PersonCard() copy constructor\n"
-				<< "  INCONSISTENT_DATA\n"
-				<< "  cannot create PersonCard from card of type: "
-				<< clueless::translateElementTypeToText( source._type );
-			throw std::logic_error( msg.str() );
-		}
-
-		//copy local data values
-		_person = (static_cast<PersonCard>(source))._person;
-	}
-
-public:
+private:
 	/// \brief Extended constructor
 	/// \param PersonType: person type
+	/// \note private scope; only flyweight instances exist
 	PersonCard(clueless::PersonType type)
-		: Card(clueless::PERSON )
+		: Card( clueless::PERSON, clueless::determineCardIndex(type) )
 		, _person( type )
-	{
-		_name = clueless::translatePersonTypeToText( type );
-	}
-
-	/// \brief Destructor
-	virtual ~PersonCard()
 	{
 	}
 
-	//--------------------------------------------------------------------------
-	// Overloaded Operators
-	//--------------------------------------------------------------------------
-	virtual bool operator==(const Card& other) const override
-	{
-		if(clueless::PERSON != other._type ) //other not person
-		{
-			return false; //must be different
-		}
-
-		PersonCard other_person( other );
-		return(	*this == other_person );
-	}
-
-	virtual bool operator==(const PersonCard& other) const
-	{
-		return( 
-			(this->Card::operator==( other )) &&
-			(_person == other._person) );
-	}
+public:
+	static const PersonCard* fetch(clueless::PersonType type);
 
 	//--------------------------------------------------------------------------
 	// Data Members
 	//--------------------------------------------------------------------------
 	clueless::PersonType _person;
 
+private:
+	static const PersonCard ALL_CARDS[clueless::PROFESSOR_PLUM]; //by type - 1
+
 }; //end struct PersonCard defn
 
 
@@ -176,74 +125,27 @@ struct WeaponCard
 	//--------------------------------------------------------------------------
 	// Constructors / Destructor
 	//--------------------------------------------------------------------------
-protected:
-	/// \brief Default constructor
-	/// \note protected scope to force use of extended constructor
-	WeaponCard()
-		: Card(clueless::WEAPON )
-		, _weapon( clueless::UNKNOWN_WEAPON )
-	{
-	}
-
-	/// \brief Copy constructor accepting base class
-	WeaponCard(const Card& source)
-		: Card( source ) //performs base class member copy
-	{
-		if(clueless::WEAPON != source._type )
-		{
-			std::ostringstream msg;
-			msg << "WeaponCard() copy constructor\n"
-				<< "  INCONSISTENT_DATA\n"
-				<< "  cannot create WeaponCard from card of type: "
-				<< clueless::translateElementTypeToText( source._type );
-			throw std::logic_error( msg.str() );
-		}
-
-		//copy local data values
-		_weapon = (static_cast<WeaponCard>(source))._weapon;
-	}
-
-public:
+private:
 	/// \brief Extended constructor
 	/// \param WeaponType: weapon type
+	/// \note private scope; only flyweight instances exist
 	WeaponCard(clueless::WeaponType type)
-		: Card(clueless::WEAPON )
+		: Card( clueless::WEAPON, clueless::determineCardIndex(type) )
 		, _weapon( type )
-	{
-		_name = clueless::translateWeaponTypeToText( type );
-	}
-
-	/// \brief Destructor
-	virtual ~WeaponCard()
 	{
 	}
 
-	//--------------------------------------------------------------------------
-	// Overloaded Operators
-	//--------------------------------------------------------------------------
-	virtual bool operator==(const Card& other) const override
-	{
-		if(clueless::WEAPON != other._type ) //other not weapon
-		{
-			return false; //must be different
-		}
-
-		WeaponCard other_wpn( other );
-		return(	*this == other_wpn );
-	}
-
-	virtual bool operator==(const WeaponCard& other) const
-	{
-		return( 
-			(this->Card::operator==( other )) &&
-			(_weapon == other._weapon) );
-	}
+public:
+	static const WeaponCard* fetch(clueless::WeaponType type);
 
 	//--------------------------------------------------------------------------
 	// Data Members
 	//--------------------------------------------------------------------------
 	clueless::WeaponType _weapon;
 
+private:
+	static const WeaponCard ALL_CARDS[clueless::WRENCH]; //by type - 1
+
 }; //end struct WeaponCard defn
 
 
@@ -253,106 +155,140 @@ struct RoomCard
 	//--------------------------------------------------------------------------
 	// Constructors / Destructor
 	//--------------------------------------------------------------------------
-protected:
-	/// \brief Default constructor
-	/// \note protected scope to force use of extended constructor
-	RoomCard()
-		: Card(clueless::ROOM )
-		, _room( clueless::UNKNOWN_ROOM )
-	{
-	}
-
-	/// \brief Copy constructor accepting base class
-	RoomCard(const Card& source)
-		: Card( source ) //performs base class member copy
-	{
-		if(clueless::ROOM != source._type )
-		{
-			std::ostringstream msg;
-			msg << "RoomCard() copy constructor\n"
-				<< "  INCONSISTENT_DATA\n"
-				<< "  cannot create RoomCard from card of type: "
-				<< clueless::translateElementTypeToText( source._type );
-			throw std::logic_error( msg.str() );
-		}
-
-		//copy local data values
-		_room = (static_cast<RoomCard>(source))._room;
-	}
-
-public:
+private:
 	/// \brief Extended constructor
 	/// \param RoomType: room type
+	/// \note private scope; only flyweight instances exist
 	RoomCard(clueless::RoomType type)
-		: Card( clueless::ROOM )
+		: Card( clueless::ROOM, clueless::determineCardIndex(type) )
 		, _room( type )
 	{
-		_name = clueless::translateRoomTypeToText( type );
 	}
 
-	/// \brief Destructor
-	virtual ~RoomCard()
-	{
-	}
+public:
+	static const RoomCard* fetch(clueless::RoomType type);
 
 	//--------------------------------------------------------------------------
-	// Overloaded Operators
+	// Data Members
 	//--------------------------------------------------------------------------
-	virtual bool operator==(const Card& other) const override
-	{
-		if(clueless::ROOM != other._type ) //other not person
-		{
-			return false; //must be different
-		}
+	clueless::RoomType _room;
+
+private:
+	static const RoomCard ALL_CARDS[clueless::KITCHEN]; //by type - 1
+
+}; //end struct RoomCard defn
 
-		RoomCard other_room( other );
-		return(	*this == other_room );
-	}
 
-	virtual bool operator==(const RoomCard& other) const
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Orders cards by element type, then by person/weapon/room type.
+/// \note
+/// - Used in place of default pointer ordering for card containers, so
+///   iteration order (and any random choice by position) depends only on the
+///   cards, not on where they happen to be allocated.
+/// - Card index follows same order.
+////////////////////////////////////////////////////////////////////////////////
+struct CardOrder
+{
+	bool operator()(const Card* lhs, const Card* rhs) const
 	{
-		return( 
-			(this->Card::operator==( other )) &&
-			(_room == other._room) );
+		return( lhs->_index < rhs->_index );
 	}
 
-	//--------------------------------------------------------------------------
-	// Data Members
-	//--------------------------------------------------------------------------
-	clueless::RoomType _room;
+	static int determineSubtype(const Card* card)
+	{
+		return clueless::determineCardSubtype( card->_index );
+	}
 
-}; //end struct RoomCard defn
+}; //end struct CardOrder defn
 
 
 //------------------------------------------------------------------------------
 // Inlined Methods
 //------------------------------------------------------------------------------
 ////////////////////////////////////////////////////////////////////////////////
-inline std::string
+inline const char*
 Card::getName()
 const
 {
-	return _name;
+	return NAMES[_index];
 
 } //end routine getName()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Populates name attribute with specified new name.
-/// \param string: new name
-/// \return None
+/// \brief Returns card's dense index in [0, NUM_CARDS).
+/// \param None
+/// \return size_t: card index
+/// \throw None
 /// \note
-/// - Currently, nothing prohibits renaming to default for or same name as
-///   another card.
-/// \throw  None
+/// - see clueless::determineCardIndex()
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+Card::getIndex()
+const
+{
+	return _index;
+
+} //end routine getIndex()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline const PersonCard*
+PersonCard::fetch(
+	clueless::PersonType type) //i - person (not unknown)
+{
+	return &ALL_CARDS[type - 1];
+
+} //end routine fetch()
+
+
 ////////////////////////////////////////////////////////////////////////////////
-inline void
-Card::rename(
-	const std::string& new_name) //i - new name for card
+inline const WeaponCard*
+WeaponCard::fetch(
+	clueless::WeaponType type) //i - weapon (not unknown)
 {
-	_name = new_name;
+	return &ALL_CARDS[type - 1];
+
+} //end routine fetch()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline const RoomCard*
+RoomCard::fetch(
+	clueless::RoomType type) //i - room (not unknown)
+{
+	return &ALL_CARDS[type - 1];
+
+} //end routine fetch()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns the card with specified index.
+/// \param size_t: card index in [0, NUM_CARDS)
+/// \return Card: flyweight instance
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+inline const Card*
+Card::fetch(
+	size_t card_index) //i - card index
+{
+	switch( clueless::determineCardElementType(card_index) )
+	{
+	case clueless::PERSON:
+		return PersonCard::fetch( clueless::PersonType(clueless::determineCardSubtype(card_index)) );
+
+	case clueless::WEAPON:
+		return WeaponCard::fetch( clueless::WeaponType(clueless::determineCardSubtype(card_index)) );
+
+	default:
+		; //room
+
+	} //end switch (on element type)
+
+	return RoomCard::fetch( clueless::RoomType(clueless::determineCardSubtype(card_index)) );
 
-} //end routine rename()
+} //end routine fetch()
 
 
 #endif //Card_h defn
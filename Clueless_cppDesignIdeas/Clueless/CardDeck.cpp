@@ -22,27 +22,23 @@
 #include "CluelessEnums.h"	//for PersonType, WeaponType, RoomType enum use
 #include "mersenneTwister.h"
 
-#include <math.h>			//for std::floor use
-#include <iostream>			//for std::cout use
 #include <stdexcept>		//for std::logic_error use
 
 //------------------------------------------------------------------------------
 // Constructors / Destructor
 //------------------------------------------------------------------------------
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Default constructor
-/// \param None
+/// \brief Extended constructor
+/// \param MersenneTwister: random number generator of owning game
 /// \return None
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
-CardDeck::CardDeck()
-	: _caseFile( nullptr )
+CardDeck::CardDeck(
+	MersenneTwister* rng) //i - random number generator of owning game
+	: _rng( rng )
+	, _numUndealtCards( 0 )
 {
-	createPersonCards();
-	createWeaponCards();
-	createRoomCards();
-
 	chooseCaseFileSet();
 
 } //end routine constructor
@@ -57,43 +53,7 @@ CardDeck::CardDeck()
 ////////////////////////////////////////////////////////////////////////////////
 CardDeck::~CardDeck()
 {
-	//delete cards
-	std::set<Card*>::iterator pcard_iter( _personCards.begin() );
-	Card* curr_pcard( nullptr );
-	while( _personCards.end() != pcard_iter )
-	{
-		curr_pcard = *pcard_iter;
-		_personCards.erase( pcard_iter );
-		delete curr_pcard;
-
-		pcard_iter = _personCards.begin();
-	}
-
-	std::set<Card*>::iterator wcard_iter( _weaponCards.begin() );
-	Card* curr_wcard( nullptr );
-	while( _weaponCards.end() != wcard_iter )
-	{
-		curr_wcard = *wcard_iter;
-		_weaponCards.erase( wcard_iter );
-		delete curr_wcard;
-
-		wcard_iter = _weaponCards.begin();
-	}
-
-	std::set<Card*>::iterator rcard_iter( _roomCards.begin() );
-	Card* curr_rcard( nullptr );
-	while( _roomCards.end() != rcard_iter )
-	{
-		curr_rcard = *rcard_iter;
-		_roomCards.erase( rcard_iter );
-		delete curr_rcard;
-
-		rcard_iter = _roomCards.begin();
-	}
-
-	//case file
-	delete _caseFile;
-	_caseFile = nullptr;
+	//cards are flyweights (not owned)
 
 } //end routine destructor
 
@@ -102,151 +62,67 @@ CardDeck::~CardDeck()
 // Game Setup Methods
 //------------------------------------------------------------------------------
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief 
+/// \brief Chooses case file (one card from each category); remaining cards
+///  become undealt deck.
 /// \param None
 /// \return None
 /// \throw None
-/// \note  None
-////////////////////////////////////////////////////////////////////////////////
-void
-CardDeck::createPersonCards()
-{
-	using clueless::PersonType;
-
-	_personCards.insert( new PersonCard(PersonType::MISS_SCARLET) );
-	_personCards.insert( new PersonCard(PersonType::COLONEL_MUSTARD) );
-	_personCards.insert( new PersonCard(PersonType::MRS_WHITE) );
-	_personCards.insert( new PersonCard(PersonType::MR_GREEN) );
-	_personCards.insert( new PersonCard(PersonType::MRS_PEACOCK) );
-	_personCards.insert( new PersonCard(PersonType::PROFESSOR_PLUM) );
-
-	std::set<Card*>::iterator card_iter( _personCards.begin() );
-	while( _personCards.end() != card_iter )
-	{
-		//add reference to undealt card stack
-		_undealtCards.insert( *card_iter );
-		++card_iter;
-
-	} //end while (more room cards)
-
-} //end routine createPersonCards()
-
-
-////////////////////////////////////////////////////////////////////////////////
-/// \brief 
-/// \param None
-/// \return None
-/// \throw None
-/// \note  None
-////////////////////////////////////////////////////////////////////////////////
-void
-CardDeck::createWeaponCards()
-{
-	using clueless::WeaponType;
-
-	_weaponCards.insert( new WeaponCard(WeaponType::LEAD_PIPE) );
-	_weaponCards.insert( new WeaponCard(WeaponType::KNIFE) );
-	_weaponCards.insert( new WeaponCard(WeaponType::ROPE) );
-	_weaponCards.insert( new WeaponCard(WeaponType::CANDLESTICK) );
-	_weaponCards.insert( new WeaponCard(WeaponType::REVOLVER) );
-	_weaponCards.insert( new WeaponCard(WeaponType::WRENCH) );
-
-	std::set<Card*>::iterator card_iter( _weaponCards.begin() );
-	while( _weaponCards.end() != card_iter )
-	{
-		//add reference to undealt card stack
-		_undealtCards.insert( *card_iter );
-		++card_iter;
-
-	} //end while (more room cards)
-
-} //end routine createWeaponCards()
-
-
-////////////////////////////////////////////////////////////////////////////////
-/// \brief 
-/// \param None
-/// \return None
-/// \throw None
-/// \note  None
-////////////////////////////////////////////////////////////////////////////////
-void
-CardDeck::createRoomCards()
-{
-	using clueless::RoomType;
-
-	_roomCards.insert( new RoomCard(RoomType::STUDY) );
-	_roomCards.insert( new RoomCard(RoomType::HALL) );
-	_roomCards.insert( new RoomCard(RoomType::LOUNGE) );
-	_roomCards.insert( new RoomCard(RoomType::LIBRARY) );
-	_roomCards.insert( new RoomCard(RoomType::BILLIARD_ROOM) );
-	_roomCards.insert( new RoomCard(RoomType::DINING_ROOM) );
-	_roomCards.insert( new RoomCard(RoomType::CONSERVATORY) );
-	_roomCards.insert( new RoomCard(RoomType::BALLROOM) );
-	_roomCards.insert( new RoomCard(RoomType::KITCHEN) );
-
-	std::set<Card*>::iterator card_iter( _roomCards.begin() );
-	while( _roomCards.end() != card_iter )
-	{
-		//add reference to undealt card stack
-		_undealtCards.insert( *card_iter );
-		++card_iter;
-
-	} //end while (more room cards)
-
-} //end routine createRoomCards()
-
-
-////////////////////////////////////////////////////////////////////////////////
-/// \brief 
-/// \param None
-/// \return None
-/// \throw None
-/// \note  None
+/// \note
+/// - Undealt cards are left in card index order; setup() shuffles them.
 ////////////////////////////////////////////////////////////////////////////////
 void
 CardDeck::chooseCaseFileSet()
 {
 	//choose one card from each category
-	PersonCard* person( (PersonCard*)chooseCard(&_personCards) );
-	WeaponCard* weapon( (WeaponCard*)chooseCard(&_weaponCards) );
-	RoomCard* room( (RoomCard*)chooseCard(&_roomCards) );
+	const PersonCard* person( (const PersonCard*)chooseCard(clueless::PERSON) );
+	const WeaponCard* weapon( (const WeaponCard*)chooseCard(clueless::WEAPON) );
+	const RoomCard* room( (const RoomCard*)chooseCard(clueless::ROOM) );
 
 	//copy into case file
-	_caseFile = new SolutionCardSet(*person, *weapon, *room);
-
-	std::cout << "Case File... " << _caseFile->report().str() << "\n\n";
+	_caseFile = SolutionCardSet(*person, *weapon, *room);
 
-	//remove from undealt collection
-	removeCardFromUndealt( person );
-	removeCardFromUndealt( weapon );
-	removeCardFromUndealt( room );
+	//all other cards remain to be dealt
+	_numUndealtCards = 0;
+	for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+	{
+		const Card* card( Card::fetch(card_index) );
+		if( (card != person) && (card != weapon) && (card != room) )
+		{
+			_undealtCards[_numUndealtCards++] = card;
+		}
+	}
 
 } //end routine chooseCaseFileSet()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Chooses card from specified container with uniform random draw.
-/// \param set<Card>: collection of cards
-/// \return Card: choosen card
-/// \throw
-/// - INSUFFICIENT_DATA when empty collection of cards
-/// \note  None
+/// \brief Shuffles undealt cards, then deals them round robin to players.
+/// \param Player*[]: players, in dealing order
+/// \param size_t: number of players
+/// \return None
+/// \throw None
+/// \note
+/// - Single pass over contiguous deck; no heap allocation.
 ////////////////////////////////////////////////////////////////////////////////
 void
 CardDeck::setup(
-	std::list<Player*>* players)
+	Player* const players[], //io- players receiving cards
+	size_t num_players) //i - number of players
 {
-	std::list<Player*>::const_iterator player_iter( (*players).begin() );
-	Card* chosen_card( nullptr );
+	size_t player_index( 0 );
+
+	shuffleUndealtCards();
 
 	while( areAnyCardsUndealt() )
 	{
 		//deal card from undealt to receiving player (incl remove card from undealt)
-		dealCard( *player_iter );
+		dealCard( players[player_index] );
 
 		//cycle to next player
-		player_iter = determineNextPlayer(players, player_iter);
+		if( num_players == ++player_index )
+		{
+			player_index = 0;
+		}
 
 	} //end while (undealt cards)
 
@@ -254,62 +130,21 @@ CardDeck::setup(
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Chooses card from specified container with uniform random draw.
-/// \param set<Card>: collection of cards
-/// \return Card: choosen card
+/// \brief Chooses card of specified category with uniform random draw.
+/// \param ElementType: category (person, weapon, room)
+/// \return Card: chosen card
 /// \throw
-/// - INSUFFICIENT_DATA when empty collection of cards
+/// - INSUFFICIENT_DATA when unknown category
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
-Card*
-CardDeck::chooseCard(
-	std::set<Card*>* cards) //i - cards to choose amongst
-const
-{
-	Card* choice( nullptr );
-
-	if( cards->empty() ) //no cards from which to choose
-	{
-		std::ostringstream msg;
-		msg << "CardDeck::chooseCard()\n"
-			<< "  INSUFFICIENT_DATA\n"
-			<< "  no cards from which to choose";
-		throw std::logic_error( msg.str() );
-	}
-	else if( 1 == cards->size() )
-	{
-		//only one choice
-		choice = *(cards->begin());
-	}
-	else //more than one card
-	{
-		//create position based on floor of random draw in [0, num cards)
-		size_t zero_based_pos( size_t(std::floor( MersenneTwister::drawReal2(0, (double)(cards->size())) )) );
-	
-		std::set<Card*>::const_iterator card_iter( cards->begin() );
-		for(size_t pos_index(0);
-			pos_index < zero_based_pos;
-			++pos_index)
-		{
-			++card_iter;
-		}
-
-		choice = *card_iter;
-	}
-
-	return choice;
-
-} //end routine chooseCard()
-
-
 const Card*
 CardDeck::chooseCard(
-	std::set<const Card*>* cards) //i - cards to choose amongst
+	clueless::ElementType category) //i - category to choose amongst
 const
 {
-	const Card* choice( nullptr );
+	size_t num_cards( clueless::getNumElementSubtypes(category) );
 
-	if( cards->empty() ) //no cards from which to choose
+	if( 0 == num_cards ) //no cards from which to choose
 	{
 		std::ostringstream msg;
 		msg << "CardDeck::chooseCard()\n"
@@ -317,76 +152,49 @@ const
 			<< "  no cards from which to choose";
 		throw std::logic_error( msg.str() );
 	}
-	else if( 1 == cards->size() )
-	{
-		//only one choice
-		choice = *(cards->begin());
-	}
-	else //more than one card
-	{
-		//create position based on floor of random draw in [0, num cards)
-		size_t zero_based_pos( size_t(std::floor( MersenneTwister::drawReal2(0, (double)(cards->size())) )) );
-
-		std::set<const Card*>::const_iterator card_iter( cards->begin() );
-		for(size_t pos_index(0);
-			pos_index < zero_based_pos;
-			++pos_index)
-		{
-			++card_iter;
-		}
-
-		choice = *card_iter;
-	}
 
-	return choice;
+	//cards of category are contiguous by card index
+	return Card::fetch( clueless::determineFirstCardIndex(category) + _rng->drawUniformInt(num_cards) );
 
 } //end routine chooseCard()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Removes specified card from undealt cards collection.
-/// \param Card: card to remove
+/// \brief Shuffles undealt cards in place (Fisher-Yates).
+/// \param None
 /// \return None
-/// \throw
-/// - INCONSISTENT_DATA when specified card not found
-/// \note  None
+/// \throw None
+/// \note
+/// - Each permutation equally likely, given unbiased integer draws.
 ////////////////////////////////////////////////////////////////////////////////
 void
-CardDeck::removeCardFromUndealt(
-	const Card* card) //i - card to remove
+CardDeck::shuffleUndealtCards()
 {
-	std::set<const Card*>::iterator card_iter( _undealtCards.find(card) );
-	
-	if( _undealtCards.end() != card_iter ) //found card
+	for(size_t pos_index(_numUndealtCards); pos_index > 1; --pos_index)
 	{
-		_undealtCards.erase( card_iter );
-	}
-	else //card not found
-	{
-		std::ostringstream msg;
-		msg << "CardDeck::removeCardFromUndealt()\n"
-			<< "  INSUFFICIENT_DATA\n"
-			<< "  card \'" << card->getName() << "\' not found in undealt set";
-		throw std::logic_error( msg.str() );
+		size_t swap_index( _rng->drawUniformInt(pos_index) );
+
+		const Card* card( _undealtCards[pos_index - 1] );
+		_undealtCards[pos_index - 1] = _undealtCards[swap_index];
+		_undealtCards[swap_index] = card;
 	}
 
-} //end routine removeCardFromUndealt()
+} //end routine shuffleUndealtCards()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief 
-/// \param None
-/// \return None
-/// \throw None
+/// \brief Deals top card of undealt deck to specified player.
+/// \param Player: player to whom card will be dealt
+/// \return Card: card dealt
+/// \throw
+/// - INSUFFICIENT_DATA when no undealt cards
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
 const Card*
 CardDeck::dealCard(
 	Player* player) //io- player to whom card will be dealt
 {
-	const Card* card( nullptr );
-
-	if( 0 == _undealtCards.size() )
+	if( 0 == _numUndealtCards )
 	{
 		std::ostringstream msg;
 		msg << "CardDeck::dealCard()\n"
@@ -395,51 +203,45 @@ CardDeck::dealCard(
 		throw std::logic_error( msg.str() );
 	}
 	
-	//uniform random draw of card
-	card = chooseCard( &_undealtCards );
+	//take from back of (shuffled) deck
+	const Card* card( _undealtCards[--_numUndealtCards] );
 	player->addCardToHand( card );
 
-	//remove reference from undealt card collection
-	removeCardFromUndealt( card );
-
 	return card; //dealt
 
 } //end routine dealCard()
 
 
+
+
+//------------------------------------------------------------------------------
+// Accessors and Mutators
+//------------------------------------------------------------------------------
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Determines next player given collection of players and current player.
-/// \param set<Player*>: all players
-/// \param set<Player*>::iterator: current player
-/// \return set<Player*>::iterator: next player
+/// \brief Returns room cards, ordered by room type.
+/// \param None
+/// \return set<Card*>: room cards
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
-std::list<Player*>::const_iterator
-CardDeck::determineNextPlayer(
-	const std::list<Player*>* const players, //i - 
-	std::list<Player*>::const_iterator curr_player_iter)
+const std::set<const Card*, CardOrder>
+CardDeck::getRoomCards()
+const
 {
-	std::list<Player*>::const_iterator next_player_iter( curr_player_iter );
+	std::set<const Card*, CardOrder> room_cards;
 
-	//increment iterator
-	++next_player_iter;
-
-	//if iterator represents end of collection
-	if( (*players).end() == next_player_iter )
+	for(int room(clueless::UNKNOWN_ROOM + 1);
+		room <= clueless::KITCHEN;
+		++room)
 	{
-		//cycle back to first player
-		next_player_iter = (*players).begin();
+		room_cards.insert( RoomCard::fetch(clueless::RoomType(room)) );
 	}
-	
-	return next_player_iter;
 
-} //end routine determineNextPlayer()
+	return room_cards;
+
+} //end routine getRoomCards()
 
 
-//------------------------------------------------------------------------------
-// Accessors and Mutators
-//------------------------------------------------------------------------------
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Reports contents of Case File (solution).
 /// \param None
@@ -451,7 +253,7 @@ std::ostringstream
 CardDeck::reportCaseFile()
 const
 {
-	return _caseFile->report();
+	return _caseFile.report();
 
 } //end routine reportCaseFile()
 
@@ -471,6 +273,6 @@ CardDeck::doesAccusationMatchCaseFile(
 	const SolutionCardSet& accusation) //i - accusation to compare with case file
 const
 {
-	return( *_caseFile == accusation );
+	return( _caseFile == accusation );
 
 } //end routine doesAccusationMatchCaseFile()
@@ -5,12 +5,15 @@
 ////////////////////////////////////////////////////////////////////////////////
 ///
 /// \file CardDeck.h
-/// \brief Responsible for creating, owning, and deleting all game cards
+/// \brief Responsible for choosing the case file and dealing all game cards
 ///  representing people, weapons, and rooms.
 ///
 /// \date   26 Feb 2019  1202
 ///
-/// \note None
+/// \note
+/// - Cards are flyweights (see Card::fetch()); deck holds references only.
+///   Choosing the case file and dealing draw unbiased integers and perform
+///   no heap allocation.
 ///
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -18,14 +21,17 @@
 #define CardDeck_h
 
 #include "Card.h"
+#include "SolutionCardSet.h"
+
+#include "CluelessEnums.h"	//for ElementType, NUM_CARDS use
 
-#include <list>		//for std::list use
 #include <set>		//for std::set use
+#include <stddef.h>	//for size_t use
 
 
 //forward declarations
+class MersenneTwister;
 class Player;
-struct SolutionCardSet;
 
 
 class CardDeck
@@ -33,16 +39,22 @@ class CardDeck
 	//--------------------------------------------------------------------------
 	// Constructors / Destructor
 	//--------------------------------------------------------------------------
-public:
+private:
+	/// \brief Default constructor
+	/// \note private scope to force use of extended constructor
 	CardDeck();
 
+public:
+	CardDeck(MersenneTwister* randomNumberGenerator);
+
 	virtual ~CardDeck();
 
 	//--------------------------------------------------------------------------
 	// Accessors and Mutators
 	//--------------------------------------------------------------------------
-	const std::set<Card*> getRoomCards() const;
+	const std::set<const Card*, CardOrder> getRoomCards() const;
 
+	const SolutionCardSet* getCaseFile() const;
 	std::ostringstream reportCaseFile() const;
 
 protected:
@@ -51,10 +63,6 @@ protected:
 	//--------------------------------------------------------------------------
 	// Game Setup Methods
 	//--------------------------------------------------------------------------
-	void createPersonCards();
-	void createWeaponCards();
-	void createRoomCards();
-
 	void chooseCaseFileSet();
 	const Card* dealCard(Player* receivingPlayer);
 
@@ -62,34 +70,27 @@ protected:
 	// Additional Member Functions
 	//--------------------------------------------------------------------------
 public:
-	void setup(std::list<Player*>* allPlayers);
+	void setup(Player* const allPlayers[], size_t numPlayers);
 
 	bool doesAccusationMatchCaseFile(const SolutionCardSet& accusation) const;
 
 protected:
-	Card* chooseCard(std::set<Card*>* cards) const;
-	const Card* chooseCard(std::set<const Card*>* cards) const;
+	const Card* chooseCard(clueless::ElementType category) const;
 
-	void removeCardFromUndealt(const Card* card);
-
-private:
-	std::list<Player*>::const_iterator determineNextPlayer(
-		const std::list<Player*>* const players,
-		std::list<Player*>::const_iterator currPlayerIter);
+	void shuffleUndealtCards();
 
 	//--------------------------------------------------------------------------
 	// Data Members
 	//--------------------------------------------------------------------------
 protected:
-	//primary storage (ownership) for all cards
-	std::set<Card*> _personCards;
-	std::set<Card*> _weaponCards;
-	std::set<Card*> _roomCards;
+	SolutionCardSet _caseFile; //solution to crime
 
-	SolutionCardSet* _caseFile; //solution to crime
+	MersenneTwister* _rng; //random draws for owning game (not owned)
 
 private:
-	std::set<const Card*> _undealtCards;
+	//cards outside case file; shuffled during setup, then dealt from back
+	const Card* _undealtCards[clueless::NUM_CARDS];
+	size_t _numUndealtCards;
 
 }; //end class CardDeck defn
 
@@ -102,19 +103,19 @@ inline bool
 CardDeck::areAnyCardsUndealt()
 const
 {
-	return( 0 < _undealtCards.size() );
+	return( 0 < _numUndealtCards );
 
 } //end routine areAnyCardsUndealt()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-inline const std::set<Card*>
-CardDeck::getRoomCards()
+inline const SolutionCardSet*
+CardDeck::getCaseFile()
 const
 {
-	return( _roomCards );
+	return &_caseFile;
 
-} //end routine getRoomCards()
+} //end routine getCaseFile()
 
 
 #endif //CardDeck_h
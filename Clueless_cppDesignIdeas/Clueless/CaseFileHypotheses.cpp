@@ -0,0 +1,242 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file CaseFileHypotheses.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  1900
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "CaseFileHypotheses.h"
+
+#include "DeductionMatrix.h"
+
+
+//------------------------------------------------------------------------------
+// Local Helpers
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns number of set bits.
+////////////////////////////////////////////////////////////////////////////////
+static size_t
+countBits(
+	unsigned int bits) //i - bits of interest
+{
+	size_t num_bits( 0 );
+	for(; 0 != bits; bits &= (bits - 1))
+	{
+		++num_bits;
+	}
+
+	return num_bits;
+
+} //end routine countBits()
+
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Default constructor
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - Every Case File equally likely.
+////////////////////////////////////////////////////////////////////////////////
+CaseFileHypotheses::CaseFileHypotheses()
+	: _mostLikely( 0 )
+{
+	for(size_t hypothesis(0); hypothesis < NUM_HYPOTHESES; ++hypothesis)
+	{
+		_weights[hypothesis] = 1.0f / NUM_HYPOTHESES;
+	}
+
+	computeMarginals();
+
+} //end routine constructor
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Reweighs every hypothesis from deductions.
+/// \param DeductionMatrix: what is known of who holds each card
+/// \return None
+/// \throw None
+/// \note
+/// - Each card starts with 1 / (number of possible holders) as its chance of
+///   being in the Case File (zero once ruled out, one once deduced); a
+///   hypothesis weighs the product over its three cards.
+/// - Each unresolved "holds one of" constraint scales a hypothesis by the
+///   share of the holder's candidate cards it leaves outside the Case File:
+///   zero when it takes them all.
+/// - Both steps broadcast a 36-lane person x weapon row over the 9 rooms.
+/// - Contradictory deductions (no weight left) restore equal weights.
+////////////////////////////////////////////////////////////////////////////////
+void
+CaseFileHypotheses::update(
+	const DeductionMatrix& deductions) //i - what is known
+{
+	float card_chances[clueless::NUM_CARDS];
+	for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+	{
+		unsigned int holders( deductions.getPossibleHolders(card_index) );
+
+		card_chances[card_index] = (0 != (holders & (1u << DeductionMatrix::CASE_FILE)))
+			? 1.0f / countBits(holders)
+			: 0.0f;
+	}
+
+	//person x weapon lane, then broadcast over rooms
+	alignas(16) float pair_lane[NUM_PAIRS];
+	for(size_t pair(0); pair < NUM_PAIRS; ++pair)
+	{
+		pair_lane[pair] =
+			card_chances[FIRST_PERSON_CARD + pair / clueless::WRENCH] *
+			card_chances[FIRST_WEAPON_CARD + pair % clueless::WRENCH];
+	}
+
+	for(size_t room_index(0); room_index < clueless::KITCHEN; ++room_index)
+	{
+		float room_chance( card_chances[FIRST_ROOM_CARD + room_index] );
+		float* row( &_weights[room_index * NUM_PAIRS] );
+
+		for(size_t pair(0); pair < NUM_PAIRS; ++pair)
+		{
+			row[pair] = room_chance * pair_lane[pair];
+		}
+	}
+
+	//holders' unresolved "holds one of" constraints
+	for(size_t constraint(0); constraint < deductions.getNumHoldsOneOf(); ++constraint)
+	{
+		size_t holder( deductions.getHoldsOneOfHolder(constraint) );
+
+		//candidates still possible for holder
+		unsigned int candidates( 0 );
+		for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+		{
+			if( (0 != (deductions.getHoldsOneOfCards(constraint) & (1u << card_index))) &&
+				deductions.isPossibleHolder(card_index, holder) )
+			{
+				candidates |= (1u << card_index);
+			}
+		}
+
+		if( 0 == candidates )
+		{
+			continue; //next constraint
+		}
+
+		float total( (float)countBits(candidates) );
+		float share( 1.0f / total );
+
+		//candidates each pair leaves outside Case File
+		for(size_t pair(0); pair < NUM_PAIRS; ++pair)
+		{
+			pair_lane[pair] = total -
+				(float)((candidates >> (FIRST_PERSON_CARD + pair / clueless::WRENCH)) & 1u) -
+				(float)((candidates >> (FIRST_WEAPON_CARD + pair % clueless::WRENCH)) & 1u);
+		}
+
+		for(size_t room_index(0); room_index < clueless::KITCHEN; ++room_index)
+		{
+			float in_room( (float)((candidates >> (FIRST_ROOM_CARD + room_index)) & 1u) );
+			float* row( &_weights[room_index * NUM_PAIRS] );
+
+			for(size_t pair(0); pair < NUM_PAIRS; ++pair)
+			{
+				row[pair] *= (pair_lane[pair] - in_room) * share;
+			}
+		}
+
+	} //end for (each constraint)
+
+	//normalize
+	float total_weight( 0.0f );
+	for(size_t hypothesis(0); hypothesis < NUM_HYPOTHESES; ++hypothesis)
+	{
+		total_weight += _weights[hypothesis];
+	}
+
+	if( 0.0f < total_weight )
+	{
+		float scale( 1.0f / total_weight );
+		for(size_t hypothesis(0); hypothesis < NUM_HYPOTHESES; ++hypothesis)
+		{
+			_weights[hypothesis] *= scale;
+		}
+	}
+	else //contradiction
+	{
+		for(size_t hypothesis(0); hypothesis < NUM_HYPOTHESES; ++hypothesis)
+		{
+			_weights[hypothesis] = 1.0f / NUM_HYPOTHESES;
+		}
+	}
+
+	computeMarginals();
+
+} //end routine update()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Sums weights into each card's chance of being in Case File, and
+///        finds most likely hypothesis.
+/// \param None
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+CaseFileHypotheses::computeMarginals()
+{
+	alignas(16) float pair_sums[NUM_PAIRS] = { 0.0f };
+	alignas(16) float pair_maxima[NUM_PAIRS] = { 0.0f }; //greatest weight over rooms
+
+	for(size_t room_index(0); room_index < clueless::KITCHEN; ++room_index)
+	{
+		const float* row( &_weights[room_index * NUM_PAIRS] );
+		float room_sum( 0.0f );
+
+		for(size_t pair(0); pair < NUM_PAIRS; ++pair)
+		{
+			pair_sums[pair] += row[pair];
+			pair_maxima[pair] = (row[pair] > pair_maxima[pair]) ? row[pair] : pair_maxima[pair];
+			room_sum += row[pair];
+		}
+
+		_marginals[FIRST_ROOM_CARD + room_index] = room_sum;
+	}
+
+	for(size_t card_index(FIRST_PERSON_CARD); card_index < FIRST_ROOM_CARD; ++card_index)
+	{
+		_marginals[card_index] = 0.0f;
+	}
+
+	float max_weight( 0.0f );
+	for(size_t pair(0); pair < NUM_PAIRS; ++pair)
+	{
+		_marginals[FIRST_PERSON_CARD + pair / clueless::WRENCH] += pair_sums[pair];
+		_marginals[FIRST_WEAPON_CARD + pair % clueless::WRENCH] += pair_sums[pair];
+
+		max_weight = (pair_maxima[pair] > max_weight) ? pair_maxima[pair] : max_weight;
+	}
+
+	//first hypothesis of greatest weight
+	_mostLikely = 0;
+	while( (_mostLikely < NUM_HYPOTHESES - 1) &&
+		(_weights[_mostLikely] < max_weight) )
+	{
+		++_mostLikely;
+	}
+
+} //end routine computeMarginals()
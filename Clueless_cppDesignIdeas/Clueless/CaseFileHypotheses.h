@@ -0,0 +1,162 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file CaseFileHypotheses.h
+/// \brief Weighs every possible Case File (person x weapon x room) against
+///        what a notebook has deduced.
+///
+/// \date   17 Oct 2026  1900
+///
+/// \note
+/// - One weight per hypothesis: 6 x 6 x 9 = 324, normalized to probabilities.
+///   Hypothesis index is ((room - 1) * 6 + (person - 1)) * 6 + (weapon - 1):
+///   one row of 36 person x weapon pairs per room.
+/// - Rebuilt from a DeductionMatrix after each thing learned (see update()),
+///   so impossible Case Files weigh exactly zero and the rest are weighed by
+///   how freely their cards could lie elsewhere.
+/// - Weights, and the 36-lane rows they are built from, are fixed-size
+///   aligned float arrays updated by branch-free loops, so an optimizing
+///   build vectorizes them.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CaseFileHypotheses_h
+#define CaseFileHypotheses_h
+
+#include "SolutionCardSet.h"
+
+#include "CluelessEnums.h"	//for NUM_CARDS, PersonType, WeaponType, RoomType use
+
+#include <stddef.h>		//for size_t use
+
+
+//forward declarations
+class DeductionMatrix;
+
+
+class CaseFileHypotheses
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const size_t NUM_PAIRS = clueless::PROFESSOR_PLUM * clueless::WRENCH; //per room
+	static const size_t NUM_HYPOTHESES = NUM_PAIRS * clueless::KITCHEN;
+
+	static const size_t FIRST_PERSON_CARD = 0; //card indices (see clueless::determineCardIndex())
+	static const size_t FIRST_WEAPON_CARD = FIRST_PERSON_CARD + clueless::PROFESSOR_PLUM;
+	static const size_t FIRST_ROOM_CARD = FIRST_WEAPON_CARD + clueless::WRENCH;
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+public:
+	CaseFileHypotheses();
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	float getProbability(size_t hypothesis) const;
+	float getMarginal(size_t cardIndex) const;
+
+	float getMaxProbability() const;
+	SolutionCardSet findMostLikely() const;
+
+	static size_t determineHypothesis(const SolutionCardSet& caseFile);
+	static SolutionCardSet determineCaseFile(size_t hypothesis);
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	void update(const DeductionMatrix& deductions);
+
+protected:
+	void computeMarginals();
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	alignas(16) float _weights[NUM_HYPOTHESES]; //probability per hypothesis
+	float _marginals[clueless::NUM_CARDS];       //probability card in Case File
+
+	size_t _mostLikely; //hypothesis of greatest weight (first if tied)
+
+}; //end class CaseFileHypotheses defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline float
+CaseFileHypotheses::getProbability(
+	size_t hypothesis) //i - hypothesis of interest
+const
+{
+	return _weights[hypothesis];
+
+} //end routine getProbability()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns probability card is in Case File.
+////////////////////////////////////////////////////////////////////////////////
+inline float
+CaseFileHypotheses::getMarginal(
+	size_t card_index) //i - card of interest
+const
+{
+	return _marginals[card_index];
+
+} //end routine getMarginal()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline float
+CaseFileHypotheses::getMaxProbability()
+const
+{
+	return _weights[_mostLikely];
+
+} //end routine getMaxProbability()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline SolutionCardSet
+CaseFileHypotheses::findMostLikely()
+const
+{
+	return determineCaseFile( _mostLikely );
+
+} //end routine findMostLikely()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+CaseFileHypotheses::determineHypothesis(
+	const SolutionCardSet& case_file) //i - Case File of interest
+{
+	return( ((case_file._room - 1) * clueless::PROFESSOR_PLUM + (case_file._person - 1)) * clueless::WRENCH +
+		(case_file._weapon - 1) );
+
+} //end routine determineHypothesis()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline SolutionCardSet
+CaseFileHypotheses::determineCaseFile(
+	size_t hypothesis) //i - hypothesis of interest
+{
+	return SolutionCardSet(
+		clueless::PersonType(1 + (hypothesis % NUM_PAIRS) / clueless::WRENCH),
+		clueless::WeaponType(1 + hypothesis % clueless::WRENCH),
+		clueless::RoomType(1 + hypothesis / NUM_PAIRS) );
+
+} //end routine determineCaseFile()
+
+
+#endif //CaseFileHypotheses_h defn
@@ -96,28 +96,28 @@ enum TurnOptionType
 //------------------------------------------------------------------------------
 // Number of Type
 //------------------------------------------------------------------------------
-static size_t getNumPersonTypes()
+inline size_t getNumPersonTypes()
 {
 	return( size_t(PersonType::PROFESSOR_PLUM) );
 
 } //end routine getNumPersonTypes()
 
 
-static size_t getNumWeaponTypes()
+inline size_t getNumWeaponTypes()
 {
 	return( size_t(WeaponType::WRENCH) );
 
 } //end routine getNumWeaponTypes()
 
 
-static size_t getNumRoomTypes()
+inline size_t getNumRoomTypes()
 {
 	return( size_t(RoomType::KITCHEN) );
 
 } //end routine getNumRoomTypes()
 
 
-static size_t getNumElementSubtypes(
+inline size_t getNumElementSubtypes(
 	ElementType elmt_type) //i - element type (person, weapon, room)
 {
 	size_t num_elmt_subtypes( 0 );
@@ -146,6 +146,90 @@ static size_t getNumElementSubtypes(
 } //end routine getNumElementSubtypes()
 
 
+//------------------------------------------------------------------------------
+// Card Index
+//------------------------------------------------------------------------------
+/// \note Every card has a dense index in [0, NUM_CARDS): people first, then
+///       weapons, then rooms, each in enumerated order.  Suits fixed-size
+///       tables and bitmasks keyed by card.
+static const size_t NUM_CARDS = 21; //people + weapons + rooms
+
+inline size_t determineCardIndex(
+	PersonType person) //i - person (not unknown)
+{
+	return( size_t(person) - 1 );
+
+} //end routine determineCardIndex(PersonType)
+
+
+inline size_t determineCardIndex(
+	WeaponType weapon) //i - weapon (not unknown)
+{
+	return( getNumPersonTypes() + size_t(weapon) - 1 );
+
+} //end routine determineCardIndex(WeaponType)
+
+
+inline size_t determineCardIndex(
+	RoomType room) //i - room (not unknown)
+{
+	return( getNumPersonTypes() + getNumWeaponTypes() + size_t(room) - 1 );
+
+} //end routine determineCardIndex(RoomType)
+
+
+inline size_t determineFirstCardIndex(
+	ElementType elmt_type) //i - element type (person, weapon, room)
+{
+	switch( elmt_type )
+	{
+	case PERSON:
+		return determineCardIndex( PersonType(UNKNOWN_PERSON + 1) );
+
+	case WEAPON:
+		return determineCardIndex( WeaponType(UNKNOWN_WEAPON + 1) );
+
+	case ROOM:
+		return determineCardIndex( RoomType(UNKNOWN_ROOM + 1) );
+
+	default:
+		; //unknown element type
+
+	} //end switch (on element type)
+
+	return NUM_CARDS;
+
+} //end routine determineFirstCardIndex()
+
+
+inline ElementType determineCardElementType(
+	size_t card_index) //i - card index in [0, NUM_CARDS)
+{
+	if( card_index < determineFirstCardIndex(WEAPON) )
+	{
+		return PERSON;
+	}
+	else if( card_index < determineFirstCardIndex(ROOM) )
+	{
+		return WEAPON;
+	}
+
+	return ROOM;
+
+} //end routine determineCardElementType()
+
+
+/// \note subtype of card within its element type (person, weapon, room enum)
+inline int determineCardSubtype(
+	size_t card_index) //i - card index in [0, NUM_CARDS)
+{
+	ElementType elmt_type( determineCardElementType(card_index) );
+
+	return( int(card_index - determineFirstCardIndex(elmt_type)) + 1 );
+
+} //end routine determineCardSubtype()
+
+
 //------------------------------------------------------------------------------
 // Translation from Type to Text
 //------------------------------------------------------------------------------
@@ -156,7 +240,7 @@ static size_t getNumElementSubtypes(
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
-static std::string
+inline std::string
 translateElementTypeToText(
 	ElementType elmt_type) //i - type to translate
 {
@@ -191,7 +275,7 @@ translateElementTypeToText(
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
-static std::string
+inline std::string
 translatePersonTypeToText(
 	PersonType person_type) //i - type to translate
 {
@@ -239,7 +323,7 @@ translatePersonTypeToText(
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
-static std::string
+inline std::string
 translateWeaponTypeToText(
 	WeaponType wpn_type) //i - type to translate
 {
@@ -287,7 +371,7 @@ translateWeaponTypeToText(
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
-static std::string
+inline std::string
 translateRoomTypeToText(
 	RoomType room_type) //i - type to translate
 {
@@ -347,7 +431,7 @@ translateRoomTypeToText(
   /// \throw None
   /// \note  None
   ////////////////////////////////////////////////////////////////////////////////
-static std::string
+inline std::string
 translateTurnOptionTypeToText(
 	TurnOptionType option_type) //i - type to translate
 {
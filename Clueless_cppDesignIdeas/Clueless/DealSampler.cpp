@@ -0,0 +1,568 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file DealSampler.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  2000
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "DealSampler.h"
+
+#include "mersenneTwister.h"
+
+
+//------------------------------------------------------------------------------
+// Local Helpers
+//------------------------------------------------------------------------------
+/// \note bits per opponent slot in State::_roomLeft (hands hold at most 6)
+static const unsigned int ROOM_BITS = 3;
+static const unsigned int ROOM_MASK = (1u << ROOM_BITS) - 1;
+
+/// \note empty count slot (summary keys use at most 53 bits)
+static const unsigned long long NO_KEY = ~0ull;
+
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param DeductionMatrix: observer's deductions
+/// \param size_t: observer's holder index
+/// \param unsigned int: observer's hand (bit per card index)
+/// \return None
+/// \throw None
+/// \note
+/// - Counts consistent completions of every partial deal reachable, unless
+///   they outgrow MAX_NUM_STATES.
+////////////////////////////////////////////////////////////////////////////////
+DealSampler::DealSampler(
+	const DeductionMatrix& deductions, //i - observer's deductions
+	size_t observer, //i - observer's holder index
+	unsigned int observer_hand) //i - observer's hand
+	: _deductions( deductions )
+	, _observer( observer )
+	, _observerHand( observer_hand )
+	, _numCards( 0 )
+	, _numSlots( 0 )
+	, _isFeasible( true )
+	, _isExact( true )
+	, _numDeals( 0.0 )
+	, _keys()
+	, _counts()
+	, _numStates( 0 )
+{
+	_initialState._roomLeft = 0;
+	_initialState._satisfied = 0;
+	_initialState._hasCaseFileCard = false;
+
+	//holders dealt to: Case File, then opponents
+	size_t num_to_deal( 0 );
+	for(size_t holder(0); holder < DeductionMatrix::NUM_HOLDERS; ++holder)
+	{
+		if( (holder == observer) ||
+			(0 == deductions.getHandSize(holder)) )
+		{
+			continue; //next holder
+		}
+
+		if( DeductionMatrix::CASE_FILE != holder )
+		{
+			_initialState._roomLeft |= (unsigned int)deductions.getHandSize(holder) << (ROOM_BITS * (_numSlots - 1));
+		}
+
+		_slotHolders[_numSlots++] = holder;
+		num_to_deal += deductions.getHandSize(holder);
+	}
+
+	//unseen cards and who may hold each
+	for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+	{
+		if( 0 != (observer_hand & (1u << card_index)) )
+		{
+			continue; //next card
+		}
+
+		unsigned char slots( 0 );
+		for(size_t slot(0); slot < _numSlots; ++slot)
+		{
+			if( deductions.isPossibleHolder(card_index, _slotHolders[slot]) )
+			{
+				slots |= (unsigned char)(1u << slot);
+			}
+		}
+
+		_isFeasible = _isFeasible && (0 != slots);
+
+		_possibleSlots[_numCards] = slots;
+		_cards[_numCards++] = (unsigned char)card_index;
+	}
+
+	for(size_t position(0); position < _numCards; ++position)
+	{
+		_endsElementType[position] = (position + 1 == _numCards) ||
+			(clueless::determineCardElementType(_cards[position + 1]) !=
+			 clueless::determineCardElementType(_cards[position]));
+
+		_closedAt[position] = 0;
+		for(size_t slot(0); slot < _numSlots; ++slot)
+		{
+			_satisfiedBy[position][slot] = 0;
+		}
+	}
+
+	_isFeasible = _isFeasible && (num_to_deal == _numCards);
+
+	//pending "holds one of" constraints
+	size_t num_tracked( 0 );
+	for(size_t constraint(0); _isFeasible && (constraint < deductions.getNumHoldsOneOf()); ++constraint)
+	{
+		size_t holder( deductions.getHoldsOneOfHolder(constraint) );
+		unsigned int cards( deductions.getHoldsOneOfCards(constraint) );
+
+		if( holder == observer )
+		{
+			_isFeasible = (0 != (cards & observer_hand));
+			continue; //next constraint
+		}
+
+		if( MAX_NUM_TRACKED_CONSTRAINTS == num_tracked )
+		{
+			_isExact = false; //checked on finished deals instead
+			break;
+		}
+
+		size_t last_position( _numCards );
+		for(size_t position(0); position < _numCards; ++position)
+		{
+			for(size_t slot(0); slot < _numSlots; ++slot)
+			{
+				if( (_slotHolders[slot] == holder) &&
+					(0 != (cards & (1u << _cards[position]))) &&
+					(0 != (_possibleSlots[position] & (1u << slot))) )
+				{
+					_satisfiedBy[position][slot] |= (1u << num_tracked);
+					last_position = position;
+				}
+			}
+		}
+
+		if( _numCards == last_position ) //holder can hold none
+		{
+			_isFeasible = false;
+		}
+		else
+		{
+			_closedAt[last_position] |= (1u << num_tracked);
+			++num_tracked;
+		}
+
+	} //end for (each constraint)
+
+	if( ! _isFeasible )
+	{
+		_isExact = false;
+		return;
+	}
+
+	if( _isExact )
+	{
+		_keys.assign( MIN_TABLE_SIZE, NO_KEY );
+		_counts.assign( MIN_TABLE_SIZE, 0.0 );
+		_numDeals = count( 0, _initialState );
+
+		if( MAX_NUM_STATES < _numStates ) //abandoned partway
+		{
+			_isExact = false;
+			_numDeals = 0.0;
+			std::vector<unsigned long long>().swap( _keys );
+			std::vector<double>().swap( _counts );
+		}
+		else
+		{
+			_isFeasible = (0.0 < _numDeals);
+		}
+	}
+
+} //end routine extended constructor
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Draws one deal of unseen cards that agrees with notebook.
+/// \param MersenneTwister: random draws
+/// \param unsigned int[]: cards (bit per card index), per holder index;
+///  observer's hand included
+/// \return bool: whether deal drawn (never, if infeasible; sometimes, if not
+///  exact and backtracking gives up or misses an untracked constraint)
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+bool
+DealSampler::sample(
+	MersenneTwister& rng, //io- random draws
+	unsigned int cards_by_holder[DeductionMatrix::NUM_HOLDERS]) // o- deal
+const
+{
+	if( ! _isFeasible )
+	{
+		return false;
+	}
+
+	unsigned char slots[clueless::NUM_CARDS]; //chosen, per position
+
+	if( _isExact )
+	{
+		State state( _initialState );
+		for(size_t position(0); position < _numCards; ++position)
+		{
+			//completions through each slot
+			State children[DeductionMatrix::NUM_HOLDERS];
+			double weights[DeductionMatrix::NUM_HOLDERS];
+			double total( 0.0 );
+
+			for(size_t slot(0); slot < _numSlots; ++slot)
+			{
+				weights[slot] = 0.0;
+				children[slot] = state;
+
+				if( (0 != (_possibleSlots[position] & (1u << slot))) &&
+					place(position, slot, &children[slot]) )
+				{
+					weights[slot] = fetchCount( position + 1, children[slot] );
+					total += weights[slot];
+				}
+			}
+
+			double draw( rng.drawRes53() * total );
+			size_t chosen( _numSlots );
+			for(size_t slot(0); slot < _numSlots; ++slot)
+			{
+				if( 0.0 == weights[slot] )
+				{
+					continue; //next slot
+				}
+
+				chosen = slot; //last with completions, should rounding overshoot
+				if( draw < weights[slot] )
+				{
+					break;
+				}
+				draw -= weights[slot];
+			}
+
+			slots[position] = (unsigned char)chosen;
+			state = children[chosen];
+		}
+	}
+	else
+	{
+		size_t num_backtracks( 0 );
+		if( ! backtrack(0, _initialState, rng, &num_backtracks, slots) )
+		{
+			return false;
+		}
+	}
+
+	for(size_t holder(0); holder < DeductionMatrix::NUM_HOLDERS; ++holder)
+	{
+		cards_by_holder[holder] = 0;
+	}
+	cards_by_holder[_observer] = _observerHand;
+
+	for(size_t position(0); position < _numCards; ++position)
+	{
+		cards_by_holder[_slotHolders[slots[position]]] |= (1u << _cards[position]);
+	}
+
+	//untracked constraints
+	return( _isExact || _deductions.isConsistentWith(cards_by_holder) );
+
+} //end routine sample()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Places card at position with holder in slot.
+/// \param size_t: position of card among unseen cards
+/// \param size_t: slot of holder
+/// \param State: partial deal before and after
+/// \return bool: whether deal can still be completed consistently
+/// \throw None
+/// \note
+/// - Caller checks slot may hold card.
+/// - Constraints closed at position must be met, and the Case File must
+///   hold a card of each type once the type's last unseen card is placed.
+////////////////////////////////////////////////////////////////////////////////
+bool
+DealSampler::place(
+	size_t position, //i - position of card
+	size_t slot, //i - slot of holder
+	State* state) //io- partial deal
+const
+{
+	if( 0 == slot ) //Case File
+	{
+		if( state->_hasCaseFileCard )
+		{
+			return false;
+		}
+		state->_hasCaseFileCard = true;
+	}
+	else
+	{
+		unsigned int shift( ROOM_BITS * (unsigned int)(slot - 1) );
+		if( 0 == ((state->_roomLeft >> shift) & ROOM_MASK) )
+		{
+			return false;
+		}
+		state->_roomLeft -= (1u << shift);
+	}
+
+	state->_satisfied |= _satisfiedBy[position][slot];
+	if( _closedAt[position] != (state->_satisfied & _closedAt[position]) )
+	{
+		return false;
+	}
+	state->_satisfied &= ~_closedAt[position];
+
+	if( _endsElementType[position] )
+	{
+		if( ! state->_hasCaseFileCard )
+		{
+			return false;
+		}
+		state->_hasCaseFileCard = false;
+	}
+
+	return true;
+
+} //end routine place()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns key of partial deal summary.
+////////////////////////////////////////////////////////////////////////////////
+unsigned long long
+DealSampler::encode(
+	size_t position, //i - cards placed
+	const State& state) //i - partial deal
+const
+{
+	return( (unsigned long long)position |
+		((unsigned long long)(state._hasCaseFileCard ? 1 : 0) << 5) |
+		((unsigned long long)state._roomLeft << 6) |
+		((unsigned long long)state._satisfied << (6 + ROOM_BITS * (DeductionMatrix::NUM_HOLDERS - 2))) );
+
+} //end routine encode()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Counts consistent completions of partial deal, remembering counts
+///        of every partial deal reached.
+/// \param size_t: cards placed
+/// \param State: partial deal
+/// \return double: consistent completions
+/// \throw None
+/// \note
+/// - Stops counting (returns zero) once MAX_NUM_STATES summaries are held;
+///   constructor then abandons exact sampling.
+////////////////////////////////////////////////////////////////////////////////
+double
+DealSampler::count(
+	size_t position, //i - cards placed
+	const State& state) //i - partial deal
+{
+	if( _numCards == position )
+	{
+		return( (0 == state._roomLeft) ? 1.0 : 0.0 );
+	}
+
+	unsigned long long key( encode(position, state) );
+	size_t slot( findSlot(key) );
+	if( NO_KEY != _keys[slot] )
+	{
+		return _counts[slot];
+	}
+
+	if( MAX_NUM_STATES < _numStates )
+	{
+		return 0.0;
+	}
+
+	double num_completions( 0.0 );
+	for(size_t holder_slot(0); holder_slot < _numSlots; ++holder_slot)
+	{
+		State child( state );
+		if( (0 != (_possibleSlots[position] & (1u << holder_slot))) &&
+			place(position, holder_slot, &child) )
+		{
+			num_completions += count( position + 1, child );
+		}
+	}
+
+	storeCount( key, num_completions );
+
+	return num_completions;
+
+} //end routine count()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns completions of partial deal counted at construction.
+////////////////////////////////////////////////////////////////////////////////
+double
+DealSampler::fetchCount(
+	size_t position, //i - cards placed
+	const State& state) //i - partial deal
+const
+{
+	if( _numCards == position )
+	{
+		return( (0 == state._roomLeft) ? 1.0 : 0.0 );
+	}
+
+	size_t slot( findSlot(encode(position, state)) );
+
+	return( (NO_KEY != _keys[slot]) ? _counts[slot] : 0.0 );
+
+} //end routine fetchCount()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns table slot holding key, or empty slot where it belongs.
+/// \param unsigned long long: summary key
+/// \return size_t: table slot
+/// \throw None
+/// \note
+/// - Fibonacci hashing, then linear probing; table never full.
+////////////////////////////////////////////////////////////////////////////////
+size_t
+DealSampler::findSlot(
+	unsigned long long key) //i - summary key
+const
+{
+	size_t mask( _keys.size() - 1 );
+	size_t slot( (size_t)((key * 0x9E3779B97F4A7C15ull) >> 32) & mask );
+
+	while( (NO_KEY != _keys[slot]) &&
+		(key != _keys[slot]) )
+	{
+		slot = (slot + 1) & mask;
+	}
+
+	return slot;
+
+} //end routine findSlot()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Records completions of partial deal not yet in table.
+/// \param unsigned long long: summary key
+/// \param double: consistent completions
+/// \return None
+/// \throw None
+/// \note
+/// - Table doubled (and rehashed) before it is half full.
+////////////////////////////////////////////////////////////////////////////////
+void
+DealSampler::storeCount(
+	unsigned long long key, //i - summary key
+	double num_completions) //i - consistent completions
+{
+	if( 2 * (_numStates + 1) > _keys.size() )
+	{
+		std::vector<unsigned long long> old_keys( 2 * _keys.size(), NO_KEY );
+		std::vector<double> old_counts( 2 * _counts.size(), 0.0 );
+		old_keys.swap( _keys );
+		old_counts.swap( _counts );
+
+		for(size_t old_slot(0); old_slot < old_keys.size(); ++old_slot)
+		{
+			if( NO_KEY != old_keys[old_slot] )
+			{
+				size_t slot( findSlot(old_keys[old_slot]) );
+				_keys[slot] = old_keys[old_slot];
+				_counts[slot] = old_counts[old_slot];
+			}
+		}
+	}
+
+	size_t slot( findSlot(key) );
+	_keys[slot] = key;
+	_counts[slot] = num_completions;
+	++_numStates;
+
+} //end routine storeCount()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Places remaining cards by depth-first search, trying holders in
+///        random order.
+/// \param size_t: cards placed
+/// \param State: partial deal
+/// \param MersenneTwister: random draws
+/// \param size_t: dead ends met so far, over whole search
+/// \param unsigned char[]: slot chosen, per position
+/// \return bool: whether deal completed
+/// \throw None
+/// \note
+/// - Gives up after MAX_NUM_BACKTRACKS dead ends.
+/// - Constraints beyond MAX_NUM_TRACKED_CONSTRAINTS are not tracked by
+///   place(); sample() checks finished deals against them.
+////////////////////////////////////////////////////////////////////////////////
+bool
+DealSampler::backtrack(
+	size_t position, //i - cards placed
+	const State& state, //i - partial deal
+	MersenneTwister& rng, //io- random draws
+	size_t* num_backtracks, //io- dead ends met
+	unsigned char slots[]) // o- slot chosen, per position
+const
+{
+	if( _numCards == position )
+	{
+		return( 0 == state._roomLeft );
+	}
+
+	size_t order[DeductionMatrix::NUM_HOLDERS];
+	size_t num_candidates( 0 );
+	for(size_t slot(0); slot < _numSlots; ++slot)
+	{
+		if( 0 != (_possibleSlots[position] & (1u << slot)) )
+		{
+			order[num_candidates++] = slot;
+		}
+	}
+
+	while( (0 < num_candidates) &&
+		(MAX_NUM_BACKTRACKS > *num_backtracks) )
+	{
+		size_t pick( rng.drawUniformInt(num_candidates) );
+		size_t slot( order[pick] );
+		order[pick] = order[--num_candidates];
+
+		State child( state );
+		if( place(position, slot, &child) )
+		{
+			slots[position] = (unsigned char)slot;
+			if( backtrack(position + 1, child, rng, num_backtracks, slots) )
+			{
+				return true;
+			}
+		}
+
+		++(*num_backtracks);
+	}
+
+	return false;
+
+} //end routine backtrack()
@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file DealSampler.h
+/// \brief Draws complete deals of the cards a player cannot see (opponents'
+///        hands, Case File) that agree with everything in the player's
+///        notebook.
+///
+/// \date   17 Oct 2026  2000
+///
+/// \note
+/// - Uniform over consistent deals, without rejection: construction counts
+///   the consistent completions of every partial deal reached (unseen cards
+///   placed in card index order), and each sample places card after card
+///   with odds proportional to those counts.  Every sample is consistent.
+/// - A partial deal is summed up by the room left in each opponent's hand,
+///   whether the Case File holds a card of the current element type yet,
+///   and which pending "holds one of" constraints are already met; counts
+///   are kept per summary in a flat hash table, so construction is paid
+///   once per notebook state and samples cost one count lookup per card
+///   and candidate holder, with no allocation.
+/// - When the summaries outgrow MAX_NUM_STATES (or constraints outnumber
+///   MAX_NUM_TRACKED_CONSTRAINTS), samples come from randomized
+///   backtracking instead: still consistent, no longer exactly uniform.
+/// - Read-only once constructed; one sampler may be shared by many threads.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DealSampler_h
+#define DealSampler_h
+
+#include "DeductionMatrix.h"
+
+#include "CluelessEnums.h"	//for NUM_CARDS use
+
+#include <stddef.h>		//for size_t use
+#include <vector>		//for std::vector use
+
+
+//forward declarations
+class MersenneTwister;
+
+
+class DealSampler
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const size_t MAX_NUM_TRACKED_CONSTRAINTS = 32; //pending constraints counted exactly
+	static const size_t MAX_NUM_STATES = 1 << 18; //partial-deal summaries counted
+	static const size_t MAX_NUM_BACKTRACKS = 4096; //per sample, when not exact
+
+	static const size_t MIN_TABLE_SIZE = 1024; //count slots, power of two
+
+	//--------------------------------------------------------------------------
+	// Class-Scoped Types
+	//--------------------------------------------------------------------------
+protected:
+	/// \brief Summary of a partial deal.
+	struct State
+	{
+		unsigned int _roomLeft;  //3 bits per opponent slot (slot 1 lowest)
+		unsigned int _satisfied; //bit per tracked constraint met so far
+		bool _hasCaseFileCard;   //of current element type
+
+	}; //end struct State defn
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	DealSampler();
+
+public:
+	DealSampler(const DeductionMatrix& deductions,
+		size_t observer,
+		unsigned int observerHand);
+
+	virtual ~DealSampler()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	bool isFeasible() const;
+	bool isExact() const;
+	double getNumDeals() const;
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	bool sample(MersenneTwister& rng,
+		unsigned int cardsByHolder[DeductionMatrix::NUM_HOLDERS]) const;
+
+protected:
+	bool place(size_t position, size_t slot, State* state) const;
+	unsigned long long encode(size_t position, const State& state) const;
+
+	double count(size_t position, const State& state);
+	double fetchCount(size_t position, const State& state) const;
+
+	size_t findSlot(unsigned long long key) const;
+	void storeCount(unsigned long long key, double numCompletions);
+
+	bool backtrack(size_t position,
+		const State& state,
+		MersenneTwister& rng,
+		size_t* numBacktracks,
+		unsigned char slots[]) const;
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	DeductionMatrix _deductions; //observer's, as of construction
+	size_t _observer;          //holder index of player who cannot see
+	unsigned int _observerHand; //bit per card index
+
+	/// \note unseen cards, in card index order
+	unsigned char _cards[clueless::NUM_CARDS];
+	size_t _numCards;
+
+	/// \note slot 0 is the Case File; opponents follow
+	size_t _slotHolders[DeductionMatrix::NUM_HOLDERS];
+	size_t _numSlots;
+
+	unsigned char _possibleSlots[clueless::NUM_CARDS]; //bit per slot, per position
+	bool _endsElementType[clueless::NUM_CARDS];        //last unseen card of its type, per position
+
+	/// \note tracked constraints met by card at position going to slot
+	unsigned int _satisfiedBy[clueless::NUM_CARDS][DeductionMatrix::NUM_HOLDERS];
+	unsigned int _closedAt[clueless::NUM_CARDS]; //tracked constraints with no card after position
+
+	State _initialState;
+
+	bool _isFeasible;
+	bool _isExact;
+	double _numDeals; //consistent deals; exact only
+
+	/// \note open addressing, linear probing; at most half full
+	std::vector<unsigned long long> _keys; //summary key, or NO_KEY
+	std::vector<double> _counts;           //completions, per summary
+	size_t _numStates;
+
+}; //end class DealSampler defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns whether any deal agrees with notebook.
+////////////////////////////////////////////////////////////////////////////////
+inline bool
+DealSampler::isFeasible()
+const
+{
+	return _isFeasible;
+
+} //end routine isFeasible()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns whether samples are exactly uniform.
+////////////////////////////////////////////////////////////////////////////////
+inline bool
+DealSampler::isExact()
+const
+{
+	return _isExact;
+
+} //end routine isExact()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline double
+DealSampler::getNumDeals()
+const
+{
+	return _numDeals;
+
+} //end routine getNumDeals()
+
+
+#endif //DealSampler_h defn
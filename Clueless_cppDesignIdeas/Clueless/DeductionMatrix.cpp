@@ -0,0 +1,465 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file DeductionMatrix.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  1310
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "DeductionMatrix.h"
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Default constructor
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - Every card starts as possibly in the Case File; players add themselves
+///   as possible holders of every card via addPlayer().
+////////////////////////////////////////////////////////////////////////////////
+DeductionMatrix::DeductionMatrix()
+	: _players( 0 )
+	, _handSize()
+	, _holdsOneOfCards()
+	, _holdsOneOfHolder()
+	, _numHoldsOneOf( 0 )
+{
+	for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+	{
+		_possibleHolders[card_index] = (1u << CASE_FILE);
+	}
+
+	_handSize[CASE_FILE] = 3; //one card per element type
+
+} //end routine constructor
+
+
+//------------------------------------------------------------------------------
+// Accessors and Mutators
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Adds player as possible holder of every card.
+/// \param PersonType: player's character
+/// \param size_t: number of cards in player's hand
+/// \return None
+/// \throw None
+/// \note
+/// - Add every player before recording anything about cards.
+////////////////////////////////////////////////////////////////////////////////
+void
+DeductionMatrix::addPlayer(
+	clueless::PersonType character, //i - player's character
+	size_t hand_size) //i - number of cards in player's hand
+{
+	size_t holder( character );
+
+	_players |= (1u << holder);
+	_handSize[holder] = hand_size;
+
+	for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+	{
+		_possibleHolders[card_index] |= (1u << holder);
+	}
+
+} //end routine addPlayer()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns holder of card, if known.
+/// \param size_t: card of interest (card index)
+/// \return size_t: holder index; UNKNOWN_HOLDER if more than one possible
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+size_t
+DeductionMatrix::findHolder(
+	size_t card_index) //i - card of interest
+const
+{
+	for(size_t holder(0); holder < NUM_HOLDERS; ++holder)
+	{
+		if( isKnownHolder(card_index, holder) )
+		{
+			return holder;
+		}
+	}
+
+	return UNKNOWN_HOLDER;
+
+} //end routine findHolder()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns whether a complete deal agrees with everything recorded.
+/// \param unsigned int[]: cards (bit per card index), per holder index
+/// \return bool: whether deal is consistent
+/// \throw None
+/// \note
+/// - Every card held by a possible holder, every hand (and the Case File)
+///   the right size, and every "holds one of" constraint met.
+/// - Holders not in game must hold nothing.
+////////////////////////////////////////////////////////////////////////////////
+bool
+DeductionMatrix::isConsistentWith(
+	const unsigned int cards_by_holder[NUM_HOLDERS]) //i - deal, per holder
+const
+{
+	for(size_t holder(0); holder < NUM_HOLDERS; ++holder)
+	{
+		unsigned int cards( cards_by_holder[holder] );
+
+		size_t num_cards( 0 );
+		for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+		{
+			if( 0 != (cards & (1u << card_index)) )
+			{
+				if( ! isPossibleHolder(card_index, holder) )
+				{
+					return false;
+				}
+
+				++num_cards;
+			}
+		}
+
+		bool is_in_game( (CASE_FILE == holder) || (0 != (_players & (1u << holder))) );
+		if( num_cards != (is_in_game ? _handSize[holder] : 0) )
+		{
+			return false;
+		}
+
+	} //end for (each holder)
+
+	for(size_t constraint(0); constraint < _numHoldsOneOf; ++constraint)
+	{
+		if( 0 == (cards_by_holder[_holdsOneOfHolder[constraint]] & _holdsOneOfCards[constraint]) )
+		{
+			return false;
+		}
+	}
+
+	return true;
+
+} //end routine isConsistentWith()
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Records that holder is known to hold card.
+/// \param size_t: card (card index)
+/// \param size_t: holder index
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+DeductionMatrix::recordCardHeld(
+	size_t card_index, //i - card
+	size_t holder) //i - holder of card
+{
+	_possibleHolders[card_index] = (unsigned char)(1u << holder);
+
+} //end routine recordCardHeld()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Records that holder is known not to hold card.
+/// \param size_t: card (card index)
+/// \param size_t: holder index
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+DeductionMatrix::recordCardNotHeld(
+	size_t card_index, //i - card
+	size_t holder) //i - holder without card
+{
+	_possibleHolders[card_index] &= (unsigned char)~(1u << holder);
+
+} //end routine recordCardNotHeld()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Records that holder holds at least one of specified cards.
+/// \param size_t: holder index
+/// \param unsigned int: cards (bit per card index)
+/// \return None
+/// \throw None
+/// \note
+/// - Constraints resolve (and are discarded) as propagation learns more.
+///   When too many are pending, new constraint is dropped; that loses
+///   information but never leads to a wrong deduction.
+////////////////////////////////////////////////////////////////////////////////
+void
+DeductionMatrix::recordHoldsOneOf(
+	size_t holder, //i - holder
+	unsigned int card_mask) //i - cards, at least one held
+{
+	if( MAX_NUM_HOLDS_ONE_OF > _numHoldsOneOf )
+	{
+		_holdsOneOfCards[_numHoldsOneOf] = card_mask;
+		_holdsOneOfHolder[_numHoldsOneOf] = (unsigned char)holder;
+		++_numHoldsOneOf;
+	}
+
+} //end routine recordHoldsOneOf()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Applies deduction rules until nothing more can be learned.
+/// \param None
+/// \return bool: whether anything was learned
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+bool
+DeductionMatrix::propagate()
+{
+	bool has_learned( false );
+	bool has_changed( true );
+
+	//while previous pass learned something
+	while( has_changed )
+	{
+		has_changed = false;
+
+		has_changed |= applyCaseFileRule();
+		has_changed |= applyHandSizeRule();
+		has_changed |= applyHoldsOneOfRule();
+
+		has_learned |= has_changed;
+
+	} //end while (previous pass learned something)
+
+	return has_learned;
+
+} //end routine propagate()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Case File holds exactly one card of each element type.
+/// \param None
+/// \return bool: whether anything was learned
+/// \throw None
+/// \note
+/// - Once the Case File card of a type is known, no other card of that type
+///   is in the Case File; if only one card of a type could be in the Case
+///   File, it is.
+////////////////////////////////////////////////////////////////////////////////
+bool
+DeductionMatrix::applyCaseFileRule()
+{
+	bool has_changed( false );
+
+	const clueless::ElementType ELEMENT_TYPES[] = { clueless::PERSON, clueless::WEAPON, clueless::ROOM };
+
+	for(size_t type_index(0); type_index < 3; ++type_index)
+	{
+		clueless::ElementType elmt_type( ELEMENT_TYPES[type_index] );
+		size_t first_card( clueless::determineFirstCardIndex(elmt_type) );
+		size_t end_card( first_card + clueless::getNumElementSubtypes(elmt_type) );
+
+		size_t known_card( clueless::NUM_CARDS );
+		size_t possible_card( clueless::NUM_CARDS );
+		size_t num_possible( 0 );
+
+		for(size_t card_index(first_card); card_index < end_card; ++card_index)
+		{
+			if( isKnownHolder(card_index, CASE_FILE) )
+			{
+				known_card = card_index;
+			}
+
+			if( isPossibleHolder(card_index, CASE_FILE) )
+			{
+				possible_card = card_index;
+				++num_possible;
+			}
+		}
+
+		if( clueless::NUM_CARDS != known_card ) //Case File card known
+		{
+			//no other card of type in Case File
+			for(size_t card_index(first_card); card_index < end_card; ++card_index)
+			{
+				if( (known_card != card_index) &&
+					isPossibleHolder(card_index, CASE_FILE) )
+				{
+					recordCardNotHeld(card_index, CASE_FILE);
+					has_changed = true;
+				}
+			}
+		}
+		else if( 1 == num_possible ) //only one candidate
+		{
+			recordCardHeld(possible_card, CASE_FILE);
+			has_changed = true;
+		}
+
+	} //end for (each element type)
+
+	return has_changed;
+
+} //end routine applyCaseFileRule()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Each player holds exactly as many cards as were dealt to them.
+/// \param None
+/// \return bool: whether anything was learned
+/// \throw None
+/// \note
+/// - Once all of a player's cards are known, player holds no other card; if
+///   player could hold only as many cards as they were dealt, they hold all
+///   of them.
+////////////////////////////////////////////////////////////////////////////////
+bool
+DeductionMatrix::applyHandSizeRule()
+{
+	bool has_changed( false );
+
+	for(size_t holder(CASE_FILE + 1); holder < NUM_HOLDERS; ++holder)
+	{
+		if( 0 == (_players & (1u << holder)) )
+		{
+			continue; //not in game
+		}
+
+		size_t num_known( 0 );
+		size_t num_possible( 0 );
+
+		for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+		{
+			if( isKnownHolder(card_index, holder) )
+			{
+				++num_known;
+			}
+
+			if( isPossibleHolder(card_index, holder) )
+			{
+				++num_possible;
+			}
+		}
+
+		if( num_possible == num_known )
+		{
+			continue; //nothing undecided for player
+		}
+
+		if( _handSize[holder] == num_known ) //whole hand known
+		{
+			for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+			{
+				if( ! isKnownHolder(card_index, holder) )
+				{
+					recordCardNotHeld(card_index, holder);
+				}
+			}
+			has_changed = true;
+		}
+		else if( _handSize[holder] == num_possible ) //every candidate held
+		{
+			for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+			{
+				if( isPossibleHolder(card_index, holder) )
+				{
+					recordCardHeld(card_index, holder);
+				}
+			}
+			has_changed = true;
+		}
+
+	} //end for (each player)
+
+	return has_changed;
+
+} //end routine applyHandSizeRule()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Resolves "holds at least one of" constraints.
+/// \param None
+/// \return bool: whether anything was learned
+/// \throw None
+/// \note
+/// - Cards holder cannot hold drop out of constraint.  Constraint is done
+///   once holder is known to hold one of its cards, or down to one card
+///   (which holder must then hold).
+////////////////////////////////////////////////////////////////////////////////
+bool
+DeductionMatrix::applyHoldsOneOfRule()
+{
+	bool has_changed( false );
+
+	size_t constraint_index( 0 );
+	while( constraint_index < _numHoldsOneOf )
+	{
+		size_t holder( _holdsOneOfHolder[constraint_index] );
+		unsigned int remaining( 0 );
+		bool is_satisfied( false );
+
+		for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+		{
+			if( 0 == (_holdsOneOfCards[constraint_index] & (1u << card_index)) )
+			{
+				continue; //not in constraint
+			}
+
+			if( isKnownHolder(card_index, holder) )
+			{
+				is_satisfied = true;
+			}
+			else if( isPossibleHolder(card_index, holder) )
+			{
+				remaining |= (1u << card_index);
+			}
+		}
+
+		//if exactly one candidate left
+		if( ! is_satisfied &&
+			(0 != remaining) &&
+			(0 == (remaining & (remaining - 1))) )
+		{
+			size_t card_index( 0 );
+			while( 0 == (remaining & (1u << card_index)) )
+			{
+				++card_index;
+			}
+
+			recordCardHeld(card_index, holder);
+			has_changed = true;
+			is_satisfied = true;
+		}
+
+		//if resolved (or contradicted)
+		if( is_satisfied || (0 == remaining) )
+		{
+			//replace with last constraint
+			--_numHoldsOneOf;
+			_holdsOneOfCards[constraint_index] = _holdsOneOfCards[_numHoldsOneOf];
+			_holdsOneOfHolder[constraint_index] = _holdsOneOfHolder[_numHoldsOneOf];
+		}
+		else
+		{
+			_holdsOneOfCards[constraint_index] = remaining;
+			++constraint_index; //next constraint
+		}
+
+	} //end while (more constraints)
+
+	return has_changed;
+
+} //end routine applyHoldsOneOfRule()
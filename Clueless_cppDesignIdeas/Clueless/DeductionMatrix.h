@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file DeductionMatrix.h
+/// \brief Tracks which holders (players, Case File) could hold each card and
+///        propagates what is learned to a fixpoint.
+///
+/// \date   17 Oct 2026  1300
+///
+/// \note
+/// - Holder indices: 0 is the Case File; each player is the value of their
+///   character's PersonType (1-6).  Possible holders of a card are a bitmask
+///   over holder indices.
+/// - Plain arrays only and no virtual members, so a matrix is trivially
+///   copyable and may be embedded in a GameState.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DeductionMatrix_h
+#define DeductionMatrix_h
+
+#include "CluelessEnums.h"	//for NUM_CARDS, PersonType use
+
+#include <stddef.h>		//for size_t use
+
+
+class DeductionMatrix
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const size_t CASE_FILE = 0; //holder index of Case File
+	static const size_t NUM_HOLDERS = 1 + clueless::PROFESSOR_PLUM; //Case File + one per character
+	static const size_t UNKNOWN_HOLDER = NUM_HOLDERS;
+
+	static const size_t MAX_NUM_HOLDS_ONE_OF = 64; //pending "holds one of" constraints
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+public:
+	DeductionMatrix();
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	void addPlayer(clueless::PersonType character, size_t handSize);
+
+	bool isPossibleHolder(size_t cardIndex, size_t holder) const;
+	unsigned int getPossibleHolders(size_t cardIndex) const;
+	size_t findHolder(size_t cardIndex) const;
+	size_t getHandSize(size_t holder) const;
+
+	size_t getNumHoldsOneOf() const;
+	size_t getHoldsOneOfHolder(size_t constraint) const;
+	unsigned int getHoldsOneOfCards(size_t constraint) const;
+
+	bool isConsistentWith(const unsigned int cardsByHolder[NUM_HOLDERS]) const;
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	void recordCardHeld(size_t cardIndex, size_t holder);
+	void recordCardNotHeld(size_t cardIndex, size_t holder);
+	void recordHoldsOneOf(size_t holder, unsigned int cardMask);
+
+	bool propagate();
+
+protected:
+	bool applyCaseFileRule();
+	bool applyHandSizeRule();
+	bool applyHoldsOneOfRule();
+
+	bool isKnownHolder(size_t cardIndex, size_t holder) const;
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	unsigned char _possibleHolders[clueless::NUM_CARDS]; //bit (1 << holder) per possible holder
+	unsigned char _players; //bit (1 << holder) per player in game
+
+	size_t _handSize[NUM_HOLDERS]; //cards held, per holder
+
+	/// \note holder holds at least one card of mask (bit per card index)
+	unsigned int _holdsOneOfCards[MAX_NUM_HOLDS_ONE_OF];
+	unsigned char _holdsOneOfHolder[MAX_NUM_HOLDS_ONE_OF];
+	size_t _numHoldsOneOf;
+
+}; //end class DeductionMatrix defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline bool
+DeductionMatrix::isPossibleHolder(
+	size_t card_index, //i - card of interest
+	size_t holder) //i - holder of interest
+const
+{
+	return( 0 != (_possibleHolders[card_index] & (1u << holder)) );
+
+} //end routine isPossibleHolder()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns bit (1 << holder) per possible holder of card.
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned int
+DeductionMatrix::getPossibleHolders(
+	size_t card_index) //i - card of interest
+const
+{
+	return _possibleHolders[card_index];
+
+} //end routine getPossibleHolders()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+DeductionMatrix::getHandSize(
+	size_t holder) //i - holder of interest
+const
+{
+	return _handSize[holder];
+
+} //end routine getHandSize()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns number of "holds one of" constraints not yet resolved.
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+DeductionMatrix::getNumHoldsOneOf()
+const
+{
+	return _numHoldsOneOf;
+
+} //end routine getNumHoldsOneOf()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+DeductionMatrix::getHoldsOneOfHolder(
+	size_t constraint) //i - unresolved constraint of interest
+const
+{
+	return _holdsOneOfHolder[constraint];
+
+} //end routine getHoldsOneOfHolder()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned int
+DeductionMatrix::getHoldsOneOfCards(
+	size_t constraint) //i - unresolved constraint of interest
+const
+{
+	return _holdsOneOfCards[constraint];
+
+} //end routine getHoldsOneOfCards()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline bool
+DeductionMatrix::isKnownHolder(
+	size_t card_index, //i - card of interest
+	size_t holder) //i - holder of interest
+const
+{
+	return( (1u << holder) == _possibleHolders[card_index] );
+
+} //end routine isKnownHolder()
+
+
+#endif //DeductionMatrix_h defn
@@ -25,6 +25,7 @@
 #include "mersenneTwister.h"
 
 #include <algorithm>		//for std::min use
+#include <cmath>			//for std::fabs use
 #include <limits.h>			//for UINT_MAX use
 #include <sstream>			//for std::ostringstream use
 #include <stdexcept>		//for std::logic_error use
@@ -38,10 +39,21 @@
 ////////////////////////////////////////////////////////////////////////////////
 DetectiveNotebook::DetectiveNotebook()
 	: _ownerCharacter( clueless::UNKNOWN_PERSON )
+	, _seenCards( 0 )
+	, _cardsInHand( 0 )
+	, _numEntries()
+	, _deductions()
+	, _hypotheses()
+	, _areHypothesesCurrent( true )
+	, _numSeats( 0 )
 	, _suspectedPerson( clueless::UNKNOWN_PERSON )
 	, _suspectedWeapon( clueless::UNKNOWN_WEAPON )
 	, _suspectedRoom( clueless::UNKNOWN_ROOM )
+	, _roomsInHand( 0 )
+	, _roomsNeedingQuestioning( 0 )
 	, _nextRoomDestination( clueless::UNKNOWN_ROOM )
+	, _assocBoard( nullptr )
+	, _rng( nullptr )
 {
 	initializeRoomsNeedingQuestioning();
 
@@ -58,10 +70,21 @@ DetectiveNotebook::DetectiveNotebook()
 DetectiveNotebook::DetectiveNotebook(
 	clueless::PersonType owner_character) //i - owner's character
 	: _ownerCharacter( owner_character )
+	, _seenCards( 0 )
+	, _cardsInHand( 0 )
+	, _numEntries()
+	, _deductions()
+	, _hypotheses()
+	, _areHypothesesCurrent( true )
+	, _numSeats( 0 )
 	, _suspectedPerson( clueless::UNKNOWN_PERSON )
 	, _suspectedWeapon( clueless::UNKNOWN_WEAPON )
 	, _suspectedRoom( clueless::UNKNOWN_ROOM )
+	, _roomsInHand( 0 )
+	, _roomsNeedingQuestioning( 0 )
 	, _nextRoomDestination( clueless::UNKNOWN_ROOM )
+	, _assocBoard( nullptr )
+	, _rng( nullptr )
 {
 	initializeRoomsNeedingQuestioning();
 
@@ -73,28 +96,7 @@ DetectiveNotebook::DetectiveNotebook(
 ////////////////////////////////////////////////////////////////////////////////
 DetectiveNotebook::~DetectiveNotebook()
 {
-	//--------------------------------------------------------------------------
-	// notebook clean up
-	//--------------------------------------------------------------------------
-	std::map<clueless::ElementType, std::set<NotebookEntry*>>::iterator page_iter( _notebook.begin() );
-	std::set<NotebookEntry*>::iterator entry_iter( page_iter->second.begin() );
-
-	//while more element type pages
-	while( _notebook.end() != page_iter )
-	{
-		for(entry_iter  = page_iter->second.begin();
-			entry_iter != page_iter->second.end();
-			++entry_iter)
-		{
-			delete *entry_iter; //notebook entry object
-		}
-		page_iter->second.clear();
-
-		++page_iter; //next page
-
-	} //end while (more element type pages)
-
-	_notebook.clear();
+	//entries held by value; cards owned by CardDeck
 
 } //end routine destructor
 
@@ -109,16 +111,16 @@ DetectiveNotebook::~DetectiveNotebook()
 void
 DetectiveNotebook::initializeRoomsNeedingQuestioning()
 {
-	size_t room_index( clueless::UNKNOWN_ROOM + 1 );
+	_roomsNeedingQuestioning = 0;
 
-	//while more entries to consider
-	for(room_index  = (clueless::RoomType)(clueless::UNKNOWN_ROOM + 1);
+	//for each room
+	for(size_t room_index( clueless::UNKNOWN_ROOM + 1 );
 		room_index <= clueless::getNumRoomTypes();
 		++room_index)
 	{
-		_roomsNeedingQuestioning.insert( (clueless::RoomType)room_index );
+		_roomsNeedingQuestioning |= (1u << room_index);
 
-	} //end while (more entries)
+	} //end for (each room)
 
 } //end routine initializeRoomsNeedingQuestioning()
 
@@ -150,132 +152,58 @@ DetectiveNotebook::setBoard(
 } //end routine setBoard()
 
 
+////////////////////////////////////////////////////////////////////////////////
+void
+DetectiveNotebook::setRandomNumberGenerator(
+	MersenneTwister* rng) //i - random number generator of owning game
+{
+	_rng = rng;
+
+} //end routine setRandomNumberGenerator()
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Returns reference to entry associated with card.  Null if no entry.
 /// \param Card: card of interest
 /// \return NotebookEntry: associated entry
-/// \throw None
-/// \note  None
+/// \throw
+/// - INCONSISTENT_DATA when card of unknown element type.
+/// \note
+/// - Constant time: entries are indexed by card index.
 ////////////////////////////////////////////////////////////////////////////////
-NotebookEntry*
+const NotebookEntry*
 DetectiveNotebook::fetchNotebookEntry(
-	const Card* card)
+	const Card* card) //i - card of interest
 const
 {
-	std::map<clueless::ElementType, std::set<NotebookEntry*>>::const_iterator book_iter( _notebook.begin() );
-	std::set<NotebookEntry*>::const_iterator entry_iter;
-	NotebookEntry* entry( nullptr );
+	size_t card_index( card->getIndex() );
 
-	switch( card->_type )
+	if( clueless::NUM_CARDS <= card_index )
 	{
-	case clueless::PERSON:
-	{
-		book_iter = _notebook.find( clueless::PERSON );
-		if( _notebook.end() != book_iter )
-		{
-			entry_iter = book_iter->second.begin();
-
-			clueless::PersonType entry_person( clueless::UNKNOWN_PERSON );
-			clueless::PersonType card_person( ((const PersonCard*)card)->_person );
-
-			//while have not found entry  AND
-			//      more entries of elmt type in book
-			while( ! entry &&
-				(entry_iter != book_iter->second.end()) )
-			{
-				entry_person = ((PersonNotebookEntry*)(*entry_iter))->_person;
-
-				//if entry matches card
-				if( entry_person == card_person )
-				{
-					//found entry for card
-					entry = *entry_iter;
-				}
-				else
-				{
-					++entry_iter; //next entry of elmt type
-				}
-
-			} //end while (have not found and more entries)
-		} //end if (person entries in notebook)
+		std::ostringstream msg;
+		msg << "DetectiveNotebook::fetchNotebookEntry()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  unknown notebook entry type";
+		throw std::logic_error( msg.str().c_str() );
 	}
-		break;
 
-	case clueless::WEAPON:
+	if( ! isCardSeen(card_index) )
 	{
-		book_iter = _notebook.find( clueless::WEAPON );
-		if( _notebook.end() != book_iter )
-		{
-			entry_iter = book_iter->second.begin();
-
-			clueless::WeaponType entry_wpn( clueless::UNKNOWN_WEAPON );
-			clueless::WeaponType card_wpn( ((const WeaponCard*)card)->_weapon );
-
-			//while have not found entry  AND
-			//      more entries of elmt type in book
-			while( ! entry &&
-				(entry_iter != book_iter->second.end()) )
-			{
-				entry_wpn = ((WeaponNotebookEntry*)(*entry_iter))->_weapon;
-
-				//if entry matches card
-				if( entry_wpn == card_wpn )
-				{
-					//found entry for card
-					entry = *entry_iter;
-				}
-				else
-				{
-					++entry_iter; //next entry of elmt type
-				}
-
-			} //end while (have not found and more entries)
-		} //end if (weapon entries in notebook)
+		return nullptr; //not found
 	}
-	break;
-
-	case clueless::ROOM:
-	{
-		book_iter = _notebook.find( clueless::ROOM );
-		if( _notebook.end() != book_iter )
-		{
-			entry_iter = book_iter->second.begin();
-
-			clueless::RoomType entry_room( clueless::UNKNOWN_ROOM );
-			clueless::RoomType card_room( ((const RoomCard*)card)->_room );
 
-			//while have not found entry  AND
-			//      more entries of elmt type in book
-			while( ! entry &&
-				(entry_iter != book_iter->second.end()) )
-			{
-				entry_room = ((RoomNotebookEntry*)(*entry_iter))->_room;
+	return &(_entries[card_index]);
 
-				//if entry matches card
-				if( entry_room == card_room )
-				{
-					//found entry for card
-					entry = *entry_iter;
-				}
-				else
-				{
-					++entry_iter; //next entry of elmt type
-				}
+} //end routine fetchNotebookEntry()
 
-			} //end while (have not found and more entries)
-		} //end if (room entries in notebook)
-	}
-	break;
 
-	default:
-		std::ostringstream msg;
-		msg << "DetectiveNotebook::fetchNotebookEntry()\n"
-			<< "  INCONSISTENT_DATA\n"
-			<< "  unknown notebook entry type";
-		throw std::logic_error( msg.str().c_str() );
-	}
-
-	return entry; //not found
+////////////////////////////////////////////////////////////////////////////////
+NotebookEntry*
+DetectiveNotebook::fetchNotebookEntry(
+	const Card* card) //i - card of interest
+{
+	return const_cast<NotebookEntry*>(
+		static_cast<const DetectiveNotebook*>(this)->fetchNotebookEntry(card) );
 
 } //end routine fetchNotebookEntry()
 
@@ -291,14 +219,7 @@ void
 DetectiveNotebook::noteRoomQuestionHasBeenAnswered(
 	clueless::RoomType room) //i - room visited
 {
-	std::set<clueless::RoomType>::iterator room_iter(
-		_roomsNeedingQuestioning.find(room) );
-
-	//if previously unvisited
-	if( _roomsNeedingQuestioning.end() != room_iter )
-	{
-		_roomsNeedingQuestioning.erase(room_iter);
-	}
+	_roomsNeedingQuestioning &= ~(1u << room);
 
 } //end routine noteRoomQuestionHasBeenAnswered()
 
@@ -318,29 +239,8 @@ DetectiveNotebook::haveCounterEvidenceForRoom(
 	const Room* room) //i - room
 const
 {
-	bool have_counter_evidence( false );
-
-	std::map<clueless::ElementType, std::set<NotebookEntry*>>::const_iterator room_iter(
-		_notebook.find(clueless::ROOM) );
-	if( _notebook.end() != room_iter )
-	{
-		std::set<NotebookEntry*>::const_iterator entry_iter( room_iter->second.begin() );
-		while( ! have_counter_evidence &&
-			(room_iter->second.end() != entry_iter) )
-		{
-			if( room->_type == ((RoomNotebookEntry*)(*entry_iter))->_room )
-			{
-				have_counter_evidence = true;
-			}
-			else
-			{
-				++entry_iter;
-			}
-		} //end while (more entries to consider)
-
-	} //end if (have room entries)
-
-	return have_counter_evidence;
+	//have counter-evidence if room card seen
+	return isCardSeen( clueless::determineCardIndex(room->_type) );
 
 } //end routine haveCounterEvidenceForRoom()
 
@@ -428,7 +328,12 @@ const
 	//consult notebook
 	const NotebookEntry* entry( fetchNotebookEntry(card) );
 
-	return( entry->_playersShown.size() );
+	if( ! entry )
+	{
+		return 0; //card not seen, so not shown
+	}
+
+	return( entry->countPlayersShown() );
 
 } //end routine numberPlayersShownCard()
 
@@ -479,7 +384,7 @@ DetectiveNotebook::recordHaveShownCardToPlayer(
 	}
 
 	//indicate card shown to player
-	entry->_playersShown.insert( player_character );
+	entry->recordShownToPlayer( player_character );
 
 } //end routine recordHaveShownCardToPlayer()
 
@@ -535,20 +440,65 @@ DetectiveNotebook::recordCardInHand(
 {
 	//add entry to notebook
 	addEntryForCard(card, _ownerCharacter);
+	_cardsInHand |= (1u << card->getIndex());
 
 	if( clueless::ROOM == card->_type )
 	{
-		_roomsInHand.insert( ((const RoomCard* const)(card))->_room );
+		_roomsInHand |= (1u << ((const RoomCard* const)(card))->_room);
 	}
 
 } //end routine recordCardInHand()
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Records seating and hand sizes of all players.
+/// \param list<Player>: all players, in order of play
+/// \return None
+/// \throw None
+/// \note
+/// - Call once cards are dealt; starts deduction from owner's hand.
+////////////////////////////////////////////////////////////////////////////////
+void
+DetectiveNotebook::recognizePlayers(
+	const std::list<Player*>& players) //i - all players, in order of play
+{
+	_deductions = DeductionMatrix();
+	_numSeats = 0;
+
+	std::list<Player*>::const_iterator player_iter( players.begin() );
+	for(player_iter  = players.begin();
+		(player_iter != players.end()) && (_numSeats < clueless::getNumPersonTypes());
+		++player_iter)
+	{
+		_seatCharacters[_numSeats] = (*player_iter)->getCharacter();
+		++_numSeats;
+
+		_deductions.addPlayer( (*player_iter)->getCharacter(), (*player_iter)->getNumCardsInHand() );
+
+	} //end for (each player)
+
+	//owner knows own hand
+	for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+	{
+		if( isCardInHand(card_index) )
+		{
+			_deductions.recordCardHeld(card_index, _ownerCharacter);
+		}
+		else
+		{
+			_deductions.recordCardNotHeld(card_index, _ownerCharacter);
+		}
+	}
+
+	applyDeductions();
+
+} //end routine recognizePlayers()
+
 //void
 //DetectiveNotebook::recordHand(
-//	const std::set<const Card*>* const hand)
+//	const std::set<const Card*, CardOrder>* const hand)
 //{
 //	//for each card in hand,
-//	std::set<const Card*>::const_iterator card_iter( hand->begin() );
+//	std::set<const Card*, CardOrder>::const_iterator card_iter( hand->begin() );
 //	for(card_iter  = hand->begin();
 //		card_iter != hand->end();
 //		++card_iter)
@@ -582,9 +532,94 @@ DetectiveNotebook::recordCardShownByPlayer(
 		addEntryForCard(card, player_character);
 	}
 
+	if( 0 < _numSeats ) //players recognized
+	{
+		_deductions.recordCardHeld(card->getIndex(), player_character);
+		applyDeductions();
+	}
+
 } //end routine recordCardShownByPlayer()
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Records what every player saw of a suggestion's outcome.
+/// \param PersonType: suggestor's character
+/// \param SolutionCardSet: suggestion
+/// \param PersonType: character of player who refuted (unknown if none)
+/// \return None
+/// \throw None
+/// \note
+/// - Players asked before refuter (in order of play) hold none of the
+///   suggested cards; refuter holds at least one.  Which card was shown is
+///   recorded separately, by suggestor only.
+////////////////////////////////////////////////////////////////////////////////
+void
+DetectiveNotebook::recordSuggestionOutcome(
+	clueless::PersonType suggestor_character, //i - suggestor's character
+	const SolutionCardSet* suggestion, //i - suggestion
+	clueless::PersonType refuter_character) //i - refuter's character
+{
+	if( 0 == _numSeats ) //players not recognized
+	{
+		return;
+	}
+
+	//suggested cards
+	unsigned int suggested_cards( 0 );
+	if( clueless::UNKNOWN_PERSON != suggestion->getPersonType() )
+	{
+		suggested_cards |= (1u << clueless::determineCardIndex(suggestion->getPersonType()));
+	}
+	if( clueless::UNKNOWN_WEAPON != suggestion->getWeaponType() )
+	{
+		suggested_cards |= (1u << clueless::determineCardIndex(suggestion->getWeaponType()));
+	}
+	if( clueless::UNKNOWN_ROOM != suggestion->getRoomType() )
+	{
+		suggested_cards |= (1u << clueless::determineCardIndex(suggestion->getRoomType()));
+	}
+
+	//find suggestor's seat
+	size_t suggestor_seat( 0 );
+	while( (suggestor_seat < _numSeats) &&
+		(_seatCharacters[suggestor_seat] != suggestor_character) )
+	{
+		++suggestor_seat;
+	}
+
+	if( _numSeats == suggestor_seat ) //suggestor unknown
+	{
+		return;
+	}
+
+	//each player asked before refuter could not refute
+	size_t seat( (suggestor_seat + 1) % _numSeats );
+	while( (suggestor_seat != seat) &&
+		(_seatCharacters[seat] != refuter_character) )
+	{
+		for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+		{
+			if( 0 != (suggested_cards & (1u << card_index)) )
+			{
+				_deductions.recordCardNotHeld(card_index, _seatCharacters[seat]);
+			}
+		}
+
+		seat = (seat + 1) % _numSeats; //next player
+
+	} //end while (players asked before refuter)
+
+	if( (clueless::UNKNOWN_PERSON != refuter_character) &&
+		(_ownerCharacter != refuter_character) )
+	{
+		_deductions.recordHoldsOneOf(refuter_character, suggested_cards);
+	}
+
+	applyDeductions();
+
+} //end routine recordSuggestionOutcome()
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Adds entry for card to notebook.
 /// \param Card: card
@@ -599,37 +634,42 @@ DetectiveNotebook::addEntryForCard(
 	const Card* const card, //i - card
 	clueless::PersonType card_owner_character) //i - card owner's character
 {
-	clueless::ElementType card_type( card->_type );
+	addEntryForCardIndex(card->getIndex(), card, card_owner_character);
 
-	//build entry
-	NotebookEntry* new_entry( nullptr );
-	
-	//depending on card type
-	switch( card_type )
-	{
-	case clueless::PERSON:
-		new_entry = new PersonNotebookEntry(card, card_owner_character);
-		break;
+} //end routine addEntryForCard()
 
-	case clueless::WEAPON:
-		new_entry = new WeaponNotebookEntry(card, card_owner_character);
-		break;
 
-	case clueless::ROOM:
-		new_entry = new RoomNotebookEntry(card, card_owner_character);
-		_roomsNeedingQuestioning.erase( ((RoomCard*)card)->_room );
-		break;
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Adds entry for card to notebook.
+/// \param size_t: card index
+/// \param Card: card (nullptr if owner deduced without seeing card)
+/// \param Player: card owner's character
+/// \return None
+/// \throw None
+/// \note
+/// - Assumes upstream check for existance of entry.
+////////////////////////////////////////////////////////////////////////////////
+void
+DetectiveNotebook::addEntryForCardIndex(
+	size_t card_index, //i - card index
+	const Card* const card, //i - card
+	clueless::PersonType card_owner_character) //i - card owner's character
+{
+	clueless::ElementType card_type( clueless::determineCardElementType(card_index) );
 
-	default:
-		;
-	} //end switch (on card type)
+	//fill entry
+	_entries[card_index] = NotebookEntry(card, card_owner_character);
+	_seenCards |= (1u << card_index);
+	++_numEntries[card_type];
 
-	//add entry to page for element type
-	_notebook[card_type].insert( new_entry );
+	if( clueless::ROOM == card_type )
+	{
+		_roomsNeedingQuestioning &= ~(1u << clueless::determineCardSubtype(card_index));
+	}
 
 	//if only one unseen card for element type
 	// i.e. number entries for element type one less than total cards for element
-	if( (clueless::getNumElementSubtypes(card_type) - 1) == _notebook.find(card_type)->second.size() )
+	if( (clueless::getNumElementSubtypes(card_type) - 1) == _numEntries[card_type] )
 	{
 		//unseen card is suspected element
 		switch( card_type )
@@ -644,7 +684,7 @@ DetectiveNotebook::addEntryForCard(
 
 		case clueless::ROOM:
 			_suspectedRoom = determineMissingRoom();
-			_roomsNeedingQuestioning.clear();
+			_roomsNeedingQuestioning = 0;
 			break;
 
 		default:
@@ -653,7 +693,7 @@ DetectiveNotebook::addEntryForCard(
 
 	} //end if (only one card not seen)
 
-} //end routine addEntryForCard()
+} //end routine addEntryForCardIndex()
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -679,7 +719,7 @@ DetectiveNotebook::notifyNoCounterEvidenceForCard(
 
 	case clueless::ROOM:
 		_suspectedRoom = ((const RoomCard* const)card)->_room;
-		_roomsNeedingQuestioning.clear();
+		_roomsNeedingQuestioning = 0;
 		break;
 
 	default:
@@ -689,6 +729,64 @@ DetectiveNotebook::notifyNoCounterEvidenceForCard(
 } //end routine notifyNoCounterEvidenceForCard()
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Propagates deductions and copies conclusions into notebook.
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - Cards whose holder is deduced get an entry (without card object) just
+///   as if shown; Case File cards become suspected elements.
+/// - Case File hypotheses reweighed from the new deductions when next read
+///   (see getHypotheses()).
+////////////////////////////////////////////////////////////////////////////////
+void
+DetectiveNotebook::applyDeductions()
+{
+	_deductions.propagate();
+	_areHypothesesCurrent = false;
+
+	for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+	{
+		size_t holder( _deductions.findHolder(card_index) );
+
+		if( DeductionMatrix::UNKNOWN_HOLDER == holder )
+		{
+			continue; //next card
+		}
+		else if( DeductionMatrix::CASE_FILE == holder )
+		{
+			int subtype( clueless::determineCardSubtype(card_index) );
+
+			switch( clueless::determineCardElementType(card_index) )
+			{
+			case clueless::PERSON:
+				_suspectedPerson = clueless::PersonType( subtype );
+				break;
+
+			case clueless::WEAPON:
+				_suspectedWeapon = clueless::WeaponType( subtype );
+				break;
+
+			case clueless::ROOM:
+				_suspectedRoom = clueless::RoomType( subtype );
+				_roomsNeedingQuestioning = 0;
+				break;
+
+			default:
+				;
+			} //end switch (on card type)
+		}
+		else if( ! isCardSeen(card_index) ) //newly deduced player card
+		{
+			addEntryForCardIndex(card_index, nullptr, clueless::PersonType(holder));
+		}
+
+	} //end for (each card)
+
+} //end routine applyDeductions()
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Chooses person for suggestion.
 /// \param None
@@ -705,13 +803,13 @@ const
 	//if has suspected person
 	if( haveSuspectedPerson() )
 	{
-		std::set<clueless::PersonType> in_hand( retrievePeopleInHand() );
+		clueless::PersonType in_hand( findFirstPersonInHand() );
 
 		//if has person in hand
-		if( ! in_hand.empty() )
+		if( clueless::UNKNOWN_PERSON != in_hand )
 		{
 			//choose person from hand
-			chosen_person = *(in_hand.begin());
+			chosen_person = in_hand;
 		}
 		else //no person in hand
 		{
@@ -721,8 +819,8 @@ const
 	}
 	else //no suspected person yet
 	{
-		//choose person not seen
-		chosen_person = determineMissingPerson(); //first missing
+		//choose person not seen, least certain whether in Case File
+		chosen_person = clueless::PersonType( findMostUncertainUnseen(clueless::PERSON) );
 	}
 
 	return chosen_person;
@@ -746,13 +844,13 @@ const
 	//if has suspected weapon
 	if( haveSuspectedWeapon() )
 	{
-		std::set<clueless::WeaponType> in_hand( retrieveWeaponsInHand() );
+		clueless::WeaponType in_hand( findFirstWeaponInHand() );
 
 		//if has weapon in hand
-		if( ! in_hand.empty() )
+		if( clueless::UNKNOWN_WEAPON != in_hand )
 		{
 			//choose weapon from hand
-			chosen_weapon = *(in_hand.begin());
+			chosen_weapon = in_hand;
 		}
 		else //no weapon in hand
 		{
@@ -762,8 +860,8 @@ const
 	}
 	else //no suspected weapon yet
 	{
-		//choose weapon not seen
-		chosen_weapon = determineMissingWeapon(); //first missing
+		//choose weapon not seen, least certain whether in Case File
+		chosen_weapon = clueless::WeaponType( findMostUncertainUnseen(clueless::WEAPON) );
 	}
 
 	return chosen_weapon;
@@ -773,7 +871,8 @@ const
 
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Decide which card to show opponent.
-/// \param set<Card>: potential cards to show opponent
+/// \param Card*[]: potential cards to show opponent, in card order
+/// \param size_t: number of potential cards
 /// \param PersonType: opponent's character
 /// \return Card: card to show opponent
 /// \throw None
@@ -781,58 +880,62 @@ const
 ////////////////////////////////////////////////////////////////////////////////
 const Card*
 DetectiveNotebook::decideWhichCardToShowOpponent(
-	const std::set<const Card*>* cards, //i - counter-evidence in hand
+	const Card* const cards[], //i - counter-evidence in hand
+	size_t num_cards, //i - number of pieces of counter-evidence
 	clueless::PersonType player) //i - opponent's character
 const
 {
 	const Card* choice( nullptr ); //no decision yet
 
 	//if only found one piece of counter-evidence
-	if( 1 == cards->size() )
+	if( 1 == num_cards )
 	{
 		//must show that card
-		choice = *(cards->begin());
+		choice = cards[0];
 	}
 	else //choose amongst cards
 	{
 		size_t greatest_num_shown( 0 );
-		std::set<const Card*> cards_shown_to_greatest_num;
+		const Card* cards_shown_to_greatest_num[clueless::NUM_CARDS];
+		size_t num_shown_to_greatest_num( 0 );
 
-		std::set<const Card*>::const_iterator card_iter( cards->begin() );
+		size_t pos_index( 0 );
 
 		while( ! choice &&
-			(cards->end() != card_iter) )
+			(num_cards > pos_index) )
 		{
+			const Card* card( cards[pos_index] );
+
 			//favor card already shown to this opponent
-			if( haveShownCardToPlayer(*card_iter, player) )
+			if( haveShownCardToPlayer(card, player) )
 			{
-				choice = *card_iter;
+				choice = card;
 			}
 
 			//next, prefer card already shown to greatest number of opponents
-			size_t num_opponents_shown( numberPlayersShownCard(*card_iter) );
+			size_t num_opponents_shown( numberPlayersShownCard(card) );
 			if( num_opponents_shown > greatest_num_shown )
 			{
-				cards_shown_to_greatest_num.clear(); //start over
+				num_shown_to_greatest_num = 0; //start over
 
 				//current card considered better choice
 				greatest_num_shown = num_opponents_shown;
-				cards_shown_to_greatest_num.insert( *card_iter );
+				cards_shown_to_greatest_num[num_shown_to_greatest_num++] = card;
 			}
 			else if( num_opponents_shown == greatest_num_shown )
 			{
 				//current card a comparable choice
-				cards_shown_to_greatest_num.insert( *card_iter );
+				cards_shown_to_greatest_num[num_shown_to_greatest_num++] = card;
 			}
 
-			++card_iter; //next card
+			++pos_index; //next card
 
 		} //end while (consider cards)
 
 		if( ! choice )
 		{
 			//otherwise, randomly choose amongst better choices
-			choice = randomlyChooseCard( &cards_shown_to_greatest_num );
+			choice = randomlyChooseCard( cards_shown_to_greatest_num, num_shown_to_greatest_num );
 		}
 	} //end else (choose amongst cards)
 
@@ -878,13 +981,18 @@ const
 		Location* next_from_chart( nullptr );
 
 		//for each room needing questioning
-		std::set<clueless::RoomType>::const_iterator ques_iter( _roomsNeedingQuestioning.begin() );
-		for(ques_iter  = _roomsNeedingQuestioning.begin();
-			ques_iter != _roomsNeedingQuestioning.end();
-			++ques_iter)
+		for(size_t room_index( clueless::UNKNOWN_ROOM + 1 );
+			room_index <= clueless::getNumRoomTypes();
+			++room_index)
 		{
+			clueless::RoomType ques_room( (clueless::RoomType)room_index );
+			if( ! doesRoomNeedQuestioning(ques_room) )
+			{
+				continue; //next room
+			}
+
 			//if starting room is room needing questioning
-			if( start_room->_type == (*ques_iter) )
+			if( start_room->_type == ques_room )
 			{
 				//if currenting in destination room
 				if( start_loc->isRoom() )
@@ -902,7 +1010,7 @@ const
 				next_from_chart =
 					_assocBoard->fetchDistanceToRoom(
 						start_room,
-						*ques_iter,
+						ques_room,
 						distance);
 			} //end else (room needing question not curr location)
 
@@ -934,9 +1042,8 @@ const
 {
 	size_t shortest_distance( UINT_MAX );
 
-	//create combined collection of rooms in hand and suspected
-	std::set<clueless::RoomType> roomsToConsider = _roomsInHand;
-	roomsToConsider.insert( _suspectedRoom );
+	//combine rooms in hand and suspected
+	unsigned int rooms_to_consider( _roomsInHand | (1u << _suspectedRoom) );
 
 	bool is_next_step_compare_needed( false );
 	size_t addition_to_dist( 0 );
@@ -958,14 +1065,19 @@ const
 		size_t distance( UINT_MAX );
 		Location* next_from_chart( nullptr );
 
-		//for each room needing questioning
-		std::set<clueless::RoomType>::const_iterator room_iter( roomsToConsider.begin() );
-		for(room_iter  = roomsToConsider.begin();
-			room_iter != roomsToConsider.end();
-			++room_iter)
+		//for each room in hand or suspected
+		for(size_t room_index( clueless::UNKNOWN_ROOM );
+			room_index <= clueless::getNumRoomTypes();
+			++room_index)
 		{
+			clueless::RoomType room( (clueless::RoomType)room_index );
+			if( 0 == (rooms_to_consider & (1u << room_index)) )
+			{
+				continue; //next room
+			}
+
 			//if starting room is room needing questioning
-			if( start_room->_type == (*room_iter) )
+			if( start_room->_type == room )
 			{
 				//if currenting in destination room
 				if( start_loc->isRoom() )
@@ -983,7 +1095,7 @@ const
 				next_from_chart =
 					_assocBoard->fetchDistanceToRoom(
 						start_room,
-						*room_iter,
+						room,
 						distance);
 			} //end else (room needing question not curr location)
 
@@ -1009,37 +1121,29 @@ const
 
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Uniform randomly choice amongst specified cards.
-/// \param set<Card>: cards to choose amongst
-/// \return Card: choice
+/// \param Card*[]: cards to choose amongst
+/// \param size_t: number of cards
+/// \return Card: choice; nullptr if no cards
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
 const Card*
 DetectiveNotebook::randomlyChooseCard(
-	const std::set<const Card*>* options) //i - cards from which to choose
+	const Card* const options[], //i - cards from which to choose
+	size_t num_options) //i - number of cards
 const
 {
 	const Card* choice( nullptr );
 
-	if( 1 == options->size() ) //only one option
+	if( 1 == num_options ) //only one option
 	{
 		//choose it
-		choice = *(options->begin());
+		choice = options[0];
 	}
-	else if( ! options->empty() ) //more than one option
+	else if( 0 < num_options ) //more than one option
 	{
-		//create position based on floor of random draw in [0, num choices)
-		size_t zero_based_pos( size_t(std::floor( MersenneTwister::drawReal2(0, (double)(options->size())) )) );
-
-		std::set<const Card*>::const_iterator opt_iter( options->begin() );
-		for(size_t pos_index(0);
-			pos_index < zero_based_pos;
-			++pos_index)
-		{
-			++opt_iter;
-		}
-
-		choice = *opt_iter;
+		//unbiased draw of position in [0, num choices)
+		choice = options[_rng->drawUniformInt(num_options)];
 
 	} //end if (at least one option)
 
@@ -1049,89 +1153,67 @@ const
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Retrieves person types in hand.
+/// \brief Finds first person (in enumerated order) in hand.
 /// \param None
-/// \return set<PersonType>: people in hand
+/// \return PersonType: first person in hand; unknown if none
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
-std::set<clueless::PersonType>
-DetectiveNotebook::retrievePeopleInHand()
+clueless::PersonType
+DetectiveNotebook::findFirstPersonInHand()
 const
 {
-	std::set<clueless::PersonType> in_hand;
-
-	std::map<clueless::ElementType, std::set<NotebookEntry*>>::const_iterator page_iter(
-		_notebook.find(clueless::PERSON) );
-
-	//have entry for at least one person
-	if( _notebook.end() != page_iter )
+	for(size_t person_index( clueless::UNKNOWN_PERSON + 1 );
+		person_index <= clueless::getNumPersonTypes();
+		++person_index)
 	{
-		std::set<NotebookEntry*>::const_iterator entry_iter( page_iter->second.begin() );
-		for(entry_iter  = page_iter->second.begin();
-			entry_iter != page_iter->second.end();
-			++entry_iter)
-		{
-			//if owned by notebook owner
-			if( _ownerCharacter == (*entry_iter)->_ownerCharacter )
-			{
-				//person type in hand
-				in_hand.insert( ((PersonNotebookEntry*)(*entry_iter))->_person );
-			}
+		clueless::PersonType person( (clueless::PersonType)person_index );
 
-		} //end for (each person entry)
+		if( isCardInHand( clueless::determineCardIndex(person) ) )
+		{
+			return person;
+		}
 
-	} //end if (at least one person entry)
+	} //end for (each person)
 
-	return in_hand;
+	return clueless::UNKNOWN_PERSON;
 
-} //end routine retrievePeopleInHand()
+} //end routine findFirstPersonInHand()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Retrieves weapon types in hand.
+/// \brief Finds first weapon (in enumerated order) in hand.
 /// \param None
-/// \return set<WeaponType>: weapons in hand
+/// \return WeaponType: first weapon in hand; unknown if none
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
-std::set<clueless::WeaponType>
-DetectiveNotebook::retrieveWeaponsInHand()
+clueless::WeaponType
+DetectiveNotebook::findFirstWeaponInHand()
 const
 {
-	std::set<clueless::WeaponType> in_hand;
-
-	std::map<clueless::ElementType, std::set<NotebookEntry*>>::const_iterator page_iter(
-		_notebook.find(clueless::WEAPON) );
-
-	//have entry for at least one weapon
-	if( _notebook.end() != page_iter )
+	for(size_t weapon_index( clueless::UNKNOWN_WEAPON + 1 );
+		weapon_index <= clueless::getNumWeaponTypes();
+		++weapon_index)
 	{
-		std::set<NotebookEntry*>::const_iterator entry_iter( page_iter->second.begin() );
-		for(entry_iter  = page_iter->second.begin();
-			entry_iter != page_iter->second.end();
-			++entry_iter)
-		{
-			//if owned by notebook owner
-			if( _ownerCharacter == (*entry_iter)->_ownerCharacter )
-			{
-				//person type in hand
-				in_hand.insert( ((WeaponNotebookEntry*)(*entry_iter))->_weapon );
-			}
+		clueless::WeaponType weapon( (clueless::WeaponType)weapon_index );
 
-		} //end for (each weapon entry)
+		if( isCardInHand( clueless::determineCardIndex(weapon) ) )
+		{
+			return weapon;
+		}
 
-	} //end if (at least one weapon entry)
+	} //end for (each weapon)
 
-	return in_hand;
+	return clueless::UNKNOWN_WEAPON;
 
-} //end routine retrieveWeaponsInHand()
+} //end routine findFirstWeaponInHand()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief 
-/// \param
-/// \return 
+/// \brief Determines first person (in enumerated order) without entry.
+/// \param None
+/// \return PersonType: first person not seen; unknown if all seen
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
@@ -1139,47 +1221,20 @@ clueless::PersonType
 DetectiveNotebook::determineMissingPerson()
 const
 {
-	clueless::PersonType missing( clueless::UNKNOWN_PERSON );
-
-	std::map<clueless::ElementType, std::set<NotebookEntry*>>::const_iterator page_iter( _notebook.find(clueless::PERSON) );
-	if( _notebook.end() != page_iter )
+	for(size_t person_index( clueless::UNKNOWN_PERSON + 1 );
+		person_index <= clueless::getNumPersonTypes();
+		++person_index)
 	{
-		std::set<NotebookEntry*>::const_iterator entry_iter( page_iter->second.begin() );
-	
-		const size_t NUM_PEOPLE( 6 ); // clueless::getNumPersonTypes() );
-		bool is_found[NUM_PEOPLE] = {false, false, false, false, false, false};
-
-		//while more entries to consider
-		for(entry_iter  = page_iter->second.begin();
-			entry_iter != page_iter->second.end();
-			++entry_iter)
-		{
-			clueless::PersonType person( ((PersonCard*)((*entry_iter)->_card))->_person );
-
-			is_found[person - 1] = true;
+		clueless::PersonType person( (clueless::PersonType)person_index );
 
-		} //end while (more entries)
-
-		size_t is_found_index( 0 );
-		while( clueless::UNKNOWN_PERSON == missing )
+		if( ! isCardSeen( clueless::determineCardIndex(person) ) )
 		{
-			if( ! is_found[is_found_index] )
-			{
-				missing = clueless::PersonType( is_found_index + 1 );
-			}
-			else
-			{
-				++is_found_index;
-			}
-		} //end while (more found result to examine)
+			return person;
+		}
 
-	}
-	else //no person entries
-	{
-		missing = clueless::PersonType(clueless::UNKNOWN_PERSON + 1);
-	}
+	} //end for (each person)
 
-	return missing;
+	return clueless::UNKNOWN_PERSON;
 
 } //end routine determineMissingPerson()
 
@@ -1189,47 +1244,20 @@ clueless::WeaponType
 DetectiveNotebook::determineMissingWeapon()
 const
 {
-	clueless::WeaponType missing( clueless::UNKNOWN_WEAPON );
-
-	std::map<clueless::ElementType, std::set<NotebookEntry*>>::const_iterator page_iter( _notebook.find(clueless::WEAPON) );
-	if( _notebook.end() != page_iter )
+	for(size_t weapon_index( clueless::UNKNOWN_WEAPON + 1 );
+		weapon_index <= clueless::getNumWeaponTypes();
+		++weapon_index)
 	{
-		std::set<NotebookEntry*>::const_iterator entry_iter( page_iter->second.begin() );
-
-		const size_t NUM_WPNS( 6 ); // clueless::getNumPersonTypes() );
-		bool is_found[NUM_WPNS] = {false, false, false, false, false, false};
+		clueless::WeaponType weapon( (clueless::WeaponType)weapon_index );
 
-		//while more entries to consider
-		for(entry_iter  = page_iter->second.begin();
-			entry_iter != page_iter->second.end();
-			++entry_iter)
+		if( ! isCardSeen( clueless::determineCardIndex(weapon) ) )
 		{
-			clueless::WeaponType weapon( ((WeaponCard*)((*entry_iter)->_card))->_weapon );
-
-			is_found[weapon - 1] = true;
-
-		} //end while (more entries)
-
-		size_t is_found_index( 0 );
-		while( clueless::UNKNOWN_WEAPON == missing )
-		{
-			if( ! is_found[is_found_index] )
-			{
-				missing = clueless::WeaponType( is_found_index + 1 );
-			}
-			else
-			{
-				++is_found_index;
-			}
-		} //end while (more found result to examine)
+			return weapon;
+		}
 
-	}
-	else //no weapon entries
-	{
-		missing = clueless::WeaponType(clueless::UNKNOWN_WEAPON + 1);
-	}
+	} //end for (each weapon)
 
-	return missing;
+	return clueless::UNKNOWN_WEAPON;
 
 } //end routine determineMissingWeapon()
 
@@ -1239,39 +1267,66 @@ clueless::RoomType
 DetectiveNotebook::determineMissingRoom()
 const
 {
-	clueless::RoomType missing( clueless::UNKNOWN_ROOM );
+	for(size_t room_index( clueless::UNKNOWN_ROOM + 1 );
+		room_index <= clueless::getNumRoomTypes();
+		++room_index)
+	{
+		clueless::RoomType room( (clueless::RoomType)room_index );
 
-	std::map<clueless::ElementType, std::set<NotebookEntry*>>::const_iterator page_iter( _notebook.find(clueless::PERSON) );
-	std::set<NotebookEntry*>::const_iterator entry_iter( page_iter->second.begin() );
+		if( ! isCardSeen( clueless::determineCardIndex(room) ) )
+		{
+			return room;
+		}
 
-	const size_t NUM_ROOMS( 9 ); // clueless::getNumPersonTypes() );
-	bool is_found[NUM_ROOMS] = {false, false, false, false, false, false, false, false, false};
+	} //end for (each room)
 
-	//while more entries to consider
-	for(entry_iter  = page_iter->second.begin();
-		entry_iter != page_iter->second.end();
-		++entry_iter)
-	{
-		clueless::RoomType weapon( ((RoomCard*)((*entry_iter)->_card))->_room );
+	return clueless::UNKNOWN_ROOM;
 
-		is_found[weapon - 1] = true;
+} //end routine determineMissingRoom()
 
-	} //end while (more entries)
 
-	size_t is_found_index( 0 );
-	while( clueless::UNKNOWN_ROOM == missing )
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Finds unseen card of element type whose answer would tell most.
+/// \param ElementType: element type of interest
+/// \return int: card's subtype (PersonType, WeaponType, RoomType); unknown
+///  if all seen
+/// \throw None
+/// \note
+/// - Chance of being in Case File (see CaseFileHypotheses) nearest one half,
+///   i.e. greatest entropy; first in enumerated order when tied, as
+///   determineMissing*().
+////////////////////////////////////////////////////////////////////////////////
+int
+DetectiveNotebook::findMostUncertainUnseen(
+	clueless::ElementType elmt_type) //i - element type of interest
+const
+{
+	static const float TIE_TOLERANCE( 1.0e-6f ); //rounding in summed weights
+
+	const CaseFileHypotheses& hypotheses( getHypotheses() );
+
+	int chosen_subtype( 0 );
+	float best_distance( 1.0f );
+
+	for(size_t card_index( clueless::determineFirstCardIndex(elmt_type) );
+		(card_index < clueless::NUM_CARDS) &&
+		(clueless::determineCardElementType(card_index) == elmt_type);
+		++card_index)
 	{
-		if( ! is_found[is_found_index] )
+		if( isCardSeen(card_index) )
 		{
-			missing = clueless::RoomType( is_found_index + 1 );
+			continue; //next card
 		}
-		else
+
+		float distance( std::fabs(hypotheses.getMarginal(card_index) - 0.5f) );
+		if( distance < best_distance - TIE_TOLERANCE )
 		{
-			++is_found_index;
+			chosen_subtype = clueless::determineCardSubtype(card_index);
+			best_distance = distance;
 		}
-	} //end while (more found result to examine)
 
-	return missing;
+	} //end for (each card of type)
 
-} //end routine determineMissingRoom()
+	return chosen_subtype;
 
+} //end routine findMostUncertainUnseen()
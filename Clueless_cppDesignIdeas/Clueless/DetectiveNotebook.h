@@ -16,18 +16,24 @@
 #ifndef DetectiveNotebook_h
 #define DetectiveNotebook_h
 
+#include "CaseFileHypotheses.h"
+#include "DeductionMatrix.h"
 #include "NotebookEntry.h"
 
 #include "CluelessEnums.h"	//for ElementType use
 
-#include <map>		//for std::map use
+#include <list>		//for std::list use
 #include <set>		//for std::set use
 
 //forward declarations
 struct Card;
+struct CardOrder;
 class Board;
+class MersenneTwister;
 class Hallway;
 class Location;
+struct LocationOrder;
+class Player;
 class Room;
 struct SolutionCardSet;
 
@@ -48,8 +54,11 @@ public:
 	//--------------------------------------------------------------------------
 	//void setRoomDistanceChart(const std::map<std::pair<const Location*, const Room*>, std::pair<size_t, Location*>>* chart);
 	void setBoard(Board* boardWithRoomDistanceChart);
+	void setRandomNumberGenerator(MersenneTwister* randomNumberGenerator);
 
-	NotebookEntry* fetchNotebookEntry(const Card* card) const;
+	const NotebookEntry* fetchNotebookEntry(const Card* card) const;
+	const DeductionMatrix& getDeductions() const;
+	const CaseFileHypotheses& getHypotheses() const;
 
 	bool isRoomInHand(clueless::RoomType room) const;
 
@@ -75,7 +84,13 @@ public:
 	// Additional Member Functions
 	//--------------------------------------------------------------------------
 	void recordCardInHand(const Card* const cardInHand);
+	void recognizePlayers(const std::list<Player*>& playersInSeatOrder);
+
 	void recordCardShownByPlayer(const Card* const card, clueless::PersonType playerCharacter);
+	void recordSuggestionOutcome(
+		clueless::PersonType suggestorCharacter,
+		const SolutionCardSet* suggestion,
+		clueless::PersonType refuterCharacter);
 
 	void notifyNoCounterEvidenceForCard(const Card* const card);
 
@@ -83,7 +98,8 @@ public:
 	clueless::WeaponType chooseWeaponForSuggestion() const;
 
 	const Card* decideWhichCardToShowOpponent(
-		const std::set<const Card*>* cards,
+		const Card* const cards[],
+		size_t numCards,
 		clueless::PersonType opponentsCharacter) const;
 
 	size_t determineShortestPathForDestinationNeedingQuestion(
@@ -96,19 +112,25 @@ public:
 protected:
 	void initializeRoomsNeedingQuestioning();
 
+	NotebookEntry* fetchNotebookEntry(const Card* card);
 	void addEntryForCard(const Card* const card, clueless::PersonType cardOwnerCharacter);
+	void addEntryForCardIndex(size_t cardIndex, const Card* const card, clueless::PersonType cardOwnerCharacter);
+
+	void applyDeductions();
 
-	std::set<clueless::PersonType> retrievePeopleInHand() const;
-//	std::set<clueless::PersonType> retrievePeopleNotSeen() const;
+	bool isCardSeen(size_t cardIndex) const;
+	bool isCardInHand(size_t cardIndex) const;
 
-	std::set<clueless::WeaponType> retrieveWeaponsInHand() const;
-//	std::set<clueless::WeaponType> retrieveWeaponsNotSeen() const;
+	clueless::PersonType findFirstPersonInHand() const;
+	clueless::WeaponType findFirstWeaponInHand() const;
 
 	clueless::PersonType determineMissingPerson() const;
 	clueless::WeaponType determineMissingWeapon() const;
 	clueless::RoomType determineMissingRoom() const;
 
-	const Card* randomlyChooseCard(const std::set<const Card*>* cards) const;
+	int findMostUncertainUnseen(clueless::ElementType elementType) const;
+
+	const Card* randomlyChooseCard(const Card* const cards[], size_t numCards) const;
 
 	//--------------------------------------------------------------------------
 	// Data Members
@@ -116,35 +138,78 @@ protected:
 protected:
 	clueless::PersonType _ownerCharacter;
 
-	std::map<clueless::ElementType, std::set<NotebookEntry*> > _notebook;
+	/// \note indexed by card index (see Card::getIndex()); entries for unseen
+	///       cards have no card
+	NotebookEntry _entries[clueless::NUM_CARDS];
+
+	unsigned int _seenCards;   //bit (1 << card index) per card with entry
+	unsigned int _cardsInHand; //bit (1 << card index) per card in owner's hand
+	size_t _numEntries[3];     //cards with entry, per ElementType
+
+	/// \note fed by every suggestion outcome once players are recognized
+	DeductionMatrix _deductions;
+	/// \note rebuilt from deductions when next read after they change
+	mutable CaseFileHypotheses _hypotheses;
+	mutable bool _areHypothesesCurrent;
+	clueless::PersonType _seatCharacters[clueless::PROFESSOR_PLUM]; //in order of play
+	size_t _numSeats;
 
 	//building accusation...
 	clueless::PersonType _suspectedPerson;
 	clueless::WeaponType _suspectedWeapon;
 	clueless::RoomType   _suspectedRoom;
 
-	std::set<clueless::RoomType> _roomsInHand;
-	std::set<clueless::RoomType> _roomsNeedingQuestioning;
+	unsigned int _roomsInHand;             //bit (1 << RoomType) per room in hand
+	unsigned int _roomsNeedingQuestioning; //bit (1 << RoomType) per room
 	clueless::RoomType _nextRoomDestination;
 
 	/// \todo remove cheat if pull chart out of board with methods
 	//const std::map<std::pair<const Location*, const Room*>, std::pair<size_t, Location*>>* _roomDistanceChart; //from board
 	Board* _assocBoard;
 
+	MersenneTwister* _rng; //random draws for owning game (not owned)
+
 }; //end class DetectiveNotebook defn
 
 
 //------------------------------------------------------------------------------
 // Inlined Methods
 //------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline const DeductionMatrix&
+DetectiveNotebook::getDeductions()
+const
+{
+	return _deductions;
+
+} //end routine getDeductions()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns Case File hypotheses weighed against current deductions.
+////////////////////////////////////////////////////////////////////////////////
+inline const CaseFileHypotheses&
+DetectiveNotebook::getHypotheses()
+const
+{
+	if( ! _areHypothesesCurrent )
+	{
+		_hypotheses.update( _deductions );
+		_areHypothesesCurrent = true;
+	}
+
+	return _hypotheses;
+
+} //end routine getHypotheses()
+
+
 ////////////////////////////////////////////////////////////////////////////////
 inline bool
 DetectiveNotebook::isRoomInHand(
 	clueless::RoomType room) //i - room of interest
 const
 {
-	//in hand if in collection
-	return( _roomsInHand.end() != _roomsInHand.find(room) );
+	return( 0 != (_roomsInHand & (1u << room)) );
 
 } //end routine isRoomInHand()
 
@@ -155,8 +220,7 @@ DetectiveNotebook::doesRoomNeedQuestioning(
 	clueless::RoomType room)
 const
 {
-	//still needs questioning if in collection
-	return( _roomsNeedingQuestioning.end() != _roomsNeedingQuestioning.find(room) );
+	return( 0 != (_roomsNeedingQuestioning & (1u << room)) );
 
 } //end routine doesRoomNeedQuestioning()
 
@@ -166,12 +230,32 @@ DetectiveNotebook::hasRoomQuestionBeenAnswered(
 	clueless::RoomType room) //i - room of interest
 const
 {
-	//have visited if not in collection
-	return( _roomsNeedingQuestioning.end() == _roomsNeedingQuestioning.find(room) );
+	return( 0 == (_roomsNeedingQuestioning & (1u << room)) );
 
 } //end routine hasRoomQuestionBeenAnswered()
 
 
+////////////////////////////////////////////////////////////////////////////////
+inline bool
+DetectiveNotebook::isCardSeen(
+	size_t card_index) //i - card of interest (see Card::getIndex())
+const
+{
+	return( 0 != (_seenCards & (1u << card_index)) );
+
+} //end routine isCardSeen()
+
+
+inline bool
+DetectiveNotebook::isCardInHand(
+	size_t card_index) //i - card of interest (see Card::getIndex())
+const
+{
+	return( 0 != (_cardsInHand & (1u << card_index)) );
+
+} //end routine isCardInHand()
+
+
 ////////////////////////////////////////////////////////////////////////////////
 inline bool
 DetectiveNotebook::haveSuspectedPerson()
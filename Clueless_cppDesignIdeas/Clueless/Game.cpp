@@ -16,14 +16,44 @@
 #include "Game.h"
 
 #include "CluelessEnums.h"	//for RoomType use
+#include "GamePiece.h"
+#include "Instrumentation.h"	//for CLUELESS_TIME_SCOPE use
 //#include "mersenneTwister.h"
 #include "Player.h"
 #include "SolutionCardSet.h"
 
-#include <iostream>			//for std::cout use
 #include <sstream>			//for std::ostringstream use
 #include <stdexcept>		//for std::logic_error use
 
+
+//------------------------------------------------------------------------------
+// Local Helpers
+//------------------------------------------------------------------------------
+/// \brief Lowest set bit of every mask of seats.
+static const unsigned char LOWEST_SEAT[1 << GameState::MAX_NUM_SEATS] =
+{
+	0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+	4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns suggestion's cards as bits by card index.
+////////////////////////////////////////////////////////////////////////////////
+static unsigned int
+determineSuggestedCards(
+	const SolutionCardSet& suggestion) //i - suggestion
+{
+	return(
+		(1u << clueless::determineCardIndex(suggestion.getPersonType())) |
+		(1u << clueless::determineCardIndex(suggestion.getWeaponType())) |
+		(1u << clueless::determineCardIndex(suggestion.getRoomType())) );
+
+} //end routine determineSuggestedCards()
+
+
 //------------------------------------------------------------------------------
 // Constructors / Destructor
 //------------------------------------------------------------------------------
@@ -32,15 +62,76 @@
 /// \param None
 /// \return None
 /// \throw None
-/// \note  None
+/// \note
+/// - Random draws use the Mersenne Twister default seed.
 ////////////////////////////////////////////////////////////////////////////////
 Game::Game()
-	: _winner( nullptr )
+	: _rng()
+	, _board( &_rng, BoardLayout::classic() )
+	, _cards( &_rng )
+	, _winner( nullptr )
 	, _numFalseAccusers( 0 )
+	, _numSuggestions( 0 )
+	, _numUnrefutedSuggestions( 0 )
+	, _publicDeductions()
+	, _events( NullEventSink::shared() )
+	, _numSeats( 0 )
 {
 } //end routine constructor
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param unsigned long: seed for game's random number generator
+/// \return None
+/// \throw None
+/// \note
+/// - All random draws for the game (weapon placement, case file, deal, player
+///   choices) come from the game's own generator, so games with different
+///   generators may be played concurrently and a seed reproduces a game.
+////////////////////////////////////////////////////////////////////////////////
+Game::Game(
+	unsigned long seed) //i - seed for random number generator
+	: _rng( seed )
+	, _board( &_rng, BoardLayout::classic() )
+	, _cards( &_rng )
+	, _winner( nullptr )
+	, _numFalseAccusers( 0 )
+	, _numSuggestions( 0 )
+	, _numUnrefutedSuggestions( 0 )
+	, _publicDeductions()
+	, _events( NullEventSink::shared() )
+	, _numSeats( 0 )
+{
+} //end routine extended constructor
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param unsigned long: seed for game's random number generator
+/// \param BoardLayout: board layout (not owned)
+/// \return None
+/// \throw None
+/// \note
+/// - Layout must outlive game; one layout may be shared by many games.
+////////////////////////////////////////////////////////////////////////////////
+Game::Game(
+	unsigned long seed, //i - seed for random number generator
+	const BoardLayout* layout) //i - board layout
+	: _rng( seed )
+	, _board( &_rng, layout )
+	, _cards( &_rng )
+	, _winner( nullptr )
+	, _numFalseAccusers( 0 )
+	, _numSuggestions( 0 )
+	, _numUnrefutedSuggestions( 0 )
+	, _publicDeductions()
+	, _events( NullEventSink::shared() )
+	, _numSeats( 0 )
+{
+} //end routine extended constructor
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Destructor
 /// \param None
@@ -55,6 +146,36 @@ Game::~Game()
 } //end routine destructor
 
 
+//------------------------------------------------------------------------------
+// Accessors and Mutators
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Directs game play events to specified sink.
+/// \param GameEventSink: receives game play events (nullptr for none)
+/// \return None
+/// \throw None
+/// \note
+/// - Events are discarded by default; batch simulations leave it that way
+///   since formatting dominates the cost of a simulated game.
+/// - Each game reports to its own sink, so concurrent games do not share
+///   output state.
+////////////////////////////////////////////////////////////////////////////////
+void
+Game::setEventSink(
+	GameEventSink* event_sink) //i - receives game play events
+{
+	if( event_sink )
+	{
+		_events = event_sink;
+	}
+	else //none specified
+	{
+		_events = NullEventSink::shared();
+	}
+
+} //end routine setEventSink()
+
+
 //--------------------------------------------------------------------------
 // Additional Member Functions
 //--------------------------------------------------------------------------
@@ -64,7 +185,9 @@ Game::~Game()
 /// \return None
 /// \throw
 /// - INSUFFICIENT_DATA when empty collection of players.
-/// \note  None
+/// - INCONSISTENT_DATA when more players than seats.
+/// \note
+/// - Players take seats in list order, which is turn order.
 ////////////////////////////////////////////////////////////////////////////////
 void
 Game::setup(
@@ -79,29 +202,173 @@ Game::setup(
 		throw std::logic_error( msg.str() );
 	}
 
+	if( GameState::MAX_NUM_SEATS < (*players).size() )
+	{
+		std::ostringstream msg;
+		msg << "Game::setup()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  more players than seats: " << (*players).size();
+		throw std::logic_error( msg.str() );
+	}
+
+	for(size_t character(0); character <= clueless::PROFESSOR_PLUM; ++character)
+	{
+		_characterSeats[character] = GameState::NO_SEAT;
+	}
+
+	std::list<Player*>::const_iterator player_iter( (*players).begin() );
+	for(player_iter  = (*players).begin();
+		player_iter != (*players).end();
+		++player_iter )
+	{
+		_players.push_back( *player_iter ); //class storage
+
+		_characterSeats[(*player_iter)->getCharacter()] = (unsigned char)_numSeats;
+		_seats[_numSeats++] = *player_iter;
+
+		(*player_iter)->setRandomNumberGenerator( &_rng );
+		(*player_iter)->setAssocGame( this );
+
+	} //end for (each player)
+
 	//create bridge between player and character / game token
 	_board.recognizePlayerCharacterAssignments( players );
 	_board.buildRoomRelationshipsWithCards( _cards.getRoomCards() );
 
+	//seats form ring in turn order
+	for(size_t seat(0); seat < _numSeats; ++seat)
+	{
+		_nextSeats[seat] = (unsigned char)((seat + 1 < _numSeats) ? (seat + 1) : 0);
+	}
+
 	//deal cards
-	_cards.setup( players );
+	_cards.setup( _seats, _numSeats );
 
-	std::list<Player*>::const_iterator player_iter( (*players).begin() );
+	for(size_t seat(0); seat < _numSeats; ++seat)
+	{
+		_seatHands[seat] = 0;
+		for(size_t hand_pos(0); hand_pos < _seats[seat]->getNumCardsInHand(); ++hand_pos)
+		{
+			_seatHands[seat] |= (1u << _seats[seat]->getCardInHand(hand_pos)->getIndex());
+		}
+	}
+
+	//hand sizes are public, so each player can begin deducing
 	for(player_iter  = (*players).begin();
 		player_iter != (*players).end();
 		++player_iter )
 	{
-		_players.push_back( *player_iter ); //class storage
+		(*player_iter)->_notebook.recognizePlayers( _players );
 
-		std::cout << (*player_iter)->report().str();
+		_publicDeductions.addPlayer( (*player_iter)->getCharacter(), (*player_iter)->getNumCardsInHand() );
 
 	} //end for (each player)
 
-	std::cout << _board.report().str() << "\n";
+	_publicDeductions.propagate();
+
+	_events->gameSetUp( _players, _board, *_cards.getCaseFile() );
 
 } //end routine setup()
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Captures current state of play for search.
+/// \param Player: player whose turn it is
+/// \return GameState: flat copy of tokens, hands, notebooks, and status
+/// \throw
+/// - INCONSISTENT_DATA when turn taker not in game.
+/// \note
+/// - Call between turns (or before turn taker's first choice); rounds are
+///   counted from the snapshot.
+/// - Leaves game unchanged and draws no random numbers.
+////////////////////////////////////////////////////////////////////////////////
+GameState
+Game::snapshot(
+	const Player* turn_taker) //i - player whose turn it is
+const
+{
+	GameState state;
+
+	std::list<Player*>::const_iterator player_iter( _players.begin() );
+	for(player_iter  = _players.begin();
+		player_iter != _players.end();
+		++player_iter )
+	{
+		const Player* player( *player_iter );
+		size_t seat_index( state._numSeats++ );
+		GameState::Seat& seat( state._seats[seat_index] );
+
+		seat._character = (unsigned char)player->getCharacter();
+
+		seat._flags = 0;
+		if( player->isFalseAccuser() )           { seat._flags |= GameState::FALSE_ACCUSER; }
+		if( player->isGameWinner() )             { seat._flags |= GameState::GAME_WINNER; }
+		if( player->wasMovedToRoomOutOfTurn() )  { seat._flags |= GameState::MOVED_TO_ROOM_OUT_OF_TURN; }
+		if( player->hasMovedDuringTurn() )       { seat._flags |= GameState::MOVED_DURING_TURN; }
+		if( player->hasMadeSuggestionDuringTurn() ) { seat._flags |= GameState::SUGGESTED_DURING_TURN; }
+
+		seat._hand = 0;
+		for(size_t hand_pos(0); hand_pos < player->getNumCardsInHand(); ++hand_pos)
+		{
+			const Card* card( player->getCardInHand(hand_pos) );
+			seat._hand |= (1u << card->getIndex());
+
+			//opponents already shown card
+			std::list<Player*>::const_iterator opponent_iter( _players.begin() );
+			for(; opponent_iter != _players.end(); ++opponent_iter )
+			{
+				clueless::PersonType opponent( (*opponent_iter)->getCharacter() );
+				if( player->_notebook.haveShownCardToPlayer(card, opponent) )
+				{
+					seat._playersShown[card->getIndex()] |= (unsigned char)(1u << opponent);
+				}
+			}
+		}
+
+		seat._notebook = player->_notebook.getDeductions();
+
+		if( player == turn_taker )
+		{
+			state._turnSeat = (unsigned char)seat_index;
+		}
+		if( player == _winner )
+		{
+			state._winnerSeat = (unsigned char)seat_index;
+		}
+
+	} //end for (each player)
+
+	if( GameState::NO_SEAT == state.findSeat(turn_taker ? turn_taker->getCharacter() : clueless::UNKNOWN_PERSON) )
+	{
+		std::ostringstream msg;
+		msg << "Game::snapshot()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  turn taker not playing this game";
+		throw std::logic_error( msg.str() );
+	}
+
+	state._numFalseAccusers = (unsigned char)_numFalseAccusers;
+
+	for(size_t person(clueless::MISS_SCARLET); person <= clueless::PROFESSOR_PLUM; ++person)
+	{
+		state._personLocations[person - 1] =
+			(unsigned char)_board._personTokens[person]->_location->getId();
+	}
+
+	for(size_t wpn(clueless::CANDLESTICK); wpn <= clueless::WRENCH; ++wpn)
+	{
+		state._weaponLocations[wpn - 1] =
+			(unsigned char)_board._weaponTokens[wpn]->_location->getId();
+	}
+
+	state._caseFile = *_cards.getCaseFile();
+	state._publicNotebook = _publicDeductions;
+
+	return state;
+
+} //end routine snapshot()
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Execute complete turn for specified player.
 /// \param Player: current turn taker
@@ -114,17 +381,20 @@ void
 Game::executePlayerTurn(
 	Player* const player) //i - turn taker
 {
-	std::cout << "\n" << player->getName() << "'s Turn (" << player->getCharacterName() << ")...\n";
+	CLUELESS_TIME_SCOPE( PLAYER_TURN );
+
+	_events->turnStarted( player );
 
 	//if player made false Accusation
 	if( player->isFalseAccuser() )
 	{
-		std::cout << "  has made false accusation => skip turn\n";
+		CLUELESS_COUNT( TURN_SKIPPED );
+		_events->turnSkipped( player );
 		return;
 	}
 
-	std::set<clueless::TurnOptionType> turn_options;
-	std::set<Location*> move_options( player->getLocation()->getMoveOptions() );
+	TurnOptionSet turn_options;
+	MoveOptionSet move_options( player->getLocation()->getMoveOptions() );
 
 	//--------------------------------------------------------------------------
 	// determine move options
@@ -134,9 +404,10 @@ Game::executePlayerTurn(
 		determinePlayerTurnOptions(player, &move_options, &turn_options);
 
 		//if at least one option
-		if( ! turn_options.empty() )
+		if( ! turn_options.isEmpty() )
 		{
 			clueless::TurnOptionType choice( player->makeTurnChoice(&turn_options) );
+			_events->turnOptionChosen( player, choice );
 
 			if( clueless::DO_NOTHING_ELSE_THIS_TURN != choice )
 			{
@@ -144,7 +415,7 @@ Game::executePlayerTurn(
 			}
 		} //end if (at least one turn option)
 
-	} while ( ! turn_options.empty() );
+	} while ( ! turn_options.isEmpty() );
 
 	//clear per turn information so ready for next turn
 	player->prepareForNewTurn();
@@ -155,8 +426,8 @@ Game::executePlayerTurn(
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Determine player's options for current turn.
 /// \param Player: current turn taker
-/// \param set<TurnOptionType>: valid turn options
-/// \param set<Location>: valid move options... may be empty
+/// \param MoveOptionSet: valid move options... may be empty
+/// \param TurnOptionSet: valid turn options
 /// \return None
 /// \throw None
 /// \note
@@ -165,10 +436,12 @@ Game::executePlayerTurn(
 void
 Game::determinePlayerTurnOptions(
 	Player* const player,
-	const std::set<Location*>* const move_options, //i - valid move options
-	std::set<clueless::TurnOptionType>* turn_options) // o- valid turn options
+	const MoveOptionSet* const move_options, //i - valid move options
+	TurnOptionSet* turn_options) // o- valid turn options
 const
 {
+	CLUELESS_TIME_SCOPE( DETERMINE_TURN_OPTIONS );
+
 	turn_options->clear(); //no known options yet
 
 	if( player->isGameWinner() ) //winner
@@ -177,9 +450,7 @@ const
 	}
 	else if( player->isFalseAccuser() ) //false accuser
 	{
-		//lose turn
-		std::cout << "  has made false accusation => no longer active\n";
-		return;
+		return; //lose turn
 	}
 
 	//if player has not moved yet  AND
@@ -188,13 +459,14 @@ const
 		! player->hasMadeSuggestionDuringTurn() )
 	{
 		//if possible moves found
-		if( 0 < move_options->size() )
+		if( ! move_options->isEmpty() )
 		{
-			turn_options->insert( clueless::MOVE );
+			turn_options->addOption( clueless::MOVE );
 		}
 		else //no permissible moves
 		{
-			std::cout << "no permissible moves\n";
+			CLUELESS_COUNT( NO_PERMISSIBLE_MOVES );
+			_events->noPermissibleMoves( player );
 		}
 
 		//if moved to current room by game play since last turn AND
@@ -203,8 +475,8 @@ const
 			! player->hasMadeSuggestionDuringTurn() )
 		{
 			//allowed to stay in room and make suggestion
-			std::cout << "  allow to stay in room and make suggestion\n";
-			turn_options->insert( clueless::MAKE_SUGGESTION );
+			_events->stayInRoomAllowed( player );
+			turn_options->addOption( clueless::MAKE_SUGGESTION );
 		}
 
 	}
@@ -212,14 +484,14 @@ const
 		player->getLocation()->isRoom() &&        // in room  AND
 		! player->hasMadeSuggestionDuringTurn() ) // has not made suggestion
 	{
-		turn_options->insert( clueless::MAKE_SUGGESTION );
+		turn_options->addOption( clueless::MAKE_SUGGESTION );
 	}
 
 	/// \note "make accusation" always option but only include if ready to make
 	///  accusation (for now) -- 29 Mar 2019, mem
 	if( player->isReadyToMakeAccusation() )
 	{
-		turn_options->insert( clueless::MAKE_ACCUSATION );
+		turn_options->addOption( clueless::MAKE_ACCUSATION );
 	}
 
 } //end routine determinePlayerTurnOptions()
@@ -229,7 +501,7 @@ const
 /// \brief Execute player's choice during turn.
 /// \param Player: current turn taker
 /// \param TurnOptionType: player's choice
-/// \param set<Location>: move options... may be empty collection
+/// \param MoveOptionSet: move options... may be empty collection
 /// \return None
 /// \throw None
 /// \note
@@ -239,37 +511,41 @@ void
 Game::executePlayerChoice(
 	Player* const player, //i - turn taker
 	clueless::TurnOptionType choice, //i - turn option choice
-	std::set<Location*>* const move_options) //i - move options
+	MoveOptionSet* const move_options) //i - move options
 {
 	switch( choice )
 	{
 	case clueless::MOVE:
 	{
+		CLUELESS_TIME_SCOPE( CHOICE_MOVE );
+
 		Location* destination( nullptr );
 
 		//consult player for preference
 		destination = player->provideMovePreference(move_options);
+		bool was_random_choice( nullptr == destination );
 
 		if( ! destination ) //no clear preference
 		{
 			//note: may have down-selected to fewer options
-			std::cout << "  random move choice... ";
 			destination = _board.chooseLocation(move_options);
 		}
 
 		_board.movePlayerTo(player, destination);
 		player->indicateHasMovedDuringTurn();
 
-		std::cout << "  move to " << destination->getName() << "\n";
+		_events->playerMoved( player, destination, was_random_choice );
 	}
 		break;
 
 	case clueless::MAKE_SUGGESTION:
 	{
+		CLUELESS_TIME_SCOPE( CHOICE_SUGGESTION );
+
 		//build suggestion
 		SolutionCardSet suggestion( player->buildSuggestion() );
 
-		notifyAllPlayers_playerMadeSuggestion( player->getCharacterName() );
+		notifyAllPlayers_playerMadeSuggestion( player, suggestion );
 
 		//pull suspected person and weapon into room
 		clueless::PersonType suggested_person( suggestion.getPersonType() );
@@ -302,20 +578,28 @@ Game::executePlayerChoice(
 			opponent_providing_counter_evidence );
 
 		player->indicateHasMadeSuggestionDuringTurn();
+		++_numSuggestions;
+
+		recordPublicSuggestionOutcome( player, suggestion, opponent_providing_counter_evidence );
 
 		if( counter_evidence )
 		{
-			notifyAllPlayers_playerRefutedSuggestion( opponent_providing_counter_evidence );
+			notifyAllPlayers_playerRefutedSuggestion( player, suggestion, opponent_providing_counter_evidence );
 		}
 		else //unrefuted
 		{
-			notifyAllPlayers_playerSuggestionUnrefuted( player->getCharacterName() );
+			++_numUnrefutedSuggestions;
+			notifyAllPlayers_playerSuggestionUnrefuted( player, suggestion );
 		}
+
+		_events->notebooksUpdated( player );
 	}
 		break;
 
 	case clueless::MAKE_ACCUSATION:
 	{
+		CLUELESS_TIME_SCOPE( CHOICE_ACCUSATION );
+
 		//build accusation
 		SolutionCardSet accusation( player->buildAccusation() );
 
@@ -334,7 +618,7 @@ Game::executePlayerChoice(
 			player->indicateHasMadeFalseAccusation();
 			++_numFalseAccusers;
 
-			notifyAllPlayers_falseAccuser( player );
+			notifyAllPlayers_falseAccuser( player, accusation );
 		}
 	}
 		break;
@@ -358,6 +642,11 @@ Game::executePlayerChoice(
 /// \note
 /// - It is important to ask each opponent for counter-evidence in the order of
 ///   play, starting with the opponent whose turn is next after suggestor.
+/// - Suggestor is asked last, only when no opponent can refute.
+/// - Players holding none of the suggested cards have nothing to show, so
+///   only the first player in order who does is asked; that player is found
+///   from dealt hands by rotating the mask of such seats to begin after
+///   suggestor and taking its lowest bit.
 ////////////////////////////////////////////////////////////////////////////////
 const Card*
 Game::requestCounterEvidenceToPlayerSuggestion(
@@ -366,60 +655,50 @@ Game::requestCounterEvidenceToPlayerSuggestion(
 	clueless::PersonType& opponent_character) // o- opponent with counter-evidence
 const
 {
-	//have not found counter-evidence for suggestor yet
-	const Card* counter_evidence( nullptr );
+	CLUELESS_TIME_SCOPE( COUNTER_EVIDENCE );
 
-	//determine suggestor iterator
-	bool have_found_suggestor_iter( false );
-	std::list<Player*>::const_iterator suggestor_iter( _players.begin() );
-	while( ! have_found_suggestor_iter &&
-		(_players.end() != suggestor_iter) )
+	//no counter-evidence unless found
+	opponent_character = clueless::UNKNOWN_PERSON;
+
+	size_t suggestor_seat( findSeat(suggestor) );
+	if( GameState::NO_SEAT == suggestor_seat ) //suggestor not in game
 	{
-		if( *suggestor_iter == suggestor )
-		{
-			have_found_suggestor_iter = true;
-		}
-		else //not suggestor
-		{
-			++suggestor_iter;
-		}
+		return nullptr;
 	}
 
-	//player following suggestor
-	std::list<Player*>::const_iterator player_iter( ++suggestor_iter );
-
-	//while have not found counter-evidence  AND
-	///     more players in list after suggestor
-	while( ! counter_evidence &&
-		(_players.end() != player_iter) )
+	//players holding any suggested card
+	unsigned int suggested_cards( determineSuggestedCards(*suggestion) );
+	unsigned int holding_seats( 0 );
+	for(size_t seat(0); seat < _numSeats; ++seat)
 	{
-		counter_evidence = (*player_iter)->offerEvidenceCounterToSuggestion(suggestion, suggestor);
-		opponent_character = (*player_iter)->getCharacter();
+		holding_seats |= ((0 != (_seatHands[seat] & suggested_cards)) ? 1u : 0u) << seat;
+	}
 
-		++player_iter; //next player
+	if( 0 == holding_seats )
+	{
+		return nullptr;
+	}
 
-	} //end while (more players in list after suggestor)
+	//rotate so bit 0 is player after suggestor (and suggestor is last bit)
+	size_t first_seat( _nextSeats[suggestor_seat] );
+	unsigned int in_turn_order(
+		((holding_seats >> first_seat) | (holding_seats << (_numSeats - first_seat))) &
+		((1u << _numSeats) - 1) );
 
-	//continue at start of player list
-	player_iter = _players.begin();
-	
-	//while have not found counter-evidence  AND
-	//      more players in list before suggestor
-	while( ! counter_evidence &&
-		(suggestor_iter != player_iter) )
+	size_t refuter_seat( first_seat + LOWEST_SEAT[in_turn_order] );
+	if( refuter_seat >= _numSeats )
 	{
-		counter_evidence = (*player_iter)->offerEvidenceCounterToSuggestion(suggestion, suggestor);
-		opponent_character = (*player_iter)->getCharacter();
-
-		++player_iter; //next player
+		refuter_seat -= _numSeats; //wrap to first seat
+	}
 
-	} //end while (more players in list before suggestor)
+	Player* refuter( _seats[refuter_seat] );
+	const Card* counter_evidence( refuter->offerEvidenceCounterToSuggestion(suggestion, suggestor) );
 
-	//if no counter-evidence uncovered
-	if( ! counter_evidence )
+	if( counter_evidence )
 	{
-		//clear last opponent
-		opponent_character = clueless::UNKNOWN_PERSON;
+		opponent_character = refuter->getCharacter();
+
+		_events->counterEvidenceShown( refuter, suggestor, counter_evidence );
 	}
 
 	return counter_evidence;
@@ -431,55 +710,86 @@ const
 // Player Notifications
 //------------------------------------------------------------------------------
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Notify all Players of 
-/// \param string: suggestor's character name
+/// \brief Notify all Players of suggestion.
+/// \param Player: suggestor
+/// \param SolutionCardSet: suggestion
 /// \return None
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
 void
 Game::notifyAllPlayers_playerMadeSuggestion(
-	const std::string& suggestor) //i - suggestor's character name
+	const Player* suggestor, //i - suggestor
+	const SolutionCardSet& suggestion) //i - suggestion
 const
 {
-	std::cout << "\nNotice to All Players...\n"
-		<< suggestor << " made a Suggestion\n";
+	_events->suggestionMade( suggestor, suggestion );
 
 } //end routine notifyAllPlayers_playerMadeSuggestion()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Notify all Players of 
-/// \param Player: 
+/// \brief Notify all Players of opponent refuting suggestion.
+/// \param Player: suggestor
+/// \param SolutionCardSet: suggestion
+/// \param PersonType: refuter's character
 /// \return None
 /// \throw None
-/// \note  None
+/// \note
+/// - Do not share counter-evidence with all players.
+/// - Every player may deduce from who refuted (and who could not).
 ////////////////////////////////////////////////////////////////////////////////
 void
 Game::notifyAllPlayers_playerRefutedSuggestion(
+	const Player* suggestor, //i - suggestor
+	const SolutionCardSet& suggestion, //i - suggestion
 	clueless::PersonType refuter) //i - player's character
 const
 {
-	std::cout << "\nNotice to All Players...\n"
-		<< clueless::translatePersonTypeToText(refuter) << " refuted Suggestion\n";
+	_events->suggestionRefuted( refuter );
+
+	std::list<Player*>::const_iterator player_iter( _players.begin() );
+	for(player_iter  = _players.begin();
+		player_iter != _players.end();
+		++player_iter )
+	{
+		(*player_iter)->_notebook.recordSuggestionOutcome(
+			suggestor->getCharacter(),
+			&suggestion,
+			refuter );
+
+	} //end for (each player)
 
 } //end routine notifyAllPlayers_playerRefutedSuggestion()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Notify all Players of 
-/// \param string: suggestor's character name
+/// \brief Notify all Players that no opponent could refute suggestion.
+/// \param Player: suggestor
+/// \param SolutionCardSet: suggestion
 /// \return None
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
 void
 Game::notifyAllPlayers_playerSuggestionUnrefuted(
-	const std::string& suggestor) //i - suggestor's character name
+	const Player* suggestor, //i - suggestor
+	const SolutionCardSet& suggestion) //i - suggestion
 const
 {
-	std::cout << "\nNotice to All Players...\n"
-		<< suggestor << "\'s Suggestion is unrefuted\n";
+	_events->suggestionUnrefuted( suggestor );
+
+	std::list<Player*>::const_iterator player_iter( _players.begin() );
+	for(player_iter  = _players.begin();
+		player_iter != _players.end();
+		++player_iter )
+	{
+		(*player_iter)->_notebook.recordSuggestionOutcome(
+			suggestor->getCharacter(),
+			&suggestion,
+			clueless::UNKNOWN_PERSON );
+
+	} //end for (each player)
 
 } //end routine notifyAllPlayers_playerSuggestionUnrefuted()
 
@@ -490,9 +800,7 @@ Game::notifyAllPlayers_personTokenMovedForSuggestion(
 	clueless::RoomType new_location) //i - new location
 const
 {
-	std::cout << "\nNotice to All Players...\n"
-		<< clueless::translatePersonTypeToText( character ) << " moved to "
-		<< clueless::translateRoomTypeToText( new_location ) << " in support of suggestion\n";
+	_events->personTokenMovedForSuggestion( character, new_location );
 
 } //end routine notifyAllPlayers_personTokenMovedForSuggestion()
 
@@ -503,9 +811,7 @@ Game::notifyAllPlayers_weaponTokenMovedForSuggestion(
 	clueless::RoomType new_location) //i - new location
 const
 {
-	std::cout << "\nNotice to All Players...\n"
-		<< clueless::translateWeaponTypeToText( wpn ) << " moved to "
-		<< clueless::translateRoomTypeToText( new_location ) << " in support of suggestion\n";
+	_events->weaponTokenMovedForSuggestion( wpn, new_location );
 
 } //end routine notifyAllPlayers_weaponTokenMovedForSuggestion()
 
@@ -522,8 +828,7 @@ Game::notifyAllPlayers_gameWinner(
 	const Player* winner) //i - game winner
 const
 {
-	std::cout << "\n*** " << winner->getName() << " WINS game\n"
-		<< "solution: " << _cards.reportCaseFile().str();
+	_events->gameWon( winner, *_cards.getCaseFile() );
 
 } //end routine notifyAllPlayers_gameWinner()
 
@@ -531,18 +836,92 @@ const
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Notify all Players of false accusation by Player.
 /// \param Player: false accuser
+/// \param SolutionCardSet: accusation
 /// \return None
 /// \throw None
 /// \note
-/// - Do not share contents of false accusation with all players.
+/// - Do not share contents of false accusation with all players; event sink
+///   receives it for the game record.
 ////////////////////////////////////////////////////////////////////////////////
 void
 Game::notifyAllPlayers_falseAccuser(
-	const Player* false_accuser) //i - false accuser
+	const Player* false_accuser, //i - false accuser
+	const SolutionCardSet& accusation) //i - accusation
 const
 {
-	std::cout << "\n*** " << false_accuser->getName() << " has made a false accusation\n"
-		<< "    eliminated from active game play\n";
+	_events->falseAccusationMade( false_accuser, accusation );
 
 } //end routine notifyAllPlayers_falseAccuser()
 
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Records what every player learned from suggestion's outcome.
+/// \param Player: suggestor
+/// \param SolutionCardSet: suggestion
+/// \param PersonType: refuter's character; unknown if unrefuted
+/// \return None
+/// \throw None
+/// \note
+/// - Same deductions as DetectiveNotebook::recordSuggestionOutcome(), for an
+///   onlooker holding no cards and shown nothing.
+////////////////////////////////////////////////////////////////////////////////
+void
+Game::recordPublicSuggestionOutcome(
+	const Player* suggestor, //i - suggestor
+	const SolutionCardSet& suggestion, //i - suggestion
+	clueless::PersonType refuter) //i - refuter's character
+{
+	unsigned int suggested_cards( determineSuggestedCards(suggestion) );
+
+	size_t seat( findSeat(suggestor) );
+	if( GameState::NO_SEAT == seat ) //suggestor not in game
+	{
+		return;
+	}
+
+	//each player asked before refuter could not refute
+	for(size_t num_asked(1); num_asked < _numSeats; ++num_asked)
+	{
+		seat = _nextSeats[seat];
+
+		if( _seats[seat]->getCharacter() == refuter )
+		{
+			break;
+		}
+
+		for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+		{
+			if( 0 != (suggested_cards & (1u << card_index)) )
+			{
+				_publicDeductions.recordCardNotHeld( card_index, _seats[seat]->getCharacter() );
+			}
+		}
+
+	} //end for (players asked)
+
+	if( clueless::UNKNOWN_PERSON != refuter )
+	{
+		_publicDeductions.recordHoldsOneOf( refuter, suggested_cards );
+	}
+
+	_publicDeductions.propagate();
+
+} //end routine recordPublicSuggestionOutcome()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Finds player's seat in turn order.
+/// \param Player: player of interest
+/// \return size_t: seat; NO_SEAT if not playing this game
+/// \throw None
+/// \note
+/// - Valid once setup() has seated players.
+////////////////////////////////////////////////////////////////////////////////
+size_t
+Game::findSeat(
+	const Player* player) //i - player of interest
+const
+{
+	return _characterSeats[player->getCharacter()];
+
+} //end routine findSeat()
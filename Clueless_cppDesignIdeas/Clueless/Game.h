@@ -12,6 +12,10 @@
 /// \note
 /// - The Game owns all of the elements required for play including the Board,
 ///   CardDeck, and Players.
+/// - Turn order is also held as a ring of seats (seat 0 plays first), each
+///   with the cards dealt to it as bits by card index, so the opponent who
+///   must refute a suggestion is found with one scan of a seat mask rather
+///   than by asking opponents one by one.
 ///
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -20,6 +24,12 @@
 
 #include "Board.h"
 #include "CardDeck.h"
+#include "DeductionMatrix.h"
+#include "GameEventSink.h"
+#include "GameState.h"
+#include "mersenneTwister.h"
+#include "MoveOptionSet.h"
+#include "TurnOptionSet.h"
 
 #include <list>		//for std::list use
 
@@ -39,6 +49,8 @@ public:
 	// Constructors / Destructor
 	//--------------------------------------------------------------------------
 	Game();
+	Game(unsigned long seed);
+	Game(unsigned long seed, const BoardLayout* layout);
 	virtual ~Game();
 
 	//--------------------------------------------------------------------------
@@ -46,20 +58,25 @@ public:
 	//--------------------------------------------------------------------------
 	bool hasWinner() const;
 
+	GameEventSink* getEventSink() const;
+	void setEventSink(GameEventSink* eventSink);
+
 	//--------------------------------------------------------------------------
 	// Additional Member Functions
 	//--------------------------------------------------------------------------
 	void setup(std::list<Player*>* allPlayers);
 
+	GameState snapshot(const Player* turnTaker) const;
+
 	void executePlayerTurn(Player* const player);
 
 	void determinePlayerTurnOptions(Player* const player,
-		const std::set<Location*>* const moveOptions,
-		std::set<clueless::TurnOptionType>* turnOptions) const;
+		const MoveOptionSet* const moveOptions,
+		TurnOptionSet* turnOptions) const;
 
 	void executePlayerChoice(Player* const player,
 		clueless::TurnOptionType choice,
-		std::set<Location*>* const move_options);
+		MoveOptionSet* const move_options);
 
 	const Card* requestCounterEvidenceToPlayerSuggestion(
 		const Player* suggestor,
@@ -67,26 +84,54 @@ public:
 		clueless::PersonType& opponentWithCounterEvidence) const;
 
 protected:
-	void notifyAllPlayers_playerMadeSuggestion(const std::string& suggestor) const;
-	void notifyAllPlayers_playerRefutedSuggestion(clueless::PersonType refuter) const;
-	void notifyAllPlayers_playerSuggestionUnrefuted(const std::string& suggestor) const;
+	void notifyAllPlayers_playerMadeSuggestion(const Player* suggestor, const SolutionCardSet& suggestion) const;
+	void notifyAllPlayers_playerRefutedSuggestion(const Player* suggestor,
+		const SolutionCardSet& suggestion,
+		clueless::PersonType refuter) const;
+	void notifyAllPlayers_playerSuggestionUnrefuted(const Player* suggestor,
+		const SolutionCardSet& suggestion) const;
 
 	void notifyAllPlayers_personTokenMovedForSuggestion(clueless::PersonType person, clueless::RoomType newLocation) const;
 	void notifyAllPlayers_weaponTokenMovedForSuggestion(clueless::WeaponType weapon, clueless::RoomType newLocation) const;
 
 	void notifyAllPlayers_gameWinner(const Player* winner) const;
-	void notifyAllPlayers_falseAccuser(const Player* accuser) const;
+	void notifyAllPlayers_falseAccuser(const Player* accuser, const SolutionCardSet& accusation) const;
+
+	void recordPublicSuggestionOutcome(const Player* suggestor,
+		const SolutionCardSet& suggestion,
+		clueless::PersonType refuter);
+
+	size_t findSeat(const Player* player) const;
 
 	//--------------------------------------------------------------------------
 	// Data Members
 	//--------------------------------------------------------------------------
 public:
+	/// \note declared before board and cards, which draw from it during
+	///       construction
+	MersenneTwister _rng;
+
 	Board _board;
 	CardDeck _cards;
 
 	std::list<Player*> _players;
 	Player* _winner;
 	size_t _numFalseAccusers;
+	size_t _numSuggestions;
+	size_t _numUnrefutedSuggestions; //nobody could show counter-evidence
+
+protected:
+	/// \note what every player saw: hand sizes and who could (not) refute
+	DeductionMatrix _publicDeductions;
+
+	GameEventSink* _events; //receives game play events (not owned); never null
+
+	/// \note turn order, filled by setup(); players not owned
+	Player* _seats[GameState::MAX_NUM_SEATS];
+	size_t _numSeats;
+	unsigned char _nextSeats[GameState::MAX_NUM_SEATS]; //seat playing after each seat
+	unsigned char _characterSeats[clueless::PROFESSOR_PLUM + 1]; //per character; NO_SEAT if not playing
+	unsigned int _seatHands[GameState::MAX_NUM_SEATS]; //bit per card index dealt to seat
 
 }; //end class Game defn
 
@@ -104,4 +149,14 @@ const
 } //end routine hasWinner()
 
 
+////////////////////////////////////////////////////////////////////////////////
+inline GameEventSink*
+Game::getEventSink()
+const
+{
+	return _events;
+
+} //end routine getEventSink()
+
+
 #endif //Game_h defn
@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file GameEventSink.h
+/// \brief Receives typed notifications of game play events.
+///
+/// \date   17 Oct 2026  1100
+///
+/// \note
+/// - Game reports each event with the raw values involved; a sink decides
+///   whether (and how) to format them.  NullEventSink discards everything, so
+///   silent games pay no formatting cost.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GameEventSink_h
+#define GameEventSink_h
+
+#include "CluelessEnums.h"	//for PersonType, WeaponType, RoomType, TurnOptionType use
+
+#include <list>		//for std::list use
+
+
+//forward declarations
+class Board;
+struct Card;
+class Location;
+class Player;
+struct SolutionCardSet;
+
+
+class GameEventSink
+{
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+public:
+	/// \brief Destructor
+	virtual ~GameEventSink()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Game Setup
+	//--------------------------------------------------------------------------
+	virtual void gameSetUp(const std::list<Player*>& players,
+		const Board& board,
+		const SolutionCardSet& caseFile) = 0;
+
+	//--------------------------------------------------------------------------
+	// Turn Progress
+	//--------------------------------------------------------------------------
+	virtual void turnStarted(const Player* player) = 0;
+	virtual void turnSkipped(const Player* falseAccuser) = 0;
+
+	virtual void noPermissibleMoves(const Player* player) = 0;
+	virtual void stayInRoomAllowed(const Player* player) = 0;
+
+	virtual void turnOptionChosen(const Player* player, clueless::TurnOptionType choice) = 0;
+
+	virtual void playerMoved(const Player* player,
+		const Location* destination,
+		bool wasRandomChoice) = 0;
+
+	//--------------------------------------------------------------------------
+	// Suggestions
+	//--------------------------------------------------------------------------
+	virtual void suggestionMade(const Player* suggestor, const SolutionCardSet& suggestion) = 0;
+
+	virtual void personTokenMovedForSuggestion(clueless::PersonType person, clueless::RoomType room) = 0;
+	virtual void weaponTokenMovedForSuggestion(clueless::WeaponType weapon, clueless::RoomType room) = 0;
+
+	virtual void counterEvidenceShown(const Player* refuter,
+		const Player* suggestor,
+		const Card* counterEvidence) = 0;
+
+	virtual void suggestionRefuted(clueless::PersonType refuter) = 0;
+	virtual void suggestionUnrefuted(const Player* suggestor) = 0;
+
+	/// \note every player has recorded suggestion's outcome; ends the
+	///       suggestion's phase of the turn
+	virtual void notebooksUpdated(const Player* suggestor) = 0;
+
+	//--------------------------------------------------------------------------
+	// Accusations
+	//--------------------------------------------------------------------------
+	virtual void gameWon(const Player* winner, const SolutionCardSet& caseFile) = 0;
+	virtual void falseAccusationMade(const Player* falseAccuser, const SolutionCardSet& accusation) = 0;
+
+}; //end class GameEventSink defn
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Discards all events.
+/// \note
+/// - Holds no state, so one shared instance serves every game.
+////////////////////////////////////////////////////////////////////////////////
+class NullEventSink : public GameEventSink
+{
+public:
+	static NullEventSink* shared()
+	{
+		static NullEventSink null_sink;
+		return &null_sink;
+	}
+
+	virtual void gameSetUp(const std::list<Player*>&, const Board&, const SolutionCardSet&) override {}
+
+	virtual void turnStarted(const Player*) override {}
+	virtual void turnSkipped(const Player*) override {}
+	virtual void noPermissibleMoves(const Player*) override {}
+	virtual void stayInRoomAllowed(const Player*) override {}
+	virtual void turnOptionChosen(const Player*, clueless::TurnOptionType) override {}
+	virtual void playerMoved(const Player*, const Location*, bool) override {}
+
+	virtual void suggestionMade(const Player*, const SolutionCardSet&) override {}
+	virtual void personTokenMovedForSuggestion(clueless::PersonType, clueless::RoomType) override {}
+	virtual void weaponTokenMovedForSuggestion(clueless::WeaponType, clueless::RoomType) override {}
+	virtual void counterEvidenceShown(const Player*, const Player*, const Card*) override {}
+	virtual void suggestionRefuted(clueless::PersonType) override {}
+	virtual void suggestionUnrefuted(const Player*) override {}
+	virtual void notebooksUpdated(const Player*) override {}
+
+	virtual void gameWon(const Player*, const SolutionCardSet&) override {}
+	virtual void falseAccusationMade(const Player*, const SolutionCardSet&) override {}
+
+}; //end class NullEventSink defn
+
+
+#endif //GameEventSink_h defn
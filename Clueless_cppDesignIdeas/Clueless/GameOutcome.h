@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file GameOutcome.h
+/// \brief Summary of a single completed (or abandoned) game.
+///
+/// \date   17 Oct 2026  0900
+///
+/// \note
+/// - Filled in by GameSimulator once a game ends; consumed by batch statistics.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GameOutcome_h
+#define GameOutcome_h
+
+#include "CluelessEnums.h"	//for PersonType use
+
+#include <stddef.h>		//for size_t use
+
+
+struct GameOutcome
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+	static const size_t MAX_NUM_SEATS = 6; //one seat per character
+	static const size_t NO_WINNER     = MAX_NUM_SEATS;
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+	GameOutcome()
+		: _numPlayers( 0 )
+		, _winnerSeat( NO_WINNER )
+		, _winnerCharacter( clueless::UNKNOWN_PERSON )
+		, _numTurnsPlayed( 0 )
+		, _numFalseAccusers( 0 )
+		, _numSuggestions( 0 )
+		, _numUnrefutedSuggestions( 0 )
+		, _reachedTurnLimit( false )
+	{
+		for(size_t seat(0); seat < MAX_NUM_SEATS; ++seat)
+		{
+			_seatCharacters[seat] = clueless::UNKNOWN_PERSON;
+			_isFalseAccuser[seat] = false;
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	bool hasWinner() const
+	{
+		return( NO_WINNER != _winnerSeat );
+	}
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+	size_t _numPlayers;
+	clueless::PersonType _seatCharacters[MAX_NUM_SEATS]; //unknown person for empty seat
+
+	size_t _winnerSeat; //zero-based position in turn order; NO_WINNER if none
+	clueless::PersonType _winnerCharacter;
+
+	unsigned int _numTurnsPlayed; //turns (rounds of play), incl. winning turn
+	size_t _numFalseAccusers;
+	bool _isFalseAccuser[MAX_NUM_SEATS];
+
+	size_t _numSuggestions;
+	size_t _numUnrefutedSuggestions; //nobody could show counter-evidence
+
+	bool _reachedTurnLimit; //game abandoned at turn cap
+
+}; //end struct GameOutcome defn
+
+
+#endif //GameOutcome_h defn
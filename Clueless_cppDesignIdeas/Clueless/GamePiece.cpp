@@ -45,6 +45,7 @@ GamePiece::GamePiece()
 GamePiece::GamePiece(
 	GamePiece::PieceType type) //i - type of piece
 	: _location( nullptr )
+	, _type( type )
 {
 }
 
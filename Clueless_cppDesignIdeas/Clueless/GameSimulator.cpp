@@ -0,0 +1,271 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file GameSimulator.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  0910
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "GameSimulator.h"
+
+#include "BoardLayout.h"
+#include "Game.h"
+#include "IsmctsStrategy.h"
+#include "Player.h"
+#include "PlayerStrategy.h"
+
+#include <list>				//for std::list use
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::logic_error use
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param size_t: number of players per game
+/// \param unsigned int: turn cap after which game is abandoned
+/// \param BoardLayout: board layout (not owned); nullptr for classic
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when number of players outside [3, 6].
+/// \note
+/// - Layout must outlive simulator.
+////////////////////////////////////////////////////////////////////////////////
+GameSimulator::GameSimulator(
+	size_t num_players, //i - number of players per game
+	unsigned int max_num_turns, //i - turn cap
+	const BoardLayout* layout) //i - board layout
+	: _numPlayers( num_players )
+	, _maxNumTurns( max_num_turns )
+	, _layout( layout ? layout : BoardLayout::classic() )
+	, _searchSeats( 0 )
+	, _searchBudget()
+	, _accusationConfidence( 1.0f )
+{
+	if( (MIN_NUM_PLAYERS > num_players) ||
+		(MAX_NUM_PLAYERS < num_players) )
+	{
+		std::ostringstream msg;
+		msg << "GameSimulator extended constructor\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  number of players must be in [" << MIN_NUM_PLAYERS << ", "
+			<< MAX_NUM_PLAYERS << "], not " << num_players;
+		throw std::logic_error( msg.str() );
+	}
+
+	for(size_t seat(0); seat < MAX_NUM_PLAYERS; ++seat)
+	{
+		_seatStrategies[seat] = nullptr;
+	}
+
+} //end routine extended constructor
+
+
+//------------------------------------------------------------------------------
+// Accessors and Mutators
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns character played from specified seat.
+/// \param size_t: zero-based seat (position in turn order)
+/// \return PersonType: character
+/// \throw None
+/// \note
+/// - Seats follow the character enumeration, so Miss Scarlet always plays first.
+////////////////////////////////////////////////////////////////////////////////
+clueless::PersonType
+GameSimulator::determineSeatCharacter(
+	size_t seat) //i - zero-based seat
+{
+	return clueless::PersonType( clueless::MISS_SCARLET + seat );
+
+} //end routine determineSeatCharacter()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Has specified seat play by strategy.
+/// \param size_t: zero-based seat
+/// \param PlayerStrategy: cloned for seat's player in every game (not
+///  owned); null for Player's heuristics
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when seat not in [0, number of players).
+/// \note
+/// - Set before sharing simulator between threads; strategy must outlive
+///   simulator.
+/// - Takes precedence over setSearchSeats() for that seat.
+////////////////////////////////////////////////////////////////////////////////
+void
+GameSimulator::setSeatStrategy(
+	size_t seat, //i - zero-based seat
+	const PlayerStrategy* strategy) //i - strategy to clone for seat
+{
+	if( _numPlayers <= seat )
+	{
+		std::ostringstream msg;
+		msg << "GameSimulator::setSeatStrategy()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  seat must be in [0, " << _numPlayers << "), not " << seat;
+		throw std::logic_error( msg.str() );
+	}
+
+	_seatStrategies[seat] = strategy;
+
+} //end routine setSeatStrategy()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Has IsmctsStrategy play specified seats.
+/// \param unsigned int: bit (1 << zero-based seat) per searching seat
+/// \param Budget: search limits per turn choice
+/// \return None
+/// \throw None
+/// \note
+/// - Set before sharing simulator between threads.
+/// - Iteration budget keeps games reproducible from seed; time budget does
+///   not.
+////////////////////////////////////////////////////////////////////////////////
+void
+GameSimulator::setSearchSeats(
+	unsigned int seat_mask, //i - searching seats
+	const IsmctsSearch::Budget& budget) //i - search limits per turn choice
+{
+	_searchSeats = seat_mask;
+	_searchBudget = budget;
+
+} //end routine setSearchSeats()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Sets chance of being right at which every player accuses.
+/// \param float: chance needed to accuse before Case File is deduced; 1 (the
+///  default) waits for deduction
+/// \return None
+/// \throw None
+/// \note
+/// - Set before sharing simulator between threads.
+////////////////////////////////////////////////////////////////////////////////
+void
+GameSimulator::setAccusationConfidence(
+	float confidence) //i - chance needed to accuse early
+{
+	_accusationConfidence = confidence;
+
+} //end routine setAccusationConfidence()
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Plays one complete game without narration.
+/// \param unsigned long: seed for game's random number generator
+/// \param GameEventSink: receives game play events (not owned); nullptr for
+///  none
+/// \return GameOutcome: winner, turns played, false accusers, suggestions
+/// \throw None
+/// \note
+/// - Same seed reproduces same game; events do not change play (e.g. a
+///   ReplayLogSink records game for replay).
+////////////////////////////////////////////////////////////////////////////////
+GameOutcome
+GameSimulator::playGame(
+	unsigned long seed, //i - seed for game's random number generator
+	GameEventSink* events) //i - receives game play events
+const
+{
+	GameOutcome outcome;
+	outcome._numPlayers = _numPlayers;
+
+	//build players (first player is marked as game creator)
+	std::list<Player*> players;
+	for(size_t seat(0); seat < _numPlayers; ++seat)
+	{
+		std::ostringstream name;
+		name << "Player " << (seat + 1);
+
+		players.push_back(
+			new Player(name.str(), determineSeatCharacter(seat), (0 == seat)) );
+
+		if( _seatStrategies[seat] )
+		{
+			players.back()->setStrategy( _seatStrategies[seat]->clone() );
+		}
+		else if( 0 != (_searchSeats & (1u << seat)) )
+		{
+			players.back()->setStrategy( new IsmctsStrategy(_searchBudget) );
+		}
+
+		players.back()->setAccusationConfidence( _accusationConfidence );
+
+	} //end for (each seat)
+
+	Game game( seed, _layout );
+	game.setEventSink( events );
+	game.setup( &players );
+
+	unsigned int turn_number( 0 );
+
+	while( ! game.hasWinner() &&
+		(game._numFalseAccusers < game._players.size()) &&
+		(_maxNumTurns > turn_number) )
+	{
+		std::list<Player*>::const_iterator player_iter( players.begin() );
+		while( ! game.hasWinner() &&
+			(players.end() != player_iter) )
+		{
+			game.executePlayerTurn( *player_iter );
+
+			++player_iter;
+
+		} //end while (more players)
+
+		++turn_number; //next turn
+
+	} //end while (reason to continue turns)
+
+	//--------------------------------------------------------------------------
+	// record outcome
+	//--------------------------------------------------------------------------
+	outcome._numTurnsPlayed = turn_number;
+	outcome._numFalseAccusers = game._numFalseAccusers;
+	outcome._numSuggestions = game._numSuggestions;
+	outcome._numUnrefutedSuggestions = game._numUnrefutedSuggestions;
+	outcome._reachedTurnLimit = ! game.hasWinner() &&
+		(game._numFalseAccusers < game._players.size());
+
+	size_t seat( 0 );
+	std::list<Player*>::iterator player_iter( players.begin() );
+	for(player_iter  = players.begin();
+		player_iter != players.end();
+		++player_iter, ++seat)
+	{
+		if( (*player_iter)->isGameWinner() )
+		{
+			outcome._winnerSeat = seat;
+			outcome._winnerCharacter = (*player_iter)->getCharacter();
+		}
+
+		outcome._seatCharacters[seat] = (*player_iter)->getCharacter();
+		outcome._isFalseAccuser[seat] = (*player_iter)->isFalseAccuser();
+
+	} //end for (each player)
+
+	//game does not own players
+	for(player_iter  = players.begin();
+		player_iter != players.end();
+		++player_iter)
+	{
+		delete *player_iter;
+	}
+
+	return outcome;
+
+} //end routine playGame()
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file GameSimulator.h
+/// \brief Plays complete games without console narration for batch runs.
+///
+/// \date   17 Oct 2026  0905
+///
+/// \note
+/// - Mirrors the turn loop in Main.cpp: every active player takes a turn each
+///   round until someone wins, everyone has made a false accusation, or the
+///   turn cap is reached.
+/// - Holds no mutable state; one simulator may be shared by many threads.
+/// - Seats play Player's heuristics unless given a strategy (see
+///   setSeatStrategy()) or set to search (see setSearchSeats()).
+/// - Players accuse once the Case File is deduced unless allowed to accuse
+///   on a likely guess (see setAccusationConfidence()).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GameSimulator_h
+#define GameSimulator_h
+
+#include "GameOutcome.h"
+#include "IsmctsSearch.h"
+
+#include "CluelessEnums.h"	//for PersonType use
+
+#include <stddef.h>		//for size_t use
+
+
+//forward declarations
+class BoardLayout;
+class GameEventSink;
+class PlayerStrategy;
+
+
+class GameSimulator
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const size_t MIN_NUM_PLAYERS = 3;
+	static const size_t MAX_NUM_PLAYERS = GameOutcome::MAX_NUM_SEATS;
+
+	static const unsigned int DEFAULT_MAX_NUM_TURNS = 100;
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	GameSimulator();
+
+public:
+	GameSimulator(size_t numPlayers,
+		unsigned int maxNumTurns = DEFAULT_MAX_NUM_TURNS,
+		const BoardLayout* layout = nullptr);
+
+	virtual ~GameSimulator()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	size_t getNumPlayers() const;
+	unsigned int getMaxNumTurns() const;
+
+	const PlayerStrategy* getSeatStrategy(size_t seat) const;
+	void setSeatStrategy(size_t seat, const PlayerStrategy* strategy);
+
+	void setSearchSeats(unsigned int seatMask, const IsmctsSearch::Budget& budget);
+	void setAccusationConfidence(float confidence);
+
+	static clueless::PersonType determineSeatCharacter(size_t seat);
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	GameOutcome playGame(unsigned long seed, GameEventSink* events = nullptr) const;
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	size_t _numPlayers;
+	unsigned int _maxNumTurns;
+	const BoardLayout* _layout; //shared by every game (not owned)
+
+	/// \note cloned for each game's player (not owned); null for none
+	const PlayerStrategy* _seatStrategies[MAX_NUM_PLAYERS];
+
+	unsigned int _searchSeats; //bit (1 << seat) per seat played by IsmctsStrategy
+	IsmctsSearch::Budget _searchBudget;
+
+	float _accusationConfidence; //every seat's (see Player::isReadyToMakeAccusation())
+
+}; //end class GameSimulator defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+GameSimulator::getNumPlayers()
+const
+{
+	return _numPlayers;
+
+} //end routine getNumPlayers()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned int
+GameSimulator::getMaxNumTurns()
+const
+{
+	return _maxNumTurns;
+
+} //end routine getMaxNumTurns()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline const PlayerStrategy*
+GameSimulator::getSeatStrategy(
+	size_t seat) //i - zero-based seat
+const
+{
+	return _seatStrategies[seat];
+
+} //end routine getSeatStrategy()
+
+
+#endif //GameSimulator_h defn
@@ -0,0 +1,615 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file GameState.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  1600
+///
+/// \note
+/// - Rules follow Game::determinePlayerTurnOptions() and
+///   Game::executePlayerChoice().
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "GameState.h"
+
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::logic_error use
+#include <type_traits>		//for std::is_trivially_copyable use
+
+//copying a state must stay a plain memcpy
+static_assert( std::is_trivially_copyable<GameState>::value,
+	"GameState must remain trivially copyable" );
+
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Default constructor
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - No seats; see Game::snapshot() for state of a live game.
+////////////////////////////////////////////////////////////////////////////////
+GameState::GameState()
+	: _seats()
+	, _numSeats( 0 )
+	, _turnSeat( 0 )
+	, _winnerSeat( NO_SEAT )
+	, _numFalseAccusers( 0 )
+	, _personLocations()
+	, _weaponLocations()
+	, _caseFile()
+	, _publicNotebook()
+	, _lastRefuterSeat( NO_SEAT )
+	, _lastShownCard( NO_CARD )
+	, _numRounds( 0 )
+{
+} //end routine constructor
+
+
+//------------------------------------------------------------------------------
+// Accessors and Mutators
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns seat of player with character.
+/// \param PersonType: player's character
+/// \return size_t: seat; NO_SEAT if character has no player
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+size_t
+GameState::findSeat(
+	clueless::PersonType character) //i - player's character
+const
+{
+	for(size_t seat(0); seat < _numSeats; ++seat)
+	{
+		if( character == _seats[seat]._character )
+		{
+			return seat;
+		}
+	}
+
+	return NO_SEAT;
+
+} //end routine findSeat()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns whether seat's notebook places one card of each element
+///  type in the Case File.
+/// \param size_t: seat of interest
+/// \return bool: whether ready to make accusation
+/// \throw None
+/// \note
+/// - Same deductions that set notebook's suspected elements (see
+///   DetectiveNotebook::applyDeductions()).
+////////////////////////////////////////////////////////////////////////////////
+bool
+GameState::isReadyToMakeAccusation(
+	size_t seat) //i - seat of interest
+const
+{
+	SolutionCardSet accusation( determineAccusation(seat) );
+
+	return(
+		(clueless::UNKNOWN_PERSON != accusation._person) &&
+		(clueless::UNKNOWN_WEAPON != accusation._weapon) &&
+		(clueless::UNKNOWN_ROOM != accusation._room) );
+
+} //end routine isReadyToMakeAccusation()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns cards seat's notebook places in the Case File.
+/// \param size_t: seat of interest
+/// \return SolutionCardSet: deduced Case File; unknown where not deduced
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+SolutionCardSet
+GameState::determineAccusation(
+	size_t seat) //i - seat of interest
+const
+{
+	const DeductionMatrix& notebook( _seats[seat]._notebook );
+	SolutionCardSet accusation;
+
+	for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+	{
+		if( DeductionMatrix::CASE_FILE != notebook.findHolder(card_index) )
+		{
+			continue; //next card
+		}
+
+		unsigned char subtype( (unsigned char)clueless::determineCardSubtype(card_index) );
+
+		switch( clueless::determineCardElementType(card_index) )
+		{
+		case clueless::PERSON:
+			accusation._person = subtype;
+			break;
+
+		case clueless::WEAPON:
+			accusation._weapon = subtype;
+			break;
+
+		default: //room
+			accusation._room = subtype;
+		} //end switch (on card type)
+
+	} //end for (each card)
+
+	return accusation;
+
+} //end routine determineAccusation()
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Determines turn taker's options.
+/// \param BoardLayout: layout of game
+/// \return unsigned int: bit (1 << TurnOptionType) per option; zero when
+///  turn is over
+/// \throw None
+/// \note
+/// - Ending turn early (DO_NOTHING_ELSE_THIS_TURN) is never included, but is
+///   always accepted by apply().
+////////////////////////////////////////////////////////////////////////////////
+unsigned int
+GameState::determineTurnOptions(
+	const BoardLayout& layout) //i - layout of game
+const
+{
+	unsigned int options( 0 );
+
+	if( isOver() ||
+		hasFlag(_turnSeat, GAME_WINNER) ||
+		hasFlag(_turnSeat, FALSE_ACCUSER) )
+	{
+		return options;
+	}
+
+	bool has_moved( hasFlag(_turnSeat, MOVED_DURING_TURN) );
+	bool has_suggested( hasFlag(_turnSeat, SUGGESTED_DURING_TURN) );
+
+	if( ! has_moved && ! has_suggested )
+	{
+		unsigned char destinations[MAX_NUM_MOVE_OPTIONS];
+		if( 0 < determineMoveOptions(layout, destinations) )
+		{
+			options |= (1u << clueless::MOVE);
+		}
+
+		if( hasFlag(_turnSeat, MOVED_TO_ROOM_OUT_OF_TURN) )
+		{
+			options |= (1u << clueless::MAKE_SUGGESTION);
+		}
+	}
+	else if( BoardLayout::isRoomId(getLocationId(_turnSeat)) &&
+		! has_suggested )
+	{
+		options |= (1u << clueless::MAKE_SUGGESTION);
+	}
+
+	if( isReadyToMakeAccusation(_turnSeat) )
+	{
+		options |= (1u << clueless::MAKE_ACCUSATION);
+	}
+
+	return options;
+
+} //end routine determineTurnOptions()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Determines where turn taker may move.
+/// \param BoardLayout: layout of game
+/// \param unsigned char[]: destinations (location identifiers), at least
+///  MAX_NUM_MOVE_OPTIONS long
+/// \return size_t: number of destinations
+/// \throw None
+/// \note
+/// - Every connection, occupied or not: as played, a hallway never refuses a
+///   token (Hallway::addOccupant() records no occupant, so
+///   Room::getMoveOptions() finds every hallway free).
+/// - Layouts give no location more than BoardLayout::MAX_NUM_EXITS
+///   connections (see BoardLayout::parse()), so destinations fit.
+////////////////////////////////////////////////////////////////////////////////
+size_t
+GameState::determineMoveOptions(
+	const BoardLayout& layout, //i - layout of game
+	unsigned char destinations[]) // o- destinations
+const
+{
+	size_t loc_id( getLocationId(_turnSeat) );
+
+	const unsigned char* connections( layout.getConnections(loc_id) );
+	size_t num_connections( layout.getNumConnections(loc_id) );
+
+	size_t num_destinations( 0 );
+
+	for(size_t conn_index(0); conn_index < num_connections; ++conn_index)
+	{
+		destinations[num_destinations++] = connections[conn_index];
+	}
+
+	return num_destinations;
+
+} //end routine determineMoveOptions()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Applies turn taker's choice.
+/// \param Action: turn taker's choice
+/// \param BoardLayout: layout of game
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when game over, choice not a turn option, or move
+///   destination not a move option.
+/// - INSUFFICIENT_DATA when suggestion missing person or weapon.
+/// \note
+/// - Turn passes on once turn taker has no options left (as in
+///   Game::executePlayerTurn()) or chooses to do nothing else; players with
+///   no options at all are passed over.
+////////////////////////////////////////////////////////////////////////////////
+void
+GameState::apply(
+	const Action& action, //i - turn taker's choice
+	const BoardLayout& layout) //i - layout of game
+{
+	if( isOver() ||
+		((clueless::DO_NOTHING_ELSE_THIS_TURN != action._choice) &&
+		 (0 == (determineTurnOptions(layout) & (1u << action._choice)))) )
+	{
+		std::ostringstream msg;
+		msg << "GameState::apply()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  choice " << action._choice << " not available to seat " << (size_t)_turnSeat;
+		throw std::logic_error( msg.str() );
+	}
+
+	switch( action._choice )
+	{
+	case clueless::MOVE:
+	{
+		unsigned char destinations[MAX_NUM_MOVE_OPTIONS];
+		size_t num_destinations( determineMoveOptions(layout, destinations) );
+
+		size_t dest_index( 0 );
+		while( (dest_index < num_destinations) &&
+			(destinations[dest_index] != action._destination) )
+		{
+			++dest_index;
+		}
+
+		if( num_destinations == dest_index )
+		{
+			std::ostringstream msg;
+			msg << "GameState::apply()\n"
+				<< "  INCONSISTENT_DATA\n"
+				<< "  location " << (size_t)action._destination << " not a move option";
+			throw std::logic_error( msg.str() );
+		}
+
+		move( action._destination );
+	}
+		break;
+
+	case clueless::MAKE_SUGGESTION:
+		if( (clueless::UNKNOWN_PERSON == action._cards._person) ||
+			(clueless::UNKNOWN_WEAPON == action._cards._weapon) )
+		{
+			std::ostringstream msg;
+			msg << "GameState::apply()\n"
+				<< "  INSUFFICIENT_DATA\n"
+				<< "  suggestion missing person or weapon";
+			throw std::logic_error( msg.str() );
+		}
+
+		suggest( action._cards.getPersonType(), action._cards.getWeaponType() );
+		break;
+
+	case clueless::MAKE_ACCUSATION:
+		accuse( action._cards );
+		break;
+
+	case clueless::DO_NOTHING_ELSE_THIS_TURN:
+	default:
+		;
+
+	} //end switch (on choice)
+
+	if( (clueless::DO_NOTHING_ELSE_THIS_TURN == action._choice) ||
+		(0 == determineTurnOptions(layout)) )
+	{
+		endTurn( layout );
+	}
+
+} //end routine apply()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns state after turn taker's choice.
+/// \param GameState: state before choice
+/// \param Action: turn taker's choice
+/// \param BoardLayout: layout of game
+/// \return GameState: state after choice
+/// \throw
+/// - INCONSISTENT_DATA when choice not permitted (see apply()).
+/// \note
+/// - Pure: depends only on arguments, which are unchanged.
+////////////////////////////////////////////////////////////////////////////////
+GameState
+GameState::step(
+	const GameState& state, //i - state before choice
+	const Action& action, //i - turn taker's choice
+	const BoardLayout& layout) //i - layout of game
+{
+	GameState next( state );
+	next.apply( action, layout );
+
+	return next;
+
+} //end routine step()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Moves turn taker's token.
+/// \param size_t: destination (location identifier)
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+GameState::move(
+	size_t dest_id) //i - destination
+{
+	Seat& seat( _seats[_turnSeat] );
+
+	_personLocations[seat._character - 1] = (unsigned char)dest_id;
+	seat._flags |= MOVED_DURING_TURN;
+
+} //end routine move()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Makes suggestion in turn taker's room and has players refute it.
+/// \param PersonType: suggested person
+/// \param WeaponType: suggested weapon
+/// \return None
+/// \throw None
+/// \note
+/// - Players asked in order of play, starting after suggestor, with
+///   suggestor asked last (as Game::requestCounterEvidenceToPlayerSuggestion()
+///   does); first with any suggested card shows one.  Every notebook records
+///   the outcome as DetectiveNotebook::recordSuggestionOutcome() would, as
+///   does the public notebook.
+/// - Tokens moved into room do not let their players stay and suggest, as in
+///   live play (see Player::wasMovedToRoomOutOfTurn()).
+////////////////////////////////////////////////////////////////////////////////
+void
+GameState::suggest(
+	clueless::PersonType person, //i - suggested person
+	clueless::WeaponType weapon) //i - suggested weapon
+{
+	size_t suggestor_seat( _turnSeat );
+	size_t room_id( getLocationId(suggestor_seat) );
+	clueless::RoomType room( clueless::RoomType(room_id + 1) );
+
+	//pull suspected person and weapon into room
+	_personLocations[person - 1] = (unsigned char)room_id;
+	_weaponLocations[weapon - 1] = (unsigned char)room_id;
+
+	unsigned int suggested_cards(
+		(1u << clueless::determineCardIndex(person)) |
+		(1u << clueless::determineCardIndex(weapon)) |
+		(1u << clueless::determineCardIndex(room)) );
+
+	//find refuter
+	_lastRefuterSeat = NO_SEAT;
+	_lastShownCard = NO_CARD;
+
+	for(size_t offset(1); (offset <= _numSeats) && (NO_SEAT == _lastRefuterSeat); ++offset)
+	{
+		size_t seat( (suggestor_seat + offset) % _numSeats ); //suggestor last
+		unsigned int matching_cards( _seats[seat]._hand & suggested_cards );
+
+		if( 0 != matching_cards )
+		{
+			_lastRefuterSeat = (unsigned char)seat;
+			_lastShownCard = (unsigned char)chooseCardToShow(seat, matching_cards, suggestor_seat);
+		}
+	}
+
+	unsigned char suggestor_character( _seats[suggestor_seat]._character );
+	size_t refuter_character( clueless::UNKNOWN_PERSON );
+
+	if( NO_SEAT != _lastRefuterSeat )
+	{
+		Seat& refuter( _seats[_lastRefuterSeat] );
+		refuter_character = refuter._character;
+		refuter._playersShown[_lastShownCard] |= (unsigned char)(1u << suggestor_character);
+
+		//suggestor sees counter-evidence
+		_seats[suggestor_seat]._notebook.recordCardHeld( _lastShownCard, refuter_character );
+	}
+
+	//every notebook records who could not refute, and who did
+	//(every opponent, when suggestor refuted or nobody did)
+	size_t num_not_refuting( _numSeats - 1 );
+	if( (NO_SEAT != _lastRefuterSeat) && (suggestor_seat != _lastRefuterSeat) )
+	{
+		num_not_refuting = ((_lastRefuterSeat + _numSeats - suggestor_seat) % _numSeats) - 1;
+	}
+
+	//(and the public notebook, owned by no seat, after the last seat's)
+	for(size_t seat(0); seat <= _numSeats; ++seat)
+	{
+		bool is_public( _numSeats == seat );
+		DeductionMatrix& notebook( is_public ? _publicNotebook : _seats[seat]._notebook );
+
+		for(size_t offset(1); offset <= num_not_refuting; ++offset)
+		{
+			size_t holder( _seats[(suggestor_seat + offset) % _numSeats]._character );
+
+			for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+			{
+				if( 0 != (suggested_cards & (1u << card_index)) )
+				{
+					notebook.recordCardNotHeld( card_index, holder );
+				}
+			}
+		}
+
+		if( (clueless::UNKNOWN_PERSON != refuter_character) &&
+			(is_public || (_seats[seat]._character != refuter_character)) )
+		{
+			notebook.recordHoldsOneOf( refuter_character, suggested_cards );
+		}
+
+		notebook.propagate();
+
+	} //end for (each seat)
+
+	_seats[suggestor_seat]._flags |= SUGGESTED_DURING_TURN;
+
+} //end routine suggest()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Compares turn taker's accusation to Case File.
+/// \param SolutionCardSet: accusation
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+GameState::accuse(
+	const SolutionCardSet& accusation) //i - accusation
+{
+	Seat& seat( _seats[_turnSeat] );
+
+	if( accusation == _caseFile )
+	{
+		seat._flags |= GAME_WINNER;
+		_winnerSeat = _turnSeat;
+	}
+	else //false accusation
+	{
+		seat._flags |= FALSE_ACCUSER;
+		++_numFalseAccusers;
+	}
+
+} //end routine accuse()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Passes turn to next player with any turn option.
+/// \param BoardLayout: layout of game
+/// \return None
+/// \throw None
+/// \note
+/// - Clears per-turn status (see Player::prepareForNewTurn()), even when
+///   game is over, as Game::executePlayerTurn() does.
+/// - Rounds counted as turn returns to first seat.
+/// - Passes over each seat at most once, so stops even if nobody can act.
+////////////////////////////////////////////////////////////////////////////////
+void
+GameState::endTurn(
+	const BoardLayout& layout) //i - layout of game
+{
+	const unsigned char PER_TURN_FLAGS(
+		MOVED_TO_ROOM_OUT_OF_TURN | MOVED_DURING_TURN | SUGGESTED_DURING_TURN );
+
+	if( isOver() )
+	{
+		_seats[_turnSeat]._flags &= (unsigned char)~PER_TURN_FLAGS;
+		return;
+	}
+
+	size_t num_passes( 0 );
+
+	do
+	{
+		_seats[_turnSeat]._flags &= (unsigned char)~PER_TURN_FLAGS;
+
+		_turnSeat = (unsigned char)((_turnSeat + 1) % _numSeats);
+		if( 0 == _turnSeat )
+		{
+			++_numRounds;
+		}
+
+		++num_passes;
+
+	} while( (0 == determineTurnOptions(layout)) &&
+		(num_passes < _numSeats) );
+
+} //end routine endTurn()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Chooses which matching card refuter shows suggestor.
+/// \param size_t: refuter's seat
+/// \param unsigned int: bit (1 << card index) per matching card in hand
+/// \param size_t: suggestor's seat
+/// \return size_t: card index
+/// \throw None
+/// \note
+/// - Follows DetectiveNotebook::decideWhichCardToShowOpponent(): favor card
+///   already shown to suggestor, then card shown to most opponents.  Ties
+///   go to lowest card index rather than a random draw, so stepping a state
+///   never consumes random numbers.
+////////////////////////////////////////////////////////////////////////////////
+size_t
+GameState::chooseCardToShow(
+	size_t refuter_seat, //i - refuter's seat
+	unsigned int matching_cards, //i - matching cards in hand
+	size_t suggestor_seat) //i - suggestor's seat
+const
+{
+	const Seat& refuter( _seats[refuter_seat] );
+	unsigned char suggestor_bit( (unsigned char)(1u << _seats[suggestor_seat]._character) );
+
+	size_t choice( NO_CARD );
+	size_t greatest_num_shown( 0 );
+
+	for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+	{
+		if( 0 == (matching_cards & (1u << card_index)) )
+		{
+			continue; //next card
+		}
+
+		unsigned char players_shown( refuter._playersShown[card_index] );
+		if( 0 != (players_shown & suggestor_bit) )
+		{
+			return card_index;
+		}
+
+		size_t num_shown( 0 );
+		for(; 0 != players_shown; players_shown &= (unsigned char)(players_shown - 1))
+		{
+			++num_shown;
+		}
+
+		if( (NO_CARD == choice) || (num_shown > greatest_num_shown) )
+		{
+			choice = card_index;
+			greatest_num_shown = num_shown;
+		}
+
+	} //end for (each card)
+
+	return choice;
+
+} //end routine chooseCardToShow()
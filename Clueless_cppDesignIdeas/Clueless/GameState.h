@@ -0,0 +1,247 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file GameState.h
+/// \brief Flat, pointer-free snapshot of a game in progress, advanced by
+///        applying turn actions.
+///
+/// \date   17 Oct 2026  1600
+///
+/// \note
+/// - Built for search-based players: take one snapshot of a live game (see
+///   Game::snapshot()), then copy and advance it as often as needed.  Every
+///   member is a plain value, so a copy is a single memcpy and touches no
+///   heap.
+/// - Seats follow order of play.  Person and weapon tokens are located by
+///   BoardLayout location identifier, so a state is only meaningful with the
+///   layout of the game it came from.
+/// - Each seat's notebook is represented by its DeductionMatrix, which holds
+///   everything the seat has learned about who holds each card.  A further
+///   matrix holds only what all seats saw.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GameState_h
+#define GameState_h
+
+#include "BoardLayout.h"
+#include "DeductionMatrix.h"
+#include "SolutionCardSet.h"
+
+#include "CluelessEnums.h"	//for PersonType, WeaponType, TurnOptionType use
+
+#include <stddef.h>		//for size_t use
+
+
+class GameState
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const size_t MAX_NUM_SEATS = clueless::PROFESSOR_PLUM;
+	static const size_t MAX_NUM_MOVE_OPTIONS = BoardLayout::MAX_NUM_EXITS; //secret passage is an exit
+
+	static const unsigned char NO_SEAT = 0xFF;
+	static const unsigned char NO_CARD = 0xFF;
+
+	//--------------------------------------------------------------------------
+	// Class-Scoped Enumerated Types
+	//--------------------------------------------------------------------------
+public:
+	/// \brief Per-seat status, as bits (see Player).
+	enum SeatFlag
+	{
+		FALSE_ACCUSER             = 0x01,
+		GAME_WINNER               = 0x02,
+		MOVED_TO_ROOM_OUT_OF_TURN = 0x04,
+		MOVED_DURING_TURN         = 0x08,
+		SUGGESTED_DURING_TURN     = 0x10
+
+	}; //end enum SeatFlag defn
+
+	//--------------------------------------------------------------------------
+	// Class-Scoped Types
+	//--------------------------------------------------------------------------
+public:
+	/// \brief One player: character, status, hand, and notebook.
+	struct Seat
+	{
+		unsigned char _character; //PersonType
+		unsigned char _flags;     //SeatFlag bits
+
+		unsigned int _hand; //bit (1 << card index) per card in hand
+
+		/// \note bit (1 << PersonType) per opponent shown card, by card index
+		unsigned char _playersShown[clueless::NUM_CARDS];
+
+		DeductionMatrix _notebook;
+
+	}; //end struct Seat defn
+
+	/// \brief Choice of turn taker.
+	struct Action
+	{
+		Action()
+			: _choice( clueless::DO_NOTHING_ELSE_THIS_TURN )
+			, _destination( BoardLayout::NO_PATH )
+			, _cards()
+		{
+		}
+
+		static Action move(size_t destinationId);
+		static Action suggest(clueless::PersonType person, clueless::WeaponType weapon);
+		static Action accuse(const SolutionCardSet& accusation);
+
+		clueless::TurnOptionType _choice;
+		unsigned char _destination; //move: location identifier
+		SolutionCardSet _cards; //suggestion (room is suggestor's) or accusation
+
+	}; //end struct Action defn
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+public:
+	GameState();
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	bool isOver() const;
+	bool hasFlag(size_t seat, SeatFlag flag) const;
+
+	size_t findSeat(clueless::PersonType character) const;
+	size_t getLocationId(size_t seat) const;
+
+	bool isReadyToMakeAccusation(size_t seat) const;
+	SolutionCardSet determineAccusation(size_t seat) const;
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	unsigned int determineTurnOptions(const BoardLayout& layout) const;
+	size_t determineMoveOptions(const BoardLayout& layout, unsigned char destinations[]) const;
+
+	void apply(const Action& action, const BoardLayout& layout);
+	static GameState step(const GameState& state, const Action& action, const BoardLayout& layout);
+
+protected:
+	void move(size_t destinationId);
+	void suggest(clueless::PersonType person, clueless::WeaponType weapon);
+	void accuse(const SolutionCardSet& accusation);
+	void endTurn(const BoardLayout& layout);
+
+	size_t chooseCardToShow(size_t refuterSeat, unsigned int matchingCards, size_t suggestorSeat) const;
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+public:
+	Seat _seats[MAX_NUM_SEATS]; //in order of play
+	unsigned char _numSeats;
+
+	unsigned char _turnSeat;   //seat of turn taker
+	unsigned char _winnerSeat; //NO_SEAT until accusation matches Case File
+	unsigned char _numFalseAccusers;
+
+	unsigned char _personLocations[clueless::PROFESSOR_PLUM]; //location identifier, per PersonType - 1
+	unsigned char _weaponLocations[clueless::WRENCH];         //location identifier, per WeaponType - 1
+
+	SolutionCardSet _caseFile;
+
+	/// \note what every seat saw (see Game::recordPublicSuggestionOutcome())
+	DeductionMatrix _publicNotebook;
+
+	/// \note most recent suggestion; NO_SEAT and NO_CARD if unrefuted
+	unsigned char _lastRefuterSeat;
+	unsigned char _lastShownCard;
+
+	size_t _numRounds; //rounds of turns completed since snapshot
+
+}; //end class GameState defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline GameState::Action
+GameState::Action::move(
+	size_t dest_id) //i - destination location
+{
+	Action action;
+	action._choice = clueless::MOVE;
+	action._destination = (unsigned char)dest_id;
+
+	return action;
+
+} //end routine move()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline GameState::Action
+GameState::Action::suggest(
+	clueless::PersonType person, //i - suggested person
+	clueless::WeaponType weapon) //i - suggested weapon
+{
+	Action action;
+	action._choice = clueless::MAKE_SUGGESTION;
+	action._cards = SolutionCardSet( person, weapon, clueless::UNKNOWN_ROOM );
+
+	return action;
+
+} //end routine suggest()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline GameState::Action
+GameState::Action::accuse(
+	const SolutionCardSet& accusation) //i - accusation
+{
+	Action action;
+	action._choice = clueless::MAKE_ACCUSATION;
+	action._cards = accusation;
+
+	return action;
+
+} //end routine accuse()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline bool
+GameState::isOver()
+const
+{
+	return( (NO_SEAT != _winnerSeat) || (_numFalseAccusers >= _numSeats) );
+
+} //end routine isOver()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline bool
+GameState::hasFlag(
+	size_t seat, //i - seat of interest
+	SeatFlag flag) //i - status of interest
+const
+{
+	return( 0 != (_seats[seat]._flags & flag) );
+
+} //end routine hasFlag()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+GameState::getLocationId(
+	size_t seat) //i - seat of interest
+const
+{
+	return _personLocations[_seats[seat]._character - 1];
+
+} //end routine getLocationId()
+
+
+#endif //GameState_h defn
@@ -26,7 +26,9 @@
 //------------------------------------------------------------------------------
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Extended constructor
-/// \param None
+/// \param Room: first connecting room
+/// \param Room: second connecting room
+/// \param unsigned int: identifier unique within board
 /// \return None
 /// \throw
 /// - INCONSISTENT_DATA when same room specified for first and second.
@@ -34,8 +36,9 @@
 ////////////////////////////////////////////////////////////////////////////////
 Hallway::Hallway(
 	Room* firstConnectingRoom,  //i - 
-	Room* secondConnectingRoom) //i - 
-	: Location( HALLWAY )
+	Room* secondConnectingRoom, //i - 
+	unsigned int id) //i - identifier unique within board
+	: Location( HALLWAY, id )
 	, _occupant( nullptr )
 	, _connectingRoom1( firstConnectingRoom )
 	, _connectingRoom2( secondConnectingRoom )
@@ -180,13 +183,13 @@ Hallway::recognizeOccupantLeft(
 /// \brief Returns collection of possible move destinations based on specified
 ///  starting point.
 /// \param Location: starting point
-/// \return set<Location*>: possible destinations
+/// \return MoveOptionSet: possible destinations
 /// \throw
 /// - INSUFFICIENT_DATA when missing connecting room reference.
 /// \note
 /// - Adjacent rooms accept an unlimited number of occupants.
 ////////////////////////////////////////////////////////////////////////////////
-std::set<Location*>
+MoveOptionSet
 Hallway::getMoveOptions()
 const
 {
@@ -199,10 +202,10 @@ const
 		throw std::logic_error( msg.str() );
 	}
 
-	std::set<Location*> destinations;
+	MoveOptionSet destinations;
 
-	destinations.insert( _connectingRoom1 );
-	destinations.insert( _connectingRoom2 );
+	destinations.addOption( _connectingRoom1 );
+	destinations.addOption( _connectingRoom2 );
 
 	return destinations;
 
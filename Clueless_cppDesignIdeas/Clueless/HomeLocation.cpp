@@ -27,6 +27,7 @@
 /// \brief Extended constructor
 /// \param PersonPiece: person token who starts in location
 /// \param Hallway: hallway into which character enters from home
+/// \param unsigned int: identifier unique within board
 /// \return None
 /// \throw
 /// - INSUFFICIENT_DATA when person token object dne
@@ -35,8 +36,9 @@
 ////////////////////////////////////////////////////////////////////////////////
 HomeLocation::HomeLocation(
 	PersonPiece* person_token, //i - person token who starts in location
-	Hallway* adjacent_hallway) //i - hallway into which character enters from home
-	: Location( HOME )
+	Hallway* adjacent_hallway, //i - hallway into which character enters from home
+	unsigned int id) //i - identifier unique within board
+	: Location( HOME, id )
 	, _personToken( person_token )
 	, _adjacentHallway( adjacent_hallway )
 	, _occupant( person_token )
@@ -141,13 +143,13 @@ HomeLocation::recognizeOccupantLeft(
 /// \brief Returns collection of possible move destinations based on specified
 ///  starting point.
 /// \param Location: starting point
-/// \return set<Location*>: possible destinations
+/// \return MoveOptionSet: possible destinations
 /// \throw
 /// - INSUFFICIENT_DATA when missing connecting room reference.
 /// \note
 /// - Adjacent rooms accept an unlimited number of occupants.
 ////////////////////////////////////////////////////////////////////////////////
-std::set<Location*>
+MoveOptionSet
 HomeLocation::getMoveOptions()
 const
 {
@@ -160,9 +162,9 @@ const
 		throw std::logic_error( msg.str() );
 	}
 
-	std::set<Location*> destinations;
+	MoveOptionSet destinations;
 
-	destinations.insert( _adjacentHallway );
+	destinations.addOption( _adjacentHallway );
 
 	return destinations;
 
@@ -0,0 +1,234 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file Instrumentation.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  2335
+///
+/// \note
+/// - Empty unless CLUELESS_INSTRUMENT is defined.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Instrumentation.h"
+
+#ifdef CLUELESS_INSTRUMENT
+
+#include <chrono>			//for std::chrono::steady_clock use
+#include <iomanip>			//for std::setw use
+#include <iostream>			//for std::cerr use
+#include <mutex>			//for std::mutex use
+
+//------------------------------------------------------------------------------
+// Local Helpers
+//------------------------------------------------------------------------------
+static const char* PROBE_NAMES[Instrumentation::NUM_PROBES] =
+{
+	"Game::executePlayerTurn",
+	"Game::determinePlayerTurnOptions",
+	"Game::executePlayerChoice MOVE",
+	"Game::executePlayerChoice MAKE_SUGGESTION",
+	"Game::executePlayerChoice MAKE_ACCUSATION",
+	"Game::requestCounterEvidenceToPlayerSuggestion",
+	"Board::movePlayerTo",
+	"turn skipped (false accuser)",
+	"no permissible moves"
+};
+
+
+/// \brief Tallies of threads that have ended; guarded by totals_mutex.
+static std::mutex totals_mutex;
+static Instrumentation::Tallies process_totals;
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Ticks and time at start up, to convert ticks to time at report.
+////////////////////////////////////////////////////////////////////////////////
+struct ClockOrigin
+{
+	ClockOrigin()
+		: _ticks( Instrumentation::readTicks() )
+		, _time( std::chrono::steady_clock::now() )
+	{
+	}
+
+	unsigned long long _ticks;
+	std::chrono::steady_clock::time_point _time;
+
+}; //end struct ClockOrigin defn
+
+static const ClockOrigin clock_origin;
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief One thread's tallies; folded into process totals when thread ends.
+////////////////////////////////////////////////////////////////////////////////
+struct ThreadTallies : public Instrumentation::Tallies
+{
+	ThreadTallies()
+	{
+		for(size_t probe(0); probe < Instrumentation::NUM_PROBES; ++probe)
+		{
+			_counts[probe] = 0;
+			_ticks[probe] = 0;
+		}
+	}
+
+	~ThreadTallies()
+	{
+		std::lock_guard<std::mutex> lock( totals_mutex );
+		for(size_t probe(0); probe < Instrumentation::NUM_PROBES; ++probe)
+		{
+			process_totals._counts[probe] += _counts[probe];
+			process_totals._ticks[probe] += _ticks[probe];
+		}
+	}
+
+}; //end struct ThreadTallies defn
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Writes report to std::cerr at exit, after main thread's tallies
+///        are folded in (thread storage ends before static storage).
+////////////////////////////////////////////////////////////////////////////////
+struct ExitReport
+{
+	~ExitReport()
+	{
+		std::cerr << Instrumentation::report().str();
+	}
+
+}; //end struct ExitReport defn
+
+static const ExitReport exit_report;
+
+
+//------------------------------------------------------------------------------
+// Accessors and Mutators
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns probe's name for reports.
+/// \param Probe: probe
+/// \return char*: name
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+const char*
+Instrumentation::getProbeName(
+	Probe probe) //i - probe
+{
+	return( (NUM_PROBES > probe) ? PROBE_NAMES[probe] : "unknown probe" );
+
+} //end routine getProbeName()
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns calling thread's tallies.
+/// \param None
+/// \return Tallies: calling thread's tallies
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+Instrumentation::Tallies&
+Instrumentation::fetchThreadTallies()
+{
+	thread_local ThreadTallies tallies;
+
+	return tallies;
+
+} //end routine fetchThreadTallies()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns tallies summed over threads that have ended.
+/// \param Tallies: sums
+/// \return None
+/// \throw None
+/// \note
+/// - Threads still running (incl. the calling thread) are not included.
+////////////////////////////////////////////////////////////////////////////////
+void
+Instrumentation::collectTotals(
+	Tallies* totals) // o- sums
+{
+	std::lock_guard<std::mutex> lock( totals_mutex );
+	*totals = process_totals;
+
+} //end routine collectTotals()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Generates report of every probe passed by threads that have ended.
+/// \param None
+/// \return ostringstream: report text; empty when no probe passed
+/// \throw None
+/// \note
+/// - Per probe: calls, total milliseconds and nanoseconds per call (timed
+///   probes), and share of time within player turns.
+////////////////////////////////////////////////////////////////////////////////
+std::ostringstream
+Instrumentation::report()
+{
+	std::ostringstream report;
+
+	Tallies totals;
+	collectTotals( &totals );
+
+	unsigned long long num_passes( 0 );
+	for(size_t probe(0); probe < NUM_PROBES; ++probe)
+	{
+		num_passes += totals._counts[probe];
+	}
+
+	if( 0 == num_passes )
+	{
+		return report; //nothing instrumented ran
+	}
+
+	//ticks per nanosecond over whole run
+	std::chrono::duration<double, std::nano> elapsed(
+		std::chrono::steady_clock::now() - clock_origin._time );
+	const double ticks_per_ns( (0.0 < elapsed.count())
+		? double(readTicks() - clock_origin._ticks) / elapsed.count()
+		: 1.0 );
+
+	const double turn_ns( double(totals._ticks[PLAYER_TURN]) / ticks_per_ns );
+
+	report << std::fixed << std::setprecision( 1 );
+	report << "Instrumentation\n"
+		<< "  probe                                                  calls     total ms    ns/call  % of turns\n";
+
+	for(size_t probe(0); probe < NUM_PROBES; ++probe)
+	{
+		report << "  " << std::left << std::setw( 46 ) << getProbeName( Probe(probe) )
+			<< std::right << std::setw( 12 ) << totals._counts[probe];
+
+		if( (0 < totals._ticks[probe]) && (0 < totals._counts[probe]) )
+		{
+			const double probe_ns( double(totals._ticks[probe]) / ticks_per_ns );
+
+			report << "  " << std::setw( 11 ) << (probe_ns / 1.0e6)
+				<< "  " << std::setw( 9 ) << (probe_ns / double(totals._counts[probe]));
+
+			if( 0.0 < turn_ns )
+			{
+				report << "  " << std::setw( 10 ) << (100.0 * probe_ns / turn_ns);
+			}
+		}
+		report << "\n";
+
+	} //end for (each probe)
+
+	return report;
+
+} //end routine report()
+
+
+#endif //CLUELESS_INSTRUMENT
@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file Instrumentation.h
+/// \brief Counters and phase timers on the turn pipeline's hot paths, built
+///        only when CLUELESS_INSTRUMENT is defined.
+///
+/// \date   17 Oct 2026  2330
+///
+/// \note
+/// - Engine code marks hot paths with CLUELESS_COUNT(probe) and
+///   CLUELESS_TIME_SCOPE(probe); without CLUELESS_INSTRUMENT both expand to
+///   nothing, so a normal build carries no trace of them.
+/// - Each thread tallies into its own block (no locks, no shared cache
+///   lines); a thread's block is folded into the process totals when the
+///   thread ends, and the totals are written to std::cerr at exit.
+/// - Timers read the time-stamp counter on x86 (steady_clock elsewhere),
+///   converted to time at report.  Timed phases nest, so a phase's time
+///   includes the phases it calls (e.g. a move includes Board::movePlayerTo).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef Instrumentation_h
+#define Instrumentation_h
+
+#ifdef CLUELESS_INSTRUMENT
+
+#include <sstream>		//for std::ostringstream use
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>		//for __rdtsc use
+#define CLUELESS_HAS_RDTSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>	//for __rdtsc use
+#define CLUELESS_HAS_RDTSC
+#else
+#include <chrono>		//for std::chrono::steady_clock use
+#endif
+
+
+class Instrumentation
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Types
+	//--------------------------------------------------------------------------
+public:
+	/// \brief Instrumented points; timed probes also count calls.
+	enum Probe
+	{
+		PLAYER_TURN,             //timed: Game::executePlayerTurn()
+		DETERMINE_TURN_OPTIONS,  //timed: Game::determinePlayerTurnOptions()
+		CHOICE_MOVE,             //timed: Game::executePlayerChoice(), by choice
+		CHOICE_SUGGESTION,
+		CHOICE_ACCUSATION,
+		COUNTER_EVIDENCE,        //timed: Game::requestCounterEvidenceToPlayerSuggestion()
+		MOVE_PLAYER,             //timed: Board::movePlayerTo()
+		TURN_SKIPPED,            //counted: false accuser's turn
+		NO_PERMISSIBLE_MOVES,    //counted: player boxed in
+		NUM_PROBES
+	};
+
+	/// \brief Tallies of one thread, or of the process.
+	struct Tallies
+	{
+		unsigned long long _counts[NUM_PROBES];
+		unsigned long long _ticks[NUM_PROBES]; //timed probes only
+
+	}; //end struct Tallies defn
+
+	/// \brief Adds time from construction to destruction to a timed probe.
+	class ScopedTimer
+	{
+	public:
+		explicit ScopedTimer(Probe probe)
+			: _probe( probe )
+			, _start( readTicks() )
+		{
+		}
+
+		~ScopedTimer()
+		{
+			addTime( _probe, readTicks() - _start );
+		}
+
+	private:
+		ScopedTimer(const ScopedTimer&);
+
+		Probe _probe;
+		unsigned long long _start;
+
+	}; //end class ScopedTimer defn
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	/// \note private scope; all members are static
+	Instrumentation();
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+public:
+	static const char* getProbeName(Probe probe);
+	static unsigned long long readTicks();
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	static void count(Probe probe);
+	static void addTime(Probe probe, unsigned long long ticks);
+
+	static void collectTotals(Tallies* totals);
+	static std::ostringstream report();
+
+protected:
+	static Tallies& fetchThreadTallies();
+
+}; //end class Instrumentation defn
+
+
+//------------------------------------------------------------------------------
+// Macros
+//------------------------------------------------------------------------------
+#define CLUELESS_INSTRUMENT_JOIN2(a, b) a##b
+#define CLUELESS_INSTRUMENT_JOIN(a, b) CLUELESS_INSTRUMENT_JOIN2(a, b)
+
+/// \brief Counts one pass through probe.
+#define CLUELESS_COUNT(probe) Instrumentation::count( Instrumentation::probe )
+
+/// \brief Times rest of enclosing scope against probe.
+#define CLUELESS_TIME_SCOPE(probe) \
+	Instrumentation::ScopedTimer CLUELESS_INSTRUMENT_JOIN(instrumentation_timer_, __LINE__)( Instrumentation::probe )
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned long long
+Instrumentation::readTicks()
+{
+#ifdef CLUELESS_HAS_RDTSC
+	return __rdtsc();
+#else
+	return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch() ).count();
+#endif
+
+} //end routine readTicks()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline void
+Instrumentation::count(
+	Probe probe) //i - probe passed
+{
+	++fetchThreadTallies()._counts[probe];
+
+} //end routine count()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline void
+Instrumentation::addTime(
+	Probe probe, //i - timed probe
+	unsigned long long ticks) //i - ticks spent
+{
+	Tallies& tallies( fetchThreadTallies() );
+	++tallies._counts[probe];
+	tallies._ticks[probe] += ticks;
+
+} //end routine addTime()
+
+
+#else //not CLUELESS_INSTRUMENT
+
+#define CLUELESS_COUNT(probe) ((void)0)
+#define CLUELESS_TIME_SCOPE(probe) ((void)0)
+
+#endif //CLUELESS_INSTRUMENT
+
+
+#endif //Instrumentation_h defn
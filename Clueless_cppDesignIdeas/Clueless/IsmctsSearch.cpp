@@ -0,0 +1,1033 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file IsmctsSearch.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  1700
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IsmctsSearch.h"
+
+#include "BoardLayout.h"
+#include "DealSampler.h"
+#include "mersenneTwister.h"
+
+#include <chrono>			//for std::chrono::steady_clock use
+#include <cmath>			//for std::log, std::sqrt use
+#include <exception>		//for std::exception_ptr use
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::logic_error use
+#include <thread>			//for std::thread use
+
+
+//------------------------------------------------------------------------------
+// Local Helpers
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns number of set bits.
+////////////////////////////////////////////////////////////////////////////////
+static size_t
+countBits(
+	unsigned int bits) //i - bits of interest
+{
+	size_t num_bits( 0 );
+	for(; 0 != bits; bits &= (bits - 1))
+	{
+		++num_bits;
+	}
+
+	return num_bits;
+
+} //end routine countBits()
+
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Default constructor
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - Exploration weight favors exploitation more than the textbook sqrt(2),
+///   since rewards are rare wins rather than even outcomes.
+////////////////////////////////////////////////////////////////////////////////
+IsmctsSearch::IsmctsSearch()
+	: _trees()
+	, _numIterations( 0 )
+	, _numThreads( 1 )
+	, _explorationWeight( 0.7 )
+{
+} //end routine constructor
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Default constructor
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - Blocks allocated as nodes are first needed.
+////////////////////////////////////////////////////////////////////////////////
+IsmctsSearch::Tree::Tree()
+	: _numNodes( 0 )
+	, _blockMutex()
+{
+	for(size_t block(0); block < MAX_NUM_BLOCKS; ++block)
+	{
+		_blocks[block].store( nullptr );
+	}
+
+} //end routine constructor
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Destructor
+/// \param None
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+IsmctsSearch::Tree::~Tree()
+{
+	for(size_t block(0); block < MAX_NUM_BLOCKS; ++block)
+	{
+		delete [] _blocks[block].load();
+	}
+
+} //end routine destructor
+
+
+//------------------------------------------------------------------------------
+// Tree Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Removes all nodes, keeping blocks for reuse.
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - Not to be called while any thread searches tree.
+////////////////////////////////////////////////////////////////////////////////
+void
+IsmctsSearch::Tree::clear()
+{
+	_numNodes.store( 0 );
+
+} //end routine clear()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Claims storage for one node.
+/// \param None
+/// \return size_t: node claimed (uninitialized); NO_NODE if tree full
+/// \throw None
+/// \note
+/// - Safe to call from several threads at once; only the first thread into
+///   a new block takes the lock.
+////////////////////////////////////////////////////////////////////////////////
+size_t
+IsmctsSearch::Tree::allocateNode()
+{
+	size_t node_index( _numNodes.fetch_add(1, std::memory_order_relaxed) );
+	size_t block( node_index / NODES_PER_BLOCK );
+
+	if( block >= MAX_NUM_BLOCKS )
+	{
+		return NO_NODE;
+	}
+
+	if( nullptr == _blocks[block].load(std::memory_order_acquire) )
+	{
+		std::lock_guard<std::mutex> lock( _blockMutex );
+		if( nullptr == _blocks[block].load(std::memory_order_relaxed) )
+		{
+			_blocks[block].store( new Node[NODES_PER_BLOCK], std::memory_order_release );
+		}
+	}
+
+	return node_index;
+
+} //end routine allocateNode()
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Searches for turn taker's best action.
+/// \param GameState: state at decision (turn taker is observer)
+/// \param BoardLayout: layout of game
+/// \param Budget: limits on search, threads to search with
+/// \param MersenneTwister: seeds each thread's random draws
+/// \return Action: most visited action; doing nothing if turn taker has no
+///  options
+/// \throw
+/// - INSUFFICIENT_DATA when budget sets no limit.
+/// - first exception raised by any thread, after all threads have stopped
+/// \note
+/// - Root state may hold true hidden cards; search only reads what the turn
+///   taker's notebook allows (see determinize()).
+/// - A lone option is returned without searching.
+/// - Calling thread searches alongside the others, so one thread starts none.
+/// - Root parallel: iteration limit split evenly amongst threads, so result
+///   depends only on the caller's generator.  Shared tree: threads claim
+///   iterations as they go; result varies with thread timing.
+////////////////////////////////////////////////////////////////////////////////
+GameState::Action
+IsmctsSearch::run(
+	const GameState& root, //i - state at decision
+	const BoardLayout& layout, //i - layout of game
+	const Budget& budget, //i - limits on search
+	MersenneTwister& rng) //io- random draws
+{
+	if( (0 == budget._maxNumIterations) &&
+		(0.0 >= budget._maxNumMilliseconds) )
+	{
+		std::ostringstream msg;
+		msg << "IsmctsSearch::run()\n"
+			<< "  INSUFFICIENT_DATA\n"
+			<< "  search budget sets no limit";
+		throw std::logic_error( msg.str() );
+	}
+
+	_numIterations = 0;
+
+	_numThreads = budget._numThreads;
+	if( 0 == _numThreads )
+	{
+		_numThreads = std::thread::hardware_concurrency();
+	}
+	if( 0 == _numThreads ) //hardware concurrency not computable
+	{
+		_numThreads = 1;
+	}
+
+	//turn taker's own options do not depend on hidden cards
+	GameState::Action actions[MAX_NUM_ACTIONS];
+	size_t num_actions( listActions(root, layout, actions) );
+	if( 1 >= num_actions )
+	{
+		return( (1 == num_actions) ? actions[0] : GameState::Action() );
+	}
+
+	size_t num_trees( (ROOT_PARALLEL == budget._parallelMode) ? _numThreads : 1 );
+	while( _trees.size() < num_trees )
+	{
+		_trees.push_back( std::unique_ptr<Tree>(new Tree) );
+	}
+
+	for(size_t tree_index(0); tree_index < num_trees; ++tree_index)
+	{
+		_trees[tree_index]->clear();
+		addChild( *_trees[tree_index], NO_NODE, GameState::Action(), GameState::NO_SEAT ); //root
+	}
+
+	//one notebook state for whole search, so deals counted once
+	const GameState::Seat& turn_taker( root._seats[root._turnSeat] );
+	DealSampler sampler( turn_taker._notebook, turn_taker._character, turn_taker._hand );
+
+	//each thread draws from own generator
+	std::vector<unsigned long> thread_seeds( _numThreads );
+	for(size_t thread_index(0); thread_index < _numThreads; ++thread_index)
+	{
+		thread_seeds[thread_index] = rng.drawInt32();
+	}
+
+	std::atomic<size_t> num_claimed( 0 );   //shared tree: iterations started
+	std::atomic<size_t> num_completed( 0 );
+	std::atomic<bool> has_failed( false );
+	std::vector<std::exception_ptr> thread_errors( _numThreads );
+
+	std::chrono::steady_clock::time_point start_time( std::chrono::steady_clock::now() );
+
+	auto search = [&](size_t thread_index)
+	{
+		try
+		{
+			MersenneTwister thread_rng( thread_seeds[thread_index] );
+			Tree& tree( *_trees[(1 < num_trees) ? thread_index : 0] );
+
+			std::vector<size_t> path; //reused every iteration
+
+			size_t quota( budget._maxNumIterations / _numThreads +
+				((thread_index < budget._maxNumIterations % _numThreads) ? 1 : 0) );
+			size_t num_done( 0 );
+
+			while( ! has_failed )
+			{
+				if( 0 != budget._maxNumIterations )
+				{
+					bool is_spent( (1 < num_trees)
+						? (num_done >= quota)
+						: (num_claimed.fetch_add(1, std::memory_order_relaxed) >= budget._maxNumIterations) );
+					if( is_spent )
+					{
+						break; //out of iterations
+					}
+				}
+
+				if( 0.0 < budget._maxNumMilliseconds )
+				{
+					std::chrono::duration<double, std::milli> elapsed(
+						std::chrono::steady_clock::now() - start_time );
+					if( elapsed.count() >= budget._maxNumMilliseconds )
+					{
+						break; //out of time
+					}
+				}
+
+				iterate( tree, root, sampler, layout, thread_rng, path );
+				++num_done;
+			}
+
+			num_completed.fetch_add( num_done );
+		}
+		catch(...)
+		{
+			thread_errors[thread_index] = std::current_exception();
+			has_failed = true;
+		}
+	};
+
+	std::vector<std::thread> helpers;
+	helpers.reserve( _numThreads - 1 );
+	for(size_t thread_index(1); thread_index < _numThreads; ++thread_index)
+	{
+		helpers.push_back( std::thread(search, thread_index) );
+	}
+
+	search( 0 );
+
+	for(size_t helper_index(0); helper_index < helpers.size(); ++helper_index)
+	{
+		helpers[helper_index].join();
+	}
+
+	for(size_t thread_index(0); thread_index < _numThreads; ++thread_index)
+	{
+		if( thread_errors[thread_index] )
+		{
+			std::rethrow_exception( thread_errors[thread_index] );
+		}
+	}
+
+	_numIterations = num_completed.load();
+
+	//most visited action, over all trees
+	unsigned long num_visits[MAX_NUM_ACTIONS] = { 0 };
+	for(size_t tree_index(0); tree_index < num_trees; ++tree_index)
+	{
+		const Tree& tree( *_trees[tree_index] );
+		for(size_t child(tree.getNode(0)._firstChild); NO_NODE != child; child = tree.getNode(child)._nextSibling)
+		{
+			for(size_t action_index(0); action_index < num_actions; ++action_index)
+			{
+				if( isSameAction(actions[action_index], tree.getNode(child)._action) )
+				{
+					num_visits[action_index] += tree.getNode(child)._numVisits;
+					break;
+				}
+			}
+		}
+	}
+
+	size_t best_action( 0 );
+	for(size_t action_index(1); action_index < num_actions; ++action_index)
+	{
+		if( num_visits[action_index] > num_visits[best_action] )
+		{
+			best_action = action_index;
+		}
+	}
+
+	return actions[best_action];
+
+} //end routine run()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Deals cards observer cannot see, consistently with its notebook.
+/// \param GameState: state at decision
+/// \param size_t: observer's seat
+/// \param DealSampler: deals consistent with observer's notebook
+/// \param MersenneTwister: random draws
+/// \param GameState: state with dealt opponents' hands and Case File
+/// \return None
+/// \throw None
+/// \note
+/// - Deal drawn by sampler, uniformly amongst those meeting every notebook
+///   constraint; when it draws none (notebook contradicted), deals ignoring
+///   the notebook.
+/// - Opponents' notebooks restart from the public notebook plus their dealt
+///   hands, since what else they learned came from their true hands.
+///   Observer's notebook is unchanged.
+////////////////////////////////////////////////////////////////////////////////
+void
+IsmctsSearch::determinize(
+	const GameState& root, //i - state at decision
+	size_t observer_seat, //i - observer's seat
+	const DealSampler& sampler, //i - deals consistent with observer's notebook
+	MersenneTwister& rng, //io- random draws
+	GameState* deal) // o- dealt state
+{
+	*deal = root;
+
+	const GameState::Seat& observer( root._seats[observer_seat] );
+
+	//cards to deal
+	unsigned char unseen_cards[clueless::NUM_CARDS];
+	size_t num_unseen( 0 );
+	for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+	{
+		if( 0 == (observer._hand & (1u << card_index)) )
+		{
+			unseen_cards[num_unseen++] = (unsigned char)card_index;
+		}
+	}
+
+	//opponents' hand sizes are public
+	size_t hand_sizes[DeductionMatrix::NUM_HOLDERS] = { 0 };
+	for(size_t seat(0); seat < root._numSeats; ++seat)
+	{
+		if( seat != observer_seat )
+		{
+			hand_sizes[root._seats[seat]._character] = countBits( root._seats[seat]._hand );
+		}
+	}
+
+	unsigned int cards_by_holder[DeductionMatrix::NUM_HOLDERS];
+	bool has_dealt( sampler.sample(rng, cards_by_holder) );
+
+	if( ! has_dealt ) //ignore notebook
+	{
+		for(size_t holder(0); holder < DeductionMatrix::NUM_HOLDERS; ++holder)
+		{
+			cards_by_holder[holder] = 0;
+		}
+		cards_by_holder[observer._character] = observer._hand;
+
+		//one unseen card of each type to Case File (true one is unseen)
+		unsigned int unseen_mask( 0 );
+		for(size_t pos(0); pos < num_unseen; ++pos)
+		{
+			unseen_mask |= (1u << unseen_cards[pos]);
+		}
+
+		for(int type(clueless::PERSON); type <= clueless::ROOM; ++type)
+		{
+			unsigned char type_cards[clueless::NUM_CARDS];
+			size_t num_type_cards( 0 );
+			for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+			{
+				if( (0 != (unseen_mask & (1u << card_index))) &&
+					(clueless::determineCardElementType(card_index) == type) )
+				{
+					type_cards[num_type_cards++] = (unsigned char)card_index;
+				}
+			}
+
+			size_t card_index( type_cards[rng.drawUniformInt(num_type_cards)] );
+			cards_by_holder[DeductionMatrix::CASE_FILE] |= (1u << card_index);
+			unseen_mask &= ~(1u << card_index);
+		}
+
+		//rest to opponents in seat order
+		size_t seat( 0 );
+		for(size_t pos(num_unseen); 1 < pos; --pos)
+		{
+			size_t other( rng.drawUniformInt(pos) );
+			unsigned char card( unseen_cards[pos - 1] );
+			unseen_cards[pos - 1] = unseen_cards[other];
+			unseen_cards[other] = card;
+		}
+
+		for(size_t pos(0); pos < num_unseen; ++pos)
+		{
+			if( 0 == (unseen_mask & (1u << unseen_cards[pos])) )
+			{
+				continue; //in Case File
+			}
+
+			while( (seat == observer_seat) ||
+				(countBits(cards_by_holder[root._seats[seat]._character]) >= hand_sizes[root._seats[seat]._character]) )
+			{
+				++seat;
+			}
+
+			cards_by_holder[root._seats[seat]._character] |= (1u << unseen_cards[pos]);
+		}
+	} //end if (ignore notebook)
+
+	//apply deal
+	for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+	{
+		if( 0 == (cards_by_holder[DeductionMatrix::CASE_FILE] & (1u << card_index)) )
+		{
+			continue; //next card
+		}
+
+		unsigned char subtype( (unsigned char)clueless::determineCardSubtype(card_index) );
+		switch( clueless::determineCardElementType(card_index) )
+		{
+		case clueless::PERSON:
+			deal->_caseFile._person = subtype;
+			break;
+
+		case clueless::WEAPON:
+			deal->_caseFile._weapon = subtype;
+			break;
+
+		default: //room
+			deal->_caseFile._room = subtype;
+		} //end switch (on card type)
+	}
+
+	//what every seat saw; only hand sizes if deal ignored notebook
+	DeductionMatrix public_notebook( root._publicNotebook );
+	if( ! has_dealt )
+	{
+		public_notebook = DeductionMatrix();
+		for(size_t seat(0); seat < root._numSeats; ++seat)
+		{
+			unsigned char character( root._seats[seat]._character );
+			public_notebook.addPlayer( clueless::PersonType(character),
+				(seat == observer_seat) ? countBits(observer._hand) : hand_sizes[character] );
+		}
+	}
+
+	for(size_t seat(0); seat < root._numSeats; ++seat)
+	{
+		if( seat == observer_seat )
+		{
+			continue; //next seat
+		}
+
+		GameState::Seat& opponent( deal->_seats[seat] );
+		opponent._hand = cards_by_holder[opponent._character];
+
+		for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+		{
+			opponent._playersShown[card_index] = 0;
+		}
+
+		//opponent knows what was public, plus own hand
+		opponent._notebook = public_notebook;
+
+		for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+		{
+			if( 0 != (opponent._hand & (1u << card_index)) )
+			{
+				opponent._notebook.recordCardHeld( card_index, opponent._character );
+			}
+			else
+			{
+				opponent._notebook.recordCardNotHeld( card_index, opponent._character );
+			}
+		}
+
+		opponent._notebook.propagate();
+
+	} //end for (each opponent)
+
+} //end routine determinize()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Lists every action available to turn taker.
+/// \param GameState: state of interest
+/// \param BoardLayout: layout of game
+/// \param Action[]: available actions
+/// \return size_t: number of actions
+/// \throw None
+/// \note
+/// - Accusation is always the turn taker's deduced Case File; suggestions
+///   limited as by isWorthSuggesting().
+/// - Doing nothing is never listed (live turns end only when no option is
+///   left; see Game::executePlayerTurn()).
+////////////////////////////////////////////////////////////////////////////////
+size_t
+IsmctsSearch::listActions(
+	const GameState& state, //i - state of interest
+	const BoardLayout& layout, //i - layout of game
+	GameState::Action actions[MAX_NUM_ACTIONS]) // o- available actions
+{
+	unsigned int options( state.determineTurnOptions(layout) );
+	size_t num_actions( 0 );
+
+	if( 0 != (options & (1u << clueless::MAKE_ACCUSATION)) )
+	{
+		actions[num_actions++] = GameState::Action::accuse( state.determineAccusation(state._turnSeat) );
+	}
+
+	if( 0 != (options & (1u << clueless::MOVE)) )
+	{
+		unsigned char destinations[GameState::MAX_NUM_MOVE_OPTIONS];
+		size_t num_destinations( state.determineMoveOptions(layout, destinations) );
+
+		for(size_t dest_index(0); dest_index < num_destinations; ++dest_index)
+		{
+			actions[num_actions++] = GameState::Action::move( destinations[dest_index] );
+		}
+	}
+
+	if( 0 != (options & (1u << clueless::MAKE_SUGGESTION)) )
+	{
+		const GameState::Seat& seat( state._seats[state._turnSeat] );
+		SolutionCardSet deduced( state.determineAccusation(state._turnSeat) );
+
+		for(size_t person(clueless::MISS_SCARLET); person <= clueless::PROFESSOR_PLUM; ++person)
+		{
+			if( ! isWorthSuggesting(seat, deduced._person, clueless::determineCardIndex(clueless::PersonType(person))) )
+			{
+				continue; //next person
+			}
+
+			for(size_t weapon(clueless::CANDLESTICK); weapon <= clueless::WRENCH; ++weapon)
+			{
+				if( isWorthSuggesting(seat, deduced._weapon, clueless::determineCardIndex(clueless::WeaponType(weapon))) )
+				{
+					actions[num_actions++] = GameState::Action::suggest(
+						clueless::PersonType(person), clueless::WeaponType(weapon) );
+				}
+			}
+		}
+	}
+
+	return num_actions;
+
+} //end routine listActions()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns whether suggesting card could serve suggestor.
+/// \param Seat: suggestor
+/// \param unsigned char: deduced Case File element of card's type (unknown
+///  if not deduced)
+/// \param size_t: card of interest (card index)
+/// \return bool: whether worth suggesting
+/// \throw None
+/// \note
+/// - Before Case File element is deduced, only cards with unknown holder
+///   teach anything; afterwards, the deduced card or one in hand lets the
+///   other elements be tested (as DetectiveNotebook::choose*ForSuggestion()).
+////////////////////////////////////////////////////////////////////////////////
+bool
+IsmctsSearch::isWorthSuggesting(
+	const GameState::Seat& seat, //i - suggestor
+	unsigned char deduced, //i - deduced Case File element
+	size_t card_index) //i - card of interest
+{
+	if( 0 != deduced ) //deduced
+	{
+		return(
+			(deduced == clueless::determineCardSubtype(card_index)) ||
+			(0 != (seat._hand & (1u << card_index))) );
+	}
+
+	return( DeductionMatrix::UNKNOWN_HOLDER == seat._notebook.findHolder(card_index) );
+
+} //end routine isWorthSuggesting()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Chooses action as a heuristic player would.
+/// \param GameState: state of interest
+/// \param BoardLayout: layout of game
+/// \param MersenneTwister: random draws
+/// \return Action: chosen action; doing nothing if no options
+/// \throw None
+/// \note
+/// - Follows Player::makeTurnChoice(), Player::provideMovePreference(), and
+///   DetectiveNotebook::choose*ForSuggestion() using turn taker's
+///   deductions: accuse when ready, otherwise pick option at random; move
+///   toward nearest room still needing questioning (or, once Case File room
+///   known, toward it or a room in hand); suggest first person and weapon
+///   with unknown holder.
+////////////////////////////////////////////////////////////////////////////////
+GameState::Action
+IsmctsSearch::chooseHeuristicAction(
+	const GameState& state, //i - state of interest
+	const BoardLayout& layout, //i - layout of game
+	MersenneTwister& rng) //io- random draws
+{
+	unsigned int options( state.determineTurnOptions(layout) );
+
+	if( 0 != (options & (1u << clueless::MAKE_ACCUSATION)) )
+	{
+		return GameState::Action::accuse( state.determineAccusation(state._turnSeat) );
+	}
+
+	const GameState::Seat& seat( state._seats[state._turnSeat] );
+	SolutionCardSet deduced( state.determineAccusation(state._turnSeat) );
+
+	bool can_move( 0 != (options & (1u << clueless::MOVE)) );
+	bool can_suggest( 0 != (options & (1u << clueless::MAKE_SUGGESTION)) );
+
+	if( can_move && can_suggest )
+	{
+		can_move = (0 == rng.drawUniformInt(2));
+		can_suggest = ! can_move;
+	}
+
+	if( can_move )
+	{
+		//rooms worth heading for
+		unsigned int target_rooms( 0 );
+		for(size_t room(clueless::STUDY); room <= clueless::KITCHEN; ++room)
+		{
+			size_t card_index( clueless::determineCardIndex(clueless::RoomType(room)) );
+
+			bool is_target( (clueless::UNKNOWN_ROOM != deduced._room)
+				? ((room == deduced._room) || (0 != (seat._hand & (1u << card_index))))
+				: (DeductionMatrix::UNKNOWN_HOLDER == seat._notebook.findHolder(card_index)) );
+			if( is_target )
+			{
+				target_rooms |= (1u << room);
+			}
+		}
+
+		unsigned char destinations[GameState::MAX_NUM_MOVE_OPTIONS];
+		size_t num_destinations( state.determineMoveOptions(layout, destinations) );
+
+		unsigned char best[GameState::MAX_NUM_MOVE_OPTIONS];
+		size_t num_best( 0 );
+		size_t best_distance( BoardLayout::NO_PATH + 1 );
+
+		for(size_t dest_index(0); dest_index < num_destinations; ++dest_index)
+		{
+			size_t distance( BoardLayout::NO_PATH );
+			for(size_t room(clueless::STUDY); room <= clueless::KITCHEN; ++room)
+			{
+				if( 0 != (target_rooms & (1u << room)) )
+				{
+					size_t room_distance( layout.getDistance(destinations[dest_index],
+						BoardLayout::determineRoomId(clueless::RoomType(room))) );
+					distance = (room_distance < distance) ? room_distance : distance;
+				}
+			}
+
+			if( distance < best_distance )
+			{
+				num_best = 0;
+				best_distance = distance;
+			}
+			if( distance == best_distance )
+			{
+				best[num_best++] = destinations[dest_index];
+			}
+		}
+
+		return GameState::Action::move( best[rng.drawUniformInt(num_best)] );
+	}
+
+	if( can_suggest )
+	{
+		clueless::PersonType person( clueless::PersonType(deduced._person) );
+		clueless::WeaponType weapon( clueless::WeaponType(deduced._weapon) );
+
+		//person in hand when suspect known, otherwise first with unknown holder
+		for(size_t candidate(clueless::PROFESSOR_PLUM); candidate >= clueless::MISS_SCARLET; --candidate)
+		{
+			size_t card_index( clueless::determineCardIndex(clueless::PersonType(candidate)) );
+			bool is_preferred( (clueless::UNKNOWN_PERSON != deduced._person)
+				? (0 != (seat._hand & (1u << card_index)))
+				: (DeductionMatrix::UNKNOWN_HOLDER == seat._notebook.findHolder(card_index)) );
+			if( is_preferred )
+			{
+				person = clueless::PersonType( candidate );
+			}
+		}
+
+		for(size_t candidate(clueless::WRENCH); candidate >= clueless::CANDLESTICK; --candidate)
+		{
+			size_t card_index( clueless::determineCardIndex(clueless::WeaponType(candidate)) );
+			bool is_preferred( (clueless::UNKNOWN_WEAPON != deduced._weapon)
+				? (0 != (seat._hand & (1u << card_index)))
+				: (DeductionMatrix::UNKNOWN_HOLDER == seat._notebook.findHolder(card_index)) );
+			if( is_preferred )
+			{
+				weapon = clueless::WeaponType( candidate );
+			}
+		}
+
+		//nothing left to learn (should not happen unless accusation ready)
+		if( clueless::UNKNOWN_PERSON == person ) { person = clueless::MISS_SCARLET; }
+		if( clueless::UNKNOWN_WEAPON == weapon ) { weapon = clueless::CANDLESTICK; }
+
+		return GameState::Action::suggest( person, weapon );
+	}
+
+	return GameState::Action();
+
+} //end routine chooseHeuristicAction()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Runs one iteration: deal, select and expand, play out, back up.
+/// \param Tree: tree searched (possibly shared with other threads)
+/// \param GameState: state at decision
+/// \param DealSampler: deals consistent with turn taker's notebook
+/// \param BoardLayout: layout of game
+/// \param MersenneTwister: random draws
+/// \param vector<size_t>: scratch for nodes visited
+/// \return None
+/// \throw None
+/// \note
+/// - One node added per iteration, unless tree is full.
+/// - Nodes entered are charged VIRTUAL_LOSS visits at once; backup refunds
+///   all but one, and credits a win to every node whose actor won.
+////////////////////////////////////////////////////////////////////////////////
+void
+IsmctsSearch::iterate(
+	Tree& tree, //io- tree searched
+	const GameState& root, //i - state at decision
+	const DealSampler& sampler, //i - deals consistent with turn taker's notebook
+	const BoardLayout& layout, //i - layout of game
+	MersenneTwister& rng, //io- random draws
+	std::vector<size_t>& path) // o- nodes visited, root first
+const
+{
+	GameState state;
+	determinize( root, root._turnSeat, sampler, rng, &state );
+
+	path.clear();
+	path.push_back( 0 );
+	tree.getNode( 0 )._numVisits.fetch_add( VIRTUAL_LOSS, std::memory_order_relaxed );
+
+	size_t node( 0 );
+	GameState::Action actions[MAX_NUM_ACTIONS];
+
+	//select, then expand one node
+	while( ! state.isOver() )
+	{
+		size_t num_actions( listActions(state, layout, actions) );
+		if( 0 == num_actions )
+		{
+			break; //nobody can act
+		}
+
+		size_t actor( state._turnSeat );
+		GameState::Action untried;
+		size_t child( selectChild(tree, node, actions, num_actions, rng, &untried) );
+		bool is_expanding( NO_NODE == child );
+
+		if( is_expanding )
+		{
+			child = addChild( tree, node, untried, actor );
+			if( NO_NODE == child ) //tree full
+			{
+				state.apply( untried, layout );
+				break;
+			}
+		}
+
+		tree.getNode( child )._numVisits.fetch_add( VIRTUAL_LOSS, std::memory_order_relaxed );
+		state.apply( tree.getNode(child)._action, layout );
+		path.push_back( child );
+		node = child;
+
+		if( is_expanding )
+		{
+			break;
+		}
+
+	} //end while (select)
+
+	//play out
+	while( ! state.isOver() &&
+		(state._numRounds < MAX_NUM_ROLLOUT_ROUNDS) )
+	{
+		GameState::Action action( chooseHeuristicAction(state, layout, rng) );
+		if( clueless::DO_NOTHING_ELSE_THIS_TURN == action._choice )
+		{
+			break; //nobody can act
+		}
+
+		state.apply( action, layout );
+	}
+
+	//back up
+	for(size_t path_index(0); path_index < path.size(); ++path_index)
+	{
+		Node& visited( tree.getNode(path[path_index]) );
+		visited._numVisits.fetch_sub( VIRTUAL_LOSS - 1, std::memory_order_relaxed );
+
+		if( (GameState::NO_SEAT != state._winnerSeat) &&
+			(visited._actorSeat == state._winnerSeat) )
+		{
+			visited._numWins.fetch_add( 1, std::memory_order_relaxed );
+		}
+	}
+
+} //end routine iterate()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Chooses child of node for available actions.
+/// \param Tree: tree searched
+/// \param size_t: parent node
+/// \param Action[]: actions available in current deal
+/// \param size_t: number of available actions
+/// \param MersenneTwister: random draws
+/// \param Action: available action without child (when returning NO_NODE)
+/// \return size_t: child with greatest UCB; NO_NODE when an available action
+///  has no child yet
+/// \throw None
+/// \note
+/// - Children for actions unavailable in current deal are skipped; the rest
+///   count the visit as available (UCB uses availability, not parent
+///   visits).
+/// - Visits include other threads' playouts in progress, which count as
+///   losses until backed up.
+////////////////////////////////////////////////////////////////////////////////
+size_t
+IsmctsSearch::selectChild(
+	const Tree& tree, //i - tree searched
+	size_t parent, //i - parent node
+	const GameState::Action actions[], //i - available actions
+	size_t num_actions, //i - number of available actions
+	MersenneTwister& rng, //io- random draws
+	GameState::Action* untried_action) // o- action without child
+const
+{
+	bool has_child[MAX_NUM_ACTIONS] = { false };
+
+	size_t best_child( NO_NODE );
+	double best_value( 0.0 );
+
+	for(size_t child(tree.getNode(parent)._firstChild.load(std::memory_order_acquire));
+		NO_NODE != child;
+		child = tree.getNode(child)._nextSibling)
+	{
+		Node& candidate( tree.getNode(child) );
+
+		size_t action_index( 0 );
+		while( (action_index < num_actions) &&
+			! isSameAction(actions[action_index], candidate._action) )
+		{
+			++action_index;
+		}
+
+		if( num_actions == action_index )
+		{
+			continue; //unavailable in this deal
+		}
+
+		has_child[action_index] = true;
+		unsigned int num_available( candidate._numAvailable.fetch_add(1, std::memory_order_relaxed) + 1 );
+		unsigned int num_visits( candidate._numVisits.load(std::memory_order_relaxed) );
+		unsigned int num_wins( candidate._numWins.load(std::memory_order_relaxed) );
+
+		if( 0 == num_visits ) //just linked by another thread
+		{
+			num_visits = 1;
+		}
+
+		double value(
+			((double)num_wins / num_visits) +
+			_explorationWeight * std::sqrt(std::log((double)num_available) / num_visits) );
+
+		if( (NO_NODE == best_child) || (value > best_value) )
+		{
+			best_child = child;
+			best_value = value;
+		}
+	}
+
+	//expand before exploiting
+	size_t untried[MAX_NUM_ACTIONS];
+	size_t num_untried( 0 );
+	for(size_t action_index(0); action_index < num_actions; ++action_index)
+	{
+		if( ! has_child[action_index] )
+		{
+			untried[num_untried++] = action_index;
+		}
+	}
+
+	if( 0 < num_untried )
+	{
+		*untried_action = actions[untried[rng.drawUniformInt(num_untried)]];
+		return NO_NODE;
+	}
+
+	return best_child;
+
+} //end routine selectChild()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Adds child for action to node.
+/// \param Tree: tree searched
+/// \param size_t: parent node (NO_NODE for root)
+/// \param Action: action from parent
+/// \param size_t: seat taking action
+/// \return size_t: child for action; NO_NODE if tree full
+/// \throw None
+/// \note
+/// - Child linked at head of parent's list by compare-and-swap.  Should
+///   another thread link a child for the same action first, that child is
+///   returned instead (the claimed node goes unused).
+////////////////////////////////////////////////////////////////////////////////
+size_t
+IsmctsSearch::addChild(
+	Tree& tree, //io- tree searched
+	size_t parent, //i - parent node
+	const GameState::Action& action, //i - action from parent
+	size_t actor_seat) //i - seat taking action
+{
+	size_t child_index( tree.allocateNode() );
+	if( NO_NODE == child_index )
+	{
+		return NO_NODE;
+	}
+
+	Node& child( tree.getNode(child_index) );
+	child._action = action;
+	child._actorSeat = (unsigned char)actor_seat;
+	child._numVisits.store( 0, std::memory_order_relaxed );
+	child._numAvailable.store( 1, std::memory_order_relaxed );
+	child._numWins.store( 0, std::memory_order_relaxed );
+	child._firstChild.store( NO_NODE, std::memory_order_relaxed );
+	child._nextSibling = NO_NODE;
+
+	if( NO_NODE == parent )
+	{
+		return child_index;
+	}
+
+	std::atomic<size_t>& first_child( tree.getNode(parent)._firstChild );
+	size_t head( first_child.load(std::memory_order_acquire) );
+	size_t checked_head( NO_NODE ); //siblings from here on already checked
+
+	for(;;)
+	{
+		for(size_t sibling(head); checked_head != sibling; sibling = tree.getNode(sibling)._nextSibling)
+		{
+			if( isSameAction(tree.getNode(sibling)._action, action) )
+			{
+				return sibling; //linked by another thread
+			}
+		}
+
+		child._nextSibling = head;
+		if( first_child.compare_exchange_weak(head, child_index,
+			std::memory_order_release, std::memory_order_acquire) )
+		{
+			return child_index;
+		}
+
+		checked_head = child._nextSibling; //head now holds newer siblings
+
+	} //end for (until linked)
+
+} //end routine addChild()
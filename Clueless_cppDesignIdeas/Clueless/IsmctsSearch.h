@@ -0,0 +1,308 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file IsmctsSearch.h
+/// \brief Information-set Monte Carlo tree search over game states.
+///
+/// \date   17 Oct 2026  1700
+///
+/// \note
+/// - Single-observer search: each iteration deals the cards the observer
+///   cannot see (opponents' hands, Case File) uniformly amongst deals
+///   consistent with the observer's notebook (see DealSampler), descends
+///   one shared tree of turn actions by UCB over the actions available in
+///   that deal, then plays out with the notebook heuristic players use (see
+///   chooseHeuristicAction()).
+/// - Cost is linear in iterations; budget by iteration count, wall-clock
+///   time, or both.
+/// - Searches on several threads at once, in either of two ways (see
+///   ParallelMode): independent trees merged when time is up, or one tree
+///   shared by all threads.  Node statistics are atomic counters and
+///   children are linked in with compare-and-swap, so the shared tree takes
+///   no locks while searching.
+/// - Tree nodes live in fixed-size blocks kept from search to search.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IsmctsSearch_h
+#define IsmctsSearch_h
+
+#include "GameState.h"
+
+#include <atomic>		//for std::atomic use
+#include <memory>		//for std::unique_ptr use
+#include <mutex>		//for std::mutex use
+#include <stddef.h>		//for size_t use
+#include <vector>		//for std::vector use
+
+
+//forward declarations
+class BoardLayout;
+class DealSampler;
+class MersenneTwister;
+
+
+class IsmctsSearch
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	/// \note suggestions (person x weapon) plus moves plus accusation
+	static const size_t MAX_NUM_ACTIONS =
+		clueless::PROFESSOR_PLUM * clueless::WRENCH + GameState::MAX_NUM_MOVE_OPTIONS + 1;
+
+	static const size_t MAX_NUM_ROLLOUT_ROUNDS = 50; //playout abandoned (no winner) after
+
+	/// \note visits charged to each node on a path while its playout runs,
+	///       steering other threads sharing the tree elsewhere; all but one
+	///       refunded on backup
+	static const unsigned int VIRTUAL_LOSS = 3;
+
+	static const size_t NODES_PER_BLOCK = 4096;
+	static const size_t MAX_NUM_BLOCKS = 256; //tree stops growing when full
+
+	static const size_t NO_NODE = (size_t)-1;
+
+	/// \note per-move latency allowed in live games
+	static const unsigned int LIVE_TURN_MILLISECONDS = 200;
+
+	//--------------------------------------------------------------------------
+	// Class-Scoped Enumerated Types
+	//--------------------------------------------------------------------------
+public:
+	/// \brief How threads share the search.
+	enum ParallelMode
+	{
+		ROOT_PARALLEL, //one tree per thread; root visits summed at end
+		SHARED_TREE    //one tree, with virtual loss
+
+	}; //end enum ParallelMode defn
+
+	//--------------------------------------------------------------------------
+	// Class-Scoped Types
+	//--------------------------------------------------------------------------
+public:
+	/// \brief Limits on one search; zero means no limit of that kind.
+	/// \note at least one limit required
+	struct Budget
+	{
+		Budget()
+			: _maxNumIterations( 1000 )
+			, _maxNumMilliseconds( 0 )
+			, _numThreads( 1 )
+			, _parallelMode( SHARED_TREE )
+		{
+		}
+
+		Budget(size_t maxNumIterations, double maxNumMilliseconds)
+			: _maxNumIterations( maxNumIterations )
+			, _maxNumMilliseconds( maxNumMilliseconds )
+			, _numThreads( 1 )
+			, _parallelMode( SHARED_TREE )
+		{
+		}
+
+		static Budget liveTurn();
+
+		size_t _maxNumIterations; //over all threads
+		double _maxNumMilliseconds;
+
+		size_t _numThreads; //0 for one per hardware thread
+		ParallelMode _parallelMode;
+
+	}; //end struct Budget defn
+
+	/// \brief Action taken from parent, with statistics of player taking it.
+	/// \note action, actor, and sibling fixed before node is linked to parent
+	struct Node
+	{
+		GameState::Action _action;
+		unsigned char _actorSeat;
+
+		std::atomic<unsigned int> _numVisits;    //including playouts in progress
+		std::atomic<unsigned int> _numAvailable; //times selectable when parent visited
+		std::atomic<unsigned int> _numWins;      //of actor
+
+		std::atomic<size_t> _firstChild;
+		size_t _nextSibling;
+
+	}; //end struct Node defn
+
+	/// \brief Nodes of one search tree, root first.
+	/// \note blocks are never moved, so nodes may be added while other
+	///       threads read
+	class Tree
+	{
+	public:
+		Tree();
+		~Tree();
+
+		size_t getNumNodes() const;
+		Node& getNode(size_t nodeIndex) const;
+
+		void clear();
+		size_t allocateNode();
+
+	private:
+		/// \note private scope, undefined: nodes are not copyable
+		Tree(const Tree&);
+		Tree& operator=(const Tree&);
+
+	protected:
+		std::atomic<Node*> _blocks[MAX_NUM_BLOCKS];
+		std::atomic<size_t> _numNodes;
+		std::mutex _blockMutex; //held only while adding a block
+
+	}; //end class Tree defn
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+public:
+	IsmctsSearch();
+
+	virtual ~IsmctsSearch()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	size_t getNumIterations() const;
+	size_t getNumThreads() const;
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	GameState::Action run(
+		const GameState& root,
+		const BoardLayout& layout,
+		const Budget& budget,
+		MersenneTwister& rng);
+
+	static void determinize(
+		const GameState& root,
+		size_t observerSeat,
+		const DealSampler& sampler,
+		MersenneTwister& rng,
+		GameState* deal);
+
+	static size_t listActions(
+		const GameState& state,
+		const BoardLayout& layout,
+		GameState::Action actions[MAX_NUM_ACTIONS]);
+
+	static GameState::Action chooseHeuristicAction(
+		const GameState& state,
+		const BoardLayout& layout,
+		MersenneTwister& rng);
+
+protected:
+	void iterate(Tree& tree,
+		const GameState& root,
+		const DealSampler& sampler,
+		const BoardLayout& layout,
+		MersenneTwister& rng,
+		std::vector<size_t>& path) const;
+
+	size_t selectChild(const Tree& tree,
+		size_t parent,
+		const GameState::Action actions[], size_t numActions,
+		MersenneTwister& rng,
+		GameState::Action* untriedAction) const;
+	static size_t addChild(Tree& tree, size_t parent, const GameState::Action& action, size_t actorSeat);
+
+	static bool isWorthSuggesting(const GameState::Seat& seat, unsigned char deduced, size_t cardIndex);
+	static bool isSameAction(const GameState::Action& lhs, const GameState::Action& rhs);
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	std::vector< std::unique_ptr<Tree> > _trees; //one per thread (root parallel), else first only
+	size_t _numIterations; //completed by last search, over all threads
+	size_t _numThreads;    //used by last search
+
+	double _explorationWeight; //UCB exploration constant
+
+}; //end class IsmctsSearch defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns budget spending live turn's latency on every core.
+////////////////////////////////////////////////////////////////////////////////
+inline IsmctsSearch::Budget
+IsmctsSearch::Budget::liveTurn()
+{
+	Budget budget( 0, LIVE_TURN_MILLISECONDS );
+	budget._numThreads = 0;
+
+	return budget;
+
+} //end routine liveTurn()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+IsmctsSearch::Tree::getNumNodes()
+const
+{
+	size_t num_nodes( _numNodes.load(std::memory_order_acquire) );
+	return( (num_nodes < MAX_NUM_BLOCKS * NODES_PER_BLOCK) ? num_nodes : MAX_NUM_BLOCKS * NODES_PER_BLOCK );
+
+} //end routine getNumNodes()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline IsmctsSearch::Node&
+IsmctsSearch::Tree::getNode(
+	size_t node_index) //i - node of interest
+const
+{
+	return _blocks[node_index / NODES_PER_BLOCK].load(std::memory_order_acquire)[node_index % NODES_PER_BLOCK];
+
+} //end routine getNode()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+IsmctsSearch::getNumIterations()
+const
+{
+	return _numIterations;
+
+} //end routine getNumIterations()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+IsmctsSearch::getNumThreads()
+const
+{
+	return _numThreads;
+
+} //end routine getNumThreads()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline bool
+IsmctsSearch::isSameAction(
+	const GameState::Action& lhs, //i - first action
+	const GameState::Action& rhs) //i - second action
+{
+	return(
+		(lhs._choice == rhs._choice) &&
+		(lhs._destination == rhs._destination) &&
+		(lhs._cards == rhs._cards) );
+
+} //end routine isSameAction()
+
+
+#endif //IsmctsSearch_h defn
@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file IsmctsStrategy.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  1730
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IsmctsStrategy.h"
+
+#include "Game.h"
+#include "Location.h"
+#include "MoveOptionSet.h"
+#include "Player.h"
+#include "Room.h"
+#include "TurnOptionSet.h"
+#include "SolutionCardSet.h"
+
+#include <sstream>			//for std::ostringstream use
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param Budget: search limits per turn choice
+/// \return None
+/// \throw None
+/// \note
+/// - Named "search" plus iteration budget (e.g. "search:1000").
+////////////////////////////////////////////////////////////////////////////////
+IsmctsStrategy::IsmctsStrategy(
+	const IsmctsSearch::Budget& budget) //i - search limits per turn choice
+	: PlayerStrategy( "search" )
+	, _budget( budget )
+	, _search()
+	, _plannedAction()
+{
+	if( 0 < budget._maxNumIterations )
+	{
+		std::ostringstream name;
+		name << _name << ":" << budget._maxNumIterations;
+		_name = name.str();
+	}
+
+} //end routine extended constructor
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Makes fresh strategy with same budget for another player.
+/// \param None
+/// \return PlayerStrategy: new strategy (caller owns)
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+PlayerStrategy*
+IsmctsStrategy::clone()
+const
+{
+	IsmctsStrategy* strategy( new IsmctsStrategy(_budget) );
+	strategy->setName( _name );
+
+	return strategy;
+
+} //end routine clone()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Makes selection amongst options for current turn by search.
+/// \param Player: player taking turn
+/// \param TurnOptionSet: valid options for current turn
+/// \return TurnOptionType: chosen option
+/// \throw None
+/// \note
+/// - Searched action's details kept for provideMovePreference() and
+///   buildSuggestion().
+////////////////////////////////////////////////////////////////////////////////
+clueless::TurnOptionType
+IsmctsStrategy::makeTurnChoice(
+	const Player& player, //i - player taking turn
+	TurnOptionSet* options) //i - valid options for turn
+{
+	_plannedAction = GameState::Action();
+
+	//accusation ends the game as soon as it is known to be right
+	const Game* game( player.getAssocGame() );
+	if( ! game ||
+		player.isReadyToMakeAccusation() )
+	{
+		return player.makeHeuristicTurnChoice( options );
+	}
+
+	GameState root( game->snapshot(&player) );
+	GameState::Action action(
+		_search.run(root, *game->_board.getLayout(), _budget, *player.getRandomNumberGenerator()) );
+
+	if( ! options->hasOption(action._choice) )
+	{
+		return player.makeHeuristicTurnChoice( options ); //search disagrees with game
+	}
+
+	_plannedAction = action;
+
+	return action._choice;
+
+} //end routine makeTurnChoice()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Provides destination chosen by search.
+/// \param Player: player moving
+/// \param MoveOptionSet: move options
+/// \return Location: preferred move destination; null if no preference
+/// \throw None
+/// \note
+/// - Player's preference when search chose no move among options.
+////////////////////////////////////////////////////////////////////////////////
+Location*
+IsmctsStrategy::provideMovePreference(
+	const Player& player, //i - player moving
+	MoveOptionSet* move_options) //io- move options
+{
+	if( clueless::MOVE == _plannedAction._choice )
+	{
+		for(size_t opt_index(0); opt_index < move_options->getNumOptions(); ++opt_index)
+		{
+			Location* option( move_options->getOption(opt_index) );
+			if( _plannedAction._destination == option->getId() )
+			{
+				_plannedAction = GameState::Action();
+				return option;
+			}
+		}
+	}
+
+	return player.provideHeuristicMovePreference( move_options );
+
+} //end routine provideMovePreference()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Constructs suggestion chosen by search.
+/// \param Player: player suggesting
+/// \return SolutionCardSet: suggestion in current room
+/// \throw None
+/// \note
+/// - Player's suggestion when search chose none.
+////////////////////////////////////////////////////////////////////////////////
+SolutionCardSet
+IsmctsStrategy::buildSuggestion(
+	const Player& player) //i - player suggesting
+{
+	if( (clueless::MAKE_SUGGESTION == _plannedAction._choice) &&
+		player.getLocation()->isRoom() )
+	{
+		SolutionCardSet suggestion(
+			_plannedAction._cards.getPersonType(),
+			_plannedAction._cards.getWeaponType(),
+			((const Room*)player.getLocation())->_type );
+
+		_plannedAction = GameState::Action();
+
+		return suggestion;
+	}
+
+	return player.buildHeuristicSuggestion();
+
+} //end routine buildSuggestion()
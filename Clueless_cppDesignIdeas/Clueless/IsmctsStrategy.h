@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file IsmctsStrategy.h
+/// \brief Strategy choosing moves and suggestions by information-set Monte
+///        Carlo tree search.
+///
+/// \date   17 Oct 2026  1730
+///
+/// \note
+/// - Each turn choice searches from a snapshot of the game (see
+///   Game::snapshot()); the chosen action's details (destination, suggested
+///   cards) are kept for the follow-up calls that ask for them.
+/// - Accuses as soon as notebook is ready, as Player does.
+/// - Falls back to Player's heuristics when search offers nothing usable,
+///   and for which counter-evidence to show.
+/// - Search reads only what the player's notebook knows; snapshot's true
+///   hidden cards are redealt every iteration.
+/// - Live games: IsmctsSearch::Budget::liveTurn() spends the per-move
+///   latency allowance on every core.
+/// - Not yet stronger than Player's heuristics: one search seat against three
+///   heuristic seats wins at the heuristic seat's rate, within sampling
+///   error, at 1000 to 4000 iterations, exploration weights 0.3 to 1.4, and
+///   with rollouts rewarding deduction progress.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IsmctsStrategy_h
+#define IsmctsStrategy_h
+
+#include "PlayerStrategy.h"
+#include "GameState.h"
+#include "IsmctsSearch.h"
+
+
+class IsmctsStrategy
+	: public PlayerStrategy
+{
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	/// \note private scope to force use of extended constructor
+	IsmctsStrategy();
+
+public:
+	IsmctsStrategy(const IsmctsSearch::Budget& budget);
+
+	virtual ~IsmctsStrategy()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	const IsmctsSearch::Budget& getBudget() const;
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	virtual PlayerStrategy* clone() const;
+
+	virtual clueless::TurnOptionType makeTurnChoice(
+		const Player& player,
+		TurnOptionSet* turnOptions);
+
+	virtual Location* provideMovePreference(
+		const Player& player,
+		MoveOptionSet* moveOptions);
+
+	virtual SolutionCardSet buildSuggestion(const Player& player);
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	IsmctsSearch::Budget _budget; //per turn choice
+
+	IsmctsSearch _search;
+	GameState::Action _plannedAction; //from latest search; doing nothing once used
+
+}; //end class IsmctsStrategy defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline const IsmctsSearch::Budget&
+IsmctsStrategy::getBudget()
+const
+{
+	return _budget;
+
+} //end routine getBudget()
+
+
+#endif //IsmctsStrategy_h defn
@@ -87,3 +87,28 @@ Location::addOccupant(
 	return false;
 
 } //end routine addOccupant()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns every location connected to this one, regardless of
+///  occupancy.
+/// \param None
+/// \return MoveOptionSet: connected locations
+/// \throw None
+/// \note
+/// - Used for board distances, which do not depend on hallway occupants.
+////////////////////////////////////////////////////////////////////////////////
+MoveOptionSet
+Location::getConnections()
+const
+{
+	MoveOptionSet connections;
+
+	for(size_t exit_index(0); exit_index < _numExits; ++exit_index)
+	{
+		connections.addOption( _exits[exit_index] );
+	}
+
+	return connections;
+
+} //end routine getConnections()
@@ -16,14 +16,16 @@
 #ifndef Location_h
 #define Location_h
 
+#include "MoveOptionSet.h"
+
 #include <iostream>	//for std::cout use
-#include <set>		//for std::set use
 #include <sstream>	//for std::ostringstream use
 #include <string>	//for std::string use
 
 
 //forward declarations
 struct GamePiece;
+struct LocationOrder;
 struct PersonPiece;
 class Room;
 
@@ -53,8 +55,13 @@ private:
 
 public:
 	/// \brief Extended constructor
-	Location( LocationType type )
+	/// \param LocationType: room, hallway, or home
+	/// \param unsigned int: identifier unique within board
+	Location( LocationType type, unsigned int id )
 		: _type( type )
+		, _id( id )
+		, _exits( nullptr )
+		, _numExits( 0 )
 	{
 	}
 
@@ -67,6 +74,7 @@ public:
 	// Accessors and Mutators
 	//--------------------------------------------------------------------------
 	std::string getName() const;
+	unsigned int getId() const;
 
 	bool isRoom() const;
 	bool isHallway() const;
@@ -79,12 +87,15 @@ public:
 
 	virtual bool isAccusationAllowedHere() const;
 
+	void setExits(Location* const* exits, size_t numExits);
+
 	//--------------------------------------------------------------------------
 	// Additional Member Functions
 	//--------------------------------------------------------------------------
 	virtual std::ostringstream report() const;
 
-	virtual std::set<Location*> getMoveOptions() const = 0;
+	virtual MoveOptionSet getMoveOptions() const = 0;
+	virtual MoveOptionSet getConnections() const;
 
 	//--------------------------------------------------------------------------
 	// Data Members
@@ -92,6 +103,10 @@ public:
 protected:
 	std::string _name;
 	LocationType _type;
+	unsigned int _id; //unique within board; fixed at creation
+
+	Location* const* _exits; //connections in identifier order, within board's table (not owned)
+	size_t _numExits;
 
 }; //end class Location defn
 
@@ -105,7 +120,7 @@ class Hallway : public Location
 private:
 	/// \brief Default constructor
 	Hallway()
-		: Location( HALLWAY )
+		: Location( HALLWAY, 0 )
 		, _connectingRoom1( nullptr )
 		, _connectingRoom2( nullptr )
 		, _occupant( nullptr )
@@ -113,7 +128,7 @@ private:
 	}
 
 public:
-	Hallway(Room* firstConnectingRoom, Room* secondConnectingRoom);
+	Hallway(Room* firstConnectingRoom, Room* secondConnectingRoom, unsigned int id);
 
 	/// \brief Destructor
 	virtual ~Hallway()
@@ -134,7 +149,7 @@ public:
 	// Additional Member Functions
 	//--------------------------------------------------------------------------
 public:
-	virtual std::set<Location*> getMoveOptions() const override;
+	virtual MoveOptionSet getMoveOptions() const override;
 
 	//--------------------------------------------------------------------------
 	// Data Members
@@ -157,7 +172,7 @@ class HomeLocation : public Location
 private:
 	/// \brief Default constructor
 	HomeLocation()
-		: Location( HOME )
+		: Location( HOME, 0 )
 		, _personToken( nullptr )
 		, _adjacentHallway( nullptr )
 		, _occupant( nullptr )
@@ -165,7 +180,7 @@ private:
 	}
 
 public:
-	HomeLocation(PersonPiece* personToken, Hallway* adjacentHallway);
+	HomeLocation(PersonPiece* personToken, Hallway* adjacentHallway, unsigned int id);
 
 	/// \brief Destructor
 	virtual ~HomeLocation()
@@ -184,7 +199,7 @@ public:
 	//--------------------------------------------------------------------------
 	// Additional Member Functions
 	//--------------------------------------------------------------------------
-	virtual std::set<Location*> getMoveOptions() const override;
+	virtual MoveOptionSet getMoveOptions() const override;
 
 	//--------------------------------------------------------------------------
 	// Data Members
@@ -198,6 +213,23 @@ private:
 }; //end class HomeLocation defn
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Orders locations by identifier.
+/// \note
+/// - Used in place of default pointer ordering for location containers, so
+///   iteration order (and any random choice by position) depends only on the
+///   board, not on where locations happen to be allocated.
+////////////////////////////////////////////////////////////////////////////////
+struct LocationOrder
+{
+	bool operator()(const Location* lhs, const Location* rhs) const
+	{
+		return( lhs->getId() < rhs->getId() );
+	}
+
+}; //end struct LocationOrder defn
+
+
 //------------------------------------------------------------------------------
 // Inlined Methods
 //------------------------------------------------------------------------------
@@ -211,6 +243,16 @@ const
 } //end routine getName()
 
 
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned int
+Location::getId()
+const
+{
+	return _id;
+
+} //end routine getId()
+
+
 ////////////////////////////////////////////////////////////////////////////////
 inline bool
 Location::isRoom()
@@ -251,4 +293,19 @@ const
 } //end routine isAccusationAllowedHere()
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Points location at its connections within owning board's table.
+/// \note exits must be in identifier order and outlive location
+////////////////////////////////////////////////////////////////////////////////
+inline void
+Location::setExits(
+	Location* const* exits, //i - connected locations
+	size_t num_exits) //i - number of connected locations
+{
+	_exits = exits;
+	_numExits = num_exits;
+
+} //end routine setExits()
+
+
 #endif //Location_h
@@ -0,0 +1,309 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file LzCodec.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  2310
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "LzCodec.h"
+
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::logic_error use
+
+//------------------------------------------------------------------------------
+// Local Helpers
+//------------------------------------------------------------------------------
+static const size_t NIBBLE_LIMIT = 15; //count needing a varint to follow
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns hash table slot for three bytes.
+////////////////////////////////////////////////////////////////////////////////
+static size_t
+hashBytes(
+	const unsigned char* bytes) //i - three bytes
+{
+	const unsigned int value( bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) );
+
+	return( (value * 2654435761u) >> 22 ); //Knuth multiplicative hash, ten bits
+
+} //end routine hashBytes()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Appends count as unsigned varint.
+////////////////////////////////////////////////////////////////////////////////
+static void
+appendCount(
+	size_t count, //i - count
+	std::vector<unsigned char>* compressed) //io- destination
+{
+	while( 0x80 <= count )
+	{
+		compressed->push_back( (unsigned char)(count | 0x80) );
+		count >>= 7;
+	}
+
+	compressed->push_back( (unsigned char)count );
+
+} //end routine appendCount()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Reads unsigned varint count.
+/// \throw
+/// - INCONSISTENT_DATA when varint runs past end or exceeds size_t.
+////////////////////////////////////////////////////////////////////////////////
+static size_t
+readCount(
+	const unsigned char* compressed, //i - compressed data
+	size_t num_compressed, //i - size of compressed data
+	size_t* position) //io- position of varint
+{
+	size_t count( 0 );
+
+	for(unsigned int shift(0); shift < 8 * sizeof(size_t); shift += 7)
+	{
+		if( num_compressed <= *position )
+		{
+			break; //truncated
+		}
+
+		unsigned char byte( compressed[(*position)++] );
+		count |= (size_t)(byte & 0x7f) << shift;
+
+		if( 0 == (byte & 0x80) ) //last byte
+		{
+			return count;
+		}
+	}
+
+	std::ostringstream msg;
+	msg << "LzCodec::decompress()\n"
+		<< "  INCONSISTENT_DATA\n"
+		<< "  truncated or oversized count before byte " << *position;
+	throw std::logic_error( msg.str() );
+
+} //end routine readCount()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Appends literals, and match when match length not zero.
+////////////////////////////////////////////////////////////////////////////////
+static void
+appendSequence(
+	const unsigned char* literals, //i - literals
+	size_t num_literals, //i - number of literals
+	size_t distance, //i - distance back to match
+	size_t match_length, //i - match length; 0 for last sequence
+	std::vector<unsigned char>* compressed) //io- destination
+{
+	const size_t extra_length( (0 < match_length) ? match_length - LzCodec::MIN_MATCH_LENGTH : 0 );
+
+	const size_t literal_nibble( (NIBBLE_LIMIT < num_literals) ? NIBBLE_LIMIT : num_literals );
+	const size_t length_nibble( (NIBBLE_LIMIT < extra_length) ? NIBBLE_LIMIT : extra_length );
+
+	compressed->push_back( (unsigned char)((literal_nibble << 4) | length_nibble) );
+	if( NIBBLE_LIMIT == literal_nibble )
+	{
+		appendCount( num_literals - NIBBLE_LIMIT, compressed );
+	}
+
+	compressed->insert( compressed->end(), literals, literals + num_literals );
+
+	if( 0 == match_length )
+	{
+		return; //last sequence
+	}
+
+	appendCount( distance, compressed );
+	if( NIBBLE_LIMIT == length_nibble )
+	{
+		appendCount( extra_length - NIBBLE_LIMIT, compressed );
+	}
+
+} //end routine appendSequence()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Reports damaged compressed data.
+/// \throw
+/// - INCONSISTENT_DATA always.
+////////////////////////////////////////////////////////////////////////////////
+static void
+throwDamaged(
+	const char* problem) //i - what is wrong
+{
+	std::ostringstream msg;
+	msg << "LzCodec::decompress()\n"
+		<< "  INCONSISTENT_DATA\n"
+		<< "  " << problem;
+	throw std::logic_error( msg.str() );
+
+} //end routine throwDamaged()
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Compresses bytes.
+/// \param unsigned char[]: bytes
+/// \param size_t: number of bytes
+/// \param vector<unsigned char>: compressed bytes; replaced
+/// \return None
+/// \throw None
+/// \note
+/// - Greedy: takes the most recent earlier match of at least
+///   MIN_MATCH_LENGTH bytes with the same hash, extended as far as it goes.
+/// - Record-sized input needs no memory beyond the output.
+////////////////////////////////////////////////////////////////////////////////
+void
+LzCodec::compress(
+	const unsigned char* bytes, //i - bytes
+	size_t num_bytes, //i - number of bytes
+	std::vector<unsigned char>* compressed) // o- compressed bytes
+{
+	compressed->clear();
+
+	size_t recent[HASH_TABLE_SIZE]; //position + 1 by hash; 0 for none
+	for(size_t slot(0); slot < HASH_TABLE_SIZE; ++slot)
+	{
+		recent[slot] = 0;
+	}
+
+	size_t anchor( 0 ); //first literal not yet written
+	size_t position( 0 );
+
+	while( position + MIN_MATCH_LENGTH <= num_bytes )
+	{
+		const size_t slot( hashBytes(bytes + position) );
+		const size_t candidate( recent[slot] );
+		recent[slot] = position + 1;
+
+		if( (0 == candidate) ||
+			(bytes[candidate - 1] != bytes[position]) ||
+			(bytes[candidate] != bytes[position + 1]) ||
+			(bytes[candidate + 1] != bytes[position + 2]) )
+		{
+			++position;
+			continue; //no match here
+		}
+
+		const size_t match_start( candidate - 1 );
+		size_t match_length( MIN_MATCH_LENGTH );
+		while( (position + match_length < num_bytes) &&
+			(bytes[match_start + match_length] == bytes[position + match_length]) )
+		{
+			++match_length;
+		}
+
+		appendSequence( bytes + anchor, position - anchor,
+			position - match_start, match_length, compressed );
+
+		//remember positions within match for later matches
+		for(size_t later(position + 1);
+			(later < position + match_length) && (later + MIN_MATCH_LENGTH <= num_bytes);
+			++later)
+		{
+			recent[hashBytes(bytes + later)] = later + 1;
+		}
+
+		position += match_length;
+		anchor = position;
+
+	} //end while (room for a match)
+
+	if( anchor < num_bytes )
+	{
+		appendSequence( bytes + anchor, num_bytes - anchor, 0, 0, compressed );
+	}
+
+} //end routine compress()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Decompresses bytes.
+/// \param unsigned char[]: compressed bytes
+/// \param size_t: number of compressed bytes
+/// \param unsigned char[]: bytes
+/// \param size_t: number of bytes (as given to compress())
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when compressed bytes damaged or do not decompress to
+///   exactly numBytes.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+LzCodec::decompress(
+	const unsigned char* compressed, //i - compressed bytes
+	size_t num_compressed, //i - number of compressed bytes
+	unsigned char* bytes, // o- bytes
+	size_t num_bytes) //i - number of bytes
+{
+	size_t in_position( 0 );
+	size_t out_position( 0 );
+
+	while( in_position < num_compressed )
+	{
+		const unsigned char token( compressed[in_position++] );
+
+		size_t num_literals( token >> 4 );
+		if( NIBBLE_LIMIT == num_literals )
+		{
+			num_literals += readCount( compressed, num_compressed, &in_position );
+		}
+
+		if( (num_compressed - in_position < num_literals) ||
+			(num_bytes - out_position < num_literals) )
+		{
+			throwDamaged( "literals run past end" );
+		}
+
+		for(size_t lit_index(0); lit_index < num_literals; ++lit_index)
+		{
+			bytes[out_position++] = compressed[in_position++];
+		}
+
+		if( in_position == num_compressed )
+		{
+			break; //last sequence
+		}
+
+		const size_t distance( readCount(compressed, num_compressed, &in_position) );
+
+		size_t match_length( token & 0x0f );
+		if( NIBBLE_LIMIT == match_length )
+		{
+			match_length += readCount( compressed, num_compressed, &in_position );
+		}
+		match_length += MIN_MATCH_LENGTH;
+
+		if( (0 == distance) || (out_position < distance) ||
+			(num_bytes - out_position < match_length) )
+		{
+			throwDamaged( "match out of range" );
+		}
+
+		//byte by byte; match may overlap bytes it writes
+		for(size_t match_index(0); match_index < match_length; ++match_index, ++out_position)
+		{
+			bytes[out_position] = bytes[out_position - distance];
+		}
+
+	} //end while (more sequences)
+
+	if( num_bytes != out_position )
+	{
+		throwDamaged( "decompressed size differs" );
+	}
+
+} //end routine decompress()
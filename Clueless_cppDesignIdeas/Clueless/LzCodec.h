@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file LzCodec.h
+/// \brief Byte-oriented LZ77 compression of short records.
+///
+/// \date   17 Oct 2026  2305
+///
+/// \note
+/// - Compressed data is a run of sequences, each a token byte (literal count
+///   in high four bits, match length less MIN_MATCH_LENGTH in low four; 15
+///   meaning "15 plus a varint"), the literals, then the distance back to the
+///   match (varint) and any match length varint.  The last sequence ends
+///   after its literals.
+/// - Meant for game records (see ReplayLogSink): each record compresses on
+///   its own, so any one can be decompressed without its neighbours.
+/// - Decompression checks every count and distance against the buffers, so
+///   damaged data is reported rather than read or written out of bounds.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef LzCodec_h
+#define LzCodec_h
+
+#include <stddef.h>		//for size_t use
+#include <vector>		//for std::vector use
+
+
+class LzCodec
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const size_t MIN_MATCH_LENGTH = 3;
+	static const size_t HASH_TABLE_SIZE = 1024; //recent positions by hash of next three bytes
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	/// \note private scope; all members are static
+	LzCodec();
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+public:
+	static void compress(const unsigned char* bytes,
+		size_t numBytes,
+		std::vector<unsigned char>* compressed);
+
+	static void decompress(const unsigned char* compressed,
+		size_t numCompressed,
+		unsigned char* bytes,
+		size_t numBytes);
+
+}; //end class LzCodec defn
+
+
+#endif //LzCodec_h defn
@@ -17,10 +17,14 @@
 #include "CardDeck.h"
 #include "Game.h"
 #include "Player.h"
+#include "ReplayLogFile.h"
+#include "ReplayLogSink.h"
 #include "SolutionCardSet.h"
+#include "TextEventSink.h"
 
 #include "CluelessEnums.h"	//for PersonType use
 
+#include <cstring>			//for std::strcmp use
 #include <iostream>			//for std::cout use
 #include <list>				//for std:list use
 #include <stdio.h>
@@ -44,7 +48,19 @@ int main( int argc, const char* argv[] )
 		players.push_back( &player_3 );
 
 
+		/// \note game recorded for ReplayInspector when run as: Clueless --replay-log LOG
+		const char* replay_log_file( nullptr );
+		if( (3 == argc) && (0 == std::strcmp(argv[1], "--replay-log")) )
+		{
+			replay_log_file = argv[2];
+		}
+
+		TextEventSink narration( std::cout );
+		ReplayLogSink recording( &narration );
+		recording.beginGame( 0, 5489 ); //MersenneTwister default, as Game()
+
 		Game clueless;
+		clueless.setEventSink( &recording );
 		clueless.setup( &players );
 
 		unsigned int turn_number( 0 );
@@ -54,6 +70,8 @@ int main( int argc, const char* argv[] )
 			(clueless._numFalseAccusers < clueless._players.size()) &&
 			(MAX_NUM_TURNS > turn_number) )
 		{
+			narration.flush(); //keep game play ahead of turn banner
+
 			if( 0 == turn_number % 5 )
 			{
 				std::cout << "--------------------------------------------------------------------------------\n";
@@ -78,6 +96,7 @@ int main( int argc, const char* argv[] )
 
 			} //end while (more players)
 
+			narration.flush();
 			std::cout << "\n";
 
 			++turn_number; //next turn
@@ -85,6 +104,22 @@ int main( int argc, const char* argv[] )
 		} //end while (reason to continue turns)
 
 		std::cout << "\n";
+
+		if( replay_log_file )
+		{
+			ReplayLogHeader header;
+			header._numPlayers = players.size();
+			header._maxNumTurns = MAX_NUM_TURNS;
+			header._batchSeed = 5489;
+
+			recording.endGame();
+
+			ReplayLogWriter replay_log( replay_log_file, header );
+			replay_log.appendGame( recording );
+			replay_log.close();
+
+			std::cout << "Replay log: " << replay_log_file << "\n";
+		}
 	}
 	catch(const std::exception& error)
 	{
@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file MappedFile.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  2320
+///
+/// \note
+/// - Only file in the engine calling the operating system directly: Windows
+///   file mapping, or POSIX mmap() elsewhere.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "MappedFile.h"
+
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::logic_error use
+
+#ifdef _WIN32
+#include <windows.h>		//for CreateFileMapping, MapViewOfFile use
+#else
+#include <fcntl.h>			//for open use
+#include <sys/mman.h>		//for mmap, munmap use
+#include <sys/stat.h>		//for fstat use
+#include <unistd.h>			//for close use
+#endif
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param char*: path of file
+/// \return None
+/// \throw
+/// - INSUFFICIENT_DATA when file cannot be opened or mapped.
+/// \note
+/// - File must not be changed while mapped.
+////////////////////////////////////////////////////////////////////////////////
+MappedFile::MappedFile(
+	const char* path) //i - path of file
+	: _data( nullptr )
+	, _size( 0 )
+{
+	bool is_mapped( false );
+
+#ifdef _WIN32
+	HANDLE file( CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) );
+	LARGE_INTEGER file_size;
+
+	if( (INVALID_HANDLE_VALUE != file) && GetFileSizeEx(file, &file_size) )
+	{
+		_size = (size_t)file_size.QuadPart;
+		is_mapped = (0 == _size);
+
+		HANDLE mapping( (0 < _size)
+			? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr)
+			: nullptr );
+		if( mapping )
+		{
+			_data = (const unsigned char*)MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+			is_mapped = (nullptr != _data);
+			CloseHandle( mapping ); //view keeps mapping open
+		}
+	}
+
+	if( INVALID_HANDLE_VALUE != file )
+	{
+		CloseHandle( file );
+	}
+#else
+	int file( open(path, O_RDONLY) );
+	struct stat file_status;
+
+	if( (0 <= file) && (0 == fstat(file, &file_status)) )
+	{
+		_size = (size_t)file_status.st_size;
+		is_mapped = (0 == _size);
+
+		if( 0 < _size )
+		{
+			void* view( mmap(nullptr, _size, PROT_READ, MAP_SHARED, file, 0) );
+			if( MAP_FAILED != view )
+			{
+				_data = (const unsigned char*)view;
+				is_mapped = true;
+			}
+		}
+	}
+
+	if( 0 <= file )
+	{
+		close( file ); //mapping stays valid
+	}
+#endif
+
+	if( ! is_mapped )
+	{
+		_data = nullptr;
+		_size = 0;
+
+		std::ostringstream msg;
+		msg << "MappedFile::MappedFile()\n"
+			<< "  INSUFFICIENT_DATA\n"
+			<< "  cannot map file " << path;
+		throw std::logic_error( msg.str() );
+	}
+
+} //end routine constructor
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Destructor
+/// \param None
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+MappedFile::~MappedFile()
+{
+	if( ! _data )
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	UnmapViewOfFile( _data );
+#else
+	munmap( (void*)_data, _size );
+#endif
+
+} //end routine destructor
@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file MappedFile.h
+/// \brief Read-only view of a whole file mapped into memory.
+///
+/// \date   17 Oct 2026  2315
+///
+/// \note
+/// - Pages are read by the operating system as they are touched, so a large
+///   file costs only what is looked at, and many threads may read one view.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MappedFile_h
+#define MappedFile_h
+
+#include <stddef.h>		//for size_t use
+
+
+class MappedFile
+{
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	MappedFile();
+
+	/// \brief Copy constructor
+	MappedFile(const MappedFile&);
+
+public:
+	MappedFile(const char* path);
+
+	virtual ~MappedFile();
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	const unsigned char* getData() const;
+	size_t getSize() const;
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	const unsigned char* _data; //nullptr for empty file
+	size_t _size;
+
+}; //end class MappedFile defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline const unsigned char*
+MappedFile::getData()
+const
+{
+	return _data;
+
+} //end routine getData()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+MappedFile::getSize()
+const
+{
+	return _size;
+
+} //end routine getSize()
+
+
+#endif //MappedFile_h defn
@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file MoveOptionSet.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  2210
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "MoveOptionSet.h"
+
+#include "Location.h"
+
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::logic_error use
+
+//------------------------------------------------------------------------------
+// Accessors and Mutators
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Adds destination, keeping options in identifier order.
+/// \param Location: destination
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when options already full.
+/// \note
+/// - Destination already amongst options is not added again.
+////////////////////////////////////////////////////////////////////////////////
+void
+MoveOptionSet::addOption(
+	Location* option) //i - destination
+{
+	size_t position( _numOptions );
+	while( (0 < position) &&
+		(option->getId() < _options[position - 1]->getId()) )
+	{
+		--position;
+	}
+
+	if( (0 < position) && (option == _options[position - 1]) )
+	{
+		return; //already an option
+	}
+
+	if( MAX_NUM_OPTIONS == _numOptions )
+	{
+		std::ostringstream msg;
+		msg << "MoveOptionSet::addOption()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  more than " << MAX_NUM_OPTIONS << " move options";
+		throw std::logic_error( msg.str() );
+	}
+
+	//shift later options up to make room
+	for(size_t later(_numOptions); later > position; --later)
+	{
+		_options[later] = _options[later - 1];
+	}
+
+	_options[position] = option;
+	++_numOptions;
+
+} //end routine addOption()
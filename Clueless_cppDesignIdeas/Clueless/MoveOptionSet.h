@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file MoveOptionSet.h
+/// \brief Destinations open to a moving player, held inline.
+///
+/// \date   17 Oct 2026  2210
+///
+/// \note
+/// - No location has more than BoardLayout::MAX_NUM_EXITS exits, so options
+///   fit in a fixed-size array; building, narrowing, and copying options
+///   allocates nothing.
+/// - Options are kept in identifier order (see LocationOrder), as in the
+///   ordered set it replaces, so a choice by position draws the same
+///   destination.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MoveOptionSet_h
+#define MoveOptionSet_h
+
+#include "BoardLayout.h"	//for MAX_NUM_EXITS use
+
+#include <stddef.h>		//for size_t use
+
+
+//forward declarations
+class Location;
+
+
+class MoveOptionSet
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const size_t MAX_NUM_OPTIONS = BoardLayout::MAX_NUM_EXITS;
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+public:
+	/// \brief Default constructor
+	MoveOptionSet()
+		: _numOptions( 0 )
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	bool isEmpty() const;
+	size_t getNumOptions() const;
+	Location* getOption(size_t position) const;
+
+	void addOption(Location* option);
+	void clear();
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+private:
+	Location* _options[MAX_NUM_OPTIONS]; //in identifier order
+	size_t _numOptions;
+
+}; //end class MoveOptionSet defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline bool
+MoveOptionSet::isEmpty()
+const
+{
+	return( 0 == _numOptions );
+
+} //end routine isEmpty()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+MoveOptionSet::getNumOptions()
+const
+{
+	return _numOptions;
+
+} //end routine getNumOptions()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns option at position, counting in identifier order.
+////////////////////////////////////////////////////////////////////////////////
+inline Location*
+MoveOptionSet::getOption(
+	size_t position) //i - position amongst options
+const
+{
+	return _options[position];
+
+} //end routine getOption()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline void
+MoveOptionSet::clear()
+{
+	_numOptions = 0;
+
+} //end routine clear()
+
+
+#endif //MoveOptionSet_h defn
@@ -13,7 +13,7 @@
 ///
 ////////////////////////////////////////////////////////////////////////////////
 
-#include "DetectiveNotebook.h"
+#include "NotebookEntry.h"
 
 //------------------------------------------------------------------------------
 // Accessors and Mutators
@@ -30,10 +30,48 @@ NotebookEntry::haveShownToPlayer(
 	clueless::PersonType player_character) //i - player
 const
 {
-	std::set<clueless::PersonType>::const_iterator player_iter(
-		_playersShown.find(player_character) );
-
-	//whether found player
-	return( _playersShown.end() != player_iter );
+	return( 0 != (_playersShown & (1u << player_character)) );
 
 } //end routine haveShownToPlayer()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Determines number of players to whom entry was previously shown.
+/// \param None
+/// \return size_t: number of players shown card
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+size_t
+NotebookEntry::countPlayersShown()
+const
+{
+	size_t num_players( 0 );
+
+	//clear lowest set bit until none remain
+	for(unsigned int remaining( _playersShown );
+		0 != remaining;
+		remaining &= (remaining - 1) )
+	{
+		++num_players;
+	}
+
+	return num_players;
+
+} //end routine countPlayersShown()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Records that entry has been shown to specified player.
+/// \param PersonType: player character shown card
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+NotebookEntry::recordShownToPlayer(
+	clueless::PersonType player_character) //i - player
+{
+	_playersShown |= (1u << player_character);
+
+} //end routine recordShownToPlayer()
@@ -18,13 +18,16 @@
 #include "Card.h"				//for Card, RoomCard use
 #include "GamePiece.h"
 #include "Location.h"
+#include "MoveOptionSet.h"
 #include "Room.h"
 #include "SolutionCardSet.h"
+#include "TurnOptionSet.h"
 
 #include "CluelessEnums.h"	//for RoomType use
 #include "mersenneTwister.h"
 
 #include <algorithm>		//for std::min() use
+#include <cmath>			//for std::floor use
 #include <limits.h>			//for UINT_MAX use
 
 //------------------------------------------------------------------------------
@@ -43,12 +46,17 @@ Player::Player()
 	, _isGameCreator( false )
 	, _character( clueless::UNKNOWN_PERSON )
 	, _assocGameToken( nullptr )
+	, _numCardsInHand( 0 )
 	, _notebook( clueless::UNKNOWN_PERSON )
 	, _wasMovedToRoomOutOfTurn( false )
 	, _hasMovedDuringTurn( false )
 	, _hasMadeSuggestionDuringTurn( false )
 	//, _isReadyToMakeAccusation( false )
 	, _hasMadeFalseAccusation( false )
+	, _accusationConfidence( 1.0f )
+	, _rng( nullptr )
+	, _assocGame( nullptr )
+	, _strategy()
 	, _isGameWinner( false )
 {
 } //end routine constructor
@@ -71,12 +79,17 @@ Player::Player(
 	, _isGameCreator( is_game_creator )
 	, _character( game_character )
 	, _assocGameToken( nullptr )
+	, _numCardsInHand( 0 )
 	, _notebook( game_character )
 	, _wasMovedToRoomOutOfTurn( false )
 	, _hasMovedDuringTurn( false )
 	, _hasMadeSuggestionDuringTurn( false )
 	//, _isReadyToMakeAccusation( false )
 	, _hasMadeFalseAccusation( false )
+	, _accusationConfidence( 1.0f )
+	, _rng( nullptr )
+	, _assocGame( nullptr )
+	, _strategy()
 	, _isGameWinner( false )
 {
 } //end routine Player(name, character)
@@ -165,7 +178,15 @@ Player::isCardInHand(
 	const Card* card) //i - card of interest
 const
 {
-	return( _hand.end() != _hand.find(card) );
+	for(size_t pos_index(0); pos_index < _numCardsInHand; ++pos_index)
+	{
+		if( card == _hand[pos_index] )
+		{
+			return true;
+		}
+	}
+
+	return false;
 
 } //end routine isCardInHand()
 
@@ -177,7 +198,7 @@ const
 //{
 //	bool is_in_hand( false );
 //
-//	std::set<const Card*>::const_iterator card_iter( _hand.begin() );
+//	std::set<const Card*, CardOrder>::const_iterator card_iter( _hand.begin() );
 //	while( ! is_in_hand &&
 //		(_hand.end() != card_iter) )
 //	{
@@ -244,19 +265,16 @@ const
 	report
 		<< " hand:";
 
-	if( ! _hand.empty() ) //at least one card
+	if( 0 < _numCardsInHand ) //at least one card
 	{
 		report << "\n";
 
-		std::set<const Card*>::const_iterator card_iter( _hand.begin() );
-		while( _hand.end() != card_iter )
+		for(size_t pos_index(0); pos_index < _numCardsInHand; ++pos_index)
 		{
 			report
-				<< "   " << (*card_iter)->getName() << "\n";
-
-			++card_iter;
+				<< "   " << _hand[pos_index]->getName() << "\n";
 
-		} //end while (more cards)
+		} //end for (each card)
 
 		report << "\n";
 	}
@@ -282,12 +300,26 @@ const
 /// \throw None
 /// \note
 /// - Player uses card but does not own it.
+/// - Hand kept in card order (as dealt order is random).
 ////////////////////////////////////////////////////////////////////////////////
 void
 Player::addCardToHand(
 	const Card* card) //i - card to join hand
 {
-	_hand.insert( card );
+	size_t card_index( card->getIndex() );
+
+	//shift later cards back one position
+	size_t pos_index( _numCardsInHand );
+	while( (0 < pos_index) &&
+		(card_index < _hand[pos_index - 1]->getIndex()) )
+	{
+		_hand[pos_index] = _hand[pos_index - 1];
+		--pos_index;
+	}
+
+	_hand[pos_index] = card;
+	++_numCardsInHand;
+
 	_notebook.recordCardInHand( card );
 
 } //end routine addCardToHand()
@@ -313,14 +345,83 @@ Player::prepareForNewTurn()
 
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Makes selection amongst options for current turn.
-/// \param set<TurnOptionType>: valid options for current turn
-/// \return None
+/// \param TurnOptionSet: valid options for current turn
+/// \return TurnOptionType: chosen option
 /// \throw None
-/// \note  None
+/// \note
+/// - Strategy decides, if player has one (see setStrategy()).
 ////////////////////////////////////////////////////////////////////////////////
 clueless::TurnOptionType
 Player::makeTurnChoice(
-	std::set<clueless::TurnOptionType>* options) //i - valid options for turn
+	TurnOptionSet* options) //i - valid options for turn
+const
+{
+	if( _strategy )
+	{
+		return _strategy->makeTurnChoice( *this, options );
+	}
+
+	return makeHeuristicTurnChoice( options );
+
+} //end routine makeTurnChoice()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Offers preference between multiple move options.
+/// \param MoveOptionSet: move options; may be narrowed to equally preferred
+/// \return Location: preferred move destination; null if no preference
+/// \throw None
+/// \note
+/// - Strategy decides, if player has one (see setStrategy()).
+////////////////////////////////////////////////////////////////////////////////
+Location*
+Player::provideMovePreference(
+	MoveOptionSet* move_options) //io- move options
+const
+{
+	if( _strategy )
+	{
+		return _strategy->provideMovePreference( *this, move_options );
+	}
+
+	return provideHeuristicMovePreference( move_options );
+
+} //end routine provideMovePreference()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Constructs a Suggestion.
+/// \param None
+/// \return SolutionCardSet: suggestion in current room
+/// \throw None
+/// \note
+/// - Strategy decides, if player has one (see setStrategy()).
+////////////////////////////////////////////////////////////////////////////////
+SolutionCardSet
+Player::buildSuggestion()
+const
+{
+	if( _strategy )
+	{
+		return _strategy->buildSuggestion( *this );
+	}
+
+	return buildHeuristicSuggestion();
+
+} //end routine buildSuggestion()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Makes selection amongst options for current turn by heuristic.
+/// \param TurnOptionSet: valid options for current turn
+/// \return TurnOptionType: chosen option
+/// \throw None
+/// \note
+/// - Accuses once ready; otherwise chooses uniformly amongst options.
+////////////////////////////////////////////////////////////////////////////////
+clueless::TurnOptionType
+Player::makeHeuristicTurnChoice(
+	TurnOptionSet* options) //i - valid options for turn
 const
 {
 	clueless::TurnOptionType choice( clueless::DO_NOTHING_ELSE_THIS_TURN );
@@ -328,25 +429,19 @@ const
 	//if not ready to make accusation
 	if( ! isReadyToMakeAccusation() )
 	{
-		if( 1 == options->size() ) //only one option
+		size_t num_options( options->getNumOptions() );
+
+		if( 1 == num_options ) //only one option
 		{
 			//choose it
-			choice = *(options->begin());
+			choice = options->getOption( 0 );
 		}
 		else
 		{
 			//create position based on floor of random draw in [0, num choices)
-			size_t zero_based_pos( size_t(std::floor( MersenneTwister::drawReal2(0, (double)(options->size())) )) );
+			size_t zero_based_pos( size_t(std::floor( _rng->drawReal2(0, (double)num_options) )) );
 
-			std::set<clueless::TurnOptionType>::const_iterator opt_iter( options->begin() );
-			for(size_t pos_index(0);
-				pos_index < zero_based_pos;
-				++pos_index)
-			{
-				++opt_iter;
-			}
-
-			choice = *opt_iter;
+			choice = options->getOption( zero_based_pos );
 		}
 	}
 	else //ready to make accusation
@@ -354,32 +449,29 @@ const
 		choice = clueless::MAKE_ACCUSATION;
 	}
 
-	std::cout
-		<< "  " << getName() << " chooses to "
-		<< clueless::translateTurnOptionTypeToText( choice ) << "\n";
-
 	return choice;
 
-} //end routine makeTurnChoice
+} //end routine makeHeuristicTurnChoice()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Offers preference between multiple move options.
-/// \param set<Location>: move options
+/// \brief Offers preference between multiple move options by heuristic.
+/// \param MoveOptionSet: move options
 /// \return Location: preferred move destination; null if no preference
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
 Location*
-Player::provideMovePreference(
-	std::set<Location*>* move_options) //i - move options
+Player::provideHeuristicMovePreference(
+	MoveOptionSet* move_options) //i - move options
 const
 {
 	Location* preferred_destination( nullptr );
-	std::map<Location*, unsigned int> prioritized_options;
-	std::set<Location*>::iterator opt_iter( move_options->begin() );
+	size_t num_options( move_options->getNumOptions() );
+	unsigned int priorities[MoveOptionSet::MAX_NUM_OPTIONS]; //per option, in option order
+	size_t opt_index( 0 );
 
-	if( 1 < move_options->size() ) //more than one option
+	if( 1 < num_options ) //more than one option
 	{
 		//if have suspected room
 		if( _notebook.haveSuspectedRoom() )
@@ -387,31 +479,33 @@ const
 			/// \todo closest "in hand" or suspected... "in hand" preferred
 
 			while( ! preferred_destination &&
-				(move_options->end() != opt_iter) )
+				(num_options > opt_index) )
 			{
-				if( (*opt_iter)->isRoom() )
+				Location* option( move_options->getOption(opt_index) );
+
+				if( option->isRoom() )
 				{
 					// 1. room in hand or suspected
-					prioritized_options[*opt_iter] =
+					priorities[opt_index] =
 						(unsigned int)
 						_notebook.determineShortestPathForDestinationSuspectedOrInHand(
 							getLocation(), //current location
-							(*opt_iter)); //next step
+							option); //next step
 
 				}
 				else //destination not room (hallway)
 				{
 					// 1. room still needing questioning
-					prioritized_options[*opt_iter] =
+					priorities[opt_index] =
 						(unsigned int)
 						_notebook.determineShortestPathForDestinationSuspectedOrInHand(
 							getLocation(), //current location (probably room)
-							(*opt_iter) ); //next step on path
+							option ); //next step on path
 
-										   //prioritized_options[*opt_iter] = 15;
+										   //priorities[opt_index] = 15;
 				}
 
-				++opt_iter; //next option
+				++opt_index; //next option
 
 
 				//if( _notebook.isRoomInHand( ((Room*)(*opt_iter))->_type ) )
@@ -427,90 +521,89 @@ const
 		}
 		else //no suspected room
 		{
-			while( move_options->end() != opt_iter )
+			while( num_options > opt_index )
 			{
+				Location* option( move_options->getOption(opt_index) );
+
 				// 2: destination is room
-				if( (*opt_iter)->isRoom() )
+				if( option->isRoom() )
 				{
 					// 1. room still needing questioning
-					prioritized_options[*opt_iter] =
+					priorities[opt_index] =
 						(unsigned int)
 						_notebook.determineShortestPathForDestinationNeedingQuestion(
 							getLocation(), //current location
-							(*opt_iter) ); //next step
+							option ); //next step
 
 					//// 3: room without counter-evidence
 					//if( ! _notebook.haveCounterEvidenceForRoom( (Room*)(*opt_iter) ) )
 					//{
-					//	prioritized_options[*opt_iter] = 5;
+					//	priorities[opt_index] = 5;
 					//}
 					//else //have counter-evidence for room
 					//{
 					//	// 4: in hand
 					//	if( _notebook.isRoomInHand( ((Room*)(*opt_iter))->_type ) )
 					//	{
-					//		prioritized_options[*opt_iter] = 7;
+					//		priorities[opt_index] = 7;
 					//	}
 					//	else //not in hand
 					//	{
-					//		prioritized_options[*opt_iter] = 10;
+					//		priorities[opt_index] = 10;
 					//	}
 					//} //end else (have counter-evidence for room)
 				}
 				else //destination not room (hallway)
 				{
 					// 1. room still needing questioning
-					prioritized_options[*opt_iter] =
+					priorities[opt_index] =
 						(unsigned int)
 						_notebook.determineShortestPathForDestinationNeedingQuestion(
 							getLocation(), //current location (probably room)
-							(*opt_iter) ); //next step on path
+							option ); //next step on path
 
-					//prioritized_options[*opt_iter] = 15;
+					//priorities[opt_index] = 15;
 				}
 
-				++opt_iter; //next option
+				++opt_index; //next option
 
 			} //end while (more options to prioritize)
 
 		} //end else (no suspected room)
 
-		//determine greatest priority (lowest value) option(s)
+		//determine greatest priority (lowest value)
 		unsigned int lowest_value( UINT_MAX );
-		std::map<Location*, unsigned int>::iterator pri_iter( prioritized_options.begin() );
-		for(pri_iter  = prioritized_options.begin();
-			pri_iter != prioritized_options.end();
-			++pri_iter)
+		for(opt_index = 0; opt_index < num_options; ++opt_index)
 		{
-			//curr option lower value
-			if( lowest_value > pri_iter->second )
-			{
-				move_options->clear();
+			lowest_value = std::min(lowest_value, priorities[opt_index]);
+		}
 
-				move_options->insert( pri_iter->first );
-			}
-			else if( lowest_value == pri_iter->second )
+		//narrow to option(s) of greatest priority
+		MoveOptionSet all_options( *move_options );
+		move_options->clear();
+
+		for(opt_index = 0; opt_index < num_options; ++opt_index)
+		{
+			if( lowest_value == priorities[opt_index] )
 			{
-				move_options->insert( pri_iter->first );
+				move_options->addOption( all_options.getOption(opt_index) );
 			}
 
-			lowest_value = std::min(lowest_value, pri_iter->second);
-
 		} //end for (each prioritized option)
 	} //end if (more than one move option supplied)
 
-	if( 1 == move_options->size() )
+	if( 1 == move_options->getNumOptions() )
 	{
-		preferred_destination = *(move_options->begin());
+		preferred_destination = move_options->getOption( 0 );
 	}
 
 	return preferred_destination;
 
-} //end routine provideMovePreference()
+} //end routine provideHeuristicMovePreference()
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Constructs a Suggestion.
+/// \brief Constructs a Suggestion by heuristic.
 /// \param None
 /// \return None
 /// \throw
@@ -519,15 +612,11 @@ const
 /// - Room must be current location.
 ////////////////////////////////////////////////////////////////////////////////
 SolutionCardSet
-Player::buildSuggestion()
+Player::buildHeuristicSuggestion()
 const
 {
 	if( ! getLocation()->isRoom() )
 	{
-		std::cout
-			<< "A suggestion must be made from a room.\n"
-			<< getName() << " is currently in the " << getLocation()->getName();
-
 		//exit routine without exception
 		return SolutionCardSet(
 			clueless::UNKNOWN_PERSON,
@@ -543,11 +632,9 @@ const
 		wpn,
 		((const Room*)getLocation())->_type ); //room must be current token location
 
-	std::cout << "  suggestion... " << suggestion.report().str() << "\n";
-
 	return suggestion;
 
-} //end routine buildSuggestion()
+} //end routine buildHeuristicSuggestion()
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -575,28 +662,31 @@ Player::acceptCounterEvidence(
 		//----------------------------------------------------------------------
 		// person
 		//----------------------------------------------------------------------
-		//if card not in hand
-		if( ! isCardInHand( &(suggestion->_person) ) )
+		//if card known and not in hand
+		const Card* person( suggestion->getPersonCard() );
+		if( person && ! isCardInHand(person) )
 		{
-			_notebook.notifyNoCounterEvidenceForCard( &(suggestion->_person) );
+			_notebook.notifyNoCounterEvidenceForCard( person );
 		}
 
 		//----------------------------------------------------------------------
 		// weapon
 		//----------------------------------------------------------------------
-		//if card not in hand
-		if( ! isCardInHand( &(suggestion->_weapon) ) )
+		//if card known and not in hand
+		const Card* weapon( suggestion->getWeaponCard() );
+		if( weapon && ! isCardInHand(weapon) )
 		{
-			_notebook.notifyNoCounterEvidenceForCard( &(suggestion->_weapon) );
+			_notebook.notifyNoCounterEvidenceForCard( weapon );
 		}
 
 		//----------------------------------------------------------------------
 		// room
 		//----------------------------------------------------------------------
-		//if card not in hand
-		if( ! isCardInHand( &(suggestion->_room) ) )
+		//if card known and not in hand
+		const Card* room( suggestion->getRoomCard() );
+		if( room && ! isCardInHand(room) )
 		{
-			_notebook.notifyNoCounterEvidenceForCard( &(suggestion->_room) );
+			_notebook.notifyNoCounterEvidenceForCard( room );
 		}
 
 	} //end else (no counter-evidence)
@@ -613,7 +703,8 @@ Player::acceptCounterEvidence(
 /// \note
 /// - If have counter-evidence, must let opponent know.
 /// - If can refute more than one element of suggestion, still only show one
-///   card to opponent.
+///   card to opponent; strategy chooses which, if player has one (see
+///   setStrategy()).
 ////////////////////////////////////////////////////////////////////////////////
 const Card*
 Player::offerEvidenceCounterToSuggestion(
@@ -623,20 +714,19 @@ Player::offerEvidenceCounterToSuggestion(
 	const Card* counter_evidence( nullptr );
 
 	//find counter-evidence in hand
-	std::set<const Card*> in_hand( findCounterEvidenceInHand(suggestion) );
+	const Card* in_hand[MAX_NUM_COUNTER_EVIDENCE];
+	size_t num_in_hand( findCounterEvidenceInHand(suggestion, in_hand) );
 
 	//if found counter-evidence
-	if( ! in_hand.empty() )
+	if( 0 < num_in_hand )
 	{
 		//decide which card to show opponent
-		counter_evidence = _notebook.decideWhichCardToShowOpponent( &in_hand, suggestor->getCharacter() );
+		counter_evidence = _strategy
+			? _strategy->chooseCounterEvidence( *this, in_hand, num_in_hand, suggestor->getCharacter() )
+			: chooseHeuristicCounterEvidence( in_hand, num_in_hand, suggestor->getCharacter() );
 
 		//make note that showed card to suggestor
 		_notebook.recordHaveShownCardToPlayer(counter_evidence, suggestor->getCharacter());
-
-		std::cout
-			<< "  " << getName() << " showed counter-evidence card \'"
-			<< counter_evidence->getName() << "\' to " << suggestor->getName() << "\n";
 	}
 	//otherwise, found no counter-evidence
 
@@ -645,39 +735,63 @@ Player::offerEvidenceCounterToSuggestion(
 } //end routine offerEvidenceCounterToSuggestion()
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Decides which card to show opponent by heuristic.
+/// \param Card*[]: counter-evidence in hand, in card order
+/// \param size_t: number of pieces of counter-evidence (at least one)
+/// \param PersonType: suggestor's character
+/// \return Card: card to show suggestor
+/// \throw None
+/// \note
+/// - See DetectiveNotebook::decideWhichCardToShowOpponent().
+////////////////////////////////////////////////////////////////////////////////
+const Card*
+Player::chooseHeuristicCounterEvidence(
+	const Card* const cards[], //i - counter-evidence in hand
+	size_t num_cards, //i - number of pieces of counter-evidence
+	clueless::PersonType suggestor) //i - suggestor's character
+const
+{
+	return _notebook.decideWhichCardToShowOpponent( cards, num_cards, suggestor );
+
+} //end routine chooseHeuristicCounterEvidence()
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Searches in hand for counter-evidence to suggestion.
 /// \param SolutionCardSet: suggestion
-/// \return None
+/// \param Card*[]: counter-evidence found, in card order
+/// \return size_t: number of pieces of counter-evidence found
 /// \throw None
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
-std::set<const Card*>
+size_t
 Player::findCounterEvidenceInHand(
-	const SolutionCardSet* suggestion) //i - suggestion
+	const SolutionCardSet* suggestion, //i - suggestion
+	const Card* counter_evidence[MAX_NUM_COUNTER_EVIDENCE]) // o- matching cards in hand
 const
 {
-	std::set<const Card*> counter_evidence;
-	std::set<const Card*>::const_iterator card_iter( _hand.begin() );
+	size_t num_found( 0 );
+	size_t pos_index( 0 );
 
 	//while have not found three pieces of counter-evidence  AND
 	//      more cards in hand
 	while(
-		(3 > counter_evidence.size() ) &&
-		(_hand.end() != card_iter) )
+		(MAX_NUM_COUNTER_EVIDENCE > num_found) &&
+		(_numCardsInHand > pos_index) )
 	{
 		//if current card matches element of suggestion
-		if( suggestion->doesCardMatchAnElement(*card_iter) )
+		if( suggestion->doesCardMatchAnElement(_hand[pos_index]) )
 		{
 			//add to counter-evidence
-			counter_evidence.insert( *card_iter );
+			counter_evidence[num_found++] = _hand[pos_index];
 		}
 
-		++card_iter; //next card in hand
+		++pos_index; //next card in hand
 
 	} //end while (more to look for)
 
-	return counter_evidence;
+	return num_found;
 
 } //end routine findCounterEvidenceInHand()
 
@@ -687,15 +801,17 @@ const
 /// \param None
 /// \return SolutionCardSet: accusation
 /// \throw None
-/// \note  None
+/// \note
+/// - Most likely Case File when accusing before all elements deduced (see
+///   isReadyToMakeAccusation()).
 ////////////////////////////////////////////////////////////////////////////////
 SolutionCardSet
 Player::buildAccusation()
 const
 {
-	if( ! isReadyToMakeAccusation() )
+	if( ! _notebook.hasAllElementsForAccusation() ) //accusing on confidence
 	{
-		std::cout << "  STUB: add details to determine elements to make accusation\n";
+		return( _notebook.getHypotheses().findMostLikely() );
 	}
 
 	//accusation
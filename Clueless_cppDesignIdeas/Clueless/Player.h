@@ -16,26 +16,37 @@
 #ifndef Player_h
 #define Player_h
 
+#include "Card.h"				//for CardOrder use
 #include "DetectiveNotebook.h"
+#include "PlayerStrategy.h"
 
 #include "CluelessEnums.h"
 
-#include <set>			//for std::set use
+#include <memory>		//for std::unique_ptr use
 #include <sstream>		//for std::ostringstream use
 #include <string>		//for std::string use
 
 
 //forward declarations
 struct Card;
+class Game;
 struct PersonCard;
 struct PersonPiece;
 class Location;
+struct LocationOrder;
+class MersenneTwister;
 struct SolutionCardSet;
 struct WeaponCard;
 
 
 class Player
 {
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const size_t MAX_NUM_COUNTER_EVIDENCE = 3; //one per suggestion element
+
 	//--------------------------------------------------------------------------
 	// Constructors / Destructor
 	//--------------------------------------------------------------------------
@@ -50,8 +61,7 @@ public:
 	/// \brief Destructor
 	virtual ~Player()
 	{
-		//clear hand (do not delete Card objects held by CardDeck)
-		_hand.clear();
+		//hand references Card objects held by CardDeck (not deleted)
 	}
 
 
@@ -73,6 +83,8 @@ public:
 	const Location* getLocation() const;
 	std::string getLocationName() const;
 
+	size_t getNumCardsInHand() const;
+	const Card* getCardInHand(size_t position) const;
 	bool isCardInHand(const Card* card) const;
 	//bool isRoomInHand(const Room* room) const;
 
@@ -87,22 +99,32 @@ public:
 	void indicateHasMadeSuggestionDuringTurn();
 
 	bool isReadyToMakeAccusation() const;
+	float getAccusationConfidence() const;
+	void setAccusationConfidence(float confidence);
 	void indicateIsGameWinner();
 	void indicateHasMadeFalseAccusation();
 
 	std::ostringstream report() const;
 	std::ostringstream reportHand() const;
 
+	MersenneTwister* getRandomNumberGenerator() const;
+	void setRandomNumberGenerator(MersenneTwister* randomNumberGenerator);
+	const Game* getAssocGame() const;
+	void setAssocGame(const Game* game);
+
+	PlayerStrategy* getStrategy() const;
+	void setStrategy(PlayerStrategy* strategy);
+
 	//--------------------------------------------------------------------------
 	// Additional Member Functions
 	//--------------------------------------------------------------------------
 	void addCardToHand(const Card* card);
 
 	void prepareForNewTurn();
-	clueless::TurnOptionType makeTurnChoice(std::set<clueless::TurnOptionType>* turnOptions) const;
+	clueless::TurnOptionType makeTurnChoice(TurnOptionSet* turnOptions) const;
 
 	// Move
-	Location* provideMovePreference(std::set<Location*>* moveOptions) const;
+	Location* provideMovePreference(MoveOptionSet* moveOptions) const;
 
 	// Make Suggestion
 	SolutionCardSet buildSuggestion() const;
@@ -115,8 +137,19 @@ public:
 	// Make Accusation
 	SolutionCardSet buildAccusation() const;
 
+	// Heuristics (decisions made without a strategy)
+	clueless::TurnOptionType makeHeuristicTurnChoice(TurnOptionSet* turnOptions) const;
+	Location* provideHeuristicMovePreference(MoveOptionSet* moveOptions) const;
+	SolutionCardSet buildHeuristicSuggestion() const;
+	const Card* chooseHeuristicCounterEvidence(
+		const Card* const cards[],
+		size_t numCards,
+		clueless::PersonType suggestor) const;
+
 protected:
-	std::set<const Card*> findCounterEvidenceInHand(const SolutionCardSet* suggestion) const;
+	size_t findCounterEvidenceInHand(
+		const SolutionCardSet* suggestion,
+		const Card* counterEvidence[MAX_NUM_COUNTER_EVIDENCE]) const;
 
 	//--------------------------------------------------------------------------
 	// Data Members
@@ -127,7 +160,8 @@ protected:
 	clueless::PersonType _character;
 	PersonPiece* _assocGameToken;
 
-	std::set<const Card*> _hand; //holds card owned by CardDeck
+	const Card* _hand[clueless::NUM_CARDS]; //cards owned by CardDeck, in card order
+	size_t _numCardsInHand;
 
 public:
 	DetectiveNotebook _notebook;
@@ -142,6 +176,16 @@ protected:
 	//bool _isReadyToMakeAccusation;
 	bool _hasMadeFalseAccusation;
 
+	/// \note chance of most likely Case File needed to accuse before all three
+	///       elements are deduced; 1 waits for deduction
+	float _accusationConfidence;
+
+	MersenneTwister* _rng; //random draws for current game (not owned)
+	const Game* _assocGame; //game being played (not owned)
+
+	/// \note makes player's decisions; null for player's own heuristics
+	std::unique_ptr<PlayerStrategy> _strategy;
+
 private:
 	bool _isGameCreator;
 	bool _isGameWinner;
@@ -271,16 +315,43 @@ Player::indicateHasMadeSuggestionDuringTurn()
 } //end routine indicateHasMadeSuggestionDuringTurn()
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// \note
+/// - Below full confidence, also ready once most likely Case File is at
+///   least that likely (see CaseFileHypotheses).
 ////////////////////////////////////////////////////////////////////////////////
 inline bool
 Player::isReadyToMakeAccusation()
 const
 {
-	return _notebook.hasAllElementsForAccusation();
+	return(
+		_notebook.hasAllElementsForAccusation() ||
+		((1.0f > _accusationConfidence) &&
+		 (_notebook.getHypotheses().getMaxProbability() >= _accusationConfidence)) );
 
 } //end routine isReadyToMakeAccusation()
 
 
+////////////////////////////////////////////////////////////////////////////////
+inline float
+Player::getAccusationConfidence()
+const
+{
+	return _accusationConfidence;
+
+} //end routine getAccusationConfidence()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline void
+Player::setAccusationConfidence(
+	float confidence) //i - chance needed to accuse early; 1 waits for deduction
+{
+	_accusationConfidence = confidence;
+
+} //end routine setAccusationConfidence()
+
+
 ////////////////////////////////////////////////////////////////////////////////
 inline bool
 Player::isFalseAccuser()
@@ -299,4 +370,87 @@ Player::indicateHasMadeFalseAccusation()
 } //end routine indicateHadMadeFalseAccusation()
 
 
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+Player::getNumCardsInHand()
+const
+{
+	return _numCardsInHand;
+
+} //end routine getNumCardsInHand()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline const Card*
+Player::getCardInHand(
+	size_t position) //i - position in hand, in [0, number of cards in hand)
+const
+{
+	return _hand[position];
+
+} //end routine getCardInHand()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline MersenneTwister*
+Player::getRandomNumberGenerator()
+const
+{
+	return _rng;
+
+} //end routine getRandomNumberGenerator()
+
+
+inline void
+Player::setRandomNumberGenerator(
+	MersenneTwister* rng) //i - random number generator of current game
+{
+	_rng = rng;
+	_notebook.setRandomNumberGenerator( rng );
+
+} //end routine setRandomNumberGenerator()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline const Game*
+Player::getAssocGame()
+const
+{
+	return _assocGame;
+
+} //end routine getAssocGame()
+
+
+inline void
+Player::setAssocGame(
+	const Game* game) //i - game being played
+{
+	_assocGame = game;
+
+} //end routine setAssocGame()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline PlayerStrategy*
+Player::getStrategy()
+const
+{
+	return _strategy.get();
+
+} //end routine getStrategy()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \note
+/// - Player takes ownership; null restores player's own heuristics.
+////////////////////////////////////////////////////////////////////////////////
+inline void
+Player::setStrategy(
+	PlayerStrategy* strategy) //i - strategy making player's decisions
+{
+	_strategy.reset( strategy );
+
+} //end routine setStrategy()
+
+
 #endif //Player_h
@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file PlayerStrategy.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  2100
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayerStrategy.h"
+
+#include "Location.h"
+#include "MoveOptionSet.h"
+#include "Player.h"
+#include "SolutionCardSet.h"
+#include "TurnOptionSet.h"
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Default constructor
+/// \param None
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+PlayerStrategy::PlayerStrategy()
+	: _name( "heuristic" )
+{
+} //end routine default constructor
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param string: name reported by tournaments
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+PlayerStrategy::PlayerStrategy(
+	std::string name) //i - name reported by tournaments
+	: _name( name )
+{
+} //end routine extended constructor
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Makes fresh strategy of same kind and settings for another player.
+/// \param None
+/// \return PlayerStrategy: new strategy (caller owns)
+/// \throw None
+/// \note
+/// - Nothing remembered from decisions already made is carried over.
+////////////////////////////////////////////////////////////////////////////////
+PlayerStrategy*
+PlayerStrategy::clone()
+const
+{
+	return new PlayerStrategy( _name );
+
+} //end routine clone()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Makes selection amongst options for current turn.
+/// \param Player: player taking turn
+/// \param TurnOptionSet: valid options for current turn
+/// \return TurnOptionType: chosen option
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+clueless::TurnOptionType
+PlayerStrategy::makeTurnChoice(
+	const Player& player, //i - player taking turn
+	TurnOptionSet* options) //i - valid options for turn
+{
+	return player.makeHeuristicTurnChoice( options );
+
+} //end routine makeTurnChoice()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Offers preference between multiple move options.
+/// \param Player: player moving
+/// \param MoveOptionSet: move options; may be narrowed to equally preferred
+/// \return Location: preferred move destination; null if no preference
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+Location*
+PlayerStrategy::provideMovePreference(
+	const Player& player, //i - player moving
+	MoveOptionSet* move_options) //io- move options
+{
+	return player.provideHeuristicMovePreference( move_options );
+
+} //end routine provideMovePreference()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Constructs a Suggestion.
+/// \param Player: player suggesting
+/// \return SolutionCardSet: suggestion in player's current room
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+SolutionCardSet
+PlayerStrategy::buildSuggestion(
+	const Player& player) //i - player suggesting
+{
+	return player.buildHeuristicSuggestion();
+
+} //end routine buildSuggestion()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Decides which card to show opponent.
+/// \param Player: player refuting suggestion
+/// \param Card*[]: counter-evidence in player's hand, in card order
+/// \param size_t: number of pieces of counter-evidence (at least one)
+/// \param PersonType: suggestor's character
+/// \return Card: card to show suggestor
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+const Card*
+PlayerStrategy::chooseCounterEvidence(
+	const Player& player, //i - player refuting suggestion
+	const Card* const cards[], //i - counter-evidence in hand
+	size_t num_cards, //i - number of pieces of counter-evidence
+	clueless::PersonType suggestor) //i - suggestor's character
+{
+	return player.chooseHeuristicCounterEvidence( cards, num_cards, suggestor );
+
+} //end routine chooseCounterEvidence()
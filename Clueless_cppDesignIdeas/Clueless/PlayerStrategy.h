@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file PlayerStrategy.h
+/// \brief Decisions a player makes during play: turn option, move
+///        destination, suggestion, and which counter-evidence to show.
+///
+/// \date   17 Oct 2026  2100
+///
+/// \note
+/// - Plugged into a Player (see Player::setStrategy()), which owns it and
+///   consults it for every decision; a player without one uses its built-in
+///   heuristics.
+/// - This class is the heuristic strategy: each decision defers to the
+///   player's heuristic (see Player::makeHeuristicTurnChoice() etc.).
+///   Derived strategies override only the decisions they make differently.
+/// - One instance per player per game, so a strategy may remember things
+///   between decisions; clone() makes a fresh one for another player (see
+///   GameSimulator::setSeatStrategy()).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PlayerStrategy_h
+#define PlayerStrategy_h
+
+#include "CluelessEnums.h"	//for PersonType, TurnOptionType use
+
+#include <stddef.h>		//for size_t use
+#include <string>		//for std::string use
+
+
+//forward declarations
+struct Card;
+class Location;
+class MoveOptionSet;
+class Player;
+struct SolutionCardSet;
+class TurnOptionSet;
+
+
+class PlayerStrategy
+{
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+public:
+	/// \brief Default constructor
+	PlayerStrategy();
+
+protected:
+	PlayerStrategy(std::string name);
+
+public:
+	virtual ~PlayerStrategy()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	std::string getName() const;
+	void setName(std::string name);
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	virtual PlayerStrategy* clone() const;
+
+	virtual clueless::TurnOptionType makeTurnChoice(
+		const Player& player,
+		TurnOptionSet* turnOptions);
+
+	virtual Location* provideMovePreference(
+		const Player& player,
+		MoveOptionSet* moveOptions);
+
+	virtual SolutionCardSet buildSuggestion(const Player& player);
+
+	virtual const Card* chooseCounterEvidence(
+		const Player& player,
+		const Card* const cards[],
+		size_t numCards,
+		clueless::PersonType suggestor);
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	std::string _name; //as reported by tournaments
+
+}; //end class PlayerStrategy defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline std::string
+PlayerStrategy::getName()
+const
+{
+	return _name;
+
+} //end routine getName()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline void
+PlayerStrategy::setName(
+	std::string name) //i - name reported by tournaments
+{
+	_name = name;
+
+} //end routine setName()
+
+
+#endif //PlayerStrategy_h defn
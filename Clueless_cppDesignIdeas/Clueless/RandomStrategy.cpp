@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file RandomStrategy.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  2110
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "RandomStrategy.h"
+
+#include "Location.h"
+#include "mersenneTwister.h"
+#include "Player.h"
+#include "Room.h"
+#include "SolutionCardSet.h"
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Default constructor
+/// \param None
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+RandomStrategy::RandomStrategy()
+	: PlayerStrategy( "random" )
+{
+} //end routine default constructor
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Makes fresh strategy for another player.
+/// \param None
+/// \return PlayerStrategy: new strategy (caller owns)
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+PlayerStrategy*
+RandomStrategy::clone()
+const
+{
+	RandomStrategy* strategy( new RandomStrategy() );
+	strategy->setName( _name );
+
+	return strategy;
+
+} //end routine clone()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Offers no preference between move options.
+/// \param Player: player moving
+/// \param MoveOptionSet: move options
+/// \return Location: null, so game chooses uniformly amongst options
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+Location*
+RandomStrategy::provideMovePreference(
+	const Player&, //i - player moving
+	MoveOptionSet*) //io- move options
+{
+	return nullptr;
+
+} //end routine provideMovePreference()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Constructs a Suggestion of uniformly drawn person and weapon.
+/// \param Player: player suggesting
+/// \return SolutionCardSet: suggestion in player's current room
+/// \throw None
+/// \note
+/// - Cards in player's own hand may be suggested.
+////////////////////////////////////////////////////////////////////////////////
+SolutionCardSet
+RandomStrategy::buildSuggestion(
+	const Player& player) //i - player suggesting
+{
+	if( ! player.getLocation()->isRoom() )
+	{
+		return player.buildHeuristicSuggestion(); //game will not accept
+	}
+
+	MersenneTwister* rng( player.getRandomNumberGenerator() );
+
+	return SolutionCardSet(
+		clueless::PersonType( 1 + rng->drawUniformInt(clueless::getNumPersonTypes()) ),
+		clueless::WeaponType( 1 + rng->drawUniformInt(clueless::getNumWeaponTypes()) ),
+		((const Room*)player.getLocation())->_type );
+
+} //end routine buildSuggestion()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Chooses uniformly which card to show opponent.
+/// \param Player: player refuting suggestion
+/// \param Card*[]: counter-evidence in player's hand, in card order
+/// \param size_t: number of pieces of counter-evidence (at least one)
+/// \param PersonType: suggestor's character
+/// \return Card: card to show suggestor
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+const Card*
+RandomStrategy::chooseCounterEvidence(
+	const Player& player, //i - player refuting suggestion
+	const Card* const cards[], //i - counter-evidence in hand
+	size_t num_cards, //i - number of pieces of counter-evidence
+	clueless::PersonType) //i - suggestor's character
+{
+	return cards[player.getRandomNumberGenerator()->drawUniformInt(num_cards)];
+
+} //end routine chooseCounterEvidence()
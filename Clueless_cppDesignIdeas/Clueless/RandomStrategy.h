@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file RandomStrategy.h
+/// \brief Strategy choosing uniformly amongst legal moves, suggestions, and
+///        counter-evidence.
+///
+/// \date   17 Oct 2026  2110
+///
+/// \note
+/// - Baseline for ratings: notebook is still kept, and player still accuses
+///   once ready (as Player does), but nothing it knows guides its play.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef RandomStrategy_h
+#define RandomStrategy_h
+
+#include "PlayerStrategy.h"
+
+
+class RandomStrategy
+	: public PlayerStrategy
+{
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+public:
+	/// \brief Default constructor
+	RandomStrategy();
+
+	virtual ~RandomStrategy()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	virtual PlayerStrategy* clone() const;
+
+	virtual Location* provideMovePreference(
+		const Player& player,
+		MoveOptionSet* moveOptions);
+
+	virtual SolutionCardSet buildSuggestion(const Player& player);
+
+	virtual const Card* chooseCounterEvidence(
+		const Player& player,
+		const Card* const cards[],
+		size_t numCards,
+		clueless::PersonType suggestor);
+
+}; //end class RandomStrategy defn
+
+
+#endif //RandomStrategy_h defn
@@ -0,0 +1,405 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file ReplayGame.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  2245
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ReplayGame.h"
+
+#include "BoardLayout.h"	//for determineRoomId use
+
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::logic_error use
+
+//------------------------------------------------------------------------------
+// Local Helpers
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Checks recorded value lies in [minValue, maxValue].
+/// \param char*: routine checking value
+/// \param char*: what value is
+/// \param unsigned long: value
+/// \param unsigned long: smallest allowed value
+/// \param unsigned long: largest allowed value
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when value out of range.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static void
+requireInRange(
+	const char* routine, //i - routine checking value
+	const char* description, //i - what value is
+	unsigned long value, //i - value
+	unsigned long min_value, //i - smallest allowed value
+	unsigned long max_value) //i - largest allowed value
+{
+	if( (min_value > value) || (max_value < value) )
+	{
+		std::ostringstream msg;
+		msg << routine << "\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  " << description << " out of range: " << value;
+		throw std::logic_error( msg.str() );
+	}
+
+} //end routine requireInRange()
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Copies game's record, decodes set up, and counts turns.
+/// \param unsigned char[]: record (see ReplayLogSink::getRecords())
+/// \param size_t: number of bytes in record
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when record malformed.
+/// \note
+/// - Next event read is first after set up.
+/// - Record may be in memory not owned by game (e.g. a mapped log).
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayGame::load(
+	const unsigned char* record, //i - game's record
+	size_t num_record_bytes) //i - number of bytes in record
+{
+	_record.assign( record, record + num_record_bytes );
+	_keyframePositions.clear();
+	_setUp._numPlayers = 0;
+	_numTurns = 0;
+
+	const unsigned char* bytes( _record.data() );
+	const size_t num_bytes( _record.size() );
+	size_t position( 0 );
+
+	_gameIndex = (unsigned long)ReplayLogSink::readVarint( bytes, num_bytes, &position );
+	_seed = (unsigned long)ReplayLogSink::readVarint( bytes, num_bytes, &position );
+
+	const unsigned long long num_keyframes( ReplayLogSink::readVarint(bytes, num_bytes, &position) );
+	requireInRange( "ReplayGame::load()", "number of keyframes",
+		(unsigned long)num_keyframes, 0, (unsigned long)num_bytes );
+
+	size_t keyframe_position( 0 ); //from start of events
+	for(size_t kf_index(0); kf_index < num_keyframes; ++kf_index)
+	{
+		keyframe_position += (size_t)ReplayLogSink::readVarint( bytes, num_bytes, &position );
+		_keyframePositions.push_back( keyframe_position );
+	}
+
+	_eventsStart = position;
+	for(size_t kf_index(0); kf_index < _keyframePositions.size(); ++kf_index)
+	{
+		_keyframePositions[kf_index] += _eventsStart;
+
+		if( (num_bytes <= _keyframePositions[kf_index]) ||
+			(ReplayLogSink::KEYFRAME != bytes[_keyframePositions[kf_index]]) )
+		{
+			std::ostringstream msg;
+			msg << "ReplayGame::load()\n"
+				<< "  INCONSISTENT_DATA\n"
+				<< "  keyframe " << kf_index << " not found in game "
+				<< _gameIndex;
+			throw std::logic_error( msg.str() );
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	// set up
+	//--------------------------------------------------------------------------
+	Event event;
+	if( ! decodeEvent(&position, &event) ||
+		(ReplayLogSink::GAME_SET_UP != event._type) )
+	{
+		std::ostringstream msg;
+		msg << "ReplayGame::load()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  game " << _gameIndex << " does not start with set up";
+		throw std::logic_error( msg.str() );
+	}
+
+	_setUp._casePerson = clueless::PersonType( event._values[0] );
+	_setUp._caseWeapon = clueless::WeaponType( event._values[1] );
+	_setUp._caseRoom = clueless::RoomType( event._values[2] );
+	_setUp._numPlayers = event._values[3];
+
+	size_t value_index( 4 );
+	for(size_t seat(0); seat < _setUp._numPlayers; ++seat)
+	{
+		_setUp._characters[seat] = clueless::PersonType( event._values[value_index++] );
+		_setUp._startLocations[seat] = (unsigned char)event._values[value_index++];
+		_setUp._numCardsInHand[seat] = event._values[value_index++];
+
+		for(size_t pos_index(0); pos_index < _setUp._numCardsInHand[seat]; ++pos_index)
+		{
+			requireInRange( "ReplayGame::load()", "card index",
+				event._values[value_index], 0, clueless::NUM_CARDS - 1 );
+
+			_setUp._hands[seat][pos_index] = (unsigned char)event._values[value_index++];
+		}
+
+	} //end for (each player)
+
+	//--------------------------------------------------------------------------
+	// count turns from last keyframe
+	//--------------------------------------------------------------------------
+	if( ! _keyframePositions.empty() )
+	{
+		ReplayLogSink::Keyframe state;
+		seekTurn( (unsigned long)-1, &state );
+		_numTurns = state._turn;
+	}
+
+	_position = position; //just after set up
+
+} //end routine load()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Rebuilds board state at start of turn; next event read is that
+///  turn's start.
+/// \param unsigned long: player turn, counted from zero; getNumTurns() (or
+///  greater) for end of game
+/// \param Keyframe: board state at start of turn
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when game has no turns or record malformed.
+/// \note
+/// - Decodes from the last keyframe at or before turn only.
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayGame::seekTurn(
+	unsigned long turn, //i - player turn, counted from zero
+	ReplayLogSink::Keyframe* state) // o- board state at start of turn
+{
+	if( _keyframePositions.empty() )
+	{
+		std::ostringstream msg;
+		msg << "ReplayGame::seekTurn()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  game " << _gameIndex << " has no turns";
+		throw std::logic_error( msg.str() );
+	}
+
+	size_t kf_index( turn / ReplayLogSink::KEYFRAME_INTERVAL );
+	if( _keyframePositions.size() <= kf_index )
+	{
+		kf_index = _keyframePositions.size() - 1;
+	}
+
+	_position = _keyframePositions[kf_index];
+
+	Event event;
+	size_t event_position( _position );
+	while( decodeEvent(&event_position, &event) )
+	{
+		if( (ReplayLogSink::TURN_STARTED == event._type) &&
+			(turn == state->_turn) )
+		{
+			break; //leave turn's start to be read next
+		}
+
+		applyEvent( event, state );
+		_position = event_position;
+
+	} //end while (more events)
+
+} //end routine seekTurn()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Reads next event.
+/// \param Event: event read
+/// \return bool: whether event read; false at end of game
+/// \throw
+/// - INCONSISTENT_DATA when record malformed.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+bool
+ReplayGame::readEvent(
+	Event* event) // o- event read
+{
+	return decodeEvent( &_position, event );
+
+} //end routine readEvent()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Brings board state up to date with event.
+/// \param Event: event
+/// \param Keyframe: board state before and after event
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when event names unknown character, token, room, or
+///   location.
+/// \note
+/// - Set up leaves state alone; state is first filled by a keyframe.
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayGame::applyEvent(
+	const Event& event, //i - event
+	ReplayLogSink::Keyframe* state) //io- board state
+{
+	static const char* const ROUTINE = "ReplayGame::applyEvent()";
+
+	switch( event._type )
+	{
+	case ReplayLogSink::KEYFRAME:
+		{
+			size_t value_index( 0 );
+			state->_turn = event._values[value_index++];
+
+			for(size_t person_index(0); person_index < ReplayLogSink::NUM_PERSONS; ++person_index)
+			{
+				requireInRange( ROUTINE, "location", event._values[value_index],
+					0, BoardLayout::MAX_NUM_LOCATIONS - 1 );
+				state->_personLocations[person_index] = (unsigned char)event._values[value_index++];
+			}
+
+			for(size_t wpn_index(0); wpn_index < ReplayLogSink::NUM_WEAPONS; ++wpn_index)
+			{
+				requireInRange( ROUTINE, "location", event._values[value_index],
+					0, BoardLayout::MAX_NUM_LOCATIONS - 1 );
+				state->_weaponLocations[wpn_index] = (unsigned char)event._values[value_index++];
+			}
+
+			state->_falseAccusers = (unsigned int)event._values[value_index];
+			state->_winner = clueless::UNKNOWN_PERSON; //keyframes precede play
+		}
+		break;
+
+	case ReplayLogSink::TURN_STARTED:
+		++state->_turn;
+		break;
+
+	case ReplayLogSink::PLAYER_MOVED:
+		requireInRange( ROUTINE, "character", event._values[0], 1, clueless::PROFESSOR_PLUM );
+		requireInRange( ROUTINE, "location", event._values[1],
+			0, BoardLayout::MAX_NUM_LOCATIONS - 1 );
+		state->_personLocations[event._values[0] - 1] = (unsigned char)event._values[1];
+		break;
+
+	case ReplayLogSink::PERSON_TOKEN_MOVED:
+		requireInRange( ROUTINE, "person", event._values[0], 1, clueless::PROFESSOR_PLUM );
+		requireInRange( ROUTINE, "room", event._values[1], 1, clueless::KITCHEN );
+		state->_personLocations[event._values[0] - 1] =
+			(unsigned char)BoardLayout::determineRoomId( clueless::RoomType(event._values[1]) );
+		break;
+
+	case ReplayLogSink::WEAPON_TOKEN_MOVED:
+		requireInRange( ROUTINE, "weapon", event._values[0], 1, clueless::WRENCH );
+		requireInRange( ROUTINE, "room", event._values[1], 1, clueless::KITCHEN );
+		state->_weaponLocations[event._values[0] - 1] =
+			(unsigned char)BoardLayout::determineRoomId( clueless::RoomType(event._values[1]) );
+		break;
+
+	case ReplayLogSink::GAME_WON:
+		requireInRange( ROUTINE, "character", event._values[0], 1, clueless::PROFESSOR_PLUM );
+		state->_winner = clueless::PersonType( event._values[0] );
+		break;
+
+	case ReplayLogSink::FALSE_ACCUSATION_MADE:
+		requireInRange( ROUTINE, "character", event._values[0], 1, clueless::PROFESSOR_PLUM );
+		state->_falseAccusers |= (1u << event._values[0]);
+		break;
+
+	default:
+		break; //board state unchanged
+
+	} //end switch (event type)
+
+} //end routine applyEvent()
+
+
+//------------------------------------------------------------------------------
+// Record Decoding
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Decodes event at position.
+/// \param size_t: position within record; moved past event
+/// \param Event: event decoded
+/// \return bool: whether event decoded; false at end of record
+/// \throw
+/// - INCONSISTENT_DATA when event type unknown, set up too large, or event
+///   truncated.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+bool
+ReplayGame::decodeEvent(
+	size_t* position, //io- position within record
+	Event* event) // o- event decoded
+const
+{
+	const unsigned char* bytes( _record.data() );
+	const size_t num_bytes( _record.size() );
+
+	if( num_bytes <= *position )
+	{
+		return false; //end of game
+	}
+
+	const unsigned long long type( ReplayLogSink::readVarint(bytes, num_bytes, position) );
+	requireInRange( "ReplayGame::decodeEvent()", "event type",
+		(unsigned long)type, ReplayLogSink::GAME_SET_UP, ReplayLogSink::NUM_EVENT_TYPES - 1 );
+
+	event->_type = ReplayLogSink::EventType( type );
+
+	if( ReplayLogSink::GAME_SET_UP != event->_type )
+	{
+		event->_numValues = ReplayLogSink::getNumValues( event->_type );
+		for(size_t value_index(0); value_index < event->_numValues; ++value_index)
+		{
+			event->_values[value_index] =
+				(unsigned long)ReplayLogSink::readVarint( bytes, num_bytes, position );
+		}
+
+		return true;
+	}
+
+	//set up: Case File, number of players, then each player's hand
+	event->_numValues = 0;
+	for(size_t value_index(0); value_index < 4; ++value_index)
+	{
+		event->_values[event->_numValues++] =
+			(unsigned long)ReplayLogSink::readVarint( bytes, num_bytes, position );
+	}
+
+	const unsigned long num_players( event->_values[3] );
+	requireInRange( "ReplayGame::decodeEvent()", "number of players",
+		num_players, 1, GameOutcome::MAX_NUM_SEATS );
+
+	size_t num_cards_dealt( 0 );
+	for(size_t seat(0); seat < num_players; ++seat)
+	{
+		for(size_t value_index(0); value_index < 3; ++value_index)
+		{
+			event->_values[event->_numValues++] =
+				(unsigned long)ReplayLogSink::readVarint( bytes, num_bytes, position );
+		}
+
+		const unsigned long num_cards( event->_values[event->_numValues - 1] );
+		num_cards_dealt += num_cards;
+		requireInRange( "ReplayGame::decodeEvent()", "number of cards dealt",
+			(unsigned long)num_cards_dealt, 0, clueless::NUM_CARDS );
+
+		for(size_t pos_index(0); pos_index < num_cards; ++pos_index)
+		{
+			event->_values[event->_numValues++] =
+				(unsigned long)ReplayLogSink::readVarint( bytes, num_bytes, position );
+		}
+
+	} //end for (each player)
+
+	return true;
+
+} //end routine decodeEvent()
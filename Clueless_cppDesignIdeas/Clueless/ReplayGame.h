@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file ReplayGame.h
+/// \brief Decodes one game's replay record and seeks to any turn.
+///
+/// \date   17 Oct 2026  2240
+///
+/// \note
+/// - Record format is described in ReplayLogSink.
+/// - Seeking starts from the last keyframe at or before the turn, so at most
+///   KEYFRAME_INTERVAL turns of events are decoded whatever the game length.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ReplayGame_h
+#define ReplayGame_h
+
+#include "GameOutcome.h"	//for MAX_NUM_SEATS use
+#include "ReplayLogSink.h"
+
+#include "CluelessEnums.h"	//for PersonType, WeaponType, RoomType use
+
+#include <stddef.h>		//for size_t use
+#include <vector>		//for std::vector use
+
+
+class ReplayGame
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	/// \note GAME_SET_UP: Case File, number of players, and per player
+	///       character, location, and hand size, plus every dealt card
+	static const size_t MAX_NUM_VALUES = 4 + 3*GameOutcome::MAX_NUM_SEATS + clueless::NUM_CARDS;
+
+	//--------------------------------------------------------------------------
+	// Class-Scoped Types
+	//--------------------------------------------------------------------------
+public:
+	/// \brief One decoded event.
+	struct Event
+	{
+		ReplayLogSink::EventType _type;
+		size_t _numValues;
+		unsigned long _values[MAX_NUM_VALUES]; //as listed in ReplayLogSink
+
+	}; //end struct Event defn
+
+	/// \brief Case File and each player's starting position and hand.
+	struct SetUp
+	{
+		clueless::PersonType _casePerson;
+		clueless::WeaponType _caseWeapon;
+		clueless::RoomType _caseRoom;
+
+		size_t _numPlayers;
+		clueless::PersonType _characters[GameOutcome::MAX_NUM_SEATS]; //in turn order
+		unsigned char _startLocations[GameOutcome::MAX_NUM_SEATS]; //location id
+
+		size_t _numCardsInHand[GameOutcome::MAX_NUM_SEATS];
+		unsigned char _hands[GameOutcome::MAX_NUM_SEATS][clueless::NUM_CARDS]; //card indices
+
+	}; //end struct SetUp defn
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+public:
+	/// \brief Default constructor
+	ReplayGame()
+		: _gameIndex( 0 )
+		, _seed( 0 )
+		, _eventsStart( 0 )
+		, _position( 0 )
+		, _numTurns( 0 )
+	{
+		_setUp._numPlayers = 0;
+	}
+
+	virtual ~ReplayGame()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	unsigned long getGameIndex() const;
+	unsigned long getSeed() const;
+	size_t getNumKeyframes() const;
+	unsigned long getNumTurns() const;
+	const SetUp& getSetUp() const;
+	const std::vector<unsigned char>& getRecord() const;
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	void load(const unsigned char* record, size_t numBytes);
+	void load(const std::vector<unsigned char>& record);
+
+	void seekTurn(unsigned long turn, ReplayLogSink::Keyframe* state);
+	bool readEvent(Event* event);
+
+	static void applyEvent(const Event& event, ReplayLogSink::Keyframe* state);
+
+protected:
+	bool decodeEvent(size_t* position, Event* event) const;
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	std::vector<unsigned char> _record;
+
+	unsigned long _gameIndex;
+	unsigned long _seed;
+
+	size_t _eventsStart;                     //within record
+	std::vector<size_t> _keyframePositions;  //within record
+	size_t _position;                        //of next event read
+
+	SetUp _setUp;
+	unsigned long _numTurns; //player turns started
+
+}; //end class ReplayGame defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline void
+ReplayGame::load(
+	const std::vector<unsigned char>& record) //i - game's record
+{
+	load( record.data(), record.size() );
+
+} //end routine load()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned long
+ReplayGame::getGameIndex()
+const
+{
+	return _gameIndex;
+
+} //end routine getGameIndex()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned long
+ReplayGame::getSeed()
+const
+{
+	return _seed;
+
+} //end routine getSeed()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+ReplayGame::getNumKeyframes()
+const
+{
+	return _keyframePositions.size();
+
+} //end routine getNumKeyframes()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned long
+ReplayGame::getNumTurns()
+const
+{
+	return _numTurns;
+
+} //end routine getNumTurns()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline const ReplayGame::SetUp&
+ReplayGame::getSetUp()
+const
+{
+	return _setUp;
+
+} //end routine getSetUp()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline const std::vector<unsigned char>&
+ReplayGame::getRecord()
+const
+{
+	return _record;
+
+} //end routine getRecord()
+
+
+#endif //ReplayGame_h defn
@@ -0,0 +1,564 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file ReplayLogFile.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  2255
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ReplayLogFile.h"
+
+#include "LzCodec.h"
+#include "ReplayGame.h"
+#include "ReplayLogSink.h"
+
+#include <cstring>			//for std::memcmp, std::memcpy use
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::logic_error use
+
+//------------------------------------------------------------------------------
+// Local Helpers
+//------------------------------------------------------------------------------
+static const char MAGIC[4] = { 'C', 'L', 'R', 'L' };
+
+static const size_t TRAILER_SIZE = 20; //index position, number of games, magic
+
+//index entry fields (see ReplayLogFile.h)
+static const size_t PAYLOAD_POSITION_FIELD = 0;
+static const size_t PAYLOAD_LENGTH_FIELD   = 8;
+static const size_t RECORD_LENGTH_FIELD    = 12;
+static const size_t PLAYER_TURNS_FIELD     = 16;
+static const size_t ROUNDS_FIELD           = 18;
+static const size_t WINNER_FIELD           = 20;
+static const size_t FALSE_ACCUSERS_FIELD   = 21;
+static const size_t NUM_PLAYERS_FIELD      = 22;
+static const size_t TURN_LIMIT_FIELD       = 23;
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Lists header values in file order.
+/// \param ReplayLogHeader: header
+/// \param unsigned long*[]: address of each value
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static void
+listHeaderValues(
+	ReplayLogHeader* header, //i - header
+	unsigned long* values[ReplayLogHeader::NUM_VALUES]) // o- address of each value
+{
+	size_t value_index( 0 );
+	values[value_index++] = &header->_numPlayers;
+	values[value_index++] = &header->_maxNumTurns;
+	values[value_index++] = &header->_batchSeed;
+	values[value_index++] = &header->_searchSeats;
+	values[value_index++] = &header->_searchIterations;
+	values[value_index++] = &header->_searchMilliseconds;
+	values[value_index++] = &header->_searchThreads;
+	values[value_index++] = &header->_searchMode;
+	values[value_index++] = &header->_accusationPercent;
+	values[value_index++] = &header->_isCustomLayout;
+	values[value_index++] = &header->_isSimulated;
+
+} //end routine listHeaderValues()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Stores value as little-endian bytes.
+////////////////////////////////////////////////////////////////////////////////
+static void
+storeFixed(
+	unsigned long long value, //i - value
+	size_t num_bytes, //i - width
+	unsigned char* bytes) // o- value's bytes
+{
+	for(size_t byte_index(0); byte_index < num_bytes; ++byte_index)
+	{
+		bytes[byte_index] = (unsigned char)(value >> (8 * byte_index));
+	}
+
+} //end routine storeFixed()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Reads little-endian value.
+////////////////////////////////////////////////////////////////////////////////
+static unsigned long long
+readFixed(
+	const unsigned char* bytes, //i - value's bytes
+	size_t num_bytes) //i - width
+{
+	unsigned long long value( 0 );
+	for(size_t byte_index(0); byte_index < num_bytes; ++byte_index)
+	{
+		value |= (unsigned long long)bytes[byte_index] << (8 * byte_index);
+	}
+
+	return value;
+
+} //end routine readFixed()
+
+
+//------------------------------------------------------------------------------
+// ReplayLogWriter
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param char*: path of log file; replaced if present
+/// \param ReplayLogHeader: how games are played
+/// \return None
+/// \throw
+/// - INSUFFICIENT_DATA when file cannot be created.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+ReplayLogWriter::ReplayLogWriter(
+	const char* path, //i - path of log file
+	const ReplayLogHeader& header) //i - how games are played
+	: _file( path, std::ios::binary | std::ios::trunc )
+	, _numGames( 0 )
+	, _position( 0 )
+{
+	if( ! _file )
+	{
+		std::ostringstream msg;
+		msg << "ReplayLogWriter::ReplayLogWriter()\n"
+			<< "  INSUFFICIENT_DATA\n"
+			<< "  cannot create replay log " << path;
+		throw std::logic_error( msg.str() );
+	}
+
+	std::vector<unsigned char> bytes( MAGIC, MAGIC + sizeof(MAGIC) );
+	bytes.push_back( (unsigned char)VERSION );
+
+	ReplayLogHeader values_header( header );
+	unsigned long* values[ReplayLogHeader::NUM_VALUES];
+	listHeaderValues( &values_header, values );
+
+	ReplayLogSink::appendVarint( ReplayLogHeader::NUM_VALUES, &bytes );
+	for(size_t value_index(0); value_index < ReplayLogHeader::NUM_VALUES; ++value_index)
+	{
+		ReplayLogSink::appendVarint( *values[value_index], &bytes );
+	}
+
+	_file.write( (const char*)bytes.data(), bytes.size() );
+	_position = bytes.size();
+
+} //end routine constructor
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Destructor
+/// \note
+/// - Closes log if not already closed; errors are lost (call close() to see
+///   them).
+////////////////////////////////////////////////////////////////////////////////
+ReplayLogWriter::~ReplayLogWriter()
+{
+	try
+	{
+		close();
+	}
+	catch(...)
+	{
+	}
+
+} //end routine destructor
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Appends game finished by sink (see ReplayLogSink::endGame()), with
+///  its outcome for the index.
+/// \param ReplayLogSink: sink holding finished game
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when log closed or game index already recorded.
+/// \note
+/// - Safe to call from many threads; games may arrive in any order.
+/// - Record is compressed before the file is locked.
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogWriter::appendGame(
+	const ReplayLogSink& game) //i - sink holding finished game
+{
+	const std::vector<unsigned char>& record( game.getRecords() );
+	const unsigned long game_index( game.getGameIndex() );
+
+	std::vector<unsigned char> compressed;
+	LzCodec::compress( record.data(), record.size(), &compressed );
+
+	const std::vector<unsigned char>& payload(
+		(compressed.size() < record.size()) ? compressed : record );
+
+	//--------------------------------------------------------------------------
+	// outcome
+	//--------------------------------------------------------------------------
+	const ReplayLogSink::Keyframe& outcome( game.getState() );
+	const size_t num_players( game.getNumPlayers() );
+
+	size_t num_false_accusers( 0 );
+	for(unsigned int accusers(outcome._falseAccusers); 0 != accusers; accusers &= (accusers - 1))
+	{
+		++num_false_accusers;
+	}
+
+	const unsigned long num_player_turns( (0xFFFF < outcome._turn) ? 0xFFFF : outcome._turn );
+	const unsigned long num_rounds( (0 < num_players)
+		? (num_player_turns + num_players - 1) / num_players
+		: 0 );
+
+	unsigned char entry[INDEX_ENTRY_SIZE];
+	storeFixed( payload.size(), 4, entry + PAYLOAD_LENGTH_FIELD );
+	storeFixed( record.size(), 4, entry + RECORD_LENGTH_FIELD );
+	storeFixed( num_player_turns, 2, entry + PLAYER_TURNS_FIELD );
+	storeFixed( num_rounds, 2, entry + ROUNDS_FIELD );
+	entry[WINNER_FIELD] = (unsigned char)outcome._winner;
+	entry[FALSE_ACCUSERS_FIELD] = (unsigned char)outcome._falseAccusers;
+	entry[NUM_PLAYERS_FIELD] = (unsigned char)num_players;
+	entry[TURN_LIMIT_FIELD] = ((clueless::UNKNOWN_PERSON == outcome._winner) &&
+		(num_false_accusers < num_players)) ? 1 : 0;
+
+	//--------------------------------------------------------------------------
+	// append
+	//--------------------------------------------------------------------------
+	std::lock_guard<std::mutex> lock( _fileMutex );
+
+	if( ! _file.is_open() ||
+		((game_index < _numGames) &&
+		 (0 != readFixed(&_index[INDEX_ENTRY_SIZE * game_index + PAYLOAD_LENGTH_FIELD], 4))) )
+	{
+		std::ostringstream msg;
+		msg << "ReplayLogWriter::appendGame()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  log closed or game " << game_index << " already recorded";
+		throw std::logic_error( msg.str() );
+	}
+
+	if( game_index >= _numGames )
+	{
+		_numGames = game_index + 1;
+		_index.resize( INDEX_ENTRY_SIZE * _numGames, 0 );
+	}
+
+	storeFixed( _position, 8, entry + PAYLOAD_POSITION_FIELD );
+	std::memcpy( &_index[INDEX_ENTRY_SIZE * game_index], entry, INDEX_ENTRY_SIZE );
+
+	_file.write( (const char*)payload.data(), payload.size() );
+	_position += payload.size();
+
+} //end routine appendGame()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Writes index and trailer, and closes file.
+/// \param None
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when file could not be written.
+/// \note
+/// - Does nothing once closed.
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogWriter::close()
+{
+	std::lock_guard<std::mutex> lock( _fileMutex );
+
+	if( ! _file.is_open() )
+	{
+		return;
+	}
+
+	unsigned char trailer[TRAILER_SIZE];
+	storeFixed( _position, 8, trailer );
+	storeFixed( _numGames, 8, trailer + 8 );
+	std::memcpy( trailer + 16, MAGIC, sizeof(MAGIC) );
+
+	_file.write( (const char*)_index.data(), _index.size() );
+	_file.write( (const char*)trailer, TRAILER_SIZE );
+	_file.close();
+
+	if( ! _file )
+	{
+		std::ostringstream msg;
+		msg << "ReplayLogWriter::close()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  failed writing replay log";
+		throw std::logic_error( msg.str() );
+	}
+
+} //end routine close()
+
+
+//------------------------------------------------------------------------------
+// ReplayLogReader
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param char*: path of log file
+/// \return None
+/// \throw
+/// - INSUFFICIENT_DATA when file cannot be opened.
+/// - INCONSISTENT_DATA when file not a finished replay log of this version.
+/// \note
+/// - Maps file; reads header and trailer only.
+////////////////////////////////////////////////////////////////////////////////
+ReplayLogReader::ReplayLogReader(
+	const char* path) //i - path of log file
+	: _file( path )
+	, _index( nullptr )
+	, _numGames( 0 )
+{
+	const unsigned char* data( _file.getData() );
+	const size_t file_size( _file.getSize() );
+
+	//--------------------------------------------------------------------------
+	// trailer
+	//--------------------------------------------------------------------------
+	if( (TRAILER_SIZE > file_size) ||
+		(0 != std::memcmp(data + file_size - sizeof(MAGIC), MAGIC, sizeof(MAGIC))) )
+	{
+		std::ostringstream msg;
+		msg << "ReplayLogReader::ReplayLogReader()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  " << path << " is not a finished replay log";
+		throw std::logic_error( msg.str() );
+	}
+
+	const unsigned char* trailer( data + file_size - TRAILER_SIZE );
+	const unsigned long long index_position( readFixed(trailer, 8) );
+	const unsigned long long num_games( readFixed(trailer + 8, 8) );
+
+	if( (index_position + TRAILER_SIZE > file_size) ||
+		(file_size - index_position - TRAILER_SIZE != ReplayLogWriter::INDEX_ENTRY_SIZE * num_games) )
+	{
+		std::ostringstream msg;
+		msg << "ReplayLogReader::ReplayLogReader()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  index of " << path << " does not match its trailer";
+		throw std::logic_error( msg.str() );
+	}
+
+	_index = data + index_position;
+	_numGames = (unsigned long)num_games;
+
+	//--------------------------------------------------------------------------
+	// header
+	//--------------------------------------------------------------------------
+	if( (sizeof(MAGIC) + 1 > index_position) ||
+		(0 != std::memcmp(data, MAGIC, sizeof(MAGIC))) ||
+		(ReplayLogWriter::VERSION != data[sizeof(MAGIC)]) )
+	{
+		std::ostringstream msg;
+		msg << "ReplayLogReader::ReplayLogReader()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  " << path << " is not a version "
+			<< (unsigned int)ReplayLogWriter::VERSION << " replay log";
+		throw std::logic_error( msg.str() );
+	}
+
+	unsigned long* values[ReplayLogHeader::NUM_VALUES];
+	listHeaderValues( &_header, values );
+
+	size_t position( sizeof(MAGIC) + 1 );
+	const unsigned long long num_values( ReplayLogSink::readVarint(data, (size_t)index_position, &position) );
+
+	for(unsigned long long value_index(0); value_index < num_values; ++value_index)
+	{
+		unsigned long long value( ReplayLogSink::readVarint(data, (size_t)index_position, &position) );
+		if( ReplayLogHeader::NUM_VALUES > value_index )
+		{
+			*values[value_index] = (unsigned long)value;
+		}
+		//else written by a later version; ignored
+	}
+
+} //end routine constructor
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns whether log holds game.
+/// \param unsigned long: game index within batch
+/// \return bool: whether game recorded
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+bool
+ReplayLogReader::hasGame(
+	unsigned long game_index) //i - game index within batch
+const
+{
+	return( 0 != getPayloadSize(game_index) );
+
+} //end routine hasGame()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns bytes game takes in log.
+/// \param unsigned long: game index within batch
+/// \return unsigned long long: payload size; 0 if game not recorded
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+unsigned long long
+ReplayLogReader::getPayloadSize(
+	unsigned long game_index) //i - game index within batch
+const
+{
+	const unsigned char* entry( findIndexEntry(game_index) );
+
+	return( entry ? readFixed(entry + PAYLOAD_LENGTH_FIELD, 4) : 0 );
+
+} //end routine getPayloadSize()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns size of game's record once decompressed.
+/// \param unsigned long: game index within batch
+/// \return unsigned long long: record size; 0 if game not recorded
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+unsigned long long
+ReplayLogReader::getRecordSize(
+	unsigned long game_index) //i - game index within batch
+const
+{
+	const unsigned char* entry( findIndexEntry(game_index) );
+
+	return( entry ? readFixed(entry + RECORD_LENGTH_FIELD, 4) : 0 );
+
+} //end routine getRecordSize()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns game's outcome from index.
+/// \param unsigned long: game index within batch
+/// \return ReplayGameSummary: outcome; no players if game not recorded
+/// \throw None
+/// \note
+/// - Reads index entry only; game's payload is not touched.
+////////////////////////////////////////////////////////////////////////////////
+ReplayGameSummary
+ReplayLogReader::getSummary(
+	unsigned long game_index) //i - game index within batch
+const
+{
+	ReplayGameSummary summary;
+
+	const unsigned char* entry( findIndexEntry(game_index) );
+	if( ! entry || (0 == readFixed(entry + PAYLOAD_LENGTH_FIELD, 4)) )
+	{
+		return summary; //not recorded
+	}
+
+	summary._numPlayerTurns = (unsigned int)readFixed( entry + PLAYER_TURNS_FIELD, 2 );
+	summary._numRounds = (unsigned int)readFixed( entry + ROUNDS_FIELD, 2 );
+	summary._winner = (clueless::PROFESSOR_PLUM >= entry[WINNER_FIELD])
+		? clueless::PersonType( entry[WINNER_FIELD] )
+		: clueless::UNKNOWN_PERSON;
+	summary._falseAccusers = entry[FALSE_ACCUSERS_FIELD];
+	summary._numPlayers = entry[NUM_PLAYERS_FIELD];
+	summary._reachedTurnLimit = (0 != entry[TURN_LIMIT_FIELD]);
+
+	return summary;
+
+} //end routine getSummary()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Reads one game's record.
+/// \param unsigned long: game index within batch
+/// \param ReplayGame: game read
+/// \return None
+/// \throw
+/// - INSUFFICIENT_DATA when game not recorded.
+/// - INCONSISTENT_DATA when payload out of file or record malformed.
+/// \note
+/// - Touches index entry and payload only.
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogReader::readGame(
+	unsigned long game_index, //i - game index within batch
+	ReplayGame* game) // o- game read
+{
+	const unsigned char* entry( findIndexEntry(game_index) );
+	const unsigned long long payload_length( entry ? readFixed(entry + PAYLOAD_LENGTH_FIELD, 4) : 0 );
+
+	if( 0 == payload_length )
+	{
+		std::ostringstream msg;
+		msg << "ReplayLogReader::readGame()\n"
+			<< "  INSUFFICIENT_DATA\n"
+			<< "  game " << game_index << " not in log of " << _numGames << " games";
+		throw std::logic_error( msg.str() );
+	}
+
+	const unsigned long long payload_position( readFixed(entry + PAYLOAD_POSITION_FIELD, 8) );
+	const size_t record_length( (size_t)readFixed(entry + RECORD_LENGTH_FIELD, 4) );
+	const unsigned long long payloads_end( _index - _file.getData() );
+
+	if( (payload_position > payloads_end) ||
+		(payloads_end - payload_position < payload_length) ||
+		(record_length < payload_length) )
+	{
+		std::ostringstream msg;
+		msg << "ReplayLogReader::readGame()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  index entry of game " << game_index << " out of range";
+		throw std::logic_error( msg.str() );
+	}
+
+	const unsigned char* payload( _file.getData() + payload_position );
+
+	if( payload_length == record_length )
+	{
+		game->load( payload, record_length ); //stored as is
+	}
+	else
+	{
+		_record.resize( record_length );
+		LzCodec::decompress( payload, (size_t)payload_length, _record.data(), record_length );
+		game->load( _record.data(), record_length );
+	}
+
+	if( game->getGameIndex() != game_index )
+	{
+		std::ostringstream msg;
+		msg << "ReplayLogReader::readGame()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  index entry " << game_index << " holds game "
+			<< game->getGameIndex();
+		throw std::logic_error( msg.str() );
+	}
+
+} //end routine readGame()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns game's index entry.
+/// \param unsigned long: game index within batch
+/// \return unsigned char[]: INDEX_ENTRY_SIZE bytes within file; nullptr when
+///  game index beyond log
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+const unsigned char*
+ReplayLogReader::findIndexEntry(
+	unsigned long game_index) //i - game index within batch
+const
+{
+	if( game_index >= _numGames )
+	{
+		return nullptr;
+	}
+
+	return( _index + ReplayLogWriter::INDEX_ENTRY_SIZE * game_index );
+
+} //end routine findIndexEntry()
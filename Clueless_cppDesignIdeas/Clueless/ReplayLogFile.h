@@ -0,0 +1,249 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file ReplayLogFile.h
+/// \brief Writes a batch's game records to a replay log (game archive) and
+///        reads any one game, or every game's outcome, back without reading
+///        the rest.
+///
+/// \date   17 Oct 2026  2250
+///
+/// \note
+/// - File layout:
+///   - "CLRL", format version (one byte), number of header values (varint),
+///     header values (varints, in ReplayLogHeader order)
+///   - game payloads, in the order games finished: each game's record (see
+///     ReplayLogSink), compressed by LzCodec unless that saves nothing
+///   - index: INDEX_ENTRY_SIZE bytes per game index, little-endian:
+///     payload position (8), payload length (4), record length (4; payload
+///     not compressed when equal), player turns (2), rounds of play (2),
+///     winner's character (1; 0 for none), false accusers (1; bit per
+///     character), number of players (1), reached turn limit (1);
+///     payload length 0 for a game not recorded
+///   - trailer: index position (8), number of games (8), "CLRL"
+/// - Reader maps the file (see MappedFile): finding game G is arithmetic on
+///   the index, and outcome queries scan the index without touching payloads.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ReplayLogFile_h
+#define ReplayLogFile_h
+
+#include "MappedFile.h"
+
+#include "CluelessEnums.h"	//for PersonType use
+
+#include <stddef.h>		//for size_t use
+#include <fstream>		//for std::ofstream use
+#include <mutex>		//for std::mutex use
+#include <vector>		//for std::vector use
+
+
+//forward declarations
+class ReplayGame;
+class ReplayLogSink;
+
+
+/// \brief How a log's games were played, enough to play them again.
+struct ReplayLogHeader
+{
+	static const size_t NUM_VALUES = 11;
+
+	/// \brief Default constructor
+	ReplayLogHeader()
+		: _numPlayers( 0 )
+		, _maxNumTurns( 0 )
+		, _batchSeed( 0 )
+		, _searchSeats( 0 )
+		, _searchIterations( 0 )
+		, _searchMilliseconds( 0 )
+		, _searchThreads( 0 )
+		, _searchMode( 0 )
+		, _accusationPercent( 100 )
+		, _isCustomLayout( 0 )
+		, _isSimulated( 0 )
+	{
+	}
+
+	unsigned long _numPlayers;
+	unsigned long _maxNumTurns; //rounds of play
+	unsigned long _batchSeed;
+
+	unsigned long _searchSeats; //bit (1 << seat) per seat played by search
+	unsigned long _searchIterations;
+	unsigned long _searchMilliseconds;
+	unsigned long _searchThreads;
+	unsigned long _searchMode; //IsmctsSearch::ParallelMode
+
+	unsigned long _accusationPercent; //confidence needed to accuse
+	unsigned long _isCustomLayout; //1 when board read from layout file
+	unsigned long _isSimulated; //1 when played by GameSimulator; 0 for Main
+
+}; //end struct ReplayLogHeader defn
+
+
+/// \brief Game's outcome, as kept in log's index.
+struct ReplayGameSummary
+{
+	/// \brief Default constructor
+	ReplayGameSummary()
+		: _numPlayerTurns( 0 )
+		, _numRounds( 0 )
+		, _winner( clueless::UNKNOWN_PERSON )
+		, _falseAccusers( 0 )
+		, _numPlayers( 0 )
+		, _reachedTurnLimit( false )
+	{
+	}
+
+	unsigned int _numPlayerTurns; //one per player per round
+	unsigned int _numRounds;      //rounds of play, incl. winning round
+	clueless::PersonType _winner; //unknown person if none
+	unsigned int _falseAccusers;  //bit per PersonType
+	size_t _numPlayers;
+	bool _reachedTurnLimit;       //game abandoned at turn cap
+
+}; //end struct ReplayGameSummary defn
+
+
+class ReplayLogWriter
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const unsigned char VERSION = 2;
+	static const size_t INDEX_ENTRY_SIZE = 24;
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	ReplayLogWriter();
+
+	/// \brief Copy constructor
+	ReplayLogWriter(const ReplayLogWriter&);
+
+public:
+	ReplayLogWriter(const char* path, const ReplayLogHeader& header);
+
+	virtual ~ReplayLogWriter();
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	unsigned long getNumGames() const;
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	void appendGame(const ReplayLogSink& game);
+	void close();
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	std::ofstream _file;
+	std::mutex _fileMutex; //held while appending a game
+
+	std::vector<unsigned char> _index; //INDEX_ENTRY_SIZE bytes by game index
+	unsigned long _numGames;           //one more than highest game index
+	unsigned long long _position;      //end of file
+
+}; //end class ReplayLogWriter defn
+
+
+class ReplayLogReader
+{
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	ReplayLogReader();
+
+	/// \brief Copy constructor
+	ReplayLogReader(const ReplayLogReader&);
+
+public:
+	ReplayLogReader(const char* path);
+
+	virtual ~ReplayLogReader()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	const ReplayLogHeader& getHeader() const;
+	unsigned long getNumGames() const;
+
+	bool hasGame(unsigned long gameIndex) const;
+	unsigned long long getPayloadSize(unsigned long gameIndex) const;
+	unsigned long long getRecordSize(unsigned long gameIndex) const;
+	ReplayGameSummary getSummary(unsigned long gameIndex) const;
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	void readGame(unsigned long gameIndex, ReplayGame* game);
+
+protected:
+	const unsigned char* findIndexEntry(unsigned long gameIndex) const;
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	MappedFile _file;
+	ReplayLogHeader _header;
+
+	const unsigned char* _index; //within file
+	unsigned long _numGames;
+
+	std::vector<unsigned char> _record; //decompressed record, reused
+
+}; //end class ReplayLogReader defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns one more than highest game index appended.
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned long
+ReplayLogWriter::getNumGames()
+const
+{
+	return _numGames;
+
+} //end routine getNumGames()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline const ReplayLogHeader&
+ReplayLogReader::getHeader()
+const
+{
+	return _header;
+
+} //end routine getHeader()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned long
+ReplayLogReader::getNumGames()
+const
+{
+	return _numGames;
+
+} //end routine getNumGames()
+
+
+#endif //ReplayLogFile_h defn
@@ -0,0 +1,550 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file ReplayLogSink.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  2235
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ReplayLogSink.h"
+
+#include "Board.h"
+#include "BoardLayout.h"	//for determineRoomId use
+#include "Card.h"
+#include "GamePiece.h"
+#include "Location.h"
+#include "Player.h"
+#include "SolutionCardSet.h"
+
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::logic_error use
+
+//------------------------------------------------------------------------------
+// Local Helpers
+//------------------------------------------------------------------------------
+/// \brief Number of values following each event type (GAME_SET_UP varies).
+static const unsigned char NUM_VALUES[ReplayLogSink::NUM_EVENT_TYPES] =
+{
+	0, //unused
+	0, //GAME_SET_UP
+	2 + ReplayLogSink::NUM_PERSONS + ReplayLogSink::NUM_WEAPONS, //KEYFRAME
+	1, //TURN_STARTED
+	1, //TURN_SKIPPED
+	1, //NO_PERMISSIBLE_MOVES
+	1, //STAY_IN_ROOM_ALLOWED
+	2, //TURN_OPTION_CHOSEN
+	3, //PLAYER_MOVED
+	4, //SUGGESTION_MADE
+	2, //PERSON_TOKEN_MOVED
+	2, //WEAPON_TOKEN_MOVED
+	3, //COUNTER_EVIDENCE_SHOWN
+	1, //SUGGESTION_REFUTED
+	1, //SUGGESTION_UNREFUTED
+	4, //GAME_WON
+	4  //FALSE_ACCUSATION_MADE
+};
+
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param GameEventSink: also receives every event (not owned); nullptr for
+///  none
+/// \return None
+/// \throw None
+/// \note
+/// - Reserves room for a typical game so recording rarely reallocates.
+////////////////////////////////////////////////////////////////////////////////
+ReplayLogSink::ReplayLogSink(
+	GameEventSink* forward_to) //i - also receives every event
+	: _forward( forward_to ? forward_to : NullEventSink::shared() )
+	, _gameIndex( 0 )
+	, _seed( 0 )
+	, _numPlayers( 0 )
+{
+	_events.reserve( 1024 );
+	_records.reserve( 1024 );
+
+	beginGame( 0, 0 );
+
+} //end routine constructor
+
+
+//------------------------------------------------------------------------------
+// Accessors and Mutators
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns number of values following event type.
+/// \param EventType: event type
+/// \return size_t: number of values; 0 for GAME_SET_UP (varies with hands)
+///  and unknown types
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+size_t
+ReplayLogSink::getNumValues(
+	EventType event) //i - event type
+{
+	if( NUM_EVENT_TYPES <= (size_t)event )
+	{
+		return 0;
+	}
+
+	return NUM_VALUES[event];
+
+} //end routine getNumValues()
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Starts recording new game, discarding any previous record.
+/// \param unsigned long: game index within batch
+/// \param unsigned long: seed for game's random number generator
+/// \return None
+/// \throw None
+/// \note
+/// - Call before Game::setup(), which reports game set up.
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::beginGame(
+	unsigned long game_index, //i - game index within batch
+	unsigned long seed) //i - seed for game's random number generator
+{
+	_gameIndex = game_index;
+	_seed = seed;
+	_numPlayers = 0;
+
+	_events.clear();
+	_keyframePositions.clear();
+	_records.clear();
+
+	_current._turn = 0;
+	for(size_t person_index(0); person_index < NUM_PERSONS; ++person_index)
+	{
+		_current._personLocations[person_index] = 0;
+	}
+	for(size_t wpn_index(0); wpn_index < NUM_WEAPONS; ++wpn_index)
+	{
+		_current._weaponLocations[wpn_index] = 0;
+	}
+	_current._falseAccusers = 0;
+	_current._winner = clueless::UNKNOWN_PERSON;
+
+} //end routine beginGame()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Finishes game record (see getRecords()).
+/// \param None
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::endGame()
+{
+	_records.clear();
+
+	appendVarint( _gameIndex, &_records );
+	appendVarint( _seed, &_records );
+
+	appendVarint( _keyframePositions.size(), &_records );
+	size_t prev_position( 0 );
+	for(size_t kf_index(0); kf_index < _keyframePositions.size(); ++kf_index)
+	{
+		appendVarint( _keyframePositions[kf_index] - prev_position, &_records );
+		prev_position = _keyframePositions[kf_index];
+	}
+
+	_records.insert( _records.end(), _events.begin(), _events.end() );
+
+} //end routine endGame()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Reads unsigned varint.
+/// \param unsigned char[]: bytes
+/// \param size_t: number of bytes
+/// \param size_t: position of varint; moved past it
+/// \return unsigned long long: value
+/// \throw
+/// - INCONSISTENT_DATA when varint runs past last byte or exceeds 64 bits.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+unsigned long long
+ReplayLogSink::readVarint(
+	const unsigned char* bytes, //i - bytes
+	size_t num_bytes, //i - number of bytes
+	size_t* position) //io- position of varint
+{
+	unsigned long long value( 0 );
+
+	for(unsigned int shift(0); shift < 64; shift += 7)
+	{
+		if( num_bytes <= *position )
+		{
+			break; //truncated
+		}
+
+		unsigned char byte( bytes[(*position)++] );
+		value |= (unsigned long long)(byte & 0x7f) << shift;
+
+		if( 0 == (byte & 0x80) ) //last byte
+		{
+			return value;
+		}
+	}
+
+	std::ostringstream msg;
+	msg << "ReplayLogSink::readVarint()\n"
+		<< "  INCONSISTENT_DATA\n"
+		<< "  truncated or oversized varint before byte " << *position;
+	throw std::logic_error( msg.str() );
+
+} //end routine readVarint()
+
+
+//------------------------------------------------------------------------------
+// Game Events
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Records Case File, each player's starting position and hand, and
+///  where every token starts.
+/// \param list<Player>: all players
+/// \param Board: game board
+/// \param SolutionCardSet: Case File
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::gameSetUp(
+	const std::list<Player*>& players, //i - all players
+	const Board& board, //i - game board
+	const SolutionCardSet& case_file) //i - Case File
+{
+	_events.push_back( (unsigned char)GAME_SET_UP );
+	appendSolution( case_file );
+	appendVarint( players.size(), &_events );
+	_numPlayers = players.size();
+
+	std::list<Player*>::const_iterator player_iter( players.begin() );
+	for(player_iter  = players.begin();
+		player_iter != players.end();
+		++player_iter )
+	{
+		const size_t num_cards( (*player_iter)->getNumCardsInHand() );
+
+		appendVarint( (*player_iter)->getCharacter(), &_events );
+		appendVarint( (*player_iter)->getLocation()->getId(), &_events );
+		appendVarint( num_cards, &_events );
+
+		for(size_t pos_index(0); pos_index < num_cards; ++pos_index)
+		{
+			appendVarint( (*player_iter)->getCardInHand(pos_index)->getIndex(), &_events );
+
+		} //end for (each card in hand)
+
+	} //end for (each player)
+
+	//where every token starts, for first keyframe
+	for(size_t person_index(0); person_index < NUM_PERSONS; ++person_index)
+	{
+		_current._personLocations[person_index] =
+			(unsigned char)board._personTokens[person_index + 1]->_location->getId();
+	}
+
+	for(size_t wpn_index(0); wpn_index < NUM_WEAPONS; ++wpn_index)
+	{
+		_current._weaponLocations[wpn_index] =
+			(unsigned char)board._weaponTokens[wpn_index + 1]->_location->getId();
+	}
+
+	_forward->gameSetUp( players, board, case_file );
+
+} //end routine gameSetUp()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Records start of turn, preceded by keyframe every
+///  KEYFRAME_INTERVAL turns.
+/// \param Player: turn taker
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::turnStarted(
+	const Player* player) //i - turn taker
+{
+	if( 0 == (_current._turn % KEYFRAME_INTERVAL) )
+	{
+		appendKeyframe();
+	}
+
+	appendEvent( TURN_STARTED, player->getCharacter() );
+	++_current._turn;
+
+	_forward->turnStarted( player );
+
+} //end routine turnStarted()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::turnSkipped(
+	const Player* false_accuser) //i - false accuser
+{
+	appendEvent( TURN_SKIPPED, false_accuser->getCharacter() );
+
+	_forward->turnSkipped( false_accuser );
+
+} //end routine turnSkipped()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::noPermissibleMoves(
+	const Player* player) //i - turn taker
+{
+	appendEvent( NO_PERMISSIBLE_MOVES, player->getCharacter() );
+
+	_forward->noPermissibleMoves( player );
+
+} //end routine noPermissibleMoves()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::stayInRoomAllowed(
+	const Player* player) //i - turn taker
+{
+	appendEvent( STAY_IN_ROOM_ALLOWED, player->getCharacter() );
+
+	_forward->stayInRoomAllowed( player );
+
+} //end routine stayInRoomAllowed()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::turnOptionChosen(
+	const Player* player, //i - turn taker
+	clueless::TurnOptionType choice) //i - turn option chosen
+{
+	appendEvent( TURN_OPTION_CHOSEN, player->getCharacter() );
+	appendVarint( choice, &_events );
+
+	_forward->turnOptionChosen( player, choice );
+
+} //end routine turnOptionChosen()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::playerMoved(
+	const Player* player, //i - turn taker
+	const Location* destination, //i - new location
+	bool was_random_choice) //i - whether game chose among move options
+{
+	appendEvent( PLAYER_MOVED, player->getCharacter() );
+	appendVarint( destination->getId(), &_events );
+	appendVarint( was_random_choice ? 1 : 0, &_events );
+
+	_current._personLocations[player->getCharacter() - 1] = (unsigned char)destination->getId();
+
+	_forward->playerMoved( player, destination, was_random_choice );
+
+} //end routine playerMoved()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::suggestionMade(
+	const Player* suggestor, //i - suggestor
+	const SolutionCardSet& suggestion) //i - suggestion
+{
+	appendEvent( SUGGESTION_MADE, suggestor->getCharacter() );
+	appendSolution( suggestion );
+
+	_forward->suggestionMade( suggestor, suggestion );
+
+} //end routine suggestionMade()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::personTokenMovedForSuggestion(
+	clueless::PersonType person, //i - person token moved
+	clueless::RoomType room) //i - new location
+{
+	appendEvent( PERSON_TOKEN_MOVED, person );
+	appendVarint( room, &_events );
+
+	_current._personLocations[person - 1] = (unsigned char)BoardLayout::determineRoomId( room );
+
+	_forward->personTokenMovedForSuggestion( person, room );
+
+} //end routine personTokenMovedForSuggestion()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::weaponTokenMovedForSuggestion(
+	clueless::WeaponType weapon, //i - weapon token moved
+	clueless::RoomType room) //i - new location
+{
+	appendEvent( WEAPON_TOKEN_MOVED, weapon );
+	appendVarint( room, &_events );
+
+	_current._weaponLocations[weapon - 1] = (unsigned char)BoardLayout::determineRoomId( room );
+
+	_forward->weaponTokenMovedForSuggestion( weapon, room );
+
+} //end routine weaponTokenMovedForSuggestion()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::counterEvidenceShown(
+	const Player* refuter, //i - player showing card
+	const Player* suggestor, //i - player shown card
+	const Card* counter_evidence) //i - card shown
+{
+	appendEvent( COUNTER_EVIDENCE_SHOWN, refuter->getCharacter() );
+	appendVarint( suggestor->getCharacter(), &_events );
+	appendVarint( counter_evidence->getIndex(), &_events );
+
+	_forward->counterEvidenceShown( refuter, suggestor, counter_evidence );
+
+} //end routine counterEvidenceShown()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::suggestionRefuted(
+	clueless::PersonType refuter) //i - refuter's character
+{
+	appendEvent( SUGGESTION_REFUTED, refuter );
+
+	_forward->suggestionRefuted( refuter );
+
+} //end routine suggestionRefuted()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::suggestionUnrefuted(
+	const Player* suggestor) //i - suggestor
+{
+	appendEvent( SUGGESTION_UNREFUTED, suggestor->getCharacter() );
+
+	_forward->suggestionUnrefuted( suggestor );
+
+} //end routine suggestionUnrefuted()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \note Not recorded; marks a phase boundary only (no state changes).
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::notebooksUpdated(
+	const Player* suggestor) //i - suggestor
+{
+	_forward->notebooksUpdated( suggestor );
+
+} //end routine notebooksUpdated()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::gameWon(
+	const Player* winner, //i - game winner
+	const SolutionCardSet& case_file) //i - Case File
+{
+	appendEvent( GAME_WON, winner->getCharacter() );
+	appendSolution( case_file );
+
+	_current._winner = winner->getCharacter();
+
+	_forward->gameWon( winner, case_file );
+
+} //end routine gameWon()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::falseAccusationMade(
+	const Player* false_accuser, //i - false accuser
+	const SolutionCardSet& accusation) //i - accusation
+{
+	appendEvent( FALSE_ACCUSATION_MADE, false_accuser->getCharacter() );
+	appendSolution( accusation );
+
+	_current._falseAccusers |= (1u << false_accuser->getCharacter());
+
+	_forward->falseAccusationMade( false_accuser, accusation );
+
+} //end routine falseAccusationMade()
+
+
+//------------------------------------------------------------------------------
+// Record Encoding
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::appendEvent(
+	EventType event, //i - event being recorded
+	unsigned long value) //i - first value (character, person, or weapon)
+{
+	_events.push_back( (unsigned char)event );
+	appendVarint( value, &_events );
+
+} //end routine appendEvent()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::appendSolution(
+	const SolutionCardSet& solution) //i - suggestion, accusation, or Case File
+{
+	appendVarint( solution.getPersonType(), &_events );
+	appendVarint( solution.getWeaponType(), &_events );
+	appendVarint( solution.getRoomType(), &_events );
+
+} //end routine appendSolution()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+ReplayLogSink::appendKeyframe()
+{
+	_keyframePositions.push_back( _events.size() );
+
+	_events.push_back( (unsigned char)KEYFRAME );
+	appendVarint( _current._turn, &_events );
+
+	for(size_t person_index(0); person_index < NUM_PERSONS; ++person_index)
+	{
+		appendVarint( _current._personLocations[person_index], &_events );
+	}
+
+	for(size_t wpn_index(0); wpn_index < NUM_WEAPONS; ++wpn_index)
+	{
+		appendVarint( _current._weaponLocations[wpn_index], &_events );
+	}
+
+	appendVarint( _current._falseAccusers, &_events );
+
+} //end routine appendKeyframe()
@@ -0,0 +1,258 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file ReplayLogSink.h
+/// \brief Records one game's play events as a compact replay record, with
+///        periodic keyframes for seeking.
+///
+/// \date   17 Oct 2026  2230
+///
+/// \note
+/// - Every number is written as an unsigned varint (seven bits per byte,
+///   low bits first, high bit set on all but the last byte); game events
+///   need one byte per value.
+/// - Record: game index, seed, number of keyframes, keyframe positions
+///   (each as distance from previous, from start of events), then events.
+/// - Each event is an EventType followed by its values:
+///   - GAME_SET_UP: case file person, weapon, room; number of players; then
+///     per player: character, location, hand size, card indices
+///   - KEYFRAME: turn, location of each person token (Miss Scarlet first),
+///     location of each weapon token (candlestick first), false accusers
+///     (bit per character)
+///   - TURN_STARTED, TURN_SKIPPED, NO_PERMISSIBLE_MOVES, STAY_IN_ROOM_ALLOWED,
+///     SUGGESTION_UNREFUTED: character
+///   - TURN_OPTION_CHOSEN: character, turn option
+///   - PLAYER_MOVED: character, location, was random choice (0 / 1)
+///   - SUGGESTION_MADE: character, person, weapon, room
+///   - PERSON_TOKEN_MOVED: person, room
+///   - WEAPON_TOKEN_MOVED: weapon, room
+///   - COUNTER_EVIDENCE_SHOWN: refuter character, suggestor character, card
+///     index
+///   - SUGGESTION_REFUTED: refuter character
+///   - GAME_WON: character, case file person, weapon, room
+///   - FALSE_ACCUSATION_MADE: character, accused person, weapon, room
+/// - A keyframe precedes every KEYFRAME_INTERVAL-th turn (a turn being one
+///   player's turn, counted from zero), so board state at any turn is
+///   rebuilt from at most KEYFRAME_INTERVAL turns of events (see ReplayGame).
+/// - Every event is also passed on to an optional sink (e.g. narration).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ReplayLogSink_h
+#define ReplayLogSink_h
+
+#include "GameEventSink.h"
+
+#include "CluelessEnums.h"	//for PersonType, WeaponType use
+
+#include <stddef.h>		//for size_t use
+#include <vector>		//for std::vector use
+
+
+class ReplayLogSink : public GameEventSink
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const unsigned long KEYFRAME_INTERVAL = 16; //turns between keyframes
+
+	static const size_t NUM_PERSONS = clueless::PROFESSOR_PLUM;
+	static const size_t NUM_WEAPONS = clueless::WRENCH;
+
+	//--------------------------------------------------------------------------
+	// Class-Scoped Enumerated Types
+	//--------------------------------------------------------------------------
+public:
+	enum EventType
+	{
+		GAME_SET_UP = 1,
+		KEYFRAME,
+		TURN_STARTED,
+		TURN_SKIPPED,
+		NO_PERMISSIBLE_MOVES,
+		STAY_IN_ROOM_ALLOWED,
+		TURN_OPTION_CHOSEN,
+		PLAYER_MOVED,
+		SUGGESTION_MADE,
+		PERSON_TOKEN_MOVED,
+		WEAPON_TOKEN_MOVED,
+		COUNTER_EVIDENCE_SHOWN,
+		SUGGESTION_REFUTED,
+		SUGGESTION_UNREFUTED,
+		GAME_WON,
+		FALSE_ACCUSATION_MADE,
+
+		NUM_EVENT_TYPES
+
+	}; //end enum EventType defn
+
+	//--------------------------------------------------------------------------
+	// Class-Scoped Types
+	//--------------------------------------------------------------------------
+public:
+	/// \brief Board state at start of a turn.
+	struct Keyframe
+	{
+		unsigned long _turn; //turns started before this one
+
+		unsigned char _personLocations[NUM_PERSONS]; //location id, Miss Scarlet first
+		unsigned char _weaponLocations[NUM_WEAPONS]; //location id, candlestick first
+
+		unsigned int _falseAccusers; //bit per PersonType
+		clueless::PersonType _winner; //unknown person until game won
+
+	}; //end struct Keyframe defn
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+public:
+	ReplayLogSink(GameEventSink* forwardTo = nullptr);
+
+	virtual ~ReplayLogSink()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	unsigned long getGameIndex() const;
+	size_t getNumPlayers() const;
+	const Keyframe& getState() const;
+	const std::vector<unsigned char>& getRecords() const;
+
+	static size_t getNumValues(EventType event);
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	void beginGame(unsigned long gameIndex, unsigned long seed);
+	void endGame();
+
+	static void appendVarint(unsigned long long value, std::vector<unsigned char>* bytes);
+	static unsigned long long readVarint(const unsigned char* bytes, size_t numBytes, size_t* position);
+
+	//--------------------------------------------------------------------------
+	// Game Events
+	//--------------------------------------------------------------------------
+	virtual void gameSetUp(const std::list<Player*>& players,
+		const Board& board,
+		const SolutionCardSet& caseFile) override;
+
+	virtual void turnStarted(const Player* player) override;
+	virtual void turnSkipped(const Player* falseAccuser) override;
+	virtual void noPermissibleMoves(const Player* player) override;
+	virtual void stayInRoomAllowed(const Player* player) override;
+	virtual void turnOptionChosen(const Player* player, clueless::TurnOptionType choice) override;
+	virtual void playerMoved(const Player* player,
+		const Location* destination,
+		bool wasRandomChoice) override;
+
+	virtual void suggestionMade(const Player* suggestor, const SolutionCardSet& suggestion) override;
+	virtual void personTokenMovedForSuggestion(clueless::PersonType person, clueless::RoomType room) override;
+	virtual void weaponTokenMovedForSuggestion(clueless::WeaponType weapon, clueless::RoomType room) override;
+	virtual void counterEvidenceShown(const Player* refuter,
+		const Player* suggestor,
+		const Card* counterEvidence) override;
+	virtual void suggestionRefuted(clueless::PersonType refuter) override;
+	virtual void suggestionUnrefuted(const Player* suggestor) override;
+	virtual void notebooksUpdated(const Player* suggestor) override;
+
+	virtual void gameWon(const Player* winner, const SolutionCardSet& caseFile) override;
+	virtual void falseAccusationMade(const Player* falseAccuser, const SolutionCardSet& accusation) override;
+
+protected:
+	void appendEvent(EventType event, unsigned long value);
+	void appendSolution(const SolutionCardSet& solution);
+	void appendKeyframe();
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	GameEventSink* _forward; //receives every event too (not owned); never null
+
+	unsigned long _gameIndex;
+	unsigned long _seed;
+	size_t _numPlayers;
+
+	std::vector<unsigned char> _events;      //current game's events
+	std::vector<size_t> _keyframePositions;  //within events
+	Keyframe _current;                       //board state as of last event
+
+	std::vector<unsigned char> _records; //finished game, set by endGame()
+
+}; //end class ReplayLogSink defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned long
+ReplayLogSink::getGameIndex()
+const
+{
+	return _gameIndex;
+
+} //end routine getGameIndex()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+ReplayLogSink::getNumPlayers()
+const
+{
+	return _numPlayers;
+
+} //end routine getNumPlayers()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns board state as of last event; game's outcome once ended.
+////////////////////////////////////////////////////////////////////////////////
+inline const ReplayLogSink::Keyframe&
+ReplayLogSink::getState()
+const
+{
+	return _current;
+
+} //end routine getState()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns record of game finished by endGame().
+////////////////////////////////////////////////////////////////////////////////
+inline const std::vector<unsigned char>&
+ReplayLogSink::getRecords()
+const
+{
+	return _records;
+
+} //end routine getRecords()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Appends value as unsigned varint.
+////////////////////////////////////////////////////////////////////////////////
+inline void
+ReplayLogSink::appendVarint(
+	unsigned long long value, //i - value
+	std::vector<unsigned char>* bytes) //io- destination
+{
+	while( 0x80 <= value )
+	{
+		bytes->push_back( (unsigned char)(value | 0x80) );
+		value >>= 7;
+	}
+
+	bytes->push_back( (unsigned char)value );
+
+} //end routine appendVarint()
+
+
+#endif //ReplayLogSink_h defn
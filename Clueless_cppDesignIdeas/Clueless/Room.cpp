@@ -20,6 +20,53 @@
 #include <stdexcept>	//for std::logic_error use
 #include <sstream>		//for std::ostringstream use
 
+//------------------------------------------------------------------------------
+// Local Helpers
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns occupancy bit for specified piece.
+/// \param GamePiece: piece of interest
+/// \return unsigned int: bit for piece's person or weapon type
+/// \throw None
+/// \note
+/// - Person and weapon bits are kept apart (see Room::_personOccupants).
+////////////////////////////////////////////////////////////////////////////////
+static unsigned int
+determineOccupantBit(
+	const GamePiece* piece) //i - piece of interest
+{
+	if( piece->isPersonPiece() )
+	{
+		return( 1u << ((const PersonPiece*)piece)->_person );
+	}
+
+	return( 1u << ((const WeaponPiece*)piece)->_weapon );
+
+} //end routine determineOccupantBit()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns number of bits set.
+/// \param unsigned int: bits
+/// \return size_t: number of bits set
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static size_t
+countBits(
+	unsigned int bits) //i - bits
+{
+	size_t num_bits( 0 );
+	for(; 0 != bits; bits &= (bits - 1))
+	{
+		++num_bits;
+	}
+
+	return num_bits;
+
+} //end routine countBits()
+
+
 //------------------------------------------------------------------------------
 // Accessors and Mutators
 //------------------------------------------------------------------------------
@@ -34,7 +81,7 @@ bool
 Room::isOccupied()
 const
 {
-	return( 0 < _occupants.size() );
+	return( 0 != (_personOccupants | _weaponOccupants) );
 
 } //end routine isOccupied()
 
@@ -68,10 +115,15 @@ Room::doesPieceResideInRoom(
 	const GamePiece* piece) //i - potential occupant
 const
 {
-	std::set<const GamePiece*>::const_iterator piece_iter( _occupants.find( piece ) );
+	if( ! piece )
+	{
+		return false;
+	}
 
-	//if found piece, is occupant
-	return( _occupants.end() != piece_iter );
+	unsigned int occupants( piece->isPersonPiece() ? _personOccupants : _weaponOccupants );
+
+	//if piece's bit set, is occupant
+	return( 0 != (occupants & determineOccupantBit(piece)) );
 
 } //end routine doesPieceResideInRoom()
 
@@ -91,8 +143,21 @@ Room::addOccupant(
 	//prompt base class logic (primarily for error handling)
 	Location::addOccupant( piece );
 
+	if( ! piece )
+	{
+		return false;
+	}
+
 	//child class logic
-	_occupants.insert( piece );
+	if( piece->isPersonPiece() )
+	{
+		_personOccupants |= determineOccupantBit( piece );
+	}
+	else //weapon
+	{
+		_weaponOccupants |= determineOccupantBit( piece );
+	}
+
 	return true; //occupant set
 
 } //end routine addOccupant()
@@ -109,11 +174,18 @@ void
 Room::recognizeOccupantLeft(
 	const GamePiece* prev_occupant) //i - person who left room
 {
-	std::set<const GamePiece*>::iterator occupant( _occupants.find(prev_occupant) );
+	if( ! prev_occupant )
+	{
+		return;
+	}
 
-	if( occupant != _occupants.end() ) //found previous occupant
+	if( prev_occupant->isPersonPiece() )
+	{
+		_personOccupants &= ~determineOccupantBit( prev_occupant );
+	}
+	else //weapon
 	{
-		_occupants.erase( occupant );
+		_weaponOccupants &= ~determineOccupantBit( prev_occupant );
 	}
 
 } //end routine recognizeOccupantLeft()
@@ -124,52 +196,27 @@ Room::recognizeOccupantLeft(
 /// \param Hallway: adjacent hallway
 /// \return None
 /// \throw
-/// - LOGIC_ERROR when already have references to two adjacent hallways.
+/// - LOGIC_ERROR when already have references to as many hallways as
+///   expected.
 /// \note  None
 ////////////////////////////////////////////////////////////////////////////////
 void
 Room::acceptAdjacentHallway(
 	Hallway* hallway) //i - adjacent hallway
 {
-	bool can_accept_another_hallway( false );
-
-	if( 2 > _adjacentHallways.size() )
-	{
-		//all rooms have at least 2 adjacent hallways
-		can_accept_another_hallway = true;
-	}
-	else if(
-		(2 == _adjacentHallways.size()) &&
-		areMoreThanTwoHallwaysExpected() )
-	{
-		can_accept_another_hallway = true;
-	}
-	else if(
-		(3 == _adjacentHallways.size()) &&
-		areMoreThanThreeHallwaysExpected() )
-	{
-		can_accept_another_hallway = true;
-	}
+	bool can_accept_another_hallway( _numHallwaysExpected > _numAdjacentHallways );
 
 	if( can_accept_another_hallway )
 	{
-		_adjacentHallways.insert( hallway );
+		++_numAdjacentHallways;
 	}
-	else //already have reference to max number hallways for room type
+	else //already have reference to number of hallways in layout
 	{
 		std::ostringstream msg;
 		msg << "Room::acceptAdjacentHallway()\n"
 			<< "  LOGIC_ERROR\n"
-			<< "  " << getName() << " already has references to " << _adjacentHallways.size() << " hallways...\n";
-		
-		std::set<Hallway*>::const_iterator hallway_iter( _adjacentHallways.begin() );
-		while( _adjacentHallways.end() != hallway_iter )
-		{
-			msg << "    " << (*hallway_iter)->getName() << "\n";
-			++hallway_iter;
-
-		} //end while (more hallways)
-
+			<< "  " << getName() << " already has " << _numAdjacentHallways
+			<< " hallways; cannot accept " << hallway->getName();
 		throw std::logic_error( msg.str() );
 	}
 
@@ -238,53 +285,20 @@ Room::createSecretPassageTo(
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Returns whether room expects egress to more than two or three
-///  hallways depending on room type.
-/// \param none
-/// \return bool: whether expects more than two or three hallways
+/// \brief Sets number of hallways room connects to.
+/// \param size_t: number of adjacent hallways in board layout
+/// \return None
 /// \throw None
-/// \note  None
+/// \note
+/// - Set before hallways are created; room refuses hallways beyond number.
 ////////////////////////////////////////////////////////////////////////////////
-bool
-Room::areMoreThanTwoHallwaysExpected()
-const
-{
-	bool does_expect_more_than_two( false );
-
-	switch( _type )
-	{
-	case clueless::HALL:
-	case clueless::LIBRARY:
-	case clueless::BILLIARD_ROOM:
-	case clueless::DINING_ROOM:
-	case clueless::BALLROOM:
-		does_expect_more_than_two = true;
-		break;
-
-	default:
-		; //still does not expect more than two
-
-	} //end switch (on room type)
-
-	return does_expect_more_than_two;
-
-} //end routine areMoreThanTwoHallwaysExpected()
-
-
-bool
-Room::areMoreThanThreeHallwaysExpected()
-const
+void
+Room::expectHallways(
+	size_t num_hallways) //i - number of adjacent hallways
 {
-	bool does_expect_more_than_three( false );
-
-	if( clueless::BILLIARD_ROOM == _type )
-	{
-		does_expect_more_than_three = true;
-	}
-
-	return does_expect_more_than_three;
+	_numHallwaysExpected = num_hallways;
 
-} //end routine areMoreThanThreeHallwaysExpected()
+} //end routine expectHallways()
 
 
 //------------------------------------------------------------------------------
@@ -305,23 +319,28 @@ const
 
 	report
 		<< Location::report().str() << " (" << clueless::translateRoomTypeToText(_type) << "): "
-		<< _occupants.size() << " occupants [";
+		<< (countBits(_personOccupants) + countBits(_weaponOccupants)) << " occupants [";
 
-	std::set<const GamePiece*>::const_iterator occupant_iter( _occupants.begin() );
-	if( _occupants.end() != occupant_iter )
+	const char* separator( "" );
+
+	//persons, then weapons, each in type order
+	for(size_t person(clueless::MISS_SCARLET); person <= clueless::PROFESSOR_PLUM; ++person)
 	{
-		//first occupant
-		report << (*occupant_iter)->getName();
-		++occupant_iter;
+		if( 0 != (_personOccupants & (1u << person)) )
+		{
+			report << separator << clueless::translatePersonTypeToText( (clueless::PersonType)person );
+			separator = ", ";
+		}
 	}
 
-	while( _occupants.end() != occupant_iter )
+	for(size_t wpn(clueless::CANDLESTICK); wpn <= clueless::WRENCH; ++wpn)
 	{
-		//subsequent occupants
-		report << ", " << (*occupant_iter)->getName();
-		++occupant_iter;
-
-	} //end while (more occupants)
+		if( 0 != (_weaponOccupants & (1u << wpn)) )
+		{
+			report << separator << clueless::translateWeaponTypeToText( (clueless::WeaponType)wpn );
+			separator = ", ";
+		}
+	}
 
 	report << "]";
 
@@ -336,44 +355,34 @@ const
 /// \brief Returns collection of possible move destinations based on specified
 ///  starting point.
 /// \param Location: starting point
-/// \return set<Location*>: possible destinations
+/// \return MoveOptionSet: possible destinations
 /// \throw None
 /// \note
 /// - Does not include adjacent hallway if occupied.
 /// - Room connected via secret passage is assumed to have unlimited capacity.
 ////////////////////////////////////////////////////////////////////////////////
-std::set<Location*>
+MoveOptionSet
 Room::getMoveOptions()
 const
 {
-	if( _adjacentHallways.empty() )
+	if( 0 == _numExits )
 	{
 		std::ostringstream msg;
-		msg << "Hallway::getMoveOptions()\n"
+		msg << "Room::getMoveOptions()\n"
 			<< "  INSUFFICIENT_DATA\n"
 			<< "  " << getName() << " missing adjacent hallway references";
 		throw std::logic_error( msg.str() );
 	}
 
-	std::set<Location*> destinations;
+	MoveOptionSet destinations;
 
-	std::set<Hallway*>::const_iterator hallway_iter( _adjacentHallways.begin() );
-	while( _adjacentHallways.end() != hallway_iter )
+	//exits are adjacent hallways and room accessed by secret passage
+	for(size_t exit_index(0); exit_index < _numExits; ++exit_index)
 	{
-		if( ! (*hallway_iter)->isOccupied() ) //not occupied
+		if( _exits[exit_index]->canAcceptAnotherOccupant() ) //hallway not occupied
 		{
-			destinations.insert( *hallway_iter );
+			destinations.addOption( _exits[exit_index] );
 		}
-
-		++hallway_iter; //next hallway
-
-	} //end while (more hallways)
-
-	//if has secret passage
-	if( _roomAccessedBySecretPassage )
-	{
-		//include room accessable by secret passage
-		destinations.insert( _roomAccessedBySecretPassage );
 	}
 
 	return destinations;
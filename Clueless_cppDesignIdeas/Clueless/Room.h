@@ -9,7 +9,9 @@
 ///
 /// \date   26 Feb 2019  1145
 ///
-/// \note None
+/// \note
+/// - Occupants held as one bit per person and per weapon type, so tracking
+///   tokens through rooms allocates nothing.
 ///
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -20,6 +22,8 @@
 
 #include "CluelessEnums.h"		//for RoomType use
 
+#include <stddef.h>		//for size_t use
+
 
 //forward declarations
 struct GamePiece;
@@ -35,8 +39,12 @@ class Room : public Location
 private:
 	/// \brief Default constructor
 	Room()
-		: Location( ROOM )
+		: Location( ROOM, 0 )
 		, _type( clueless::UNKNOWN_ROOM )
+		, _personOccupants( 0 )
+		, _weaponOccupants( 0 )
+		, _numAdjacentHallways( 0 )
+		, _numHallwaysExpected( 0 )
 		, _roomAccessedBySecretPassage( nullptr )
 		, _assocCard( nullptr )
 	{
@@ -44,9 +52,14 @@ private:
 
 public:
 	/// \brief Extended constructor
+	/// \note room identifier follows room type (study is zero)
 	Room(clueless::RoomType type)
-		: Location( ROOM )
+		: Location( ROOM, (unsigned int)type - 1 )
 		, _type(type)
+		, _personOccupants( 0 )
+		, _weaponOccupants( 0 )
+		, _numAdjacentHallways( 0 )
+		, _numHallwaysExpected( 0 )
 		, _roomAccessedBySecretPassage( nullptr )
 		, _assocCard( nullptr )
 	{
@@ -56,10 +69,6 @@ public:
 	/// \brief Destructor
 	virtual ~Room()
 	{
-		_occupants.clear(); //not responsible for deleting occupant objects
-
-		_adjacentHallways.clear(); //do not delete hallways owned by board
-
 		_roomAccessedBySecretPassage = nullptr;
 	}
 
@@ -80,9 +89,7 @@ public:
 	bool hasSecretPassage() const;
 	void createSecretPassageTo(Room* destination);
 
-protected:
-	bool areMoreThanTwoHallwaysExpected() const;
-	bool areMoreThanThreeHallwaysExpected() const;
+	void expectHallways(size_t numHallways);
 
 	//--------------------------------------------------------------------------
 	// Additional Member Functions
@@ -90,19 +97,21 @@ protected:
 public:
 	virtual std::ostringstream report() const override;
 
-	virtual std::set<Location*> getMoveOptions() const override;
+	virtual MoveOptionSet getMoveOptions() const override;
 
 	//--------------------------------------------------------------------------
 	// Data Members
 	//--------------------------------------------------------------------------
 	clueless::RoomType _type;
-	std::set<const GamePiece*> _occupants;
+	unsigned int _personOccupants; //bit per PersonType
+	unsigned int _weaponOccupants; //bit per WeaponType
 
-	std::set<Hallway*> _adjacentHallways;
+	size_t _numAdjacentHallways;
+	size_t _numHallwaysExpected; //per board layout
 
 	Room* _roomAccessedBySecretPassage;
 
-	RoomCard* _assocCard;
+	const RoomCard* _assocCard;
 
 }; //end class Room defn
 
@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file SimulationPool.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  1005
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SimulationPool.h"
+
+#include "GameSimulator.h"
+#include "ReplayLogFile.h"
+#include "ReplayLogSink.h"
+#include "TraceEventSink.h"
+#include "TraceWriter.h"
+
+#include <atomic>			//for std::atomic use
+#include <exception>		//for std::exception_ptr use
+#include <memory>			//for std::unique_ptr use
+#include <thread>			//for std::thread use
+#include <vector>			//for std::vector use
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param size_t: number of worker threads (0 for one per hardware thread)
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+SimulationPool::SimulationPool(
+	size_t num_threads) //i - number of worker threads
+	: _numThreads( num_threads )
+{
+	if( 0 == _numThreads )
+	{
+		_numThreads = std::thread::hardware_concurrency();
+	}
+
+	if( 0 == _numThreads ) //hardware concurrency not computable
+	{
+		_numThreads = 1;
+	}
+
+} //end routine extended constructor
+
+
+//------------------------------------------------------------------------------
+// Accessors and Mutators
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns seed for specified game within batch.
+/// \param unsigned long: batch seed
+/// \param unsigned long: zero-based game index within batch
+/// \return unsigned long: 32-bit game seed
+/// \throw None
+/// \note
+/// - Batch seed is scrambled with splitmix64 to pick a starting point; game
+///   index is then added and scrambled with the murmur3 32-bit finalizer.
+///   Both the addition and the finalizer are one-to-one on 32-bit values, so
+///   no two games in a batch of fewer than 2^32 games share a seed.
+////////////////////////////////////////////////////////////////////////////////
+unsigned long
+SimulationPool::deriveGameSeed(
+	unsigned long batch_seed, //i - batch seed
+	unsigned long game_index) //i - zero-based game index within batch
+{
+	//splitmix64 of batch seed
+	unsigned long long base( (unsigned long long)batch_seed + 0x9e3779b97f4a7c15ULL );
+	base = (base ^ (base >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	base = (base ^ (base >> 27)) * 0x94d049bb133111ebULL;
+	base =  base ^ (base >> 31);
+
+	//murmur3 finalizer of offset from starting point
+	unsigned long seed( (unsigned long)((base + game_index) & 0xffffffffUL) );
+	seed = ((seed ^ (seed >> 16)) * 0x85ebca6bUL) & 0xffffffffUL;
+	seed = ((seed ^ (seed >> 13)) * 0xc2b2ae35UL) & 0xffffffffUL;
+	seed =   seed ^ (seed >> 16);
+
+	return seed;
+
+} //end routine deriveGameSeed()
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Plays specified number of games across worker threads.
+/// \param GameSimulator: plays each game
+/// \param unsigned long: number of games to play
+/// \param unsigned long: batch seed
+/// \param ReplayLogWriter: receives every game's replay record (not owned);
+///  nullptr for none
+/// \param TraceWriter: receives spans of games it traces (not owned);
+///  nullptr for none
+/// \return SimulationSummary: statistics over all games
+/// \throw
+/// - first exception raised by any game, after all workers have stopped
+/// \note
+/// - Workers claim blocks of game indices from a shared counter and keep
+///   their own summary; summaries are merged once all workers finish.
+/// - Each worker records its games with its own ReplayLogSink, and times
+///   them with its own TraceEventSink (trace thread id: worker index + 1),
+///   both reused from game to game.
+////////////////////////////////////////////////////////////////////////////////
+SimulationSummary
+SimulationPool::run(
+	const GameSimulator& simulator, //i - plays each game
+	unsigned long num_games, //i - number of games to play
+	unsigned long batch_seed, //i - batch seed
+	ReplayLogWriter* replay_log, //io- receives every game's replay record
+	TraceWriter* trace) //io- receives spans of games it traces
+const
+{
+	std::atomic<unsigned long> next_game_index( 0 );
+	std::atomic<bool> has_failed( false );
+
+	std::vector<SimulationSummary> worker_summaries( _numThreads );
+	std::vector<std::exception_ptr> worker_errors( _numThreads );
+	std::vector<std::thread> workers;
+	workers.reserve( _numThreads );
+
+	for(size_t worker_index(0); worker_index < _numThreads; ++worker_index)
+	{
+		workers.push_back( std::thread( [&, worker_index]()
+		{
+			try
+			{
+				std::unique_ptr<TraceEventSink> tracing( trace
+					? new TraceEventSink( trace, (unsigned int)worker_index + 1 )
+					: nullptr );
+				ReplayLogSink recording( tracing.get() );
+
+				//while more games to claim
+				while( ! has_failed )
+				{
+					unsigned long first_game( next_game_index.fetch_add(GAMES_PER_CLAIM) );
+					if( first_game >= num_games )
+					{
+						break; //all games claimed
+					}
+
+					unsigned long end_game( first_game + GAMES_PER_CLAIM );
+					if( (end_game > num_games) || (end_game < first_game) )
+					{
+						end_game = num_games;
+					}
+
+					for(unsigned long game_index(first_game); game_index < end_game; ++game_index)
+					{
+						const unsigned long game_seed( deriveGameSeed(batch_seed, game_index) );
+
+						const bool is_traced( trace && trace->isGameTraced(game_index) );
+
+						if( ! replay_log && ! is_traced )
+						{
+							worker_summaries[worker_index].recordOutcome(
+								simulator.playGame( game_seed ) );
+							continue;
+						}
+
+						if( is_traced )
+						{
+							tracing->beginGame( game_index );
+						}
+
+						if( ! replay_log )
+						{
+							worker_summaries[worker_index].recordOutcome(
+								simulator.playGame( game_seed, tracing.get() ) );
+							tracing->endGame();
+							continue;
+						}
+
+						recording.beginGame( game_index, game_seed );
+						worker_summaries[worker_index].recordOutcome(
+							simulator.playGame( game_seed, &recording ) );
+						recording.endGame();
+
+						if( is_traced )
+						{
+							tracing->endGame();
+						}
+
+						replay_log->appendGame( recording );
+
+					} //end for (each game claimed)
+
+				} //end while (more games to claim)
+
+				if( tracing )
+				{
+					tracing->flush(); //before pool returns and trace is closed
+				}
+			}
+			catch(...)
+			{
+				worker_errors[worker_index] = std::current_exception();
+				has_failed = true;
+			}
+		} ) );
+
+	} //end for (each worker)
+
+	SimulationSummary summary;
+	for(size_t worker_index(0); worker_index < _numThreads; ++worker_index)
+	{
+		workers[worker_index].join();
+		summary.merge( worker_summaries[worker_index] );
+	}
+
+	for(size_t worker_index(0); worker_index < _numThreads; ++worker_index)
+	{
+		if( worker_errors[worker_index] )
+		{
+			std::rethrow_exception( worker_errors[worker_index] );
+		}
+	}
+
+	return summary;
+
+} //end routine run()
@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file SimulationPool.h
+/// \brief Plays independent games concurrently on a fixed set of worker
+///        threads.
+///
+/// \date   17 Oct 2026  1000
+///
+/// \note
+/// - Each game is identified by its zero-based index within the batch and is
+///   seeded from (batch seed, game index) only, so a batch produces the same
+///   games no matter how many threads play it or which thread plays which
+///   game.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SimulationPool_h
+#define SimulationPool_h
+
+#include "SimulationSummary.h"
+
+#include <stddef.h>		//for size_t use
+
+
+//forward declarations
+class GameSimulator;
+class ReplayLogWriter;
+class TraceWriter;
+
+
+class SimulationPool
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const unsigned long GAMES_PER_CLAIM = 64; //games claimed per visit to shared counter
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	SimulationPool();
+
+public:
+	SimulationPool(size_t numThreads);
+
+	virtual ~SimulationPool()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	size_t getNumThreads() const;
+
+	static unsigned long deriveGameSeed(unsigned long batchSeed, unsigned long gameIndex);
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	SimulationSummary run(const GameSimulator& simulator,
+		unsigned long numGames,
+		unsigned long batchSeed,
+		ReplayLogWriter* replayLog = nullptr,
+		TraceWriter* trace = nullptr) const;
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	size_t _numThreads;
+
+}; //end class SimulationPool defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+SimulationPool::getNumThreads()
+const
+{
+	return _numThreads;
+
+} //end routine getNumThreads()
+
+
+#endif //SimulationPool_h defn
@@ -0,0 +1,746 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file SimulationSummary.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  0920
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SimulationSummary.h"
+
+#include "GameSimulator.h"	//for determineSeatCharacter() use
+
+#include "CluelessEnums.h"	//for translatePersonTypeToText() use
+
+#include <cmath>			//for std::sqrt use
+#include <iomanip>			//for std::setprecision use
+#include <limits>			//for std::numeric_limits use
+#include <string>			//for std::string use
+
+//------------------------------------------------------------------------------
+// Local Helpers
+//------------------------------------------------------------------------------
+static const double Z_95 = 1.959964; //standard normal quantile for 95% interval
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Writes one CSV row: metric, scope, value, and interval if any.
+////////////////////////////////////////////////////////////////////////////////
+static void
+writeCsvRow(
+	std::ostream& csv, //io- CSV report
+	const char* metric, //i - statistic
+	const std::string& scope, //i - what statistic covers
+	double value, //i - value
+	bool has_interval = false, //i - whether interval follows
+	double low = 0.0, //i - 95% interval low end
+	double high = 0.0) //i - 95% interval high end
+{
+	csv << metric << "," << scope << "," << value << ",";
+	if( has_interval )
+	{
+		csv << low << "," << high;
+	}
+	else
+	{
+		csv << ",";
+	}
+	csv << "\n";
+
+} //end routine writeCsvRow()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Writes JSON rate with its 95% interval, e.g. "win_rate": 0.3,
+///  "win_rate_ci95": [0.28, 0.32]
+////////////////////////////////////////////////////////////////////////////////
+static void
+writeJsonRate(
+	std::ostream& json, //io- JSON report
+	const char* name, //i - member name
+	size_t num_successes, //i - e.g. wins
+	size_t num_trials) //i - e.g. games
+{
+	double low( 0.0 );
+	double high( 0.0 );
+	SimulationSummary::calcRateInterval( num_successes, num_trials, &low, &high );
+
+	json << "\"" << name << "\": "
+		<< ((0 < num_trials) ? double(num_successes) / double(num_trials) : 0.0)
+		<< ", \"" << name << "_ci95\": [" << low << ", " << high << "]";
+
+} //end routine writeJsonRate()
+
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Default constructor
+/// \param None
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+SimulationSummary::SimulationSummary()
+	: _numGames( 0 )
+	, _numGamesWon( 0 )
+	, _numGamesAtTurnLimit( 0 )
+	, _numGamesAllFalseAccusers( 0 )
+	, _sumTurnsToWin( 0 )
+	, _sumSquaredTurnsToWin( 0 )
+	, _minTurnsToWin( std::numeric_limits<unsigned int>::max() )
+	, _maxTurnsToWin( 0 )
+	, _numFalseAccusations( 0 )
+	, _numSuggestions( 0 )
+	, _numUnrefutedSuggestions( 0 )
+{
+	for(size_t bin(0); bin < NUM_TURN_BINS; ++bin)
+	{
+		_numGamesWonInTurns[bin] = 0;
+	}
+
+	for(size_t seat(0); seat < GameOutcome::MAX_NUM_SEATS; ++seat)
+	{
+		_numGamesPerSeat[seat] = 0;
+		_numWinsPerSeat[seat] = 0;
+		_numFalseAccusationsPerSeat[seat] = 0;
+	}
+
+	for(size_t character(0); character < NUM_CHARACTERS; ++character)
+	{
+		_numGamesPerCharacter[character] = 0;
+		_numWinsPerCharacter[character] = 0;
+		_numFalseAccusationsPerCharacter[character] = 0;
+	}
+
+} //end routine default constructor
+
+
+//------------------------------------------------------------------------------
+// Accessors and Mutators
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns mean number of turns over games with a winner.
+/// \param None
+/// \return double: mean turns to win (zero when no game won)
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+double
+SimulationSummary::calcMeanTurnsToWin()
+const
+{
+	if( 0 == _numGamesWon )
+	{
+		return 0.0; //nothing to average
+	}
+
+	return( double(_sumTurnsToWin) / double(_numGamesWon) );
+
+} //end routine calcMeanTurnsToWin()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns fraction of games in which specified seat was filled that
+///        were won by that seat.
+/// \param size_t: zero-based seat
+/// \return double: win rate (zero when seat never filled)
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+double
+SimulationSummary::calcSeatWinRate(
+	size_t seat) //i - zero-based seat
+const
+{
+	if( (GameOutcome::MAX_NUM_SEATS <= seat) ||
+		(0 == _numGamesPerSeat[seat]) )
+	{
+		return 0.0; //seat never played
+	}
+
+	return( double(_numWinsPerSeat[seat]) / double(_numGamesPerSeat[seat]) );
+
+} //end routine calcSeatWinRate()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns fraction of games in which specified character was played
+///        that were won by that character.
+/// \param PersonType: character
+/// \return double: win rate (zero when character never played)
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+double
+SimulationSummary::calcCharacterWinRate(
+	clueless::PersonType character) //i - character
+const
+{
+	if( (NUM_CHARACTERS <= size_t(character)) ||
+		(0 == _numGamesPerCharacter[character]) )
+	{
+		return 0.0; //character never played
+	}
+
+	return( double(_numWinsPerCharacter[character]) / double(_numGamesPerCharacter[character]) );
+
+} //end routine calcCharacterWinRate()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns 95% confidence interval of mean turns to win.
+/// \param double: interval low end
+/// \param double: interval high end
+/// \return None
+/// \throw None
+/// \note
+/// - Normal approximation from sample variance; interval is the mean alone
+///   when fewer than two games won.
+////////////////////////////////////////////////////////////////////////////////
+void
+SimulationSummary::calcTurnsToWinInterval(
+	double* low, // o- interval low end
+	double* high) // o- interval high end
+const
+{
+	const double mean( calcMeanTurnsToWin() );
+	*low = mean;
+	*high = mean;
+
+	if( 2 > _numGamesWon )
+	{
+		return; //no spread to estimate
+	}
+
+	const double num_won( (double)_numGamesWon );
+	double variance( (double(_sumSquaredTurnsToWin) - num_won * mean * mean) / (num_won - 1.0) );
+	if( 0.0 > variance )
+	{
+		variance = 0.0; //rounding
+	}
+
+	const double half_width( Z_95 * std::sqrt(variance / num_won) );
+	*low = mean - half_width;
+	*high = mean + half_width;
+
+} //end routine calcTurnsToWinInterval()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns 95% confidence interval of a rate (e.g. wins per game).
+/// \param size_t: number of successes (e.g. wins)
+/// \param size_t: number of trials (e.g. games)
+/// \param double: interval low end
+/// \param double: interval high end
+/// \return None
+/// \throw None
+/// \note
+/// - Wilson score interval: stays within [0, 1] and is sensible for rates
+///   near 0 or 1 and for few trials; [0, 1] when no trials.
+////////////////////////////////////////////////////////////////////////////////
+void
+SimulationSummary::calcRateInterval(
+	size_t num_successes, //i - number of successes
+	size_t num_trials, //i - number of trials
+	double* low, // o- interval low end
+	double* high) // o- interval high end
+{
+	*low = 0.0;
+	*high = 1.0;
+
+	if( 0 == num_trials )
+	{
+		return; //nothing known
+	}
+
+	const double trials( (double)num_trials );
+	const double rate( double(num_successes) / trials );
+	const double z_squared( Z_95 * Z_95 );
+
+	const double denominator( 1.0 + z_squared / trials );
+	const double centre( (rate + z_squared / (2.0 * trials)) / denominator );
+	const double half_width( Z_95 *
+		std::sqrt(rate * (1.0 - rate) / trials + z_squared / (4.0 * trials * trials)) /
+		denominator );
+
+	*low = (centre - half_width > 0.0) ? centre - half_width : 0.0;
+	*high = (centre + half_width < 1.0) ? centre + half_width : 1.0;
+
+} //end routine calcRateInterval()
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Folds specified game outcome into running statistics.
+/// \param GameOutcome: outcome of one game
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+SimulationSummary::recordOutcome(
+	const GameOutcome& outcome) //i - outcome of one game
+{
+	++_numGames;
+
+	if( outcome.hasWinner() )
+	{
+		++_numGamesWon;
+		++_numWinsPerSeat[outcome._winnerSeat];
+
+		_sumTurnsToWin += outcome._numTurnsPlayed;
+		_sumSquaredTurnsToWin +=
+			(unsigned long long)outcome._numTurnsPlayed * outcome._numTurnsPlayed;
+		++_numGamesWonInTurns[(outcome._numTurnsPlayed < NUM_TURN_BINS)
+			? outcome._numTurnsPlayed
+			: NUM_TURN_BINS - 1];
+
+		if( size_t(outcome._winnerCharacter) < NUM_CHARACTERS )
+		{
+			++_numWinsPerCharacter[outcome._winnerCharacter];
+		}
+
+		if( outcome._numTurnsPlayed < _minTurnsToWin )
+		{
+			_minTurnsToWin = outcome._numTurnsPlayed;
+		}
+
+		if( outcome._numTurnsPlayed > _maxTurnsToWin )
+		{
+			_maxTurnsToWin = outcome._numTurnsPlayed;
+		}
+	}
+	else if( outcome._reachedTurnLimit )
+	{
+		++_numGamesAtTurnLimit;
+	}
+	else
+	{
+		++_numGamesAllFalseAccusers;
+	}
+
+	_numFalseAccusations += outcome._numFalseAccusers;
+	_numSuggestions += outcome._numSuggestions;
+	_numUnrefutedSuggestions += outcome._numUnrefutedSuggestions;
+
+	for(size_t seat(0);
+		(seat < outcome._numPlayers) && (seat < GameOutcome::MAX_NUM_SEATS);
+		++seat)
+	{
+		++_numGamesPerSeat[seat];
+
+		if( outcome._isFalseAccuser[seat] )
+		{
+			++_numFalseAccusationsPerSeat[seat];
+		}
+
+		const size_t character( outcome._seatCharacters[seat] );
+		if( character < NUM_CHARACTERS )
+		{
+			++_numGamesPerCharacter[character];
+
+			if( outcome._isFalseAccuser[seat] )
+			{
+				++_numFalseAccusationsPerCharacter[character];
+			}
+		}
+
+	} //end for (each seat)
+
+} //end routine recordOutcome()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Folds statistics gathered by another summary into this one.
+/// \param SimulationSummary: statistics to fold in
+/// \return None
+/// \throw None
+/// \note
+/// - Result does not depend on order of merging, so per-thread summaries
+///   combine into same totals regardless of which thread played which game.
+////////////////////////////////////////////////////////////////////////////////
+void
+SimulationSummary::merge(
+	const SimulationSummary& other) //i - statistics to fold in
+{
+	_numGames += other._numGames;
+	_numGamesWon += other._numGamesWon;
+	_numGamesAtTurnLimit += other._numGamesAtTurnLimit;
+	_numGamesAllFalseAccusers += other._numGamesAllFalseAccusers;
+
+	_sumTurnsToWin += other._sumTurnsToWin;
+	_sumSquaredTurnsToWin += other._sumSquaredTurnsToWin;
+
+	if( other._minTurnsToWin < _minTurnsToWin )
+	{
+		_minTurnsToWin = other._minTurnsToWin;
+	}
+
+	if( other._maxTurnsToWin > _maxTurnsToWin )
+	{
+		_maxTurnsToWin = other._maxTurnsToWin;
+	}
+
+	for(size_t bin(0); bin < NUM_TURN_BINS; ++bin)
+	{
+		_numGamesWonInTurns[bin] += other._numGamesWonInTurns[bin];
+	}
+
+	_numFalseAccusations += other._numFalseAccusations;
+	_numSuggestions += other._numSuggestions;
+	_numUnrefutedSuggestions += other._numUnrefutedSuggestions;
+
+	for(size_t seat(0); seat < GameOutcome::MAX_NUM_SEATS; ++seat)
+	{
+		_numGamesPerSeat[seat] += other._numGamesPerSeat[seat];
+		_numWinsPerSeat[seat] += other._numWinsPerSeat[seat];
+		_numFalseAccusationsPerSeat[seat] += other._numFalseAccusationsPerSeat[seat];
+	}
+
+	for(size_t character(0); character < NUM_CHARACTERS; ++character)
+	{
+		_numGamesPerCharacter[character] += other._numGamesPerCharacter[character];
+		_numWinsPerCharacter[character] += other._numWinsPerCharacter[character];
+		_numFalseAccusationsPerCharacter[character] += other._numFalseAccusationsPerCharacter[character];
+	}
+
+} //end routine merge()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Generates summary report of all recorded games.
+/// \param double: wall-clock seconds spent playing games
+/// \return ostringstream: report text
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+std::ostringstream
+SimulationSummary::report(
+	double elapsed_seconds) //i - wall-clock seconds
+const
+{
+	std::ostringstream report;
+	report << std::fixed << std::setprecision( 3 );
+
+	report << "Games played:           " << _numGames << "\n"
+		<< "  won:                  " << _numGamesWon << "\n"
+		<< "  abandoned (turn cap): " << _numGamesAtTurnLimit << "\n"
+		<< "  all false accusers:   " << _numGamesAllFalseAccusers << "\n";
+
+	report << "Turns to win\n";
+	if( 0 < _numGamesWon )
+	{
+		report << "  mean: " << calcMeanTurnsToWin() << "\n"
+			<< "  min:  " << _minTurnsToWin << "\n"
+			<< "  max:  " << _maxTurnsToWin << "\n";
+	}
+	else
+	{
+		report << "  (no game won)\n";
+	}
+
+	report << "False accusations:      " << _numFalseAccusations;
+	if( 0 < _numGames )
+	{
+		report << " (" << (double(_numFalseAccusations) / double(_numGames))
+			<< " per game)";
+	}
+	report << "\n";
+
+	report << "Per seat\n"
+		<< "  seat  character          games     wins  win rate  false accusations\n";
+	for(size_t seat(0); seat < GameOutcome::MAX_NUM_SEATS; ++seat)
+	{
+		if( 0 == _numGamesPerSeat[seat] )
+		{
+			continue; //seat never filled
+		}
+
+		report << "  " << std::setw( 4 ) << (seat + 1)
+			<< "  " << std::left << std::setw( 17 )
+			<< clueless::translatePersonTypeToText(
+				GameSimulator::determineSeatCharacter( seat ) )
+			<< std::right
+			<< "  " << std::setw( 7 ) << _numGamesPerSeat[seat]
+			<< "  " << std::setw( 7 ) << _numWinsPerSeat[seat]
+			<< "  " << std::setw( 8 ) << calcSeatWinRate( seat )
+			<< "  " << std::setw( 17 ) << _numFalseAccusationsPerSeat[seat]
+			<< "\n";
+
+	} //end for (each seat)
+
+	report << "Elapsed:                " << elapsed_seconds << " s";
+	if( 0.0 < elapsed_seconds )
+	{
+		report << " (" << std::setprecision( 1 )
+			<< (double(_numGames) / elapsed_seconds) << " games/s)";
+	}
+	report << "\n";
+
+	return report;
+
+} //end routine report()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Generates report of all recorded games as CSV.
+/// \param double: wall-clock seconds spent playing games
+/// \return ostringstream: report text
+/// \throw None
+/// \note
+/// - Header row, then one row per statistic: metric, scope ("all", a turn
+///   count, "seat N", or a character), value, and 95% interval low and high
+///   ends where the value is a rate or mean (empty otherwise).
+/// - Rows for seats and characters never played are left out.
+////////////////////////////////////////////////////////////////////////////////
+std::ostringstream
+SimulationSummary::reportCsv(
+	double elapsed_seconds) //i - wall-clock seconds
+const
+{
+	std::ostringstream csv;
+	csv << std::setprecision( 10 );
+
+	csv << "metric,scope,value,ci95_low,ci95_high\n";
+
+	writeCsvRow( csv, "games", "all", double(_numGames) );
+	writeCsvRow( csv, "games_won", "all", double(_numGamesWon) );
+	writeCsvRow( csv, "games_at_turn_limit", "all", double(_numGamesAtTurnLimit) );
+	writeCsvRow( csv, "games_all_false_accusers", "all", double(_numGamesAllFalseAccusers) );
+
+	double low( 0.0 );
+	double high( 0.0 );
+
+	//--------------------------------------------------------------------------
+	// turns to win
+	//--------------------------------------------------------------------------
+	if( 0 < _numGamesWon )
+	{
+		calcTurnsToWinInterval( &low, &high );
+		writeCsvRow( csv, "turns_to_win_mean", "all", calcMeanTurnsToWin(), true, low, high );
+		writeCsvRow( csv, "turns_to_win_min", "all", double(_minTurnsToWin) );
+		writeCsvRow( csv, "turns_to_win_max", "all", double(_maxTurnsToWin) );
+	}
+
+	for(size_t bin(0); bin < NUM_TURN_BINS; ++bin)
+	{
+		if( 0 == _numGamesWonInTurns[bin] )
+		{
+			continue;
+		}
+
+		std::ostringstream turns;
+		turns << bin << ((NUM_TURN_BINS - 1 == bin) ? "+" : "");
+		writeCsvRow( csv, "games_won_in_turns", turns.str(), double(_numGamesWonInTurns[bin]) );
+
+	} //end for (each turns-to-win bin)
+
+	//--------------------------------------------------------------------------
+	// suggestions and accusations
+	//--------------------------------------------------------------------------
+	writeCsvRow( csv, "suggestions", "all", double(_numSuggestions) );
+	if( 0 < _numGames )
+	{
+		writeCsvRow( csv, "suggestions_per_game", "all", double(_numSuggestions) / double(_numGames) );
+	}
+
+	if( 0 < _numSuggestions )
+	{
+		calcRateInterval( _numUnrefutedSuggestions, _numSuggestions, &low, &high );
+		writeCsvRow( csv, "unrefuted_suggestion_rate", "all",
+			double(_numUnrefutedSuggestions) / double(_numSuggestions), true, low, high );
+	}
+
+	writeCsvRow( csv, "false_accusations", "all", double(_numFalseAccusations) );
+	if( 0 < _numGames )
+	{
+		writeCsvRow( csv, "false_accusations_per_game", "all",
+			double(_numFalseAccusations) / double(_numGames) );
+	}
+
+	//--------------------------------------------------------------------------
+	// seats and characters
+	//--------------------------------------------------------------------------
+	for(size_t seat(0); seat < GameOutcome::MAX_NUM_SEATS; ++seat)
+	{
+		if( 0 == _numGamesPerSeat[seat] )
+		{
+			continue; //seat never filled
+		}
+
+		std::ostringstream scope;
+		scope << "seat " << (seat + 1);
+
+		writeCsvRow( csv, "games", scope.str(), double(_numGamesPerSeat[seat]) );
+		writeCsvRow( csv, "wins", scope.str(), double(_numWinsPerSeat[seat]) );
+
+		calcRateInterval( _numWinsPerSeat[seat], _numGamesPerSeat[seat], &low, &high );
+		writeCsvRow( csv, "win_rate", scope.str(), calcSeatWinRate(seat), true, low, high );
+
+		calcRateInterval( _numFalseAccusationsPerSeat[seat], _numGamesPerSeat[seat], &low, &high );
+		writeCsvRow( csv, "false_accusation_rate", scope.str(),
+			double(_numFalseAccusationsPerSeat[seat]) / double(_numGamesPerSeat[seat]), true, low, high );
+
+	} //end for (each seat)
+
+	for(size_t character(clueless::MISS_SCARLET); character < NUM_CHARACTERS; ++character)
+	{
+		if( 0 == _numGamesPerCharacter[character] )
+		{
+			continue; //character never played
+		}
+
+		const std::string scope( clueless::translatePersonTypeToText(clueless::PersonType(character)) );
+
+		writeCsvRow( csv, "games", scope, double(_numGamesPerCharacter[character]) );
+		writeCsvRow( csv, "wins", scope, double(_numWinsPerCharacter[character]) );
+
+		calcRateInterval( _numWinsPerCharacter[character], _numGamesPerCharacter[character], &low, &high );
+		writeCsvRow( csv, "win_rate", scope,
+			calcCharacterWinRate(clueless::PersonType(character)), true, low, high );
+
+		calcRateInterval( _numFalseAccusationsPerCharacter[character], _numGamesPerCharacter[character], &low, &high );
+		writeCsvRow( csv, "false_accusation_rate", scope,
+			double(_numFalseAccusationsPerCharacter[character]) / double(_numGamesPerCharacter[character]),
+			true, low, high );
+
+	} //end for (each character)
+
+	writeCsvRow( csv, "elapsed_seconds", "all", elapsed_seconds );
+
+	return csv;
+
+} //end routine reportCsv()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Generates report of all recorded games as JSON.
+/// \param double: wall-clock seconds spent playing games
+/// \return ostringstream: report text
+/// \throw None
+/// \note
+/// - One object; rates and mean turns to win have a "_ci95" [low, high]
+///   member alongside.  Seats and characters never played are left out.
+////////////////////////////////////////////////////////////////////////////////
+std::ostringstream
+SimulationSummary::reportJson(
+	double elapsed_seconds) //i - wall-clock seconds
+const
+{
+	std::ostringstream json;
+	json << std::setprecision( 10 );
+
+	json << "{\n"
+		<< "  \"games\": " << _numGames << ",\n"
+		<< "  \"games_won\": " << _numGamesWon << ",\n"
+		<< "  \"games_at_turn_limit\": " << _numGamesAtTurnLimit << ",\n"
+		<< "  \"games_all_false_accusers\": " << _numGamesAllFalseAccusers << ",\n";
+
+	//--------------------------------------------------------------------------
+	// turns to win
+	//--------------------------------------------------------------------------
+	double low( 0.0 );
+	double high( 0.0 );
+	calcTurnsToWinInterval( &low, &high );
+
+	json << "  \"turns_to_win\": {\"mean\": " << calcMeanTurnsToWin()
+		<< ", \"mean_ci95\": [" << low << ", " << high << "]"
+		<< ", \"min\": " << ((0 < _numGamesWon) ? _minTurnsToWin : 0)
+		<< ", \"max\": " << _maxTurnsToWin
+		<< ",\n    \"histogram\": [";
+
+	bool is_first( true );
+	for(size_t bin(0); bin < NUM_TURN_BINS; ++bin)
+	{
+		if( 0 == _numGamesWonInTurns[bin] )
+		{
+			continue;
+		}
+
+		json << (is_first ? "" : ", ")
+			<< "{\"turns\": " << bin
+			<< ((NUM_TURN_BINS - 1 == bin) ? ", \"or_more\": true" : "")
+			<< ", \"games\": " << _numGamesWonInTurns[bin] << "}";
+		is_first = false;
+
+	} //end for (each turns-to-win bin)
+	json << "]},\n";
+
+	//--------------------------------------------------------------------------
+	// suggestions and accusations
+	//--------------------------------------------------------------------------
+	json << "  \"suggestions\": {\"total\": " << _numSuggestions
+		<< ", \"per_game\": " << ((0 < _numGames) ? double(_numSuggestions) / double(_numGames) : 0.0)
+		<< ", \"unrefuted\": " << _numUnrefutedSuggestions << ", ";
+	writeJsonRate( json, "unrefuted_rate", _numUnrefutedSuggestions, _numSuggestions );
+	json << "},\n";
+
+	json << "  \"false_accusations\": {\"total\": " << _numFalseAccusations
+		<< ", \"per_game\": " << ((0 < _numGames) ? double(_numFalseAccusations) / double(_numGames) : 0.0)
+		<< "},\n";
+
+	//--------------------------------------------------------------------------
+	// seats and characters
+	//--------------------------------------------------------------------------
+	json << "  \"seats\": [";
+	is_first = true;
+	for(size_t seat(0); seat < GameOutcome::MAX_NUM_SEATS; ++seat)
+	{
+		if( 0 == _numGamesPerSeat[seat] )
+		{
+			continue; //seat never filled
+		}
+
+		json << (is_first ? "\n" : ",\n")
+			<< "    {\"seat\": " << (seat + 1)
+			<< ", \"games\": " << _numGamesPerSeat[seat]
+			<< ", \"wins\": " << _numWinsPerSeat[seat] << ", ";
+		writeJsonRate( json, "win_rate", _numWinsPerSeat[seat], _numGamesPerSeat[seat] );
+		json << ", ";
+		writeJsonRate( json, "false_accusation_rate", _numFalseAccusationsPerSeat[seat], _numGamesPerSeat[seat] );
+		json << "}";
+		is_first = false;
+
+	} //end for (each seat)
+	json << "\n  ],\n";
+
+	json << "  \"characters\": [";
+	is_first = true;
+	for(size_t character(clueless::MISS_SCARLET); character < NUM_CHARACTERS; ++character)
+	{
+		if( 0 == _numGamesPerCharacter[character] )
+		{
+			continue; //character never played
+		}
+
+		json << (is_first ? "\n" : ",\n")
+			<< "    {\"character\": \""
+			<< clueless::translatePersonTypeToText( clueless::PersonType(character) ) << "\""
+			<< ", \"games\": " << _numGamesPerCharacter[character]
+			<< ", \"wins\": " << _numWinsPerCharacter[character] << ", ";
+		writeJsonRate( json, "win_rate", _numWinsPerCharacter[character], _numGamesPerCharacter[character] );
+		json << ", ";
+		writeJsonRate( json, "false_accusation_rate", _numFalseAccusationsPerCharacter[character], _numGamesPerCharacter[character] );
+		json << "}";
+		is_first = false;
+
+	} //end for (each character)
+	json << "\n  ],\n";
+
+	json << "  \"elapsed_seconds\": " << elapsed_seconds << "\n"
+		<< "}\n";
+
+	return json;
+
+} //end routine reportJson()
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file SimulationSummary.h
+/// \brief Accumulates outcomes of many simulated games into summary statistics.
+///
+/// \date   17 Oct 2026  0915
+///
+/// \note
+/// - Memory is fixed whatever the number of games: counts, sums, and a
+///   turns-to-win histogram of NUM_TURN_BINS bins.  Each worker thread keeps
+///   its own summary (a shard), merged once the batch ends.
+/// - Besides the console report, statistics are written as CSV (one row per
+///   statistic) or JSON for dashboards; rates come with 95% confidence
+///   intervals.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SimulationSummary_h
+#define SimulationSummary_h
+
+#include "GameOutcome.h"
+
+#include "CluelessEnums.h"	//for PersonType use
+
+#include <sstream>		//for std::ostringstream use
+#include <stddef.h>		//for size_t use
+
+
+class SimulationSummary
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const size_t NUM_TURN_BINS = 64; //wins in NUM_TURN_BINS - 1 turns or more share last bin
+	static const size_t NUM_CHARACTERS = clueless::PROFESSOR_PLUM + 1; //indexed by PersonType
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+public:
+	/// \brief Default constructor
+	SimulationSummary();
+
+	virtual ~SimulationSummary()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	size_t getNumGames() const;
+	size_t getNumGamesWon() const;
+
+	double calcMeanTurnsToWin() const;
+	double calcSeatWinRate(size_t seat) const;
+	double calcCharacterWinRate(clueless::PersonType character) const;
+
+	void calcTurnsToWinInterval(double* low, double* high) const;
+	static void calcRateInterval(size_t numSuccesses, size_t numTrials, double* low, double* high);
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	void recordOutcome(const GameOutcome& outcome);
+	void merge(const SimulationSummary& other);
+
+	std::ostringstream report(double elapsedSeconds) const;
+	std::ostringstream reportCsv(double elapsedSeconds) const;
+	std::ostringstream reportJson(double elapsedSeconds) const;
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	size_t _numGames;
+	size_t _numGamesWon;
+	size_t _numGamesAtTurnLimit; //abandoned at turn cap
+	size_t _numGamesAllFalseAccusers; //no player left to win
+
+	unsigned long long _sumTurnsToWin; //over games with winner
+	unsigned long long _sumSquaredTurnsToWin;
+	unsigned int _minTurnsToWin;
+	unsigned int _maxTurnsToWin;
+	size_t _numGamesWonInTurns[NUM_TURN_BINS]; //by turns to win
+
+	size_t _numFalseAccusations;
+	size_t _numSuggestions;
+	size_t _numUnrefutedSuggestions;
+
+	size_t _numGamesPerSeat[GameOutcome::MAX_NUM_SEATS]; //games seat was filled
+	size_t _numWinsPerSeat[GameOutcome::MAX_NUM_SEATS];
+	size_t _numFalseAccusationsPerSeat[GameOutcome::MAX_NUM_SEATS];
+
+	size_t _numGamesPerCharacter[NUM_CHARACTERS]; //games character was played
+	size_t _numWinsPerCharacter[NUM_CHARACTERS];
+	size_t _numFalseAccusationsPerCharacter[NUM_CHARACTERS];
+
+}; //end class SimulationSummary defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+SimulationSummary::getNumGames()
+const
+{
+	return _numGames;
+
+} //end routine getNumGames()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+SimulationSummary::getNumGamesWon()
+const
+{
+	return _numGamesWon;
+
+} //end routine getNumGamesWon()
+
+
+#endif //SimulationSummary_h defn
@@ -9,7 +9,9 @@
 ///
 /// \date   26 Feb 2019  1223
 ///
-/// \note None
+/// \note
+/// - Small value type (one byte per element); copying and comparing a
+///   suggestion or accusation never allocates.
 ///
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -29,7 +31,7 @@ struct SolutionCardSet
 	//--------------------------------------------------------------------------
 	// Constructors / Destructor
 	//--------------------------------------------------------------------------
-protected:
+public:
 	SolutionCardSet()
 		: _person( clueless::UNKNOWN_PERSON )
 		, _weapon( clueless::UNKNOWN_WEAPON )
@@ -37,25 +39,24 @@ protected:
 	{
 	}
 
-public:
 	SolutionCardSet(clueless::PersonType person, clueless::WeaponType weapon, clueless::RoomType room)
-		: _person( person )
-		, _weapon( weapon )
-		, _room( room )
+		: _person( (unsigned char)person )
+		, _weapon( (unsigned char)weapon )
+		, _room( (unsigned char)room )
 	{
 	}
 
 	SolutionCardSet(const PersonCard& person, const WeaponCard& weapon, const RoomCard& room)
-		: _person( person )
-		, _weapon( weapon )
-		, _room( room )
+		: _person( (unsigned char)person._person )
+		, _weapon( (unsigned char)weapon._weapon )
+		, _room( (unsigned char)room._room )
 	{
 	}
 
 	//--------------------------------------------------------------------------
 	// Overloaded Operators
 	//--------------------------------------------------------------------------
-	virtual bool
+	bool
 	operator==(const SolutionCardSet& other)
 	const
 	{
@@ -72,6 +73,10 @@ public:
 	clueless::WeaponType getWeaponType() const;
 	clueless::RoomType getRoomType() const;
 
+	const PersonCard* getPersonCard() const;
+	const WeaponCard* getWeaponCard() const;
+	const RoomCard* getRoomCard() const;
+
 	////////////////////////////////////////////////////////////////////////////
 	/// \brief
 	////////////////////////////////////////////////////////////////////////////
@@ -85,15 +90,15 @@ public:
 		switch( card->_type )
 		{
 		case clueless::PERSON:
-			does_match = (_person._person == ((const PersonCard*)card)->_person );
+			does_match = (_person == ((const PersonCard*)card)->_person );
 			break;
 
 		case clueless::WEAPON:
-			does_match = (_weapon._weapon == ((const WeaponCard*)card)->_weapon );
+			does_match = (_weapon == ((const WeaponCard*)card)->_weapon );
 			break;
 
 		case clueless::ROOM:
-			does_match = (_room._room == ((const RoomCard*)card)->_room );
+			does_match = (_room == ((const RoomCard*)card)->_room );
 			break;
 
 		default:
@@ -107,15 +112,15 @@ public:
 	//--------------------------------------------------------------------------
 	// Additional Member Functions
 	//--------------------------------------------------------------------------
-	virtual std::ostringstream
+	std::ostringstream
 	report()
 	const
 	{
 		std::ostringstream report;
 		report
-			<< _person.getName()
-			<< " with the " << _weapon.getName()
-			<< " in the " << _room.getName();
+			<< clueless::translatePersonTypeToText( getPersonType() )
+			<< " with the " << clueless::translateWeaponTypeToText( getWeaponType() )
+			<< " in the " << clueless::translateRoomTypeToText( getRoomType() );
 
 		return report;
 	}
@@ -124,9 +129,9 @@ public:
 	// Data Members
 	//--------------------------------------------------------------------------
 public:
-	PersonCard _person;
-	WeaponCard _weapon;
-	RoomCard   _room;
+	unsigned char _person; //PersonType
+	unsigned char _weapon; //WeaponType
+	unsigned char _room;   //RoomType
 
 }; //end struct SolutionCardSet defn
 
@@ -136,7 +141,7 @@ inline clueless::PersonType
 SolutionCardSet::getPersonType()
 const
 {
-	return _person._person;
+	return clueless::PersonType( _person );
 
 } //end routine getPersonType()
 
@@ -145,7 +150,7 @@ inline clueless::WeaponType
 SolutionCardSet::getWeaponType()
 const
 {
-	return _weapon._weapon;
+	return clueless::WeaponType( _weapon );
 
 } //end routine getWeaponType()
 
@@ -154,9 +159,39 @@ inline clueless::RoomType
 SolutionCardSet::getRoomType()
 const
 {
-	return _room._room;
+	return clueless::RoomType( _room );
 
 } //end routine getRoomType()
 
 
+/// \note null if person unknown
+inline const PersonCard*
+SolutionCardSet::getPersonCard()
+const
+{
+	return( (clueless::UNKNOWN_PERSON != _person) ? PersonCard::fetch(getPersonType()) : nullptr );
+
+} //end routine getPersonCard()
+
+
+/// \note null if weapon unknown
+inline const WeaponCard*
+SolutionCardSet::getWeaponCard()
+const
+{
+	return( (clueless::UNKNOWN_WEAPON != _weapon) ? WeaponCard::fetch(getWeaponType()) : nullptr );
+
+} //end routine getWeaponCard()
+
+
+/// \note null if room unknown
+inline const RoomCard*
+SolutionCardSet::getRoomCard()
+const
+{
+	return( (clueless::UNKNOWN_ROOM != _room) ? RoomCard::fetch(getRoomType()) : nullptr );
+
+} //end routine getRoomCard()
+
+
 #endif //SolutionCardSet_h defn
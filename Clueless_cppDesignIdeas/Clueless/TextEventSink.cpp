@@ -0,0 +1,368 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file TextEventSink.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  1115
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "TextEventSink.h"
+
+#include "Board.h"
+#include "Card.h"
+#include "Location.h"
+#include "Player.h"
+#include "SolutionCardSet.h"
+
+#include <sstream>			//for std::ostringstream use
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param ostream: destination for narration
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+TextEventSink::TextEventSink(
+	std::ostream& destination) //i - destination for narration
+	: _destination( destination )
+{
+	_buffer.reserve( 2 * FLUSH_THRESHOLD );
+
+} //end routine extended constructor
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Destructor
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - Writes any buffered text to destination.
+////////////////////////////////////////////////////////////////////////////////
+TextEventSink::~TextEventSink()
+{
+	flush();
+
+} //end routine destructor
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Writes buffered text to destination.
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - Call before writing to destination directly so text stays in order.
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::flush()
+{
+	if( ! _buffer.empty() )
+	{
+		_destination.write( _buffer.data(), _buffer.size() );
+		_destination.flush();
+
+		_buffer.clear();
+	}
+
+} //end routine flush()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::flushIfFull()
+{
+	if( FLUSH_THRESHOLD <= _buffer.size() )
+	{
+		flush();
+	}
+
+} //end routine flushIfFull()
+
+
+//------------------------------------------------------------------------------
+// Game Events
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Narrates Case File, each player's starting position and hand, and
+///        board layout.
+/// \param list<Player>: all players
+/// \param Board: game board
+/// \param SolutionCardSet: Case File
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::gameSetUp(
+	const std::list<Player*>& players, //i - all players
+	const Board& board, //i - game board
+	const SolutionCardSet& case_file) //i - Case File
+{
+	_buffer += "Case File... ";
+	_buffer += case_file.report().str();
+	_buffer += "\n\n";
+
+	std::list<Player*>::const_iterator player_iter( players.begin() );
+	for(player_iter  = players.begin();
+		player_iter != players.end();
+		++player_iter )
+	{
+		_buffer += (*player_iter)->report().str();
+
+	} //end for (each player)
+
+	_buffer += board.report().str();
+	_buffer += "\n";
+
+	flushIfFull();
+
+} //end routine gameSetUp()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::turnStarted(
+	const Player* player) //i - turn taker
+{
+	_buffer += "\n";
+	_buffer += player->getName();
+	_buffer += "'s Turn (";
+	_buffer += player->getCharacterName();
+	_buffer += ")...\n";
+
+	flushIfFull();
+
+} //end routine turnStarted()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::turnSkipped(
+	const Player*) //i - false accuser
+{
+	_buffer += "  has made false accusation => skip turn\n";
+
+	flushIfFull();
+
+} //end routine turnSkipped()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::noPermissibleMoves(
+	const Player*) //i - turn taker
+{
+	_buffer += "no permissible moves\n";
+
+	flushIfFull();
+
+} //end routine noPermissibleMoves()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::stayInRoomAllowed(
+	const Player*) //i - turn taker
+{
+	_buffer += "  allow to stay in room and make suggestion\n";
+
+	flushIfFull();
+
+} //end routine stayInRoomAllowed()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::turnOptionChosen(
+	const Player* player, //i - turn taker
+	clueless::TurnOptionType choice) //i - turn option chosen
+{
+	_buffer += "  ";
+	_buffer += player->getName();
+	_buffer += " chooses to ";
+	_buffer += clueless::translateTurnOptionTypeToText( choice );
+	_buffer += "\n";
+
+	flushIfFull();
+
+} //end routine turnOptionChosen()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::playerMoved(
+	const Player*, //i - turn taker
+	const Location* destination, //i - new location
+	bool was_random_choice) //i - whether game chose among move options
+{
+	if( was_random_choice )
+	{
+		_buffer += "  random move choice... ";
+	}
+
+	_buffer += "  move to ";
+	_buffer += destination->getName();
+	_buffer += "\n";
+
+	flushIfFull();
+
+} //end routine playerMoved()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::suggestionMade(
+	const Player* suggestor, //i - suggestor
+	const SolutionCardSet& suggestion) //i - suggestion
+{
+	_buffer += "  suggestion... ";
+	_buffer += suggestion.report().str();
+	_buffer += "\n";
+
+	_buffer += "\nNotice to All Players...\n";
+	_buffer += suggestor->getCharacterName();
+	_buffer += " made a Suggestion\n";
+
+	flushIfFull();
+
+} //end routine suggestionMade()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::personTokenMovedForSuggestion(
+	clueless::PersonType person, //i - person token moved
+	clueless::RoomType room) //i - new location
+{
+	_buffer += "\nNotice to All Players...\n";
+	_buffer += clueless::translatePersonTypeToText( person );
+	_buffer += " moved to ";
+	_buffer += clueless::translateRoomTypeToText( room );
+	_buffer += " in support of suggestion\n";
+
+	flushIfFull();
+
+} //end routine personTokenMovedForSuggestion()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::weaponTokenMovedForSuggestion(
+	clueless::WeaponType weapon, //i - weapon token moved
+	clueless::RoomType room) //i - new location
+{
+	_buffer += "\nNotice to All Players...\n";
+	_buffer += clueless::translateWeaponTypeToText( weapon );
+	_buffer += " moved to ";
+	_buffer += clueless::translateRoomTypeToText( room );
+	_buffer += " in support of suggestion\n";
+
+	flushIfFull();
+
+} //end routine weaponTokenMovedForSuggestion()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::counterEvidenceShown(
+	const Player* refuter, //i - player showing card
+	const Player* suggestor, //i - player shown card
+	const Card* counter_evidence) //i - card shown
+{
+	_buffer += "  ";
+	_buffer += refuter->getName();
+	_buffer += " showed counter-evidence card \'";
+	_buffer += counter_evidence->getName();
+	_buffer += "\' to ";
+	_buffer += suggestor->getName();
+	_buffer += "\n";
+
+	flushIfFull();
+
+} //end routine counterEvidenceShown()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::suggestionRefuted(
+	clueless::PersonType refuter) //i - refuter's character
+{
+	_buffer += "\nNotice to All Players...\n";
+	_buffer += clueless::translatePersonTypeToText( refuter );
+	_buffer += " refuted Suggestion\n";
+
+	flushIfFull();
+
+} //end routine suggestionRefuted()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::suggestionUnrefuted(
+	const Player* suggestor) //i - suggestor
+{
+	_buffer += "\nNotice to All Players...\n";
+	_buffer += suggestor->getCharacterName();
+	_buffer += "\'s Suggestion is unrefuted\n";
+
+	flushIfFull();
+
+} //end routine suggestionUnrefuted()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \note Nothing to narrate.
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::notebooksUpdated(
+	const Player*) //i - suggestor
+{
+} //end routine notebooksUpdated()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::gameWon(
+	const Player* winner, //i - game winner
+	const SolutionCardSet& case_file) //i - Case File
+{
+	_buffer += "\n*** ";
+	_buffer += winner->getName();
+	_buffer += " WINS game\n";
+	_buffer += "solution: ";
+	_buffer += case_file.report().str();
+
+	flushIfFull();
+
+} //end routine gameWon()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TextEventSink::falseAccusationMade(
+	const Player* false_accuser, //i - false accuser
+	const SolutionCardSet&) //i - accusation (not narrated; kept from other players)
+{
+	_buffer += "\n*** ";
+	_buffer += false_accuser->getName();
+	_buffer += " has made a false accusation\n";
+	_buffer += "    eliminated from active game play\n";
+
+	flushIfFull();
+
+} //end routine falseAccusationMade()
@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file TextEventSink.h
+/// \brief Narrates game play events as human-readable text.
+///
+/// \date   17 Oct 2026  1110
+///
+/// \note
+/// - Text accumulates in a buffer and is written to the destination stream
+///   in blocks, when flushed, and on destruction.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TextEventSink_h
+#define TextEventSink_h
+
+#include "GameEventSink.h"
+
+#include <ostream>	//for std::ostream use
+#include <string>	//for std::string use
+
+
+class TextEventSink : public GameEventSink
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const size_t FLUSH_THRESHOLD = 4096; //buffered characters before write
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	/// \note private scope to force use of extended constructor
+	TextEventSink();
+
+public:
+	TextEventSink(std::ostream& destination);
+
+	virtual ~TextEventSink();
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	void flush();
+
+	//--------------------------------------------------------------------------
+	// Game Events
+	//--------------------------------------------------------------------------
+	virtual void gameSetUp(const std::list<Player*>& players,
+		const Board& board,
+		const SolutionCardSet& caseFile) override;
+
+	virtual void turnStarted(const Player* player) override;
+	virtual void turnSkipped(const Player* falseAccuser) override;
+	virtual void noPermissibleMoves(const Player* player) override;
+	virtual void stayInRoomAllowed(const Player* player) override;
+	virtual void turnOptionChosen(const Player* player, clueless::TurnOptionType choice) override;
+	virtual void playerMoved(const Player* player,
+		const Location* destination,
+		bool wasRandomChoice) override;
+
+	virtual void suggestionMade(const Player* suggestor, const SolutionCardSet& suggestion) override;
+	virtual void personTokenMovedForSuggestion(clueless::PersonType person, clueless::RoomType room) override;
+	virtual void weaponTokenMovedForSuggestion(clueless::WeaponType weapon, clueless::RoomType room) override;
+	virtual void counterEvidenceShown(const Player* refuter,
+		const Player* suggestor,
+		const Card* counterEvidence) override;
+	virtual void suggestionRefuted(clueless::PersonType refuter) override;
+	virtual void suggestionUnrefuted(const Player* suggestor) override;
+	virtual void notebooksUpdated(const Player* suggestor) override;
+
+	virtual void gameWon(const Player* winner, const SolutionCardSet& caseFile) override;
+	virtual void falseAccusationMade(const Player* falseAccuser, const SolutionCardSet& accusation) override;
+
+protected:
+	void flushIfFull();
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	std::ostream& _destination; //not owned
+	std::string _buffer; //text not yet written to destination
+
+}; //end class TextEventSink defn
+
+
+#endif //TextEventSink_h defn
@@ -0,0 +1,626 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file Tournament.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  2120
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Tournament.h"
+
+#include "mersenneTwister.h"
+#include "PlayerStrategy.h"
+#include "SimulationPool.h"
+
+#include <algorithm>		//for std::next_permutation, std::sort use
+#include <atomic>			//for std::atomic use
+#include <cmath>			//for std::log, std::fabs use
+#include <exception>		//for std::exception_ptr use
+#include <iomanip>			//for std::setw use
+#include <stdexcept>		//for std::logic_error use
+#include <thread>			//for std::thread use
+
+//------------------------------------------------------------------------------
+// Local Constants
+//------------------------------------------------------------------------------
+/// \note Elo points per factor of e in Bradley-Terry strength
+static const double ELO_PER_NEPER( 400.0 / std::log(10.0) );
+
+/// \note wins granted each way between every pair of entrants, so an entrant
+///       that never wins (or never loses) still gets a finite rating
+static const double PRIOR_WINS( 0.5 );
+
+static const size_t MAX_NUM_FIT_ITERATIONS = 10000;
+static const double FIT_TOLERANCE( 1e-9 ); //largest change in log strength
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param size_t: number of players per game
+/// \param unsigned int: turn cap after which game is abandoned
+/// \param BoardLayout: board layout (not owned); nullptr for classic
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when number of players outside [3, 6].
+/// \note
+/// - Layout must outlive tournament.
+////////////////////////////////////////////////////////////////////////////////
+Tournament::Tournament(
+	size_t num_players, //i - number of players per game
+	unsigned int max_num_turns, //i - turn cap
+	const BoardLayout* layout) //i - board layout
+	: _numPlayers( num_players )
+	, _maxNumTurns( max_num_turns )
+	, _layout( layout )
+	, _entrants()
+	, _lineups()
+	, _numGamesPerLineup( 0 )
+	, _seed( 0 )
+	, _numThreads( 0 )
+	, _winnerSeats()
+{
+	if( (GameSimulator::MIN_NUM_PLAYERS > num_players) ||
+		(GameSimulator::MAX_NUM_PLAYERS < num_players) )
+	{
+		std::ostringstream msg;
+		msg << "Tournament extended constructor\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  number of players must be in [" << GameSimulator::MIN_NUM_PLAYERS << ", "
+			<< GameSimulator::MAX_NUM_PLAYERS << "], not " << num_players;
+		throw std::logic_error( msg.str() );
+	}
+
+} //end routine extended constructor
+
+
+//------------------------------------------------------------------------------
+// Accessors and Mutators
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Enters strategy into tournament.
+/// \param PlayerStrategy: strategy cloned for each seat it holds (not owned)
+/// \return size_t: entrant index
+/// \throw
+/// - INSUFFICIENT_DATA when strategy null.
+/// - INCONSISTENT_DATA when MAX_NUM_ENTRANTS already entered.
+/// \note
+/// - Strategy must outlive tournament; same strategy may be entered twice
+///   (under different names, to tell apart in report).
+////////////////////////////////////////////////////////////////////////////////
+size_t
+Tournament::addEntrant(
+	const PlayerStrategy* strategy) //i - strategy to enter
+{
+	if( ! strategy )
+	{
+		std::ostringstream msg;
+		msg << "Tournament::addEntrant()\n"
+			<< "  INSUFFICIENT_DATA\n"
+			<< "  no strategy";
+		throw std::logic_error( msg.str() );
+	}
+
+	if( MAX_NUM_ENTRANTS <= _entrants.size() )
+	{
+		std::ostringstream msg;
+		msg << "Tournament::addEntrant()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  at most " << MAX_NUM_ENTRANTS << " entrants";
+		throw std::logic_error( msg.str() );
+	}
+
+	_entrants.push_back( strategy );
+
+	return( _entrants.size() - 1 );
+
+} //end routine addEntrant()
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Plays every lineup across worker threads.
+/// \param unsigned long: games per lineup
+/// \param unsigned long: tournament seed
+/// \param size_t: number of worker threads (0 for one per hardware thread)
+/// \return None
+/// \throw
+/// - INSUFFICIENT_DATA when fewer than two entrants.
+/// - INCONSISTENT_DATA when lineups exceed MAX_NUM_LINEUPS.
+/// - first exception raised by any game, after all workers have stopped
+/// \note
+/// - Replaces results of any earlier play().
+/// - Workers claim blocks of games from a shared counter, as SimulationPool
+///   does; each game's winner is kept for rating.
+////////////////////////////////////////////////////////////////////////////////
+void
+Tournament::play(
+	unsigned long num_games_per_lineup, //i - games per lineup
+	unsigned long seed, //i - tournament seed
+	size_t num_threads) //i - number of worker threads
+{
+	if( 2 > _entrants.size() )
+	{
+		std::ostringstream msg;
+		msg << "Tournament::play()\n"
+			<< "  INSUFFICIENT_DATA\n"
+			<< "  at least two entrants needed, not " << _entrants.size();
+		throw std::logic_error( msg.str() );
+	}
+
+	arrangeLineups();
+
+	_numGamesPerLineup = num_games_per_lineup;
+	_seed = seed;
+	_numThreads = SimulationPool( num_threads ).getNumThreads();
+
+	size_t num_lineups( getNumLineups() );
+
+	//one simulator per lineup
+	std::vector<GameSimulator> simulators;
+	simulators.reserve( num_lineups );
+	for(size_t lineup(0); lineup < num_lineups; ++lineup)
+	{
+		simulators.push_back( GameSimulator(_numPlayers, _maxNumTurns, _layout) );
+
+		for(size_t seat(0); seat < _numPlayers; ++seat)
+		{
+			simulators.back().setSeatStrategy( seat, _entrants[_lineups[lineup * _numPlayers + seat]] );
+		}
+	}
+
+	unsigned long num_games( (unsigned long)num_lineups * num_games_per_lineup );
+	_winnerSeats.assign( num_games, (unsigned char)GameOutcome::NO_WINNER );
+
+	std::atomic<unsigned long> next_game( 0 );
+	std::atomic<bool> has_failed( false );
+
+	std::vector<std::exception_ptr> worker_errors( _numThreads );
+	std::vector<std::thread> workers;
+	workers.reserve( _numThreads );
+
+	for(size_t worker_index(0); worker_index < _numThreads; ++worker_index)
+	{
+		workers.push_back( std::thread( [&, worker_index]()
+		{
+			try
+			{
+				//while more games to claim
+				while( ! has_failed )
+				{
+					unsigned long first_game( next_game.fetch_add(SimulationPool::GAMES_PER_CLAIM) );
+					if( first_game >= num_games )
+					{
+						break; //all games claimed
+					}
+
+					unsigned long end_game( first_game + SimulationPool::GAMES_PER_CLAIM );
+					if( end_game > num_games )
+					{
+						end_game = num_games;
+					}
+
+					for(unsigned long game(first_game); game < end_game; ++game)
+					{
+						GameOutcome outcome( simulators[game / num_games_per_lineup].playGame(
+							SimulationPool::deriveGameSeed(seed, game % num_games_per_lineup)) );
+
+						_winnerSeats[game] = (unsigned char)outcome._winnerSeat;
+					}
+
+				} //end while (more games to claim)
+			}
+			catch(...)
+			{
+				worker_errors[worker_index] = std::current_exception();
+				has_failed = true;
+			}
+		} ) );
+
+	} //end for (each worker)
+
+	for(size_t worker_index(0); worker_index < _numThreads; ++worker_index)
+	{
+		workers[worker_index].join();
+	}
+
+	for(size_t worker_index(0); worker_index < _numThreads; ++worker_index)
+	{
+		if( worker_errors[worker_index] )
+		{
+			std::rethrow_exception( worker_errors[worker_index] );
+		}
+	}
+
+} //end routine play()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Rates entrants from games played.
+/// \param size_t: deal resamples for 95% intervals; 0 for none
+/// \return vector<Standing>: one per entrant, best rated first
+/// \throw None
+/// \note
+/// - Resampling draws from tournament seed, so same seed gives same
+///   intervals.
+////////////////////////////////////////////////////////////////////////////////
+std::vector<Tournament::Standing>
+Tournament::rate(
+	size_t num_resamples) //i - deal resamples for intervals
+const
+{
+	size_t num_entrants( _entrants.size() );
+
+	std::vector<Standing> standings( num_entrants );
+	for(size_t entrant(0); entrant < num_entrants; ++entrant)
+	{
+		standings[entrant]._entrant = entrant;
+		standings[entrant]._numSeats = 0;
+		standings[entrant]._numWins = 0;
+	}
+
+	//record
+	for(size_t lineup(0); lineup < getNumLineups(); ++lineup)
+	{
+		const unsigned char* seats( &_lineups[lineup * _numPlayers] );
+
+		for(size_t seat(0); seat < _numPlayers; ++seat)
+		{
+			standings[seats[seat]]._numSeats += _numGamesPerLineup;
+		}
+
+		for(unsigned long game(0); game < _numGamesPerLineup; ++game)
+		{
+			unsigned char winner( _winnerSeats[lineup * _numGamesPerLineup + game] );
+			if( NO_WINNER != winner )
+			{
+				++standings[seats[winner]]._numWins;
+			}
+		}
+	}
+
+	//ratings, over every deal once
+	std::vector<unsigned int> deal_weights( _numGamesPerLineup, 1 );
+	std::vector<double> wins;
+	std::vector<double> ratings;
+
+	tallyWins( deal_weights, &wins );
+	fitRatings( wins, &ratings );
+
+	for(size_t entrant(0); entrant < num_entrants; ++entrant)
+	{
+		standings[entrant]._rating = ratings[entrant];
+		standings[entrant]._lowRating = ratings[entrant];
+		standings[entrant]._highRating = ratings[entrant];
+	}
+
+	//intervals, over resampled deals
+	if( (0 < num_resamples) && (0 < _numGamesPerLineup) )
+	{
+		MersenneTwister rng( SimulationPool::deriveGameSeed(_seed, _numGamesPerLineup) );
+		std::vector<double> resampled_ratings( num_entrants * num_resamples ); //entrant after entrant
+
+		for(size_t resample(0); resample < num_resamples; ++resample)
+		{
+			deal_weights.assign( _numGamesPerLineup, 0 );
+			for(unsigned long draw(0); draw < _numGamesPerLineup; ++draw)
+			{
+				++deal_weights[rng.drawUniformInt(_numGamesPerLineup)];
+			}
+
+			tallyWins( deal_weights, &wins );
+			fitRatings( wins, &ratings );
+
+			for(size_t entrant(0); entrant < num_entrants; ++entrant)
+			{
+				resampled_ratings[entrant * num_resamples + resample] = ratings[entrant];
+			}
+		}
+
+		size_t low_index( (size_t)(0.025 * (double)num_resamples) );
+		size_t high_index( (size_t)(0.975 * (double)num_resamples) );
+		if( high_index >= num_resamples )
+		{
+			high_index = num_resamples - 1;
+		}
+
+		for(size_t entrant(0); entrant < num_entrants; ++entrant)
+		{
+			std::vector<double>::iterator first( resampled_ratings.begin() + entrant * num_resamples );
+			std::sort( first, first + num_resamples );
+
+			standings[entrant]._lowRating = first[low_index];
+			standings[entrant]._highRating = first[high_index];
+		}
+
+	} //end if (intervals wanted)
+
+	std::sort( standings.begin(), standings.end(),
+		[](const Standing& lhs, const Standing& rhs)
+		{
+			return( (lhs._rating > rhs._rating) ||
+				((lhs._rating == rhs._rating) && (lhs._entrant < rhs._entrant)) );
+		} );
+
+	return standings;
+
+} //end routine rate()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Generates report of tournament and its standings.
+/// \param vector<Standing>: standings (see rate())
+/// \param double: wall-clock seconds spent playing games
+/// \return ostringstream: report text
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+std::ostringstream
+Tournament::report(
+	const std::vector<Standing>& standings, //i - standings
+	double elapsed_seconds) //i - wall-clock seconds
+const
+{
+	unsigned long num_games( (unsigned long)_winnerSeats.size() );
+
+	unsigned long num_games_won( 0 );
+	for(unsigned long game(0); game < num_games; ++game)
+	{
+		if( NO_WINNER != _winnerSeats[game] )
+		{
+			++num_games_won;
+		}
+	}
+
+	std::ostringstream report;
+	report << std::fixed << std::setprecision( 3 );
+
+	report << "Entrants: " << _entrants.size()
+		<< "  Players: " << _numPlayers
+		<< "  Lineups: " << getNumLineups()
+		<< "  Games per lineup: " << _numGamesPerLineup << "\n"
+		<< "Games played:           " << num_games << "\n"
+		<< "  won:                  " << num_games_won << "\n";
+
+	report << "Ratings (Elo scale; 95% interval from resampled deals)\n"
+		<< "  rank  strategy              rating      interval          seats     wins  win rate\n";
+	for(size_t rank(0); rank < standings.size(); ++rank)
+	{
+		const Standing& standing( standings[rank] );
+
+		report << "  " << std::setw( 4 ) << (rank + 1)
+			<< "  " << std::left << std::setw( 18 ) << _entrants[standing._entrant]->getName()
+			<< std::right << std::setprecision( 1 )
+			<< "  " << std::setw( 8 ) << standing._rating
+			<< "  [" << std::setw( 6 ) << standing._lowRating
+			<< ", " << std::setw( 6 ) << standing._highRating << "]"
+			<< "  " << std::setw( 7 ) << standing._numSeats
+			<< "  " << std::setw( 7 ) << standing._numWins
+			<< std::setprecision( 3 )
+			<< "  " << std::setw( 8 )
+			<< ((0 < standing._numSeats) ? double(standing._numWins) / double(standing._numSeats) : 0.0)
+			<< "\n";
+
+	} //end for (each standing)
+
+	report << "Elapsed:                " << elapsed_seconds << " s";
+	if( 0.0 < elapsed_seconds )
+	{
+		report << " (" << std::setprecision( 1 )
+			<< (double(num_games) / elapsed_seconds) << " games/s)";
+	}
+	report << "\n";
+
+	return report;
+
+} //end routine report()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Lists every lineup to play.
+/// \param None
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when lineups exceed MAX_NUM_LINEUPS.
+/// \note
+/// - Tables (groups of entrants filling every seat) in lexicographic order,
+///   each followed by its distinct seatings in lexicographic order.
+////////////////////////////////////////////////////////////////////////////////
+void
+Tournament::arrangeLineups()
+{
+	size_t num_entrants( _entrants.size() );
+
+	_lineups.clear();
+
+	//membership flag per entrant; first table is first entrants
+	std::vector<bool> at_table( num_entrants, false );
+	for(size_t entrant(0); (entrant < num_entrants) && (entrant < _numPlayers); ++entrant)
+	{
+		at_table[entrant] = true;
+	}
+
+	std::vector<unsigned char> seats( _numPlayers );
+
+	do
+	{
+		//seat table's entrants, in turn when fewer than seats
+		size_t num_at_table( 0 );
+		unsigned char members[MAX_NUM_ENTRANTS];
+		for(size_t entrant(0); entrant < num_entrants; ++entrant)
+		{
+			if( at_table[entrant] )
+			{
+				members[num_at_table++] = (unsigned char)entrant;
+			}
+		}
+
+		for(size_t seat(0); seat < _numPlayers; ++seat)
+		{
+			seats[seat] = members[seat % num_at_table];
+		}
+		std::sort( seats.begin(), seats.end() );
+
+		//every distinct seating
+		do
+		{
+			if( MAX_NUM_LINEUPS * _numPlayers <= _lineups.size() )
+			{
+				std::ostringstream msg;
+				msg << "Tournament::arrangeLineups()\n"
+					<< "  INCONSISTENT_DATA\n"
+					<< "  more than " << MAX_NUM_LINEUPS << " lineups of "
+					<< num_entrants << " entrants at " << _numPlayers << " seats";
+				throw std::logic_error( msg.str() );
+			}
+
+			_lineups.insert( _lineups.end(), seats.begin(), seats.end() );
+
+		} while( std::next_permutation(seats.begin(), seats.end()) );
+
+	} while( std::prev_permutation(at_table.begin(), at_table.end()) ); //next table
+
+} //end routine arrangeLineups()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Counts, for each pair of entrants, games one won at other's table.
+/// \param vector<unsigned int>: times each deal counts
+/// \param vector<double>: wins (winner * entrants + loser) over weighted games
+/// \return None
+/// \throw None
+/// \note
+/// - Entrant holding several seats is beaten (or beats) once per seat;
+///   entrant never beats itself.
+////////////////////////////////////////////////////////////////////////////////
+void
+Tournament::tallyWins(
+	const std::vector<unsigned int>& deal_weights, //i - times each deal counts
+	std::vector<double>* wins) // o- wins per pair of entrants
+const
+{
+	size_t num_entrants( _entrants.size() );
+
+	wins->assign( num_entrants * num_entrants, 0.0 );
+
+	for(size_t lineup(0); lineup < getNumLineups(); ++lineup)
+	{
+		const unsigned char* seats( &_lineups[lineup * _numPlayers] );
+		const unsigned char* winners( &_winnerSeats[lineup * _numGamesPerLineup] );
+
+		//weighted wins per seat
+		double seat_wins[GameOutcome::MAX_NUM_SEATS] = { 0.0 };
+		for(unsigned long game(0); game < _numGamesPerLineup; ++game)
+		{
+			if( NO_WINNER != winners[game] )
+			{
+				seat_wins[winners[game]] += deal_weights[game];
+			}
+		}
+
+		for(size_t winner(0); winner < _numPlayers; ++winner)
+		{
+			for(size_t loser(0); loser < _numPlayers; ++loser)
+			{
+				if( seats[winner] != seats[loser] )
+				{
+					(*wins)[seats[winner] * num_entrants + seats[loser]] += seat_wins[winner];
+				}
+			}
+		}
+
+	} //end for (each lineup)
+
+} //end routine tallyWins()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Fits Bradley-Terry strengths to pairwise wins, on the Elo scale.
+/// \param vector<double>: wins (winner * entrants + loser)
+/// \param vector<double>: rating per entrant, averaging BASE_RATING
+/// \return None
+/// \throw None
+/// \note
+/// - Minorization-maximization (Hunter 2004): each strength becomes its
+///   wins over the sum, across opponents, of games played against that
+///   opponent divided by the pair's combined strength; log strengths are
+///   recentred after every sweep.
+////////////////////////////////////////////////////////////////////////////////
+void
+Tournament::fitRatings(
+	const std::vector<double>& wins, //i - wins per pair of entrants
+	std::vector<double>* ratings) // o- rating per entrant
+const
+{
+	size_t num_entrants( _entrants.size() );
+
+	std::vector<double> total_wins( num_entrants, 0.0 );
+	for(size_t winner(0); winner < num_entrants; ++winner)
+	{
+		for(size_t loser(0); loser < num_entrants; ++loser)
+		{
+			if( winner != loser )
+			{
+				total_wins[winner] += wins[winner * num_entrants + loser] + PRIOR_WINS;
+			}
+		}
+	}
+
+	std::vector<double> strengths( num_entrants, 1.0 );
+	std::vector<double> next_strengths( num_entrants );
+
+	for(size_t iteration(0); iteration < MAX_NUM_FIT_ITERATIONS; ++iteration)
+	{
+		double mean_log( 0.0 );
+		for(size_t entrant(0); entrant < num_entrants; ++entrant)
+		{
+			double denominator( 0.0 );
+			for(size_t opponent(0); opponent < num_entrants; ++opponent)
+			{
+				if( entrant != opponent )
+				{
+					denominator +=
+						(wins[entrant * num_entrants + opponent] + wins[opponent * num_entrants + entrant] + 2.0 * PRIOR_WINS) /
+						(strengths[entrant] + strengths[opponent]);
+				}
+			}
+
+			next_strengths[entrant] = total_wins[entrant] / denominator;
+			mean_log += std::log( next_strengths[entrant] );
+		}
+		mean_log /= (double)num_entrants;
+
+		double largest_change( 0.0 );
+		for(size_t entrant(0); entrant < num_entrants; ++entrant)
+		{
+			double next_strength( next_strengths[entrant] / std::exp(mean_log) );
+
+			largest_change = std::max( largest_change,
+				std::fabs(std::log(next_strength / strengths[entrant])) );
+			strengths[entrant] = next_strength;
+		}
+
+		if( FIT_TOLERANCE > largest_change )
+		{
+			break; //converged
+		}
+
+	} //end for (each sweep)
+
+	ratings->resize( num_entrants );
+	for(size_t entrant(0); entrant < num_entrants; ++entrant)
+	{
+		(*ratings)[entrant] = BASE_RATING + ELO_PER_NEPER * std::log( strengths[entrant] );
+	}
+
+} //end routine fitRatings()
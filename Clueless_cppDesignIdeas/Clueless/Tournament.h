@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file Tournament.h
+/// \brief Round-robin of player strategies across every seating, rated on
+///        the Elo scale.
+///
+/// \date   17 Oct 2026  2120
+///
+/// \note
+/// - A lineup assigns one entrant per seat.  With at least as many entrants
+///   as seats, every group of entrants filling the table plays in every
+///   seating; with fewer, entrants fill seats in turn (two entrants at four
+///   seats: A B A B) and that table plays in every distinct seating.  Seat
+///   advantage therefore cancels out.
+/// - Game g of every lineup is dealt from the same seed (see
+///   SimulationPool::deriveGameSeed()), so lineups are compared over the
+///   same deals.
+/// - Games are spread over worker threads; results depend only on the seed.
+/// - Ratings: each game's winner beats every other entrant at the table;
+///   entrants are then rated by Bradley-Terry maximum likelihood (the model
+///   behind Elo) and reported on the Elo scale, averaging BASE_RATING.
+///   Intervals come from resampling deals (with every lineup's game on each
+///   resampled deal), refitting each time.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef Tournament_h
+#define Tournament_h
+
+#include "GameSimulator.h"
+
+#include <sstream>		//for std::ostringstream use
+#include <stddef.h>		//for size_t use
+#include <vector>		//for std::vector use
+
+
+//forward declarations
+class BoardLayout;
+class PlayerStrategy;
+
+
+class Tournament
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const size_t MAX_NUM_ENTRANTS = 16;
+	static const size_t MAX_NUM_LINEUPS = 1 << 16;
+
+	static const int BASE_RATING = 1500; //average entrant's
+	static const size_t DEFAULT_NUM_RESAMPLES = 200;
+
+	static const unsigned char NO_WINNER = (unsigned char)GameOutcome::NO_WINNER;
+
+	//--------------------------------------------------------------------------
+	// Class-Scoped Types
+	//--------------------------------------------------------------------------
+public:
+	/// \brief Entrant's rating and record.
+	struct Standing
+	{
+		size_t _entrant; //in order added
+
+		double _rating;     //Elo scale
+		double _lowRating;  //95% interval
+		double _highRating;
+
+		unsigned long _numSeats; //games played, counting each seat held
+		unsigned long _numWins;
+
+	}; //end struct Standing defn
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	Tournament();
+
+public:
+	Tournament(size_t numPlayers,
+		unsigned int maxNumTurns = GameSimulator::DEFAULT_MAX_NUM_TURNS,
+		const BoardLayout* layout = nullptr);
+
+	virtual ~Tournament()
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	size_t getNumPlayers() const;
+	size_t getNumEntrants() const;
+	const PlayerStrategy* getEntrant(size_t entrant) const;
+
+	size_t getNumLineups() const;
+	unsigned long getNumGamesPerLineup() const;
+	size_t getNumThreads() const;
+
+	size_t addEntrant(const PlayerStrategy* strategy);
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	void play(unsigned long numGamesPerLineup, unsigned long seed, size_t numThreads);
+
+	std::vector<Standing> rate(size_t numResamples = DEFAULT_NUM_RESAMPLES) const;
+	std::ostringstream report(const std::vector<Standing>& standings, double elapsedSeconds) const;
+
+protected:
+	void arrangeLineups();
+
+	void tallyWins(const std::vector<unsigned int>& dealWeights, std::vector<double>* wins) const;
+	void fitRatings(const std::vector<double>& wins, std::vector<double>* ratings) const;
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	size_t _numPlayers;
+	unsigned int _maxNumTurns;
+	const BoardLayout* _layout; //shared by every game (not owned)
+
+	std::vector<const PlayerStrategy*> _entrants; //not owned
+
+	std::vector<unsigned char> _lineups; //entrant per seat, lineup after lineup
+	unsigned long _numGamesPerLineup;
+	unsigned long _seed;
+	size_t _numThreads; //used by last play()
+
+	std::vector<unsigned char> _winnerSeats; //per game, lineup after lineup; NO_WINNER if none
+
+}; //end class Tournament defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+Tournament::getNumPlayers()
+const
+{
+	return _numPlayers;
+
+} //end routine getNumPlayers()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+Tournament::getNumEntrants()
+const
+{
+	return _entrants.size();
+
+} //end routine getNumEntrants()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline const PlayerStrategy*
+Tournament::getEntrant(
+	size_t entrant) //i - entrant, in order added
+const
+{
+	return _entrants[entrant];
+
+} //end routine getEntrant()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns number of lineups played by last play().
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+Tournament::getNumLineups()
+const
+{
+	return( _lineups.size() / _numPlayers );
+
+} //end routine getNumLineups()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned long
+Tournament::getNumGamesPerLineup()
+const
+{
+	return _numGamesPerLineup;
+
+} //end routine getNumGamesPerLineup()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+Tournament::getNumThreads()
+const
+{
+	return _numThreads;
+
+} //end routine getNumThreads()
+
+
+#endif //Tournament_h defn
@@ -0,0 +1,494 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file TraceEventSink.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  2355
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "TraceEventSink.h"
+
+#include "Player.h"
+#include "SolutionCardSet.h"
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param TraceWriter: receives spans (not owned)
+/// \param unsigned int: worker's thread id within trace (1 and up)
+/// \param GameEventSink: also receives every event (not owned); nullptr for
+///  none
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+TraceEventSink::TraceEventSink(
+	TraceWriter* writer, //i - receives spans
+	unsigned int thread_id, //i - worker's thread id within trace
+	GameEventSink* forward_to) //i - also receives every event
+	: _writer( writer )
+	, _forward( forward_to ? forward_to : NullEventSink::shared() )
+	, _threadId( thread_id )
+	, _isGameOpen( false )
+	, _gameIndex( 0 )
+	, _gameStart( 0 )
+	, _isTurnOpen( false )
+	, _turnStart( 0 )
+	, _turnCharacter( clueless::UNKNOWN_PERSON )
+	, _phaseStart( 0 )
+	, _suggestedPerson( clueless::UNKNOWN_PERSON )
+	, _suggestedWeapon( clueless::UNKNOWN_WEAPON )
+	, _suggestedRoom( clueless::UNKNOWN_ROOM )
+{
+	_events.reserve( BLOCK_SIZE + 1024 ); //room for game ending past block size
+
+} //end routine extended constructor
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Destructor
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - Submits any collected spans; lost if writer already closed.
+////////////////////////////////////////////////////////////////////////////////
+TraceEventSink::~TraceEventSink()
+{
+	try
+	{
+		flush();
+	}
+	catch(...)
+	{
+	}
+
+} //end routine destructor
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Starts tracing game.
+/// \param unsigned long: zero-based game index within batch
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::beginGame(
+	unsigned long game_index) //i - zero-based game index within batch
+{
+	_isGameOpen = true;
+	_gameIndex = game_index;
+	_gameStart = _writer->readClock();
+
+	_isTurnOpen = false;
+	_phaseStart = _gameStart;
+
+} //end routine beginGame()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Ends last turn and game's span, and submits collected spans once
+///  a block is full.
+/// \param None
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when writer closed.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::endGame()
+{
+	if( ! _isGameOpen )
+	{
+		return;
+	}
+
+	const unsigned long long now( _writer->readClock() );
+
+	endTurn( now );
+	appendSpan( TraceWriter::GAME, _gameStart, now );
+
+	_isGameOpen = false;
+
+	if( BLOCK_SIZE <= _events.size() )
+	{
+		flush();
+	}
+
+} //end routine endGame()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Submits collected spans to writer.
+/// \param None
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when writer closed.
+/// \note
+/// - Writer hands back an empty block, so collecting continues without
+///   allocating.
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::flush()
+{
+	if( ! _events.empty() )
+	{
+		_writer->submit( _threadId, &_events );
+		_events.reserve( BLOCK_SIZE + 1024 );
+	}
+
+} //end routine flush()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Adds span (or instant, when start equals end) to block.
+/// \param EventType: kind of span
+/// \param unsigned long long: start (writer clock)
+/// \param unsigned long long: end (writer clock)
+/// \param unsigned int: values as listed by event type
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::appendSpan(
+	TraceWriter::EventType type, //i - kind of span
+	unsigned long long start, //i - start
+	unsigned long long end, //i - end
+	unsigned int value0, //i - first value
+	unsigned int value1, //i - second value
+	unsigned int value2, //i - third value
+	unsigned int value3) //i - fourth value
+{
+	_events.push_back( TraceWriter::Event() );
+
+	TraceWriter::Event& event( _events.back() );
+	event._start = start;
+	event._duration = end - start;
+	event._gameIndex = _gameIndex;
+	event._type = (unsigned char)type;
+	event._values[0] = (unsigned char)value0;
+	event._values[1] = (unsigned char)value1;
+	event._values[2] = (unsigned char)value2;
+	event._values[3] = (unsigned char)value3;
+
+} //end routine appendSpan()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Adds span of phase ending now, which next phase starts from.
+/// \param EventType: kind of span
+/// \param unsigned int: values as listed by event type
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::endPhase(
+	TraceWriter::EventType type, //i - kind of span
+	unsigned int value0, //i - first value
+	unsigned int value1) //i - second value
+{
+	const unsigned long long now( _writer->readClock() );
+
+	appendSpan( type, _phaseStart, now, value0, value1 );
+	_phaseStart = now;
+
+} //end routine endPhase()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::endTurn(
+	unsigned long long end) //i - end (writer clock)
+{
+	if( _isTurnOpen )
+	{
+		appendSpan( TraceWriter::TURN, _turnStart, end, _turnCharacter );
+		_isTurnOpen = false;
+	}
+
+} //end routine endTurn()
+
+
+//------------------------------------------------------------------------------
+// Game Events
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \note Setup is part of game's span; nothing of its own.
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::gameSetUp(
+	const std::list<Player*>& players, //i - all players
+	const Board& board, //i - game board
+	const SolutionCardSet& case_file) //i - Case File
+{
+	_forward->gameSetUp( players, board, case_file );
+
+} //end routine gameSetUp()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Ends previous turn's span and starts this one's.
+/// \param Player: turn taker
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::turnStarted(
+	const Player* player) //i - turn taker
+{
+	if( _isGameOpen )
+	{
+		const unsigned long long now( _writer->readClock() );
+
+		endTurn( now );
+
+		_isTurnOpen = true;
+		_turnStart = now;
+		_turnCharacter = player->getCharacter();
+		_phaseStart = now;
+	}
+
+	_forward->turnStarted( player );
+
+} //end routine turnStarted()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::turnSkipped(
+	const Player* false_accuser) //i - false accuser
+{
+	if( _isGameOpen )
+	{
+		const unsigned long long now( _writer->readClock() );
+		appendSpan( TraceWriter::TURN_SKIPPED, now, now, false_accuser->getCharacter() );
+	}
+
+	_forward->turnSkipped( false_accuser );
+
+} //end routine turnSkipped()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::noPermissibleMoves(
+	const Player* player) //i - turn taker
+{
+	_forward->noPermissibleMoves( player );
+
+} //end routine noPermissibleMoves()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::stayInRoomAllowed(
+	const Player* player) //i - turn taker
+{
+	_forward->stayInRoomAllowed( player );
+
+} //end routine stayInRoomAllowed()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Ends decision span; chosen option's span starts now.
+/// \param Player: turn taker
+/// \param TurnOptionType: option chosen
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::turnOptionChosen(
+	const Player* player, //i - turn taker
+	clueless::TurnOptionType choice) //i - option chosen
+{
+	if( _isGameOpen )
+	{
+		endPhase( TraceWriter::DECISION, player->getCharacter(), choice );
+	}
+
+	_forward->turnOptionChosen( player, choice );
+
+} //end routine turnOptionChosen()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::playerMoved(
+	const Player* player, //i - turn taker
+	const Location* destination, //i - new location
+	bool was_random_choice) //i - whether destination chosen at random
+{
+	if( _isGameOpen )
+	{
+		endPhase( TraceWriter::MOVE, player->getCharacter(), was_random_choice ? 1 : 0 );
+	}
+
+	_forward->playerMoved( player, destination, was_random_choice );
+
+} //end routine playerMoved()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \note Suggestion kept for its span, which ends when refuted / unrefuted.
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::suggestionMade(
+	const Player* suggestor, //i - suggestor
+	const SolutionCardSet& suggestion) //i - suggestion
+{
+	_suggestedPerson = suggestion.getPersonType();
+	_suggestedWeapon = suggestion.getWeaponType();
+	_suggestedRoom = suggestion.getRoomType();
+
+	_forward->suggestionMade( suggestor, suggestion );
+
+} //end routine suggestionMade()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::personTokenMovedForSuggestion(
+	clueless::PersonType person, //i - person moved
+	clueless::RoomType room) //i - suggested room
+{
+	_forward->personTokenMovedForSuggestion( person, room );
+
+} //end routine personTokenMovedForSuggestion()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::weaponTokenMovedForSuggestion(
+	clueless::WeaponType weapon, //i - weapon moved
+	clueless::RoomType room) //i - suggested room
+{
+	_forward->weaponTokenMovedForSuggestion( weapon, room );
+
+} //end routine weaponTokenMovedForSuggestion()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::counterEvidenceShown(
+	const Player* refuter, //i - refuter
+	const Player* suggestor, //i - suggestor
+	const Card* counter_evidence) //i - card shown
+{
+	if( _isGameOpen )
+	{
+		const unsigned long long now( _writer->readClock() );
+		appendSpan( TraceWriter::COUNTER_EVIDENCE, now, now,
+			refuter->getCharacter(), suggestor->getCharacter() );
+	}
+
+	_forward->counterEvidenceShown( refuter, suggestor, counter_evidence );
+
+} //end routine counterEvidenceShown()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Ends suggestion's span; notebook update starts now.
+/// \param PersonType: refuter
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::suggestionRefuted(
+	clueless::PersonType refuter) //i - refuter
+{
+	if( _isGameOpen )
+	{
+		const unsigned long long now( _writer->readClock() );
+
+		appendSpan( TraceWriter::SUGGESTION, _phaseStart, now,
+			_suggestedPerson, _suggestedWeapon, _suggestedRoom, refuter );
+		_phaseStart = now;
+	}
+
+	_forward->suggestionRefuted( refuter );
+
+} //end routine suggestionRefuted()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::suggestionUnrefuted(
+	const Player* suggestor) //i - suggestor
+{
+	if( _isGameOpen )
+	{
+		const unsigned long long now( _writer->readClock() );
+
+		appendSpan( TraceWriter::SUGGESTION, _phaseStart, now,
+			_suggestedPerson, _suggestedWeapon, _suggestedRoom, clueless::UNKNOWN_PERSON );
+		_phaseStart = now;
+	}
+
+	_forward->suggestionUnrefuted( suggestor );
+
+} //end routine suggestionUnrefuted()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::notebooksUpdated(
+	const Player* suggestor) //i - suggestor
+{
+	if( _isGameOpen )
+	{
+		endPhase( TraceWriter::NOTEBOOK_UPDATE, suggestor->getCharacter() );
+	}
+
+	_forward->notebooksUpdated( suggestor );
+
+} //end routine notebooksUpdated()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::gameWon(
+	const Player* winner, //i - winner
+	const SolutionCardSet& case_file) //i - Case File
+{
+	if( _isGameOpen )
+	{
+		endPhase( TraceWriter::ACCUSATION, winner->getCharacter(), 1 );
+	}
+
+	_forward->gameWon( winner, case_file );
+
+} //end routine gameWon()
+
+
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceEventSink::falseAccusationMade(
+	const Player* false_accuser, //i - false accuser
+	const SolutionCardSet& accusation) //i - accusation
+{
+	if( _isGameOpen )
+	{
+		endPhase( TraceWriter::ACCUSATION, false_accuser->getCharacter(), 0 );
+	}
+
+	_forward->falseAccusationMade( false_accuser, accusation );
+
+} //end routine falseAccusationMade()
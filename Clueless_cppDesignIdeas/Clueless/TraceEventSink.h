@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file TraceEventSink.h
+/// \brief Times the phases of one worker's games as trace spans, for a
+///        TraceWriter.
+///
+/// \date   17 Oct 2026  2350
+///
+/// \note
+/// - Spans are cut at game events, each running from the previous boundary
+///   within the turn:
+///   - game: beginGame() to endGame()
+///   - turn (named by character): turn started to next turn started, or to
+///     end of game
+///   - decision (named by option): start of turn, or end of previous phase,
+///     to turn option chosen; includes finding turn options
+///   - move: option chosen to player moved
+///   - suggestion: option chosen to suggestion refuted / unrefuted; builds
+///     suggestion, moves tokens, and finds counter-evidence
+///   - notebook update: refuted / unrefuted to notebooks updated
+///   - accusation: option chosen to game won / false accusation
+/// - Turn skipped and counter-evidence shown are instants.
+/// - Events outside beginGame() / endGame() are not traced, so a sink may
+///   stay attached (e.g. behind a ReplayLogSink) while untraced games play.
+/// - Spans collect in a block submitted to the writer when it holds
+///   BLOCK_SIZE events (checked at end of game), and on destruction.
+/// - Every event is also passed on to an optional sink.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TraceEventSink_h
+#define TraceEventSink_h
+
+#include "GameEventSink.h"
+#include "TraceWriter.h"
+
+#include "CluelessEnums.h"	//for PersonType, WeaponType, RoomType use
+
+#include <stddef.h>		//for size_t use
+#include <vector>		//for std::vector use
+
+
+class TraceEventSink : public GameEventSink
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const size_t BLOCK_SIZE = 4096; //events submitted at once
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	/// \note private scope to force use of extended constructor
+	TraceEventSink();
+
+	/// \brief Copy constructor
+	TraceEventSink(const TraceEventSink&);
+
+public:
+	TraceEventSink(TraceWriter* writer, unsigned int threadId, GameEventSink* forwardTo = nullptr);
+
+	virtual ~TraceEventSink();
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	void beginGame(unsigned long gameIndex);
+	void endGame();
+
+	void flush();
+
+	//--------------------------------------------------------------------------
+	// Game Events
+	//--------------------------------------------------------------------------
+	virtual void gameSetUp(const std::list<Player*>& players,
+		const Board& board,
+		const SolutionCardSet& caseFile) override;
+
+	virtual void turnStarted(const Player* player) override;
+	virtual void turnSkipped(const Player* falseAccuser) override;
+	virtual void noPermissibleMoves(const Player* player) override;
+	virtual void stayInRoomAllowed(const Player* player) override;
+	virtual void turnOptionChosen(const Player* player, clueless::TurnOptionType choice) override;
+	virtual void playerMoved(const Player* player,
+		const Location* destination,
+		bool wasRandomChoice) override;
+
+	virtual void suggestionMade(const Player* suggestor, const SolutionCardSet& suggestion) override;
+	virtual void personTokenMovedForSuggestion(clueless::PersonType person, clueless::RoomType room) override;
+	virtual void weaponTokenMovedForSuggestion(clueless::WeaponType weapon, clueless::RoomType room) override;
+	virtual void counterEvidenceShown(const Player* refuter,
+		const Player* suggestor,
+		const Card* counterEvidence) override;
+	virtual void suggestionRefuted(clueless::PersonType refuter) override;
+	virtual void suggestionUnrefuted(const Player* suggestor) override;
+	virtual void notebooksUpdated(const Player* suggestor) override;
+
+	virtual void gameWon(const Player* winner, const SolutionCardSet& caseFile) override;
+	virtual void falseAccusationMade(const Player* falseAccuser, const SolutionCardSet& accusation) override;
+
+protected:
+	void appendSpan(TraceWriter::EventType type,
+		unsigned long long start,
+		unsigned long long end,
+		unsigned int value0 = 0,
+		unsigned int value1 = 0,
+		unsigned int value2 = 0,
+		unsigned int value3 = 0);
+	void endPhase(TraceWriter::EventType type, unsigned int value0 = 0, unsigned int value1 = 0);
+	void endTurn(unsigned long long end);
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	TraceWriter* _writer;    //not owned
+	GameEventSink* _forward; //receives every event too (not owned); never null
+	unsigned int _threadId;  //within trace
+
+	std::vector<TraceWriter::Event> _events; //not yet submitted
+
+	bool _isGameOpen;             //between beginGame() and endGame()
+	unsigned long _gameIndex;
+	unsigned long long _gameStart;
+
+	bool _isTurnOpen;
+	unsigned long long _turnStart;
+	clueless::PersonType _turnCharacter;
+
+	unsigned long long _phaseStart; //end of previous phase within turn
+
+	clueless::PersonType _suggestedPerson;
+	clueless::WeaponType _suggestedWeapon;
+	clueless::RoomType _suggestedRoom;
+
+}; //end class TraceEventSink defn
+
+
+#endif //TraceEventSink_h defn
@@ -0,0 +1,712 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file TraceWriter.cpp
+/// \brief
+///
+/// \date   17 Oct 2026  2345
+///
+/// \note None
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "TraceWriter.h"
+
+#include "CluelessEnums.h"	//for translate...TypeToText use
+
+#include <cstring>			//for std::memcpy, std::memset, std::strlen use
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::logic_error use
+
+//------------------------------------------------------------------------------
+// Local Helpers
+//------------------------------------------------------------------------------
+static const unsigned int PROCESS_ID = 1;
+
+static const long long CALIBRATION_NS = 1000000; //time over which clock rate timed
+
+static const size_t MAX_EVENT_SIZE = 512; //characters of one formatted event, at most,
+                                          //counting fragments' padding
+
+static const char DIGIT_PAIRS[] =
+	"0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+	"5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Writes characters of text.
+/// \param char*: text
+/// \param size_t: number of characters
+/// \param char*: where to write
+/// \return char*: just past characters written
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static char*
+writeText(
+	const char* text, //i - text
+	size_t length, //i - number of characters
+	char* out) // o- where to write
+{
+	std::memcpy( out, text, length );
+
+	return( out + length );
+
+} //end routine writeText()
+
+
+////////////////////////////////////////////////////////////////////////////////
+static char*
+writeText(
+	const char* text, //i - text (nul-terminated)
+	char* out) // o- where to write
+{
+	return writeText( text, std::strlen(text), out );
+
+} //end routine writeText()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Writes fragment.
+/// \param Fragment: fragment
+/// \param char*: where to write; room for FRAGMENT_SIZE characters
+/// \return char*: just past fragment's text
+/// \throw None
+/// \note
+/// - Copies padding too, which following text overwrites.
+////////////////////////////////////////////////////////////////////////////////
+static char*
+writeFragment(
+	const TraceWriter::Fragment& fragment, //i - fragment
+	char* out) // o- where to write
+{
+	std::memcpy( out, fragment._text, TraceWriter::FRAGMENT_SIZE );
+
+	return( out + fragment._length );
+
+} //end routine writeFragment()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Writes decimal digits of value, two at a time, in place.
+/// \param unsigned long long: value
+/// \param char*: where to write
+/// \return char*: just past digits written
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static char*
+writeUnsigned(
+	unsigned long long value, //i - value
+	char* out) // o- where to write
+{
+	size_t num_digits( 1 );
+	for(unsigned long long rest(value / 10); 0 != rest; rest /= 10)
+	{
+		++num_digits;
+	}
+
+	char* const digits_end( out + num_digits );
+	char* first_digit( digits_end );
+
+	while( 100 <= value )
+	{
+		const size_t pair( 2 * (size_t)(value % 100) );
+		value /= 100;
+
+		*--first_digit = DIGIT_PAIRS[pair + 1];
+		*--first_digit = DIGIT_PAIRS[pair];
+	}
+
+	if( 10 <= value )
+	{
+		*--first_digit = DIGIT_PAIRS[2 * value + 1];
+		*--first_digit = DIGIT_PAIRS[2 * value];
+	}
+	else
+	{
+		*--first_digit = (char)('0' + value);
+	}
+
+	return digits_end;
+
+} //end routine writeUnsigned()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Writes nanoseconds as microseconds, to three decimals.
+/// \param unsigned long long: nanoseconds
+/// \param char*: where to write
+/// \return char*: just past characters written
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static char*
+writeMicroseconds(
+	unsigned long long nanoseconds, //i - nanoseconds
+	char* out) // o- where to write
+{
+	const size_t fraction( (size_t)(nanoseconds % 1000) );
+
+	out = writeUnsigned( nanoseconds / 1000, out );
+	*out++ = '.';
+	*out++ = (char)('0' + fraction / 100);
+	*out++ = DIGIT_PAIRS[2 * (fraction % 100)];
+	*out++ = DIGIT_PAIRS[2 * (fraction % 100) + 1];
+
+	return out;
+
+} //end routine writeMicroseconds()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns fragment naming enumerated value from table.
+/// \param vector<Fragment>: fragments by value
+/// \param unsigned char: value
+/// \return Fragment: fragment; first (unknown) when value beyond table
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static const TraceWriter::Fragment&
+lookUpName(
+	const std::vector<TraceWriter::Fragment>& names, //i - fragments by value
+	unsigned char value) //i - value
+{
+	return( (value < names.size()) ? names[value] : names[0] );
+
+} //end routine lookUpName()
+
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Extended constructor
+/// \param char*: path of trace file; replaced if present
+/// \param unsigned long: every this many games traced, from first (1 for
+///  all)
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when trace interval is 0.
+/// - INSUFFICIENT_DATA when file cannot be created.
+/// \note
+/// - Times clock rate, taking CALIBRATION_NS on x86.
+/// - Starts background thread writing submitted blocks.
+////////////////////////////////////////////////////////////////////////////////
+TraceWriter::TraceWriter(
+	const char* path, //i - path of trace file
+	unsigned long trace_interval) //i - every this many games traced
+	: _file( path, std::ios::binary | std::ios::trunc )
+	, _traceInterval( trace_interval )
+	, _originTicks( readTicks() )
+	, _nanosecondsPerTick( 1.0 )
+	, _isClosing( false )
+{
+	if( 0 == trace_interval )
+	{
+		std::ostringstream msg;
+		msg << "TraceWriter::TraceWriter()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  trace interval must be at least 1";
+		throw std::logic_error( msg.str() );
+	}
+
+	if( ! _file )
+	{
+		std::ostringstream msg;
+		msg << "TraceWriter::TraceWriter()\n"
+			<< "  INSUFFICIENT_DATA\n"
+			<< "  cannot create trace file " << path;
+		throw std::logic_error( msg.str() );
+	}
+
+	//--------------------------------------------------------------------------
+	// clock rate
+	//--------------------------------------------------------------------------
+#ifdef CLUELESS_HAS_RDTSC
+	const std::chrono::steady_clock::time_point start_time( std::chrono::steady_clock::now() );
+	const unsigned long long start_ticks( readTicks() );
+
+	std::chrono::nanoseconds elapsed( 0 );
+	while( CALIBRATION_NS > elapsed.count() )
+	{
+		elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - start_time );
+	}
+
+	const unsigned long long elapsed_ticks( readTicks() - start_ticks );
+	if( 0 < elapsed_ticks )
+	{
+		_nanosecondsPerTick = (double)elapsed.count() / (double)elapsed_ticks;
+	}
+#endif
+
+	//--------------------------------------------------------------------------
+	// names
+	//--------------------------------------------------------------------------
+	std::vector<std::string> person_names; //"none" for unknown
+	for(int person(clueless::UNKNOWN_PERSON); person <= clueless::PROFESSOR_PLUM; ++person)
+	{
+		person_names.push_back( clueless::translatePersonTypeToText(clueless::PersonType(person)) );
+	}
+	person_names[clueless::UNKNOWN_PERSON] = "none";
+
+	std::vector<std::string> weapon_names;
+	for(int weapon(clueless::UNKNOWN_WEAPON); weapon <= clueless::WRENCH; ++weapon)
+	{
+		weapon_names.push_back( clueless::translateWeaponTypeToText(clueless::WeaponType(weapon)) );
+	}
+
+	std::vector<std::string> room_names;
+	for(int room(clueless::UNKNOWN_ROOM); room <= clueless::KITCHEN; ++room)
+	{
+		room_names.push_back( clueless::translateRoomTypeToText(clueless::RoomType(room)) );
+	}
+
+	//--------------------------------------------------------------------------
+	// heads
+	//--------------------------------------------------------------------------
+	_heads[GAME] = makeHead( "game", false );
+	_heads[MOVE] = makeHead( "move", false );
+	_heads[SUGGESTION] = makeHead( "suggestion", false );
+	_heads[NOTEBOOK_UPDATE] = makeHead( "notebook update", false );
+	_heads[ACCUSATION] = makeHead( "accusation", false );
+	_heads[TURN_SKIPPED] = makeHead( "turn skipped", true );
+	_heads[COUNTER_EVIDENCE] = makeHead( "counter-evidence shown", true );
+
+	for(size_t person(0); person < person_names.size(); ++person)
+	{
+		_turnHeads.push_back( makeHead(person_names[person], false) );
+	}
+
+	for(int option(clueless::DO_NOTHING_ELSE_THIS_TURN); option <= clueless::MAKE_ACCUSATION; ++option)
+	{
+		_decisionHeads.push_back( makeHead("decide: " +
+			clueless::translateTurnOptionTypeToText(clueless::TurnOptionType(option)), false) );
+	}
+
+	//--------------------------------------------------------------------------
+	// arguments, in order written
+	//--------------------------------------------------------------------------
+	addArgument( TURN_SKIPPED, 0, "character", person_names );
+
+	_arguments[MOVE][1].push_back( makeFragment(",\"random\":false") );
+	_arguments[MOVE][1].push_back( makeFragment(",\"random\":true") );
+
+	addArgument( SUGGESTION, 0, "person", person_names );
+	addArgument( SUGGESTION, 1, "weapon", weapon_names );
+	addArgument( SUGGESTION, 2, "room", room_names );
+	addArgument( SUGGESTION, 3, "refuter", person_names );
+
+	addArgument( NOTEBOOK_UPDATE, 0, "suggestor", person_names );
+
+	addArgument( ACCUSATION, 0, "accuser", person_names );
+	_arguments[ACCUSATION][1].push_back( makeFragment(",\"correct\":false") );
+	_arguments[ACCUSATION][1].push_back( makeFragment(",\"correct\":true") );
+
+	addArgument( COUNTER_EVIDENCE, 0, "refuter", person_names );
+	addArgument( COUNTER_EVIDENCE, 1, "suggestor", person_names );
+
+	_file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+		<< "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << PROCESS_ID
+		<< ",\"args\":{\"name\":\"Clue-Less games\"}}";
+
+	_writerThread = std::thread( &TraceWriter::writeBlocks, this );
+
+} //end routine constructor
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Destructor
+/// \note
+/// - Closes file if not already closed; errors are lost (call close() to
+///   see them).
+////////////////////////////////////////////////////////////////////////////////
+TraceWriter::~TraceWriter()
+{
+	try
+	{
+		close();
+	}
+	catch(...)
+	{
+	}
+
+} //end routine destructor
+
+
+//------------------------------------------------------------------------------
+// Additional Member Functions
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Queues worker's events to be written, and hands back an empty
+///  block (reused, when one is spare) to collect more.
+/// \param unsigned int: worker's thread id within trace (1 and up)
+/// \param vector<Event>: events collected; emptied
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when writer closed.
+/// \note
+/// - Safe to call from many threads.
+/// - Waits while MAX_QUEUED_BLOCKS blocks are queued.
+/// - Wakes writer thread only when queue was empty, the one case in which
+///   it waits.
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceWriter::submit(
+	unsigned int thread_id, //i - worker's thread id within trace
+	std::vector<Event>* events) //io- events collected; emptied
+{
+	if( events->empty() )
+	{
+		return;
+	}
+
+	bool was_empty( false );
+
+	{
+		std::unique_lock<std::mutex> lock( _queueMutex );
+		_queueChanged.wait( lock, [this]()
+		{
+			return( _isClosing || (MAX_QUEUED_BLOCKS > _queue.size()) );
+		} );
+
+		if( _isClosing )
+		{
+			std::ostringstream msg;
+			msg << "TraceWriter::submit()\n"
+				<< "  INCONSISTENT_DATA\n"
+				<< "  trace file closed";
+			throw std::logic_error( msg.str() );
+		}
+
+		was_empty = _queue.empty();
+
+		_queue.push_back( Block() );
+		_queue.back()._threadId = thread_id;
+		_queue.back()._events.swap( *events );
+
+		if( ! _spares.empty() )
+		{
+			events->swap( _spares.back() );
+			_spares.pop_back();
+		}
+	}
+
+	if( was_empty )
+	{
+		_queueChanged.notify_all();
+	}
+
+} //end routine submit()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Writes blocks still queued, ends JSON, and closes file.
+/// \param None
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when file could not be written.
+/// \note
+/// - Does nothing once closed.
+/// - Workers must have submitted their last blocks.
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceWriter::close()
+{
+	if( ! _writerThread.joinable() )
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock( _queueMutex );
+		_isClosing = true;
+	}
+
+	_queueChanged.notify_all();
+	_writerThread.join();
+
+	_file << "\n]}\n";
+	_file.close();
+
+	if( ! _file )
+	{
+		std::ostringstream msg;
+		msg << "TraceWriter::close()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  failed writing trace file";
+		throw std::logic_error( msg.str() );
+	}
+
+} //end routine close()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Formats and writes queued blocks until closed and queue empty.
+/// \param None
+/// \return None
+/// \throw None
+/// \note
+/// - Runs on writer thread; file is touched by no other thread until
+///   writer thread ends.
+/// - Takes every queued block at once, and hands their emptied events back
+///   as spares at once, so the queue is locked twice per batch rather than
+///   per block.
+/// - Text is formatted into a buffer sized for a block's worst case, grown
+///   only for a larger block, so formatting neither allocates nor checks
+///   capacity per character.
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceWriter::writeBlocks()
+{
+	std::vector<char> text;
+	std::deque<Block> blocks; //taken from queue together
+
+	std::unique_lock<std::mutex> lock( _queueMutex );
+
+	while( true )
+	{
+		_queueChanged.wait( lock, [this]()
+		{
+			return( _isClosing || ! _queue.empty() );
+		} );
+
+		if( _queue.empty() )
+		{
+			break; //closing, and all written
+		}
+
+		blocks.swap( _queue );
+
+		lock.unlock();
+		_queueChanged.notify_all(); //room for waiting workers
+
+		//----------------------------------------------------------------------
+		// format and write
+		//----------------------------------------------------------------------
+		for(std::deque<Block>::iterator block(blocks.begin()); block != blocks.end(); ++block)
+		{
+			const size_t max_text_size( MAX_EVENT_SIZE * (block->_events.size() + 1) );
+			if( text.size() < max_text_size )
+			{
+				text.resize( max_text_size );
+			}
+
+			char* out( writeThreadName(block->_threadId, text.data()) );
+
+			const Fragment& thread_fields( _threadFields[block->_threadId] );
+			for(size_t event_index(0); event_index < block->_events.size(); ++event_index)
+			{
+				out = writeEvent( block->_events[event_index], thread_fields, out );
+			}
+
+			_file.write( text.data(), out - text.data() );
+
+			block->_events.clear();
+		}
+
+		lock.lock();
+		for(std::deque<Block>::iterator block(blocks.begin());
+			(block != blocks.end()) && (MAX_QUEUED_BLOCKS > _spares.size()); ++block)
+		{
+			_spares.push_back( std::vector<Event>() );
+			_spares.back().swap( block->_events );
+		}
+		blocks.clear();
+
+	} //end while (blocks to write)
+
+} //end routine writeBlocks()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Writes thread-name event, and formats thread's fields, first time
+///  thread is seen.
+/// \param unsigned int: worker's thread id within trace
+/// \param char*: where to write
+/// \return char*: just past characters written
+/// \throw None
+/// \note
+/// - Writer thread only.
+////////////////////////////////////////////////////////////////////////////////
+char*
+TraceWriter::writeThreadName(
+	unsigned int thread_id, //i - worker's thread id within trace
+	char* out) // o- where to write
+{
+	if( (thread_id < _threadFields.size()) && (0 != _threadFields[thread_id]._length) )
+	{
+		return out;
+	}
+
+	if( thread_id >= _threadFields.size() )
+	{
+		_threadFields.resize( thread_id + 1, Fragment() );
+	}
+	_threadFields[thread_id] = makeFragment( ",\"pid\":" + std::to_string(PROCESS_ID)
+		+ ",\"tid\":" + std::to_string(thread_id)
+		+ ",\"args\":{\"game\":" );
+
+	out = writeText( ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":", out ); //follows process name
+	out = writeUnsigned( PROCESS_ID, out );
+	out = writeText( ",\"tid\":", out );
+	out = writeUnsigned( thread_id, out );
+	out = writeText( ",\"args\":{\"name\":\"worker ", out );
+	out = writeUnsigned( thread_id, out );
+	out = writeText( "\"}}", out );
+
+	return out;
+
+} //end routine writeThreadName()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Writes event as JSON object, preceded by separator.
+/// \param Event: event
+/// \param Fragment: pid, tid, and opening of args, as formatted for worker
+/// \param char*: where to write; room for MAX_EVENT_SIZE characters
+/// \return char*: just past characters written
+/// \throw None
+/// \note
+/// - Called after writeThreadName(), so a separator is always needed.
+/// - Names come from tables built once.
+////////////////////////////////////////////////////////////////////////////////
+char*
+TraceWriter::writeEvent(
+	const Event& event, //i - event
+	const Fragment& thread_fields, //i - pid, tid, and opening of args
+	char* out) // o- where to write
+const
+{
+	const unsigned char* values( event._values );
+
+	switch( event._type )
+	{
+	case TURN:
+		out = writeFragment( lookUpName(_turnHeads, values[0]), out );
+		break;
+
+	case DECISION:
+		out = writeFragment( lookUpName(_decisionHeads, values[1]), out );
+		break;
+
+	default:
+		out = writeFragment( _heads[event._type], out );
+
+	} //end switch (on event type)
+
+	const unsigned long long start( convertToNanoseconds(event._start) );
+	out = writeMicroseconds( start, out );
+
+	if( (TURN_SKIPPED != event._type) && (COUNTER_EVIDENCE != event._type) )
+	{
+		out = writeText( ",\"dur\":", out ); //end converted too, so nested spans stay within
+		out = writeMicroseconds( convertToNanoseconds(event._start + event._duration) - start, out );
+	}
+
+	//--------------------------------------------------------------------------
+	// arguments
+	//--------------------------------------------------------------------------
+	out = writeFragment( thread_fields, out );
+	out = writeUnsigned( event._gameIndex, out );
+
+	for(size_t value_index(0); value_index < NUM_VALUES; ++value_index)
+	{
+		const std::vector<Fragment>& arguments( _arguments[event._type][value_index] );
+		if( ! arguments.empty() )
+		{
+			out = writeFragment( lookUpName(arguments, values[value_index]), out );
+		}
+	}
+
+	*out++ = '}';
+	*out++ = '}';
+
+	return out;
+
+} //end routine writeEvent()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Formats argument of event type from value, for each value named.
+/// \param EventType: kind of event
+/// \param size_t: index of value within Event::_values
+/// \param char*: key
+/// \param vector<string>: names by value (need no escaping); first for
+///  value beyond them
+/// \return None
+/// \throw None
+/// \note
+/// - Constructor only; arguments are written in order of value index.
+////////////////////////////////////////////////////////////////////////////////
+void
+TraceWriter::addArgument(
+	EventType type, //i - kind of event
+	size_t value_index, //i - index of value
+	const char* key, //i - key
+	const std::vector<std::string>& names) //i - names by value
+{
+	std::vector<Fragment>& arguments( _arguments[type][value_index] );
+
+	for(size_t value(0); value < names.size(); ++value)
+	{
+		arguments.push_back( makeFragment(",\"" + std::string(key) + "\":\"" + names[value] + "\"") );
+	}
+
+} //end routine addArgument()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Makes fragment of text.
+/// \param string: text
+/// \return Fragment: fragment
+/// \throw
+/// - INCONSISTENT_DATA when text does not fit.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+TraceWriter::Fragment
+TraceWriter::makeFragment(
+	const std::string& text) //i - text
+{
+	if( text.size() > FRAGMENT_SIZE )
+	{
+		std::ostringstream msg;
+		msg << "TraceWriter::makeFragment()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  text longer than " << FRAGMENT_SIZE << " characters: " << text;
+		throw std::logic_error( msg.str() );
+	}
+
+	Fragment fragment;
+	std::memset( fragment._text, ' ', FRAGMENT_SIZE );
+	std::memcpy( fragment._text, text.data(), text.size() );
+	fragment._length = text.size();
+
+	return fragment;
+
+} //end routine makeFragment()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Makes start of event: separator, name, and phase, up to the
+///  timestamp's value.
+/// \param string: name (needs no escaping)
+/// \param bool: whether instant, else complete span
+/// \return Fragment: fragment
+/// \throw
+/// - INCONSISTENT_DATA when name is too long.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+TraceWriter::Fragment
+TraceWriter::makeHead(
+	const std::string& name, //i - name
+	bool is_instant) //i - whether instant, else complete span
+{
+	return makeFragment( ",\n{\"name\":\"" + name +
+		(is_instant ? "\",\"ph\":\"i\",\"s\":\"t\",\"ts\":" : "\",\"ph\":\"X\",\"ts\":") );
+
+} //end routine makeHead()
@@ -0,0 +1,246 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file TraceWriter.h
+/// \brief Writes timed spans of simulated games as a Chrome trace-event file,
+///        viewable in Perfetto (ui.perfetto.dev) or chrome://tracing.
+///
+/// \date   17 Oct 2026  2340
+///
+/// \note
+/// - Each worker thread collects its spans in blocks of compact binary
+///   events (see TraceEventSink) and submits full blocks; a background
+///   thread takes every queued block at once, formats them as JSON, and
+///   writes them together, so simulating threads neither format text nor
+///   wait on the file.
+/// - File is a JSON object with one "traceEvents" array: complete ("X")
+///   events for spans, instant ("i") events, and one thread-name ("M")
+///   event per worker.  Timestamps are microseconds since the writer was
+///   created; every event carries pid 1 and its worker's tid.
+/// - Workers read the time-stamp counter on x86 (steady_clock elsewhere),
+///   about half the cost of steady_clock there; the writer converts ticks
+///   to time by a rate timed at construction.
+/// - At most MAX_QUEUED_BLOCKS blocks wait to be written; a worker
+///   submitting beyond that waits, which bounds memory when the file cannot
+///   keep up.
+/// - Every game is traced unless a trace interval samples every Nth game.
+/// - Text of names, arguments, and each worker's pid and tid is built once
+///   as fixed-size fragments, so formatting an event copies a few fragments
+///   whole and writes its numbers.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TraceWriter_h
+#define TraceWriter_h
+
+#include <stddef.h>				//for size_t use
+#include <chrono>				//for std::chrono::steady_clock use
+#include <condition_variable>	//for std::condition_variable use
+#include <deque>				//for std::deque use
+#include <fstream>				//for std::ofstream use
+#include <mutex>				//for std::mutex use
+#include <string>				//for std::string use
+#include <thread>				//for std::thread use
+#include <vector>				//for std::vector use
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>				//for __rdtsc use
+#define CLUELESS_HAS_RDTSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>			//for __rdtsc use
+#define CLUELESS_HAS_RDTSC
+#endif
+
+
+class TraceWriter
+{
+	//--------------------------------------------------------------------------
+	// Class-Scoped Constants
+	//--------------------------------------------------------------------------
+public:
+	static const size_t MAX_QUEUED_BLOCKS = 64; //blocks awaiting write
+
+	static const size_t NUM_VALUES = 4;
+
+	static const size_t FRAGMENT_SIZE = 64; //characters copied per fragment
+
+	//--------------------------------------------------------------------------
+	// Class-Scoped Enumerated Types
+	//--------------------------------------------------------------------------
+public:
+	/// \note values listed are those of Event::_values
+	enum EventType
+	{
+		GAME,             //span: game, start to end
+		TURN,             //span: character
+		DECISION,         //span: character, turn option chosen
+		MOVE,             //span: character, was random choice (0 / 1)
+		SUGGESTION,       //span: person, weapon, room, refuter (0 for none)
+		NOTEBOOK_UPDATE,  //span: suggestor character
+		ACCUSATION,       //span: character, was correct (0 / 1)
+		TURN_SKIPPED,     //instant: character
+		COUNTER_EVIDENCE, //instant: refuter character, suggestor character
+
+		NUM_EVENT_TYPES
+
+	}; //end enum EventType defn
+
+	//--------------------------------------------------------------------------
+	// Class-Scoped Types
+	//--------------------------------------------------------------------------
+public:
+	/// \brief One span or instant, as collected by a worker.
+	struct Event
+	{
+		unsigned long long _start;    //clock ticks since writer created
+		unsigned long long _duration; //clock ticks; 0 for instants
+		unsigned long _gameIndex;
+		unsigned char _type;          //EventType
+		unsigned char _values[NUM_VALUES]; //as listed by EventType
+
+	}; //end struct Event defn
+
+	/// \brief Events of one worker thread, in order collected.
+	struct Block
+	{
+		unsigned int _threadId;
+		std::vector<Event> _events;
+
+	}; //end struct Block defn
+
+	/// \brief Text formatted once, always copied as FRAGMENT_SIZE characters
+	///  (a fixed-size copy) and then passed by its own length.
+	struct Fragment
+	{
+		char _text[FRAGMENT_SIZE]; //text, then padding
+		size_t _length;            //0 until formatted
+
+	}; //end struct Fragment defn
+
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+private:
+	/// \brief Default constructor
+	TraceWriter();
+
+	/// \brief Copy constructor
+	TraceWriter(const TraceWriter&);
+
+public:
+	TraceWriter(const char* path, unsigned long traceInterval);
+
+	virtual ~TraceWriter();
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	bool isGameTraced(unsigned long gameIndex) const;
+	unsigned long long readClock() const;
+
+	//--------------------------------------------------------------------------
+	// Additional Member Functions
+	//--------------------------------------------------------------------------
+	void submit(unsigned int threadId, std::vector<Event>* events);
+	void close();
+
+protected:
+	void writeBlocks();
+
+	char* writeThreadName(unsigned int threadId, char* out);
+	char* writeEvent(const Event& event, const Fragment& threadFields, char* out) const;
+
+	unsigned long long convertToNanoseconds(unsigned long long ticks) const;
+
+	void addArgument(EventType type,
+		size_t valueIndex,
+		const char* key,
+		const std::vector<std::string>& names);
+
+	static Fragment makeFragment(const std::string& text);
+	static Fragment makeHead(const std::string& name, bool isInstant);
+
+	static unsigned long long readTicks();
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+protected:
+	std::ofstream _file;
+	const unsigned long _traceInterval; //every this many games traced, from first
+	const unsigned long long _originTicks; //of timestamps
+	double _nanosecondsPerTick;            //timed at construction; 1 without TSC
+
+	Fragment _heads[NUM_EVENT_TYPES];     //separator, name, phase, up to "ts"
+	std::vector<Fragment> _turnHeads;     //by PersonType
+	std::vector<Fragment> _decisionHeads; //by TurnOptionType
+	std::vector<Fragment> _arguments[NUM_EVENT_TYPES][NUM_VALUES]; //,"key":value
+	                                      //by value; empty when value no argument
+
+	std::mutex _queueMutex; //guards members below, up to writer thread
+	std::condition_variable _queueChanged;
+	std::deque<Block> _queue;                   //blocks awaiting write
+	std::vector<std::vector<Event> > _spares;   //written blocks, for reuse
+	bool _isClosing;
+
+	std::thread _writerThread;           //runs writeBlocks()
+	std::vector<Fragment> _threadFields; //pid, tid, and opening of args, by
+	                                     //thread id; empty until thread named;
+	                                     //writer thread only
+
+}; //end class TraceWriter defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline bool
+TraceWriter::isGameTraced(
+	unsigned long game_index) //i - zero-based game index within batch
+const
+{
+	return( 0 == (game_index % _traceInterval) );
+
+} //end routine isGameTraced()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned long long
+TraceWriter::readClock()
+const
+{
+	return( readTicks() - _originTicks );
+
+} //end routine readClock()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned long long
+TraceWriter::convertToNanoseconds(
+	unsigned long long ticks) //i - clock ticks
+const
+{
+	return (unsigned long long)( (double)ticks * _nanosecondsPerTick );
+
+} //end routine convertToNanoseconds()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned long long
+TraceWriter::readTicks()
+{
+#ifdef CLUELESS_HAS_RDTSC
+	return __rdtsc();
+#else
+	return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch() ).count();
+#endif
+
+} //end routine readTicks()
+
+
+#endif //TraceWriter_h defn
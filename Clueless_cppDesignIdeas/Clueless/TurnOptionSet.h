@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file TurnOptionSet.h
+/// \brief Options open to turn taker, as one bit per turn option.
+///
+/// \date   17 Oct 2026  2200
+///
+/// \note
+/// - Options are visited in TurnOptionType order, as in the ordered set it
+///   replaces, so a choice by position draws the same option.
+/// - Held by value; determining turn options allocates nothing.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TurnOptionSet_h
+#define TurnOptionSet_h
+
+#include "CluelessEnums.h"	//for TurnOptionType use
+
+#include <stddef.h>		//for size_t use
+
+
+class TurnOptionSet
+{
+	//--------------------------------------------------------------------------
+	// Constructors / Destructor
+	//--------------------------------------------------------------------------
+public:
+	/// \brief Default constructor
+	TurnOptionSet()
+		: _bits( 0 )
+	{
+	}
+
+	//--------------------------------------------------------------------------
+	// Accessors and Mutators
+	//--------------------------------------------------------------------------
+	bool isEmpty() const;
+	size_t getNumOptions() const;
+	bool hasOption(clueless::TurnOptionType option) const;
+	clueless::TurnOptionType getOption(size_t position) const;
+
+	void addOption(clueless::TurnOptionType option);
+	void clear();
+
+	//--------------------------------------------------------------------------
+	// Data Members
+	//--------------------------------------------------------------------------
+private:
+	unsigned char _bits; //bit per TurnOptionType
+
+}; //end class TurnOptionSet defn
+
+
+//------------------------------------------------------------------------------
+// Inlined Methods
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+inline bool
+TurnOptionSet::isEmpty()
+const
+{
+	return( 0 == _bits );
+
+} //end routine isEmpty()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline size_t
+TurnOptionSet::getNumOptions()
+const
+{
+	size_t num_options( 0 );
+	for(unsigned int bits(_bits); 0 != bits; bits &= (bits - 1))
+	{
+		++num_options;
+	}
+
+	return num_options;
+
+} //end routine getNumOptions()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline bool
+TurnOptionSet::hasOption(
+	clueless::TurnOptionType option) //i - option of interest
+const
+{
+	return( 0 != (_bits & (1u << option)) );
+
+} //end routine hasOption()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns option at position, counting in TurnOptionType order.
+/// \note position must be less than getNumOptions()
+////////////////////////////////////////////////////////////////////////////////
+inline clueless::TurnOptionType
+TurnOptionSet::getOption(
+	size_t position) //i - position amongst options
+const
+{
+	unsigned int bits( _bits );
+	for(; 0 < position; --position)
+	{
+		bits &= (bits - 1); //skip lowest option
+	}
+
+	size_t option( 0 );
+	while( 0 == (bits & (1u << option)) )
+	{
+		++option;
+	}
+
+	return clueless::TurnOptionType( option );
+
+} //end routine getOption()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline void
+TurnOptionSet::addOption(
+	clueless::TurnOptionType option) //i - option to add
+{
+	_bits |= (unsigned char)(1u << option);
+
+} //end routine addOption()
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline void
+TurnOptionSet::clear()
+{
+	_bits = 0;
+
+} //end routine clear()
+
+
+#endif //TurnOptionSet_h defn
@@ -90,27 +90,12 @@
 //------------------------------------------------------------------------------
 /* Period parameters */
 //------------------------------------------------------------------------------
-const unsigned short NNN = 624;
+const unsigned short NNN = MersenneTwister::STATE_LENGTH;
 const unsigned short MMM = 397;
 const unsigned long  MATRIX_A = 0x9908b0dfUL;  /* constant vector a */
 const unsigned long  UMASK = 0x80000000UL; /* most significant w-r bits */
 const unsigned long  LMASK = 0x7fffffffUL; /* least significant r bits */
 
-//------------------------------------------------------------------------------
-// populate static member variables
-//------------------------------------------------------------------------------
-//NOTE: since decrement at begin of rn request, essentially means no draws avail
-int  MersenneTwister::unused_draws_left = 1;
-bool MersenneTwister::is_initialized    = false;
-
-//------------------------------------------------------------------------------
-// define additional static variables
-//------------------------------------------------------------------------------
-static unsigned long state[NNN]; /* the array for the state vector  */
-static unsigned long *next = 0;  //ptr to draw from state array which will be
-                                 // used for next request
-
-
 //------------------------------------------------------------------------------
 //-- Name:   initialize                                  
 //--
@@ -253,8 +238,8 @@ MersenneTwister::drawInt32(void)
 		next_state();
 	}
 
-	//assign current value of next to yyy and increment next
-    yyy = *next++;
+	//assign value at next draw index to yyy and increment index
+    yyy = state[next_draw++];
 
     /* Tempering */
     yyy ^= (yyy >> 11);
@@ -291,8 +276,8 @@ MersenneTwister::drawInt31(void)
 		next_state();
 	}
 
-	//assign current value of next to yyy and increment next
-    yyy = *next++;
+	//assign value at next draw index to yyy and increment index
+    yyy = state[next_draw++];
 
     /* Tempering */
     yyy ^= (yyy >> 11);
@@ -330,8 +315,8 @@ MersenneTwister::drawReal1(void)
 		next_state();
 	}
 
-	//assign current value of next to yyy and increment next
-    yyy = *next++;
+	//assign value at next draw index to yyy and increment index
+    yyy = state[next_draw++];
 
     /* Tempering */
     yyy ^= (yyy >> 11);
@@ -370,8 +355,8 @@ MersenneTwister::drawReal2(void)
 		next_state();
 	}
 
-	//assign current value of next to yyy and increment next
-    yyy = *next++;
+	//assign value at next draw index to yyy and increment index
+    yyy = state[next_draw++];
 
     /* Tempering */
     yyy ^= (yyy >> 11);
@@ -410,8 +395,8 @@ MersenneTwister::drawReal3(void)
 		next_state();
 	}
 
-	//assign current value of next to yyy and increment next
-    yyy = *next++;
+	//assign value at next draw index to yyy and increment index
+    yyy = state[next_draw++];
 
     /* Tempering */
     yyy ^= (yyy >> 11);
@@ -504,6 +489,49 @@ MersenneTwister::drawReal3(
 //endchng  mem  24 Mar 2006
 
 
+//chng  17 Oct 2026
+//------------------------------------------------------------------------------
+//-- Name:  drawUniformInt
+//--
+//-- Description: Generates a random integer on [0,num_values)-interval, each
+//--              value equally likely.
+//--
+//-- Exceptions:  None
+//--
+//-- Programmer Notes:
+//--    - Rejects the few 32-bit draws below 2^32 mod num_values so the
+//--      remaining range is an exact multiple of num_values; the modulo is then
+//--      unbiased (unlike scaling a real draw and taking its floor).
+//--    - Returns zero when num_values is zero or one, without drawing.
+//--    - num_values must not exceed 2^32.
+//------------------------------------------------------------------------------
+unsigned long
+MersenneTwister::drawUniformInt(
+	unsigned long num_values)   //i - number of equally likely values
+{
+	if (num_values < 2)
+	{
+		return 0;
+	}
+
+	//2^32 mod num_values
+	const unsigned long threshold =
+		(unsigned long)((0x100000000ULL - num_values) % num_values);
+
+	unsigned long draw;
+	do
+	{
+		draw = drawInt32() & 0xffffffffUL;
+
+	} while (draw < threshold);
+
+	return (draw % num_values);
+
+} //end routine MersenneTwister::drawUniformInt
+
+//endchng  17 Oct 2026
+
+
 //------------------------------------------------------------------------------
 //-- Name:   next_state                                  
 //--
@@ -511,7 +539,7 @@ MersenneTwister::drawReal3(
 //--
 //-- Description: Populates state array with next sequence of draws.  Resets
 //--              indicators for number of draws requested from current state
-//--              array.  Resets pointer for next draw to be used to head of
+//--              array.  Resets index for next draw to be used to head of
 //--              state array.
 //--
 //-- Exceptions:  None
@@ -527,7 +555,7 @@ MersenneTwister::next_state(void)
     int jjj; //local loop counter
 
     //if initialization not yet performed
-    if ( !MersenneTwister::is_initialized )
+    if ( !is_initialized )
 	{
 		//initialize with default seed
 		initialize( 5489UL );
@@ -535,7 +563,7 @@ MersenneTwister::next_state(void)
 
 	//reset variables indicating state array use
     unused_draws_left = NNN; //no draws yet requested from new state array
-    next = state;            //next draw used from head of state array
+    next_draw = 0;           //next draw used from head of state array
 
 	//for first N-M elements of state array
     for (jjj = NNN-MMM+1; --jjj; p_state++)
@@ -33,6 +33,9 @@
 /// Modifications:
 ///  24 Mar 2006  mem  add draw methods to extend drawReal1, 2, & 3 for user
 ///                    specified interval
+///  17 Oct 2026       move generator state from statics into each instance so
+///                    independent games may draw concurrently
+///  17 Oct 2026       add unbiased integer draw on [0, n)
 ///
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -95,6 +98,9 @@ public:
 	// Default Constructor
 	//,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,
 	MersenneTwister()
+		: unused_draws_left( 1 )
+		, is_initialized( false )
+		, next_draw( 0 )
 	{
 	}
 
@@ -102,6 +108,9 @@ public:
 	// Description: Extended Constructor 1.
 	//,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,
 	MersenneTwister( unsigned long seed )
+		: unused_draws_left( 1 )
+		, is_initialized( false )
+		, next_draw( 0 )
 	{
 		//initialize PRNG with specified seed
 		initialize( seed );
@@ -115,6 +124,9 @@ public:
 	MersenneTwister(
 		unsigned long initialization_key_array[],
 		int key_array_length )
+		: unused_draws_left( 1 )
+		, is_initialized( false )
+		, next_draw( 0 )
 	{
 		//initialize PRNG with specified key array and key length
 		initialize( initialization_key_array, key_array_length );
@@ -134,10 +146,10 @@ public:
 	// Initialization
 	//--------------------------------------------------------------------------
 	// initializes state[N] with a seed (old name: init_genrand)
-	static void initialize( unsigned long seed );
+	void initialize( unsigned long seed );
 
 	// initialize by an array with array-length (old name: init_by_array)
-	static void initialize(
+	void initialize(
 		unsigned long initialization_key_array[], // array for initializing keys
 		int key_array_length );                   // array's length
 
@@ -146,42 +158,48 @@ public:
 	////////////////////////////////////////////////////////////////////////////
 	// generates a random number on [0,0xffffffff]-interval
 	// old name: genrand_int32
-	static unsigned long drawInt32(void);
+	unsigned long drawInt32(void);
 
 	// generates a random number on [0,0x7fffffff]-interval
 	// old name: genrand_int31
-	static long drawInt31(void);
+	long drawInt31(void);
 
 	// generates a random number on [0,1]-real-interval
 	// old name: genrand_real1
-	static double drawReal1(void);
+	double drawReal1(void);
 
 	// generates a random number on [0,1)-real-interval
 	// old name: genrand_real2
-	static double drawReal2(void);
+	double drawReal2(void);
 
 	// generates a random number on (0,1)-real-interval
 	// old name: genrand_real2
-	static double drawReal3(void);
+	double drawReal3(void);
 
 	// generates a random number on [0,1) with 53-bit resolution
 	// old name: genrand_res53
-	static double drawRes53(void);
+	double drawRes53(void);
 
 //chng  24 Mar 2006  mem
 	// generates random number on [a,b]-real-interval
-	static double drawReal1(double lower_bound, double upper_bound); // [a,b]
+	double drawReal1(double lower_bound, double upper_bound); // [a,b]
 
 	// generates random number on [a,b)-real-interval
-	static double drawReal2(double lower_bound, double upper_bound); // [a,b)
+	double drawReal2(double lower_bound, double upper_bound); // [a,b)
 
 	// generates random number on (a,b)-real-interval
-	static double drawReal3(double lower_bound, double upper_bound); // (a,b)
+	double drawReal3(double lower_bound, double upper_bound); // (a,b)
 
 //endchng  mem  24 Mar 2006
 
+//chng  17 Oct 2026
+	// generates random integer on [0,n)-interval without modulo bias
+	unsigned long drawUniformInt(unsigned long num_values); // [0,n)
+
+//endchng  17 Oct 2026
+
 private:
-	static void next_state(void);
+	void next_state(void);
 
 	static unsigned long mixBits( unsigned long first, unsigned long second );
 	static unsigned long twist( unsigned long first, unsigned long second );
@@ -189,9 +207,15 @@ private:
 	////////////////////////////////////////////////////////////////////////////
 	// Data Members
 	////////////////////////////////////////////////////////////////////////////
+public:
+	static const int STATE_LENGTH = 624; //N in original code
+
 private:
-	static int  unused_draws_left;
-	static bool is_initialized;
+	int  unused_draws_left;
+	bool is_initialized;
+
+	unsigned long state[STATE_LENGTH]; //the array for the state vector
+	int next_draw; //index within state array of draw used for next request
 
 }; //end class MersenneTwister defn
 
@@ -0,0 +1,933 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file ReplayInspector.cpp
+/// \brief Examines games in a replay log and plays them again.
+///
+/// \date   17 Oct 2026  2300
+///
+/// \note
+/// - Usage:
+///     ReplayInspector LOG [--game G] [--turn T] [--turns K] [--resimulate]
+///                         [--narrate] [--layout FILE]
+///     ReplayInspector LOG --find [--winner NAME] [--min-rounds R]
+///                         [--max-rounds R] [--no-winner]
+///                         [--min-false-accusers N] [--limit N]
+/// - LOG is written by BatchSimulator --replay-log (or Clueless --replay-log).
+///   Alone, its header, number of games, and compressed size are listed.
+/// - G (zero-based game index within batch) lists that game's seed, deal,
+///   and outcome; only G's record is read from LOG.
+/// - T lists board state at the start of player turn T (counted from zero,
+///   one per player per round) and the events of K turns (default 1) from
+///   there.  The nearest keyframe at or before T is decoded, never the whole
+///   game.
+/// - --resimulate plays G again from its seed with the batch's settings and
+///   checks every event matches the log, reporting the first turn that does
+///   not; --narrate prints the game as it is played again.  Only
+///   BatchSimulator logs can be re-simulated.
+/// - FILE is the layout the batch was played on; needed when it was not the
+///   classic board.
+/// - --find counts the games whose outcome matches every filter given and
+///   lists the first N (default 20): won by NAME (e.g. "MISS_SCARLET" or
+///   "Scarlet"), won or abandoned within rounds R, by nobody, or with at
+///   least N false accusations.  Only LOG's index is read.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "../Clueless/Board.h"
+#include "../Clueless/BoardLayout.h"
+#include "../Clueless/Card.h"
+#include "../Clueless/GameSimulator.h"
+#include "../Clueless/Location.h"
+#include "../Clueless/mersenneTwister.h"
+#include "../Clueless/ReplayGame.h"
+#include "../Clueless/ReplayLogFile.h"
+#include "../Clueless/ReplayLogSink.h"
+#include "../Clueless/TextEventSink.h"
+
+#include "../Clueless/CluelessEnums.h"	//for translate*ToText use
+
+#include <cctype>			//for std::isalpha, std::tolower use
+#include <chrono>			//for std::chrono::steady_clock use
+#include <cstdlib>			//for std::strtoul use
+#include <cstring>			//for std::strcmp use
+#include <fstream>			//for std::ifstream use
+#include <iostream>			//for std::cout use
+#include <memory>			//for std::unique_ptr use
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::exception use
+#include <string>			//for std::string use
+#include <vector>			//for std::vector use
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Parses unsigned value following command line option.
+/// \param int: index of option within argument list
+/// \param int: number of arguments
+/// \param char*[]: argument list
+/// \return unsigned long: parsed value
+/// \throw
+/// - INSUFFICIENT_DATA when option has no value.
+/// - INCONSISTENT_DATA when value not a non-negative integer.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static unsigned long
+parseOptionValue(
+	int option_index, //i - index of option within argument list
+	int argc, //i - number of arguments
+	const char* argv[]) //i - argument list
+{
+	if( option_index + 1 >= argc )
+	{
+		std::ostringstream msg;
+		msg << "parseOptionValue()\n"
+			<< "  INSUFFICIENT_DATA\n"
+			<< "  missing value for option " << argv[option_index];
+		throw std::logic_error( msg.str() );
+	}
+
+	const char* text( argv[option_index + 1] );
+	char* text_end( nullptr );
+	unsigned long value( std::strtoul(text, &text_end, 10) );
+
+	if( (text == text_end) || ('\0' != *text_end) || ('-' == *text) )
+	{
+		std::ostringstream msg;
+		msg << "parseOptionValue()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  invalid value for option " << argv[option_index]
+			<< ": " << text;
+		throw std::logic_error( msg.str() );
+	}
+
+	return value;
+
+} //end routine parseOptionValue()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Parses character name, e.g. "MISS_SCARLET", "Miss Scarlet", or
+///  "scarlet".
+/// \param char*: name
+/// \return PersonType: character named
+/// \throw
+/// - INCONSISTENT_DATA when name is no character's.
+/// \note
+/// - Case, spaces, punctuation, and title are ignored.
+////////////////////////////////////////////////////////////////////////////////
+static clueless::PersonType
+parsePersonName(
+	const char* name) //i - name
+{
+	std::string letters;
+	for(const char* curr_char(name); '\0' != *curr_char; ++curr_char)
+	{
+		if( std::isalpha((unsigned char)*curr_char) )
+		{
+			letters += (char)std::tolower( (unsigned char)*curr_char );
+		}
+	}
+
+	for(size_t person(clueless::MISS_SCARLET); person <= clueless::PROFESSOR_PLUM; ++person)
+	{
+		const std::string full_name( clueless::translatePersonTypeToText(clueless::PersonType(person)) );
+
+		std::string full_letters;
+		std::string surname;
+		for(size_t char_index(0); char_index < full_name.size(); ++char_index)
+		{
+			const char curr_char( full_name[char_index] );
+			if( ' ' == curr_char )
+			{
+				surname.clear();
+			}
+			else if( std::isalpha((unsigned char)curr_char) )
+			{
+				full_letters += (char)std::tolower( (unsigned char)curr_char );
+				surname += (char)std::tolower( (unsigned char)curr_char );
+			}
+		}
+
+		if( (letters == full_letters) || (letters == surname) )
+		{
+			return clueless::PersonType( person );
+		}
+
+	} //end for (each character)
+
+	std::ostringstream msg;
+	msg << "parsePersonName()\n"
+		<< "  INCONSISTENT_DATA\n"
+		<< "  no character named " << name;
+	throw std::logic_error( msg.str() );
+
+} //end routine parsePersonName()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns name of location on board.
+/// \param Board: board game was played on
+/// \param unsigned long: location identifier
+/// \return string: name; identifier when board has no such location
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static std::string
+describeLocation(
+	const Board& board, //i - board game was played on
+	unsigned long loc_id) //i - location identifier
+{
+	if( (loc_id < board.getLayout()->getNumLocations()) &&
+		board.getLocation(loc_id) )
+	{
+		return board.getLocation( loc_id )->getName();
+	}
+
+	std::ostringstream name;
+	name << "location " << loc_id;
+	return name.str();
+
+} //end routine describeLocation()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns person, weapon, and room named by values.
+/// \param unsigned long[]: person, weapon, room
+/// \return string: names
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static std::string
+describeSolution(
+	const unsigned long* values) //i - person, weapon, room
+{
+	return clueless::translatePersonTypeToText( clueless::PersonType(values[0]) ) + ", " +
+		clueless::translateWeaponTypeToText( clueless::WeaponType(values[1]) ) + ", " +
+		clueless::translateRoomTypeToText( clueless::RoomType(values[2]) );
+
+} //end routine describeSolution()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Prints one event.
+/// \param Board: board game was played on
+/// \param Event: event
+/// \param ReplayLogSink::Keyframe: board state after event
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static void
+printEvent(
+	const Board& board, //i - board game was played on
+	const ReplayGame::Event& event, //i - event
+	const ReplayLogSink::Keyframe& state) //i - board state after event
+{
+	const std::string character(
+		clueless::translatePersonTypeToText( clueless::PersonType(event._values[0]) ) );
+
+	switch( event._type )
+	{
+	case ReplayLogSink::KEYFRAME:
+		std::cout << "  (keyframe)\n";
+		break;
+
+	case ReplayLogSink::TURN_STARTED:
+		std::cout << "Turn " << (state._turn - 1) << ": " << character << "\n";
+		break;
+
+	case ReplayLogSink::TURN_SKIPPED:
+		std::cout << "  " << character << " skips turn (false accuser)\n";
+		break;
+
+	case ReplayLogSink::NO_PERMISSIBLE_MOVES:
+		std::cout << "  " << character << " has no permissible moves\n";
+		break;
+
+	case ReplayLogSink::STAY_IN_ROOM_ALLOWED:
+		std::cout << "  " << character << " may stay in room\n";
+		break;
+
+	case ReplayLogSink::TURN_OPTION_CHOSEN:
+		std::cout << "  " << character << " chooses "
+			<< clueless::translateTurnOptionTypeToText( clueless::TurnOptionType(event._values[1]) )
+			<< "\n";
+		break;
+
+	case ReplayLogSink::PLAYER_MOVED:
+		std::cout << "  " << character << " moves to "
+			<< describeLocation( board, event._values[1] )
+			<< ((0 != event._values[2]) ? " (random choice)" : "") << "\n";
+		break;
+
+	case ReplayLogSink::SUGGESTION_MADE:
+		std::cout << "  " << character << " suggests "
+			<< describeSolution( event._values + 1 ) << "\n";
+		break;
+
+	case ReplayLogSink::PERSON_TOKEN_MOVED:
+		std::cout << "  " << character << " token moved to "
+			<< clueless::translateRoomTypeToText( clueless::RoomType(event._values[1]) ) << "\n";
+		break;
+
+	case ReplayLogSink::WEAPON_TOKEN_MOVED:
+		std::cout << "  "
+			<< clueless::translateWeaponTypeToText( clueless::WeaponType(event._values[0]) )
+			<< " token moved to "
+			<< clueless::translateRoomTypeToText( clueless::RoomType(event._values[1]) ) << "\n";
+		break;
+
+	case ReplayLogSink::COUNTER_EVIDENCE_SHOWN:
+		std::cout << "  " << character << " shows "
+			<< clueless::translatePersonTypeToText( clueless::PersonType(event._values[1]) ) << " "
+			<< ((clueless::NUM_CARDS > event._values[2]) ? Card::fetch(event._values[2])->getName() : "unknown card")
+			<< "\n";
+		break;
+
+	case ReplayLogSink::SUGGESTION_REFUTED:
+		std::cout << "  suggestion refuted by " << character << "\n";
+		break;
+
+	case ReplayLogSink::SUGGESTION_UNREFUTED:
+		std::cout << "  " << character << "'s suggestion unrefuted\n";
+		break;
+
+	case ReplayLogSink::GAME_WON:
+		std::cout << "  " << character << " wins: "
+			<< describeSolution( event._values + 1 ) << "\n";
+		break;
+
+	case ReplayLogSink::FALSE_ACCUSATION_MADE:
+		std::cout << "  " << character << " accuses falsely: "
+			<< describeSolution( event._values + 1 ) << "\n";
+		break;
+
+	default:
+		std::cout << "  (set up)\n";
+		break;
+
+	} //end switch (event type)
+
+} //end routine printEvent()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Prints where every token is and who has accused falsely.
+/// \param Board: board game was played on
+/// \param ReplayLogSink::Keyframe: board state
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static void
+printState(
+	const Board& board, //i - board game was played on
+	const ReplayLogSink::Keyframe& state) //i - board state
+{
+	std::cout << "Board at start of turn " << state._turn << ":\n";
+
+	for(size_t person_index(0); person_index < ReplayLogSink::NUM_PERSONS; ++person_index)
+	{
+		const clueless::PersonType person( clueless::PersonType(person_index + 1) );
+
+		std::cout << "  " << clueless::translatePersonTypeToText( person )
+			<< ": " << describeLocation( board, state._personLocations[person_index] )
+			<< ((0 != (state._falseAccusers & (1u << person))) ? " (false accuser)" : "")
+			<< "\n";
+	}
+
+	for(size_t wpn_index(0); wpn_index < ReplayLogSink::NUM_WEAPONS; ++wpn_index)
+	{
+		std::cout << "  " << clueless::translateWeaponTypeToText( clueless::WeaponType(wpn_index + 1) )
+			<< ": " << describeLocation( board, state._weaponLocations[wpn_index] ) << "\n";
+	}
+
+} //end routine printState()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Prints game's seed, deal, and outcome.
+/// \param Board: board game was played on
+/// \param ReplayGame: game
+/// \return None
+/// \throw
+/// - INCONSISTENT_DATA when record malformed.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static void
+printGame(
+	const Board& board, //i - board game was played on
+	ReplayGame* game) //io- game
+{
+	const ReplayGame::SetUp& set_up( game->getSetUp() );
+
+	std::cout << "Game " << game->getGameIndex()
+		<< "  Seed: " << game->getSeed()
+		<< "  Record: " << game->getRecord().size() << " bytes"
+		<< "  Keyframes: " << game->getNumKeyframes() << "\n";
+
+	std::cout << "Case File: " << clueless::translatePersonTypeToText( set_up._casePerson )
+		<< ", " << clueless::translateWeaponTypeToText( set_up._caseWeapon )
+		<< ", " << clueless::translateRoomTypeToText( set_up._caseRoom ) << "\n";
+
+	for(size_t seat(0); seat < set_up._numPlayers; ++seat)
+	{
+		std::cout << "  Seat " << (seat + 1) << ": "
+			<< clueless::translatePersonTypeToText( set_up._characters[seat] )
+			<< " at " << describeLocation( board, set_up._startLocations[seat] ) << "; holds";
+
+		for(size_t pos_index(0); pos_index < set_up._numCardsInHand[seat]; ++pos_index)
+		{
+			std::cout << ((0 == pos_index) ? " " : ", ")
+				<< Card::fetch( set_up._hands[seat][pos_index] )->getName();
+		}
+		std::cout << "\n";
+
+	} //end for (each seat)
+
+	std::cout << "Player turns: " << game->getNumTurns() << "\n";
+
+	if( 0 == game->getNumTurns() )
+	{
+		return;
+	}
+
+	ReplayLogSink::Keyframe final_state;
+	game->seekTurn( game->getNumTurns(), &final_state );
+
+	if( clueless::UNKNOWN_PERSON != final_state._winner )
+	{
+		std::cout << "Winner: " << clueless::translatePersonTypeToText( final_state._winner ) << "\n";
+	}
+	else
+	{
+		std::cout << "No winner\n";
+	}
+
+	if( 0 != final_state._falseAccusers )
+	{
+		std::cout << "False accusers:";
+		for(size_t person(clueless::MISS_SCARLET); person <= clueless::PROFESSOR_PLUM; ++person)
+		{
+			if( 0 != (final_state._falseAccusers & (1u << person)) )
+			{
+				std::cout << " " << clueless::translatePersonTypeToText( clueless::PersonType(person) );
+			}
+		}
+		std::cout << "\n";
+	}
+
+} //end routine printGame()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Plays game again with batch's settings and compares every event
+///  with log.
+/// \param ReplayLogHeader: how batch was played
+/// \param BoardLayout: board layout; nullptr for classic
+/// \param Board: board on layout, for naming locations
+/// \param ReplayGame: recorded game
+/// \param bool: whether to narrate game as it is played again
+/// \return bool: whether every event matches
+/// \throw
+/// - INCONSISTENT_DATA when record malformed.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static bool
+resimulateGame(
+	const ReplayLogHeader& header, //i - how batch was played
+	const BoardLayout* layout, //i - board layout
+	const Board& board, //i - board on layout
+	const ReplayGame& game, //i - recorded game
+	bool is_narrated) //i - whether to narrate game
+{
+	GameSimulator simulator( header._numPlayers, (unsigned int)header._maxNumTurns, layout );
+
+	if( 0 != header._searchSeats )
+	{
+		IsmctsSearch::Budget search_budget( header._searchIterations, (double)header._searchMilliseconds );
+		search_budget._numThreads = header._searchThreads;
+		search_budget._parallelMode = IsmctsSearch::ParallelMode( header._searchMode );
+		simulator.setSearchSeats( (unsigned int)header._searchSeats, search_budget );
+
+		if( (0 != header._searchMilliseconds) || (1 != header._searchThreads) )
+		{
+			std::cout << "Note: search budget depends on timing; game may not repeat\n";
+		}
+	}
+
+	simulator.setAccusationConfidence( (float)header._accusationPercent / 100.0f );
+
+	TextEventSink narration( std::cout );
+	ReplayLogSink recording( is_narrated ? &narration : nullptr );
+
+	std::chrono::steady_clock::time_point start_time(
+		std::chrono::steady_clock::now() );
+
+	recording.beginGame( game.getGameIndex(), game.getSeed() );
+	simulator.playGame( game.getSeed(), &recording );
+	recording.endGame();
+
+	std::chrono::duration<double, std::milli> elapsed(
+		std::chrono::steady_clock::now() - start_time );
+
+	if( is_narrated )
+	{
+		narration.flush();
+		std::cout << "\n\n";
+	}
+
+	if( recording.getRecords() == game.getRecord() )
+	{
+		std::cout << "Re-simulation matches log (" << elapsed.count() << " ms)\n";
+		return true;
+	}
+
+	//--------------------------------------------------------------------------
+	// find first event that differs
+	//--------------------------------------------------------------------------
+	ReplayGame recorded;
+	recorded.load( game.getRecord() );
+
+	ReplayGame replayed;
+	replayed.load( recording.getRecords() );
+
+	ReplayLogSink::Keyframe state;
+	state._turn = 0;
+
+	ReplayGame::Event recorded_event;
+	ReplayGame::Event replayed_event;
+	for(;;)
+	{
+		const bool has_recorded( recorded.readEvent(&recorded_event) );
+		const bool has_replayed( replayed.readEvent(&replayed_event) );
+
+		if( ! has_recorded && ! has_replayed )
+		{
+			std::cout << "Re-simulation differs from log in set up\n";
+			return false;
+		}
+
+		bool is_same( has_recorded == has_replayed );
+		if( is_same )
+		{
+			is_same = (recorded_event._type == replayed_event._type) &&
+				(recorded_event._numValues == replayed_event._numValues);
+
+			for(size_t value_index(0); is_same && (value_index < recorded_event._numValues); ++value_index)
+			{
+				is_same = (recorded_event._values[value_index] == replayed_event._values[value_index]);
+			}
+		}
+
+		if( ! is_same )
+		{
+			std::cout << "Re-simulation differs from log in turn "
+				<< ((0 < state._turn) ? state._turn - 1 : 0) << "\n";
+
+			std::cout << "Log:\n";
+			if( has_recorded )
+			{
+				ReplayGame::applyEvent( recorded_event, &state );
+				printEvent( board, recorded_event, state );
+			}
+			std::cout << "Re-simulation:\n";
+			if( has_replayed )
+			{
+				printEvent( board, replayed_event, state );
+			}
+			return false;
+		}
+
+		ReplayGame::applyEvent( recorded_event, &state );
+
+	} //end for (each event)
+
+} //end routine resimulateGame()
+
+
+/// \brief Which games --find lists; each test applies only when set.
+struct GameQuery
+{
+	/// \brief Default constructor
+	GameQuery()
+		: _winner( clueless::UNKNOWN_PERSON )
+		, _isWinnerless( false )
+		, _minNumRounds( 0 )
+		, _maxNumRounds( 0 )
+		, _minNumFalseAccusers( 0 )
+		, _limit( 20 )
+	{
+	}
+
+	clueless::PersonType _winner;  //unknown person for any
+	bool _isWinnerless;            //only games nobody won
+	unsigned long _minNumRounds;   //0 for any
+	unsigned long _maxNumRounds;   //0 for any
+	unsigned long _minNumFalseAccusers;
+	unsigned long _limit;          //games listed; all are counted
+
+}; //end struct GameQuery defn
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Lists games whose outcome matches query.
+/// \param ReplayLogReader: log
+/// \param GameQuery: which games
+/// \return None
+/// \throw None
+/// \note
+/// - Reads the log's index only; no game's record is touched.
+////////////////////////////////////////////////////////////////////////////////
+static void
+findGames(
+	const ReplayLogReader& replay_log, //i - log
+	const GameQuery& query) //i - which games
+{
+	std::chrono::steady_clock::time_point start_time(
+		std::chrono::steady_clock::now() );
+
+	std::vector<unsigned long> matches;
+	unsigned long num_matches( 0 );
+
+	for(unsigned long game_index(0); game_index < replay_log.getNumGames(); ++game_index)
+	{
+		const ReplayGameSummary summary( replay_log.getSummary(game_index) );
+
+		size_t num_false_accusers( 0 );
+		for(unsigned int accusers(summary._falseAccusers); 0 != accusers; accusers &= (accusers - 1))
+		{
+			++num_false_accusers;
+		}
+
+		if( (0 == summary._numPlayers) || //not recorded
+			((clueless::UNKNOWN_PERSON != query._winner) && (query._winner != summary._winner)) ||
+			(query._isWinnerless && (clueless::UNKNOWN_PERSON != summary._winner)) ||
+			(query._minNumRounds > summary._numRounds) ||
+			((0 < query._maxNumRounds) && (query._maxNumRounds < summary._numRounds)) ||
+			(query._minNumFalseAccusers > num_false_accusers) )
+		{
+			continue;
+		}
+
+		if( matches.size() < query._limit )
+		{
+			matches.push_back( game_index );
+		}
+		++num_matches;
+
+	} //end for (each game)
+
+	std::chrono::duration<double, std::milli> elapsed(
+		std::chrono::steady_clock::now() - start_time );
+
+	std::cout << "\nMatching games: " << num_matches
+		<< " (index scanned in " << elapsed.count() << " ms)\n";
+
+	for(size_t match_index(0); match_index < matches.size(); ++match_index)
+	{
+		const ReplayGameSummary summary( replay_log.getSummary(matches[match_index]) );
+
+		std::cout << "  Game " << matches[match_index] << ": ";
+		if( clueless::UNKNOWN_PERSON != summary._winner )
+		{
+			std::cout << clueless::translatePersonTypeToText( summary._winner ) << " won";
+		}
+		else
+		{
+			std::cout << (summary._reachedTurnLimit ? "turn limit reached" : "no winner");
+		}
+		std::cout << " in round " << summary._numRounds
+			<< " (" << summary._numPlayerTurns << " player turns)";
+
+		if( 0 != summary._falseAccusers )
+		{
+			std::cout << "; false accusers:";
+			for(size_t person(clueless::MISS_SCARLET); person <= clueless::PROFESSOR_PLUM; ++person)
+			{
+				if( 0 != (summary._falseAccusers & (1u << person)) )
+				{
+					std::cout << " " << clueless::translatePersonTypeToText( clueless::PersonType(person) );
+				}
+			}
+		}
+		std::cout << "\n";
+
+	} //end for (each game listed)
+
+	if( num_matches > matches.size() )
+	{
+		std::cout << "  ... " << (num_matches - matches.size()) << " more\n";
+	}
+
+} //end routine findGames()
+
+
+int main( int argc, const char* argv[] )
+{
+	try
+	{
+		const char* log_file( nullptr );
+		bool has_game( false );
+		unsigned long game_index( 0 );
+		bool has_turn( false );
+		unsigned long turn( 0 );
+		unsigned long num_turns( 1 );
+		bool is_resimulated( false );
+		bool is_narrated( false );
+		const char* layout_file( nullptr ); //classic board
+		bool is_find( false );
+		GameQuery query;
+
+		//----------------------------------------------------------------------
+		// Command Line Options
+		//----------------------------------------------------------------------
+		for(int arg_index(1); arg_index < argc; ++arg_index)
+		{
+			if( 0 == std::strcmp(argv[arg_index], "--game") )
+			{
+				game_index = parseOptionValue( arg_index++, argc, argv );
+				has_game = true;
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--turn") )
+			{
+				turn = parseOptionValue( arg_index++, argc, argv );
+				has_turn = true;
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--turns") )
+			{
+				num_turns = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--resimulate") )
+			{
+				is_resimulated = true;
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--narrate") )
+			{
+				is_narrated = true;
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--find") )
+			{
+				is_find = true;
+			}
+			else if( (0 == std::strcmp(argv[arg_index], "--winner")) &&
+				(arg_index + 1 < argc) )
+			{
+				query._winner = parsePersonName( argv[++arg_index] );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--no-winner") )
+			{
+				query._isWinnerless = true;
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--min-rounds") )
+			{
+				query._minNumRounds = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--max-rounds") )
+			{
+				query._maxNumRounds = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--min-false-accusers") )
+			{
+				query._minNumFalseAccusers = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--limit") )
+			{
+				query._limit = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( (0 == std::strcmp(argv[arg_index], "--layout")) &&
+				(arg_index + 1 < argc) )
+			{
+				layout_file = argv[++arg_index];
+			}
+			else if( ! log_file && ('-' != argv[arg_index][0]) )
+			{
+				log_file = argv[arg_index];
+			}
+			else
+			{
+				log_file = nullptr;
+				break;
+			}
+
+		} //end for (each argument)
+
+		if( ! log_file || ((has_turn || is_resimulated) && ! has_game) ||
+			(is_find && has_game) )
+		{
+			std::cout << "usage: " << argv[0]
+				<< " LOG [--game G] [--turn T] [--turns K] [--resimulate]"
+				<< " [--narrate] [--layout FILE]\n"
+				<< "       " << argv[0]
+				<< " LOG --find [--winner NAME] [--min-rounds R] [--max-rounds R]"
+				<< " [--no-winner] [--min-false-accusers N] [--limit N]\n"
+				<< "  (--turn and --resimulate need --game)\n";
+			return 1;
+		}
+
+		//----------------------------------------------------------------------
+		// Log Summary
+		//----------------------------------------------------------------------
+		ReplayLogReader replay_log( log_file );
+		const ReplayLogHeader& header( replay_log.getHeader() );
+
+		std::cout << "Replay log: " << log_file
+			<< "  Games: " << replay_log.getNumGames()
+			<< "  Players: " << header._numPlayers
+			<< "  Batch seed: " << header._batchSeed
+			<< "  Max turns: " << header._maxNumTurns << "\n";
+
+		if( 0 != header._searchSeats )
+		{
+			std::cout << "Search seats:";
+			for(unsigned long seat(0); seat < header._numPlayers; ++seat)
+			{
+				if( 0 != (header._searchSeats & (1ul << seat)) )
+				{
+					std::cout << " " << (seat + 1);
+				}
+			}
+			std::cout << "  Iterations: " << header._searchIterations
+				<< "  Milliseconds: " << header._searchMilliseconds
+				<< "  Threads: " << header._searchThreads
+				<< ((IsmctsSearch::ROOT_PARALLEL == header._searchMode) ? " (root)" : " (shared)") << "\n";
+		}
+
+		if( 100 > header._accusationPercent )
+		{
+			std::cout << "Accusation confidence: " << header._accusationPercent << "%\n";
+		}
+
+		if( 0 != header._isCustomLayout )
+		{
+			std::cout << "Played on custom layout\n";
+		}
+
+		if( is_find )
+		{
+			findGames( replay_log, query );
+			return 0;
+		}
+
+		if( ! has_game )
+		{
+			unsigned long long num_stored_bytes( 0 );
+			unsigned long long num_record_bytes( 0 );
+			for(unsigned long index(0); index < replay_log.getNumGames(); ++index)
+			{
+				num_stored_bytes += replay_log.getPayloadSize( index );
+				num_record_bytes += replay_log.getRecordSize( index );
+			}
+
+			std::cout << "Game records: " << num_record_bytes << " bytes, stored in "
+				<< num_stored_bytes << " bytes";
+			if( 0 < num_stored_bytes )
+			{
+				std::cout << " (" << (double)num_record_bytes / num_stored_bytes << " : 1)";
+			}
+			std::cout << "\n";
+
+			return 0;
+		}
+
+		//----------------------------------------------------------------------
+		// Board Layout
+		//----------------------------------------------------------------------
+		if( (0 != header._isCustomLayout) && ! layout_file )
+		{
+			std::ostringstream msg;
+			msg << "main()\n"
+				<< "  INSUFFICIENT_DATA\n"
+				<< "  log played on custom layout; give it with --layout FILE";
+			throw std::logic_error( msg.str() );
+		}
+
+		std::unique_ptr<BoardLayout> layout;
+		if( layout_file )
+		{
+			std::ifstream description( layout_file );
+			if( ! description )
+			{
+				std::ostringstream msg;
+				msg << "main()\n"
+					<< "  INSUFFICIENT_DATA\n"
+					<< "  cannot open layout file " << layout_file;
+				throw std::logic_error( msg.str() );
+			}
+
+			layout.reset( new BoardLayout(description) );
+		}
+
+		//names locations only; weapons placed by board are not used
+		MersenneTwister rng;
+		Board board( &rng, layout ? layout.get() : BoardLayout::classic() );
+
+		//----------------------------------------------------------------------
+		// Game
+		//----------------------------------------------------------------------
+		ReplayGame game;
+		replay_log.readGame( game_index, &game );
+
+		std::cout << "\n";
+		printGame( board, &game );
+
+		if( has_turn && (0 < game.getNumTurns()) )
+		{
+			std::chrono::steady_clock::time_point start_time(
+				std::chrono::steady_clock::now() );
+
+			ReplayLogSink::Keyframe state;
+			game.seekTurn( turn, &state );
+
+			std::chrono::duration<double, std::milli> elapsed(
+				std::chrono::steady_clock::now() - start_time );
+
+			std::cout << "\nSeek to turn " << state._turn
+				<< ": " << elapsed.count() << " ms\n";
+			printState( board, state );
+
+			ReplayGame::Event event;
+			while( game.readEvent(&event) )
+			{
+				if( (ReplayLogSink::TURN_STARTED == event._type) &&
+					(state._turn >= turn + num_turns) )
+				{
+					break; //past last turn asked for
+				}
+
+				ReplayGame::applyEvent( event, &state );
+				printEvent( board, event, state );
+
+			} //end while (more events)
+		}
+
+		if( is_resimulated )
+		{
+			if( 0 == header._isSimulated )
+			{
+				std::ostringstream msg;
+				msg << "main()\n"
+					<< "  INCONSISTENT_DATA\n"
+					<< "  only BatchSimulator logs can be re-simulated";
+				throw std::logic_error( msg.str() );
+			}
+
+			std::cout << "\n";
+			if( ! resimulateGame(header, layout.get(), board, game, is_narrated) )
+			{
+				return 2;
+			}
+		}
+	}
+	catch(const std::exception& error)
+	{
+		std::cout << error.what() << "\n\n";
+		return 1;
+	}
+
+	return 0;
+
+} //end routine main
@@ -0,0 +1,285 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file TournamentRunner.cpp
+/// \brief Plays player strategies against each other in every seating and
+///        reports their ratings.
+///
+/// \date   17 Oct 2026  2130
+///
+/// \note
+/// - Usage:
+///     TournamentRunner [--entrant SPEC]... [--games N] [--players P]
+///                      [--seed S] [--max-turns T] [--threads W]
+///                      [--layout FILE] [--resamples R]
+/// - SPEC is one of
+///     heuristic     Player's built-in heuristics (see PlayerStrategy)
+///     random        uniform choices (see RandomStrategy)
+///     search:I      search of I iterations per turn choice, on one thread
+///                   (see IsmctsStrategy)
+///   Entrants default to heuristic and random.  The same SPEC may be
+///   entered more than once (e.g. to check ratings agree).
+/// - N (default 100) games are played per lineup (see Tournament for how
+///   lineups are arranged); P must be in [3, 6].
+/// - W of 0 (default) uses one worker per hardware thread.  Results depend
+///   only on the seed, not on the number of workers.
+/// - R (default 200) deal resamples give each rating's 95% interval; 0 skips
+///   intervals.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "../Clueless/BoardLayout.h"
+#include "../Clueless/IsmctsStrategy.h"
+#include "../Clueless/PlayerStrategy.h"
+#include "../Clueless/RandomStrategy.h"
+#include "../Clueless/Tournament.h"
+
+#include <chrono>			//for std::chrono::steady_clock use
+#include <cstdlib>			//for std::strtoul use
+#include <cstring>			//for std::strcmp use
+#include <fstream>			//for std::ifstream use
+#include <iostream>			//for std::cout use
+#include <memory>			//for std::unique_ptr use
+#include <sstream>			//for std::ostringstream use
+#include <stdexcept>		//for std::exception use
+#include <string>			//for std::string use
+#include <vector>			//for std::vector use
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Parses unsigned value following command line option.
+/// \param int: index of option within argument list
+/// \param int: number of arguments
+/// \param char*[]: argument list
+/// \return unsigned long: parsed value
+/// \throw
+/// - INSUFFICIENT_DATA when option has no value.
+/// - INCONSISTENT_DATA when value not a non-negative integer.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static unsigned long
+parseOptionValue(
+	int option_index, //i - index of option within argument list
+	int argc, //i - number of arguments
+	const char* argv[]) //i - argument list
+{
+	if( option_index + 1 >= argc )
+	{
+		std::ostringstream msg;
+		msg << "parseOptionValue()\n"
+			<< "  INSUFFICIENT_DATA\n"
+			<< "  missing value for option " << argv[option_index];
+		throw std::logic_error( msg.str() );
+	}
+
+	const char* text( argv[option_index + 1] );
+	char* text_end( nullptr );
+	unsigned long value( std::strtoul(text, &text_end, 10) );
+
+	if( (text == text_end) || ('\0' != *text_end) || ('-' == *text) )
+	{
+		std::ostringstream msg;
+		msg << "parseOptionValue()\n"
+			<< "  INCONSISTENT_DATA\n"
+			<< "  invalid value for option " << argv[option_index]
+			<< ": " << text;
+		throw std::logic_error( msg.str() );
+	}
+
+	return value;
+
+} //end routine parseOptionValue()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Builds strategy described by entrant specification.
+/// \param string: specification (see file notes)
+/// \return PlayerStrategy: new strategy (caller owns)
+/// \throw
+/// - INCONSISTENT_DATA when specification not recognized.
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static PlayerStrategy*
+buildStrategy(
+	const std::string& spec) //i - entrant specification
+{
+	if( "heuristic" == spec )
+	{
+		return new PlayerStrategy();
+	}
+
+	if( "random" == spec )
+	{
+		return new RandomStrategy();
+	}
+
+	if( 0 == spec.compare(0, 7, "search:") )
+	{
+		const char* text( spec.c_str() + 7 );
+		char* text_end( nullptr );
+		unsigned long num_iterations( std::strtoul(text, &text_end, 10) );
+
+		if( (text != text_end) && ('\0' == *text_end) && ('-' != *text) &&
+			(0 < num_iterations) )
+		{
+			return new IsmctsStrategy( IsmctsSearch::Budget(num_iterations, 0) );
+		}
+	}
+
+	std::ostringstream msg;
+	msg << "buildStrategy()\n"
+		<< "  INCONSISTENT_DATA\n"
+		<< "  unknown entrant: " << spec;
+	throw std::logic_error( msg.str() );
+
+} //end routine buildStrategy()
+
+
+int main( int argc, const char* argv[] )
+{
+	try
+	{
+		std::vector<std::string> specs;
+		unsigned long num_games( 100 ); //per lineup
+		unsigned long num_players( 4 );
+		unsigned long seed( 5489 ); //MersenneTwister default
+		unsigned long max_num_turns( GameSimulator::DEFAULT_MAX_NUM_TURNS );
+		unsigned long num_threads( 0 ); //one per hardware thread
+		const char* layout_file( nullptr ); //classic board
+		unsigned long num_resamples( Tournament::DEFAULT_NUM_RESAMPLES );
+
+		//----------------------------------------------------------------------
+		// Command Line Options
+		//----------------------------------------------------------------------
+		for(int arg_index(1); arg_index < argc; ++arg_index)
+		{
+			if( (0 == std::strcmp(argv[arg_index], "--entrant")) &&
+				(arg_index + 1 < argc) )
+			{
+				specs.push_back( argv[++arg_index] );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--games") )
+			{
+				num_games = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--players") )
+			{
+				num_players = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--seed") )
+			{
+				seed = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--max-turns") )
+			{
+				max_num_turns = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--threads") )
+			{
+				num_threads = parseOptionValue( arg_index++, argc, argv );
+			}
+			else if( (0 == std::strcmp(argv[arg_index], "--layout")) &&
+				(arg_index + 1 < argc) )
+			{
+				layout_file = argv[++arg_index];
+			}
+			else if( 0 == std::strcmp(argv[arg_index], "--resamples") )
+			{
+				num_resamples = parseOptionValue( arg_index++, argc, argv );
+			}
+			else
+			{
+				std::cout << "usage: " << argv[0]
+					<< " [--entrant heuristic|random|search:I]... [--games N]"
+					<< " [--players 3-6] [--seed S] [--max-turns T] [--threads W]"
+					<< " [--layout FILE] [--resamples R]\n";
+				return 1;
+			}
+
+		} //end for (each argument)
+
+		if( specs.empty() )
+		{
+			specs.push_back( "heuristic" );
+			specs.push_back( "random" );
+		}
+
+		//----------------------------------------------------------------------
+		// Board Layout
+		//----------------------------------------------------------------------
+		std::unique_ptr<BoardLayout> layout;
+		if( layout_file )
+		{
+			std::ifstream description( layout_file );
+			if( ! description )
+			{
+				std::ostringstream msg;
+				msg << "main()\n"
+					<< "  INSUFFICIENT_DATA\n"
+					<< "  cannot open layout file " << layout_file;
+				throw std::logic_error( msg.str() );
+			}
+
+			layout.reset( new BoardLayout(description) );
+		}
+
+		//----------------------------------------------------------------------
+		// Entrants
+		//----------------------------------------------------------------------
+		Tournament tournament( num_players, (unsigned int)max_num_turns, layout.get() );
+
+		std::vector< std::unique_ptr<PlayerStrategy> > strategies;
+		for(size_t spec_index(0); spec_index < specs.size(); ++spec_index)
+		{
+			strategies.push_back( std::unique_ptr<PlayerStrategy>(buildStrategy(specs[spec_index])) );
+
+			//tell repeated entrants apart
+			size_t num_repeats( 0 );
+			for(size_t earlier(0); earlier < spec_index; ++earlier)
+			{
+				if( specs[earlier] == specs[spec_index] )
+				{
+					++num_repeats;
+				}
+			}
+
+			if( 0 < num_repeats )
+			{
+				std::ostringstream name;
+				name << strategies.back()->getName() << "#" << (num_repeats + 1);
+				strategies.back()->setName( name.str() );
+			}
+
+			tournament.addEntrant( strategies.back().get() );
+
+		} //end for (each entrant)
+
+		//----------------------------------------------------------------------
+		// Play Games
+		//----------------------------------------------------------------------
+		std::chrono::steady_clock::time_point start_time(
+			std::chrono::steady_clock::now() );
+
+		tournament.play( num_games, seed, num_threads );
+
+		std::chrono::duration<double> elapsed(
+			std::chrono::steady_clock::now() - start_time );
+
+		std::cout << "Seed: " << seed
+			<< "  Max turns: " << max_num_turns
+			<< "  Threads: " << tournament.getNumThreads() << "\n";
+
+		std::cout << tournament.report( tournament.rate(num_resamples), elapsed.count() ).str();
+	}
+	catch(const std::exception& error)
+	{
+		std::cout << error.what() << "\n\n";
+		return 1;
+	}
+
+	return 0;
+
+} //end routine main
@@ -0,0 +1,1503 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Clue-Less
+///
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file UnitTests.cpp
+/// \brief Checks engine components against known results.
+///
+/// \date   17 Oct 2026  2355
+///
+/// \note
+/// - Usage:
+///     UnitTests [GROUP...]
+/// - GROUP is one of the groups listed in TEST_GROUPS (e.g. "deduction");
+///   every group runs when none given.  CMake registers each group as its
+///   own test, so ctest reports them separately.
+/// - Each failed check is listed with its file and line; exit status is
+///   nonzero when any check failed.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "../Clueless/BoardLayout.h"
+#include "../Clueless/Card.h"
+#include "../Clueless/CaseFileHypotheses.h"
+#include "../Clueless/DealSampler.h"
+#include "../Clueless/DeductionMatrix.h"
+#include "../Clueless/Game.h"
+#include "../Clueless/GameEventSink.h"
+#include "../Clueless/GameSimulator.h"
+#include "../Clueless/GameState.h"
+#include "../Clueless/Location.h"
+#include "../Clueless/LzCodec.h"
+#include "../Clueless/mersenneTwister.h"
+#include "../Clueless/Player.h"
+#include "../Clueless/PlayerStrategy.h"
+#include "../Clueless/ReplayGame.h"
+#include "../Clueless/ReplayLogFile.h"
+#include "../Clueless/ReplayLogSink.h"
+#include "../Clueless/Tournament.h"
+
+#include "../Clueless/CluelessEnums.h"	//for determineCardIndex use
+
+#include <algorithm>		//for std::equal use
+#include <cmath>			//for std::fabs, std::log10 use
+#include <cstdio>			//for std::remove use
+#include <cstring>			//for std::strcmp use
+#include <iostream>			//for std::cout use
+#include <list>				//for std::list use
+#include <sstream>			//for std::istringstream use
+#include <stdexcept>		//for std::exception use
+#include <string>			//for std::string use
+#include <vector>			//for std::vector use
+
+
+//------------------------------------------------------------------------------
+// Local Helpers
+//------------------------------------------------------------------------------
+static size_t num_failed_checks( 0 );
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Records outcome of one check, listing it when failed.
+/// \param bool: whether check passed
+/// \param char*: checked condition, as written
+/// \param char*: source file of check
+/// \param int: source line of check
+/// \return None
+/// \throw None
+/// \note  None
+////////////////////////////////////////////////////////////////////////////////
+static void
+recordCheck(
+	bool has_passed, //i - whether check passed
+	const char* condition, //i - checked condition, as written
+	const char* file, //i - source file of check
+	int line) //i - source line of check
+{
+	if( ! has_passed )
+	{
+		++num_failed_checks;
+		std::cout << "  FAILED " << file << ":" << line << ": " << condition << "\n";
+	}
+
+} //end routine recordCheck()
+
+
+#define CHECK(condition) recordCheck( (condition), #condition, __FILE__, __LINE__ )
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns deduction matrix of a three-player game (six cards each),
+///  nothing yet recorded.
+////////////////////////////////////////////////////////////////////////////////
+static DeductionMatrix
+makeThreePlayerMatrix()
+{
+	DeductionMatrix deductions;
+	deductions.addPlayer( clueless::MISS_SCARLET, 6 );
+	deductions.addPlayer( clueless::COLONEL_MUSTARD, 6 );
+	deductions.addPlayer( clueless::MRS_WHITE, 6 );
+
+	return deductions;
+
+} //end routine makeThreePlayerMatrix()
+
+
+//------------------------------------------------------------------------------
+// Deduction Matrix
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Checks each propagation rule of DeductionMatrix.
+////////////////////////////////////////////////////////////////////////////////
+static void
+testDeductionMatrix()
+{
+	const size_t CASE_FILE( DeductionMatrix::CASE_FILE );
+	const size_t SCARLET( clueless::MISS_SCARLET );
+	const size_t MUSTARD( clueless::COLONEL_MUSTARD );
+	const size_t WHITE( clueless::MRS_WHITE );
+
+	//two cards of each type: a plausible hand
+	const unsigned int SIX_CARDS(
+		(1u << clueless::determineCardIndex(clueless::MISS_SCARLET)) |
+		(1u << clueless::determineCardIndex(clueless::COLONEL_MUSTARD)) |
+		(1u << clueless::determineCardIndex(clueless::CANDLESTICK)) |
+		(1u << clueless::determineCardIndex(clueless::KNIFE)) |
+		(1u << clueless::determineCardIndex(clueless::STUDY)) |
+		(1u << clueless::determineCardIndex(clueless::HALL)) );
+
+	//--------------------------------------------------------------------------
+	// Case File rule: last possible card of a type is in the Case File
+	//--------------------------------------------------------------------------
+	{
+		DeductionMatrix deductions( makeThreePlayerMatrix() );
+
+		for(int person(clueless::MISS_SCARLET); person < clueless::PROFESSOR_PLUM; ++person)
+		{
+			deductions.recordCardNotHeld( clueless::determineCardIndex(clueless::PersonType(person)), CASE_FILE );
+		}
+
+		const size_t plum( clueless::determineCardIndex(clueless::PROFESSOR_PLUM) );
+		CHECK( deductions.propagate() );
+		CHECK( CASE_FILE == deductions.findHolder(plum) );
+		CHECK( ! deductions.isPossibleHolder(plum, SCARLET) );
+	}
+
+	//--------------------------------------------------------------------------
+	// Case File rule: known Case File card rules out rest of its type
+	//--------------------------------------------------------------------------
+	{
+		DeductionMatrix deductions( makeThreePlayerMatrix() );
+
+		const size_t rope( clueless::determineCardIndex(clueless::ROPE) );
+		deductions.recordCardHeld( rope, CASE_FILE );
+		CHECK( deductions.propagate() );
+
+		for(int weapon(clueless::CANDLESTICK); weapon <= clueless::WRENCH; ++weapon)
+		{
+			const size_t card_index( clueless::determineCardIndex(clueless::WeaponType(weapon)) );
+			CHECK( (rope == card_index) == deductions.isPossibleHolder(card_index, CASE_FILE) );
+		}
+
+		//other types untouched
+		CHECK( deductions.isPossibleHolder(clueless::determineCardIndex(clueless::KITCHEN), CASE_FILE) );
+	}
+
+	//--------------------------------------------------------------------------
+	// hand-size rule: whole hand known, so player holds nothing else
+	//--------------------------------------------------------------------------
+	{
+		DeductionMatrix deductions( makeThreePlayerMatrix() );
+
+		for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+		{
+			if( 0 != (SIX_CARDS & (1u << card_index)) )
+			{
+				deductions.recordCardHeld( card_index, MUSTARD );
+			}
+		}
+		CHECK( deductions.propagate() );
+
+		for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+		{
+			CHECK( (0 != (SIX_CARDS & (1u << card_index))) == deductions.isPossibleHolder(card_index, MUSTARD) );
+		}
+		CHECK( deductions.isPossibleHolder(2, WHITE) );
+	}
+
+	//--------------------------------------------------------------------------
+	// hand-size rule: only as many candidates as cards, so all held
+	//--------------------------------------------------------------------------
+	{
+		DeductionMatrix deductions( makeThreePlayerMatrix() );
+
+		for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+		{
+			if( 0 == (SIX_CARDS & (1u << card_index)) )
+			{
+				deductions.recordCardNotHeld( card_index, WHITE );
+			}
+		}
+		CHECK( deductions.propagate() );
+
+		for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+		{
+			CHECK( (0 != (SIX_CARDS & (1u << card_index))) == (WHITE == deductions.findHolder(card_index)) );
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	// holds-one-of rule: last candidate of constraint is held
+	//--------------------------------------------------------------------------
+	{
+		DeductionMatrix deductions( makeThreePlayerMatrix() );
+
+		const size_t green( clueless::determineCardIndex(clueless::MR_GREEN) );
+		const size_t knife( clueless::determineCardIndex(clueless::KNIFE) );
+		const size_t hall( clueless::determineCardIndex(clueless::HALL) );
+
+		deductions.recordHoldsOneOf( SCARLET, (1u << green) | (1u << knife) | (1u << hall) );
+		CHECK( ! deductions.propagate() );
+		CHECK( 1 == deductions.getNumHoldsOneOf() );
+
+		deductions.recordCardNotHeld( green, SCARLET );
+		deductions.recordCardNotHeld( hall, SCARLET );
+		CHECK( deductions.propagate() );
+		CHECK( SCARLET == deductions.findHolder(knife) );
+		CHECK( 0 == deductions.getNumHoldsOneOf() );
+	}
+
+	//--------------------------------------------------------------------------
+	// holds-one-of rule: constraint met by known card is dropped
+	//--------------------------------------------------------------------------
+	{
+		DeductionMatrix deductions( makeThreePlayerMatrix() );
+
+		const size_t peacock( clueless::determineCardIndex(clueless::MRS_PEACOCK) );
+		const size_t wrench( clueless::determineCardIndex(clueless::WRENCH) );
+
+		deductions.recordHoldsOneOf( MUSTARD, (1u << peacock) | (1u << wrench) );
+		deductions.recordCardHeld( wrench, MUSTARD );
+		deductions.propagate();
+		CHECK( 0 == deductions.getNumHoldsOneOf() );
+		CHECK( DeductionMatrix::UNKNOWN_HOLDER == deductions.findHolder(peacock) );
+	}
+
+	//--------------------------------------------------------------------------
+	// rules feed each other: hand-size result completes a Case File type
+	//--------------------------------------------------------------------------
+	{
+		DeductionMatrix deductions( makeThreePlayerMatrix() );
+
+		//White holds five of the six people and one weapon
+		for(int person(clueless::MISS_SCARLET); person < clueless::PROFESSOR_PLUM; ++person)
+		{
+			deductions.recordCardHeld( clueless::determineCardIndex(clueless::PersonType(person)), WHITE );
+		}
+		deductions.recordCardHeld( clueless::determineCardIndex(clueless::CANDLESTICK), WHITE );
+
+		//Scarlet and Mustard cannot hold Plum
+		const size_t plum( clueless::determineCardIndex(clueless::PROFESSOR_PLUM) );
+		deductions.recordCardNotHeld( plum, SCARLET );
+		deductions.recordCardNotHeld( plum, MUSTARD );
+
+		CHECK( deductions.propagate() );
+		CHECK( CASE_FILE == deductions.findHolder(plum) );
+		CHECK( ! deductions.isPossibleHolder(clueless::determineCardIndex(clueless::KITCHEN), WHITE) );
+	}
+
+} //end routine testDeductionMatrix()
+
+
+//------------------------------------------------------------------------------
+// LZ Codec
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns whether bytes decompress from compressed form unchanged.
+////////////////////////////////////////////////////////////////////////////////
+static bool
+isRoundTripExact(
+	const std::vector<unsigned char>& bytes) //i - bytes to compress
+{
+	std::vector<unsigned char> compressed;
+	LzCodec::compress( bytes.data(), bytes.size(), &compressed );
+
+	std::vector<unsigned char> decompressed( bytes.size() + 1, 0xA5 ); //one byte spare, untouched
+	LzCodec::decompress( compressed.data(), compressed.size(), decompressed.data(), bytes.size() );
+
+	return( std::equal(bytes.begin(), bytes.end(), decompressed.begin()) &&
+		(0xA5 == decompressed.back()) );
+
+} //end routine isRoundTripExact()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns whether decompressing throws.
+////////////////////////////////////////////////////////////////////////////////
+static bool
+doesDecompressThrow(
+	const std::vector<unsigned char>& compressed, //i - compressed bytes
+	size_t num_bytes) //i - expected decompressed size
+{
+	std::vector<unsigned char> bytes( num_bytes + 1 );
+
+	try
+	{
+		LzCodec::decompress( compressed.data(), compressed.size(), bytes.data(), num_bytes );
+	}
+	catch( const std::logic_error& )
+	{
+		return true;
+	}
+
+	return false;
+
+} //end routine doesDecompressThrow()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Checks LzCodec round trips, and that damaged input is reported.
+////////////////////////////////////////////////////////////////////////////////
+static void
+testLzCodec()
+{
+	MersenneTwister rng( 20261017ul );
+
+	//--------------------------------------------------------------------------
+	// round trips: empty, tiny, repetitive, random, and mixed input
+	//--------------------------------------------------------------------------
+	CHECK( isRoundTripExact(std::vector<unsigned char>()) );
+	CHECK( isRoundTripExact(std::vector<unsigned char>(1, 7)) );
+	CHECK( isRoundTripExact(std::vector<unsigned char>(5000, 42)) ); //long matches
+
+	std::vector<unsigned char> random_bytes( 3000 );
+	for(size_t byte_index(0); byte_index < random_bytes.size(); ++byte_index)
+	{
+		random_bytes[byte_index] = (unsigned char)rng.drawUniformInt( 256 );
+	}
+	CHECK( isRoundTripExact(random_bytes) ); //long literal runs
+
+	std::vector<unsigned char> mixed_bytes;
+	for(size_t run(0); run < 200; ++run)
+	{
+		const size_t num_literals( rng.drawUniformInt(20) );
+		for(size_t literal(0); literal < num_literals; ++literal)
+		{
+			mixed_bytes.push_back( (unsigned char)rng.drawUniformInt(4) );
+		}
+
+		if( ! mixed_bytes.empty() ) //repeat recent bytes
+		{
+			const size_t distance( 1 + rng.drawUniformInt(mixed_bytes.size()) );
+			const size_t length( rng.drawUniformInt(40) );
+			for(size_t copied(0); copied < length; ++copied)
+			{
+				mixed_bytes.push_back( mixed_bytes[mixed_bytes.size() - distance] );
+			}
+		}
+	}
+	CHECK( isRoundTripExact(mixed_bytes) );
+
+	std::vector<unsigned char> compressed;
+	LzCodec::compress( mixed_bytes.data(), mixed_bytes.size(), &compressed );
+	CHECK( compressed.size() < mixed_bytes.size() );
+
+	//--------------------------------------------------------------------------
+	// damaged input throws
+	//--------------------------------------------------------------------------
+	CHECK( ! doesDecompressThrow(compressed, mixed_bytes.size()) );
+
+	CHECK( doesDecompressThrow(compressed, mixed_bytes.size() - 1) ); //size differs
+	CHECK( doesDecompressThrow(compressed, mixed_bytes.size() + 1) );
+
+	std::vector<unsigned char> truncated( compressed.begin(), compressed.end() - 1 );
+	CHECK( doesDecompressThrow(truncated, mixed_bytes.size()) );
+
+	std::vector<unsigned char> far_match;
+	far_match.push_back( 0x10 ); //one literal, then match of MIN_MATCH_LENGTH
+	far_match.push_back( 'x' );
+	far_match.push_back( 5 );    //distance beyond bytes written
+	CHECK( doesDecompressThrow(far_match, 1 + LzCodec::MIN_MATCH_LENGTH) );
+
+	std::vector<unsigned char> long_literals;
+	long_literals.push_back( 0xF0 ); //literal count continues in varint
+	long_literals.push_back( 0xFF ); //varint runs past end
+	CHECK( doesDecompressThrow(long_literals, 100) );
+
+} //end routine testLzCodec()
+
+
+//------------------------------------------------------------------------------
+// Replay Log
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Checks a replay log reads back the header, index, and records
+///  written.
+/// \note
+/// - Games are appended out of order and one index is skipped, as happens
+///   when worker threads finish games in any order.
+////////////////////////////////////////////////////////////////////////////////
+static void
+testReplayLog()
+{
+	const char* const LOG_PATH( "UnitTests_replay.crl" );
+	const size_t NUM_GAMES( 6 );
+	const size_t SKIPPED_GAME( 2 );
+	const unsigned long BATCH_SEED( 99 );
+
+	GameSimulator simulator( 4 );
+
+	ReplayLogHeader header;
+	header._numPlayers = simulator.getNumPlayers();
+	header._maxNumTurns = simulator.getMaxNumTurns();
+	header._batchSeed = BATCH_SEED;
+	header._isSimulated = 1;
+
+	std::vector<GameOutcome> outcomes( NUM_GAMES );
+	std::vector<std::vector<unsigned char> > records( NUM_GAMES );
+
+	{
+		ReplayLogWriter writer( LOG_PATH, header );
+		ReplayLogSink recording;
+
+		for(size_t game(NUM_GAMES); 0 < game--; ) //last game first
+		{
+			if( SKIPPED_GAME == game )
+			{
+				continue;
+			}
+
+			recording.beginGame( game, BATCH_SEED + game );
+			outcomes[game] = simulator.playGame( BATCH_SEED + game, &recording );
+			recording.endGame();
+
+			records[game] = recording.getRecords();
+			writer.appendGame( recording );
+		}
+
+		CHECK( NUM_GAMES == writer.getNumGames() );
+		writer.close();
+	}
+
+	//--------------------------------------------------------------------------
+	// read back
+	//--------------------------------------------------------------------------
+	{
+		ReplayLogReader reader( LOG_PATH );
+
+		CHECK( NUM_GAMES == reader.getNumGames() );
+		CHECK( header._numPlayers == reader.getHeader()._numPlayers );
+		CHECK( header._maxNumTurns == reader.getHeader()._maxNumTurns );
+		CHECK( BATCH_SEED == reader.getHeader()._batchSeed );
+		CHECK( 1 == reader.getHeader()._isSimulated );
+
+		ReplayGame game;
+		for(size_t game_index(0); game_index < NUM_GAMES; ++game_index)
+		{
+			if( SKIPPED_GAME == game_index )
+			{
+				CHECK( ! reader.hasGame(game_index) );
+				continue;
+			}
+
+			CHECK( reader.hasGame(game_index) );
+			CHECK( records[game_index].size() == reader.getRecordSize(game_index) );
+
+			//index entry matches game's outcome
+			const GameOutcome& outcome( outcomes[game_index] );
+			const ReplayGameSummary summary( reader.getSummary(game_index) );
+
+			unsigned int false_accusers( 0 );
+			for(size_t seat(0); seat < outcome._numPlayers; ++seat)
+			{
+				if( outcome._isFalseAccuser[seat] )
+				{
+					false_accusers |= (1u << outcome._seatCharacters[seat]);
+				}
+			}
+
+			CHECK( outcome._numPlayers == summary._numPlayers );
+			CHECK( outcome._winnerCharacter == summary._winner );
+			CHECK( false_accusers == summary._falseAccusers );
+			CHECK( outcome._reachedTurnLimit == summary._reachedTurnLimit );
+			CHECK( outcome._numTurnsPlayed == summary._numRounds );
+
+			//record reads back byte for byte
+			reader.readGame( game_index, &game );
+			CHECK( game_index == game.getGameIndex() );
+			CHECK( BATCH_SEED + game_index == game.getSeed() );
+			CHECK( records[game_index] == game.getRecord() );
+			CHECK( summary._numPlayerTurns == game.getNumTurns() );
+		}
+	}
+
+	std::remove( LOG_PATH );
+
+} //end routine testReplayLog()
+
+
+//------------------------------------------------------------------------------
+// Random Draws
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns Pearson's chi-square statistic of draws on [0, n) against
+///  equal chances.
+////////////////////////////////////////////////////////////////////////////////
+static double
+computeChiSquare(
+	MersenneTwister* rng, //io- generator drawn from
+	unsigned long num_values, //i - number of equally likely values
+	unsigned long num_draws) //i - number of draws
+{
+	std::vector<unsigned long> counts( num_values, 0 );
+	for(unsigned long draw(0); draw < num_draws; ++draw)
+	{
+		++counts[rng->drawUniformInt(num_values)];
+	}
+
+	const double expected( (double)num_draws / (double)num_values );
+	double chi_square( 0.0 );
+	for(unsigned long value(0); value < num_values; ++value)
+	{
+		chi_square += (counts[value] - expected) * (counts[value] - expected) / expected;
+	}
+
+	return chi_square;
+
+} //end routine computeChiSquare()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Checks MersenneTwister::drawUniformInt() stays in range and favors
+///  no value.
+////////////////////////////////////////////////////////////////////////////////
+static void
+testUniformInt()
+{
+	MersenneTwister rng( 20261017ul );
+
+	//--------------------------------------------------------------------------
+	// zero or one value: zero, without drawing
+	//--------------------------------------------------------------------------
+	{
+		MersenneTwister twin( rng );
+
+		CHECK( 0 == rng.drawUniformInt(0) );
+		CHECK( 0 == rng.drawUniformInt(1) );
+		CHECK( twin.drawInt32() == rng.drawInt32() );
+	}
+
+	//--------------------------------------------------------------------------
+	// every draw below n, including n near 2^32
+	//--------------------------------------------------------------------------
+	const unsigned long RANGES[] = { 2, 3, 6, 7, 10, 324, 1000003, 0x80000001ul, 0xFFFFFFFFul };
+	for(size_t range_index(0); range_index < sizeof(RANGES) / sizeof(RANGES[0]); ++range_index)
+	{
+		bool is_in_range( true );
+		for(size_t draw(0); draw < 2000; ++draw)
+		{
+			is_in_range &= (rng.drawUniformInt(RANGES[range_index]) < RANGES[range_index]);
+		}
+		CHECK( is_in_range );
+	}
+
+	//--------------------------------------------------------------------------
+	// equal chances: chi-square below its 0.1% critical value
+	//--------------------------------------------------------------------------
+	CHECK( computeChiSquare(&rng, 6, 60000) < 20.52 );  //5 degrees of freedom
+	CHECK( computeChiSquare(&rng, 7, 70000) < 22.46 );  //6
+	CHECK( computeChiSquare(&rng, 36, 72000) < 66.62 ); //35
+
+	//--------------------------------------------------------------------------
+	// no modulo bias: with n = 3 * 2^30, a plain modulo of 32-bit draws
+	// would put half of all draws below 2^30, not a third
+	//--------------------------------------------------------------------------
+	const unsigned long BIASED_RANGE( 0xC0000000ul );
+	const unsigned long NUM_DRAWS( 30000 );
+
+	unsigned long num_low( 0 );
+	for(unsigned long draw(0); draw < NUM_DRAWS; ++draw)
+	{
+		num_low += (rng.drawUniformInt(BIASED_RANGE) < 0x40000000ul) ? 1 : 0;
+	}
+	CHECK( std::fabs((double)num_low / NUM_DRAWS - 1.0 / 3.0) < 0.02 );
+
+} //end routine testUniformInt()
+
+
+//------------------------------------------------------------------------------
+// Deal Sampler
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Checks every deal drawn agrees with the observer's notebook.
+////////////////////////////////////////////////////////////////////////////////
+static void
+testDealSampler()
+{
+	const size_t NUM_SAMPLES( 500 );
+	const size_t SCARLET( clueless::MISS_SCARLET );
+	const size_t MUSTARD( clueless::COLONEL_MUSTARD );
+	const size_t WHITE( clueless::MRS_WHITE );
+
+	//--------------------------------------------------------------------------
+	// Scarlet's notebook: own hand, one card seen, one refutation
+	//--------------------------------------------------------------------------
+	DeductionMatrix deductions( makeThreePlayerMatrix() );
+
+	unsigned int scarlet_hand( 0 );
+	const size_t hand_cards[] = {
+		clueless::determineCardIndex( clueless::MISS_SCARLET ),
+		clueless::determineCardIndex( clueless::MR_GREEN ),
+		clueless::determineCardIndex( clueless::ROPE ),
+		clueless::determineCardIndex( clueless::STUDY ),
+		clueless::determineCardIndex( clueless::HALL ),
+		clueless::determineCardIndex( clueless::KITCHEN ) };
+
+	for(size_t hand_index(0); hand_index < 6; ++hand_index)
+	{
+		scarlet_hand |= (1u << hand_cards[hand_index]);
+	}
+
+	for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+	{
+		if( 0 != (scarlet_hand & (1u << card_index)) )
+		{
+			deductions.recordCardHeld( card_index, SCARLET );
+		}
+		else
+		{
+			deductions.recordCardNotHeld( card_index, SCARLET );
+		}
+	}
+
+	const size_t knife( clueless::determineCardIndex(clueless::KNIFE) );
+	deductions.recordCardHeld( knife, MUSTARD );
+
+	const size_t plum( clueless::determineCardIndex(clueless::PROFESSOR_PLUM) );
+	const size_t wrench( clueless::determineCardIndex(clueless::WRENCH) );
+	const size_t lounge( clueless::determineCardIndex(clueless::LOUNGE) );
+	const unsigned int refuted( (1u << plum) | (1u << wrench) | (1u << lounge) );
+	deductions.recordHoldsOneOf( WHITE, refuted );
+
+	deductions.recordCardNotHeld( plum, MUSTARD ); //Mustard passed on Plum
+	deductions.propagate();
+
+	DealSampler sampler( deductions, SCARLET, scarlet_hand );
+	CHECK( sampler.isFeasible() );
+	CHECK( sampler.isExact() );
+	CHECK( 0.0 < sampler.getNumDeals() );
+
+	//--------------------------------------------------------------------------
+	// every deal complete, disjoint, and consistent
+	//--------------------------------------------------------------------------
+	MersenneTwister rng( 7ul );
+	unsigned int white_plum_seen( 0 );
+
+	for(size_t sample(0); sample < NUM_SAMPLES; ++sample)
+	{
+		unsigned int cards_by_holder[DeductionMatrix::NUM_HOLDERS];
+		if( ! sampler.sample(rng, cards_by_holder) )
+		{
+			CHECK( ! "sample drawn" );
+			break;
+		}
+
+		unsigned int all_cards( 0 );
+		bool is_disjoint( true );
+		for(size_t holder(0); holder < DeductionMatrix::NUM_HOLDERS; ++holder)
+		{
+			is_disjoint &= (0 == (all_cards & cards_by_holder[holder]));
+			all_cards |= cards_by_holder[holder];
+		}
+
+		CHECK( is_disjoint );
+		CHECK( ((1u << clueless::NUM_CARDS) - 1) == all_cards );
+		CHECK( scarlet_hand == cards_by_holder[SCARLET] );
+		CHECK( 0 != (cards_by_holder[MUSTARD] & (1u << knife)) );
+		CHECK( 0 == (cards_by_holder[MUSTARD] & (1u << plum)) );
+		CHECK( 0 != (cards_by_holder[WHITE] & refuted) );
+		CHECK( deductions.isConsistentWith(cards_by_holder) );
+
+		if( 0 != (cards_by_holder[WHITE] & (1u << plum)) )
+		{
+			++white_plum_seen;
+		}
+	}
+
+	//Plum with White or in Case File: both should turn up
+	CHECK( 0 < white_plum_seen );
+	CHECK( NUM_SAMPLES > white_plum_seen );
+
+	//--------------------------------------------------------------------------
+	// contradictory notebook has no deals
+	//--------------------------------------------------------------------------
+	DeductionMatrix contradicted( deductions );
+	contradicted.recordHoldsOneOf( MUSTARD, (1u << plum) );
+
+	DealSampler infeasible( contradicted, SCARLET, scarlet_hand );
+	CHECK( ! infeasible.isFeasible() );
+
+	unsigned int cards_by_holder[DeductionMatrix::NUM_HOLDERS];
+	CHECK( ! infeasible.sample(rng, cards_by_holder) );
+
+} //end routine testDealSampler()
+
+
+//------------------------------------------------------------------------------
+// Board Layout
+//------------------------------------------------------------------------------
+/// \note same as BoardLayout::classic(): 21 lines
+static const char* const CLASSIC_LAYOUT =
+	"# classic Clue-Less board\n"
+	"hallway study hall\n"
+	"hallway hall lounge\n"
+	"home miss_scarlet\n"
+	"hallway study library\n"
+	"home professor_plum\n"
+	"hallway hall billiard_room\n"
+	"hallway lounge dining_room\n"
+	"home colonel_mustard\n"
+	"hallway library billiard_room\n"
+	"hallway billiard_room dining_room\n"
+	"hallway library conservatory\n"
+	"home mrs_peacock\n"
+	"hallway billiard_room ballroom\n"
+	"hallway dining_room kitchen\n"
+	"hallway conservatory ballroom\n"
+	"home mr_green\n"
+	"hallway ballroom kitchen\n"
+	"home mrs_white\n"
+	"passage study kitchen\n"
+	"passage lounge conservatory\n";
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns message of error parsing layout; empty when none.
+////////////////////////////////////////////////////////////////////////////////
+static std::string
+findLayoutError(
+	const std::string& description) //i - layout description
+{
+	std::istringstream text( description );
+
+	try
+	{
+		BoardLayout layout( text );
+	}
+	catch( const std::logic_error& error )
+	{
+		return error.what();
+	}
+
+	return std::string();
+
+} //end routine findLayoutError()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns whether text contains part.
+////////////////////////////////////////////////////////////////////////////////
+static bool
+contains(
+	const std::string& text, //i - text to search
+	const char* part) //i - text sought
+{
+	return( std::string::npos != text.find(part) );
+
+} //end routine contains()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Checks layout descriptions are parsed, and rejected when a room
+///  has more exits than move options hold.
+////////////////////////////////////////////////////////////////////////////////
+static void
+testBoardLayout()
+{
+	CHECK( findLayoutError(CLASSIC_LAYOUT).empty() );
+
+	//--------------------------------------------------------------------------
+	// exits per room bounded, whether hallway or passage adds one too many
+	//--------------------------------------------------------------------------
+	const std::string five_exits( std::string(CLASSIC_LAYOUT) +
+		"hallway study ballroom\n"
+		"hallway study dining_room\n" );
+	CHECK( findLayoutError(five_exits).empty() );
+
+	std::string error( findLayoutError(five_exits + "hallway conservatory study\n") );
+	CHECK( contains(error, "line 24:") );
+	CHECK( contains(error, "study has more than 5 exits") );
+
+	const std::string library_full( std::string(CLASSIC_LAYOUT) +
+		"hallway library hall\n"
+		"hallway library lounge\n" );
+	CHECK( findLayoutError(library_full).empty() );
+
+	error = findLayoutError( library_full + "passage dining_room library\n" );
+	CHECK( contains(error, "line 24:") );
+	CHECK( contains(error, "library has more than 5 exits") );
+
+	//--------------------------------------------------------------------------
+	// malformed lines, each named by line number
+	//--------------------------------------------------------------------------
+	CHECK( contains(findLayoutError("hallway study study\n"), "line 1: hallway must connect two different rooms") );
+	CHECK( contains(findLayoutError("# first\nhome miss_scarlet\n"), "line 2: home must follow hallway it enters") );
+	CHECK( contains(findLayoutError("tunnel study hall\n"), "line 1: unknown keyword 'tunnel'") );
+	CHECK( contains(findLayoutError("hallway study attic\n"), "line 1: unknown room 'attic'") );
+	CHECK( contains(findLayoutError("hallway study hall\nhome colonel_plum\n"), "line 2: unknown character 'colonel_plum'") );
+	CHECK( contains(findLayoutError("hallway study hall lounge\n"), "line 1: unexpected 'lounge'") );
+	CHECK( contains(findLayoutError("hallway study hall\nhome mr_green kitchen\n"), "line 2: unexpected 'kitchen'") );
+	CHECK( contains(findLayoutError(std::string(CLASSIC_LAYOUT) + "home miss_scarlet\n"), "line 22: miss_scarlet already has home") );
+	CHECK( findLayoutError(std::string(CLASSIC_LAYOUT) + "passage library hall\n").empty() );
+	CHECK( contains(findLayoutError(std::string(CLASSIC_LAYOUT) + "passage library study\n"), "line 22: room already has secret passage") );
+
+	//--------------------------------------------------------------------------
+	// incomplete boards
+	//--------------------------------------------------------------------------
+	std::string no_white_home( CLASSIC_LAYOUT );
+	no_white_home.erase( no_white_home.find("home mrs_white\n"), std::strlen("home mrs_white\n") );
+	error = findLayoutError( no_white_home );
+	CHECK( contains(error, "INSUFFICIENT_DATA") );
+	CHECK( contains(error, "has no home") );
+
+	error = findLayoutError(
+		"hallway study hall\nhome miss_scarlet\nhome colonel_mustard\nhome mrs_white\n"
+		"home mr_green\nhome mrs_peacock\nhome professor_plum\n" );
+	CHECK( contains(error, "INSUFFICIENT_DATA") );
+	CHECK( contains(error, "has no hallway") );
+
+} //end routine testBoardLayout()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Checks breadth-first distance and next-step tables against an
+///  independent all-pairs computation over the same connections.
+/// \note
+/// - Next step is the lowest-identifier connection on some shortest path,
+///   as connections are visited in identifier order.
+////////////////////////////////////////////////////////////////////////////////
+static void
+testShortestPaths()
+{
+	const BoardLayout& layout( *BoardLayout::classic() );
+	const size_t num_locations( layout.getNumLocations() );
+	const unsigned int NO_PATH( BoardLayout::NO_PATH );
+
+	//--------------------------------------------------------------------------
+	// reference distances: Floyd-Warshall
+	//--------------------------------------------------------------------------
+	std::vector<unsigned int> reference( num_locations * num_locations, NO_PATH );
+	for(size_t start_id(0); start_id < num_locations; ++start_id)
+	{
+		reference[start_id * num_locations + start_id] = 0;
+
+		const unsigned char* connections( layout.getConnections(start_id) );
+		for(size_t conn_index(0); conn_index < layout.getNumConnections(start_id); ++conn_index)
+		{
+			reference[start_id * num_locations + connections[conn_index]] = 1;
+		}
+	}
+
+	for(size_t via_id(0); via_id < num_locations; ++via_id)
+	{
+		for(size_t start_id(0); start_id < num_locations; ++start_id)
+		{
+			for(size_t dest_id(0); dest_id < num_locations; ++dest_id)
+			{
+				unsigned int& distance( reference[start_id * num_locations + dest_id] );
+				unsigned int via_distance(
+					reference[start_id * num_locations + via_id] + reference[via_id * num_locations + dest_id] );
+
+				distance = (via_distance < distance) ? via_distance : distance;
+			}
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	// tables agree with reference
+	//--------------------------------------------------------------------------
+	bool is_distance_right( true );
+	bool is_next_step_right( true );
+
+	for(size_t start_id(0); start_id < num_locations; ++start_id)
+	{
+		for(size_t dest_id(0); dest_id < num_locations; ++dest_id)
+		{
+			unsigned int expected( reference[start_id * num_locations + dest_id] );
+			if( NO_PATH <= expected )
+			{
+				expected = NO_PATH;
+			}
+
+			is_distance_right &= (expected == layout.getDistance(start_id, dest_id));
+
+			if( (start_id == dest_id) || (NO_PATH == expected) )
+			{
+				is_next_step_right &= (NO_PATH == layout.getNextStep(start_id, dest_id));
+				continue; //next destination
+			}
+
+			//lowest connection one move closer
+			unsigned int expected_step( NO_PATH );
+			const unsigned char* connections( layout.getConnections(start_id) );
+			for(size_t conn_index(0); conn_index < layout.getNumConnections(start_id); ++conn_index)
+			{
+				if( (expected - 1 == reference[connections[conn_index] * num_locations + dest_id]) &&
+					(connections[conn_index] < expected_step) )
+				{
+					expected_step = connections[conn_index];
+				}
+			}
+
+			is_next_step_right &= (expected_step == layout.getNextStep(start_id, dest_id));
+		}
+	}
+
+	CHECK( is_distance_right );
+	CHECK( is_next_step_right );
+
+	//--------------------------------------------------------------------------
+	// known routes of the classic board
+	//--------------------------------------------------------------------------
+	const size_t study( BoardLayout::determineRoomId(clueless::STUDY) );
+	const size_t hall( BoardLayout::determineRoomId(clueless::HALL) );
+	const size_t kitchen( BoardLayout::determineRoomId(clueless::KITCHEN) );
+	const size_t study_hall_hallway( layout.getHallways()[0]._id );
+
+	CHECK( 1 == layout.getDistance(study, kitchen) ); //secret passage
+	CHECK( kitchen == layout.getNextStep(study, kitchen) );
+	CHECK( 2 == layout.getDistance(study, hall) );
+	CHECK( study_hall_hallway == layout.getNextStep(study, hall) );
+
+	//homes are left, never entered
+	for(size_t home_index(0); home_index < layout.getHomes().size(); ++home_index)
+	{
+		const size_t home_id( layout.getHomes()[home_index]._id );
+
+		CHECK( NO_PATH == layout.getDistance(study, home_id) );
+		CHECK( NO_PATH != layout.getDistance(home_id, kitchen) );
+	}
+
+} //end routine testShortestPaths()
+
+
+//------------------------------------------------------------------------------
+// Case File Hypotheses
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns whether values agree to within float rounding.
+////////////////////////////////////////////////////////////////////////////////
+static bool
+isNear(
+	double value, //i - value of interest
+	double expected, //i - value expected
+	double tolerance = 1e-5) //i - largest difference allowed
+{
+	return( std::fabs(value - expected) < tolerance );
+
+} //end routine isNear()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns sum of marginals over cards of one type.
+////////////////////////////////////////////////////////////////////////////////
+static double
+sumMarginals(
+	const CaseFileHypotheses& hypotheses, //i - weighed hypotheses
+	size_t first_card, //i - first card of type (card index)
+	size_t num_cards) //i - number of cards of type
+{
+	double sum( 0.0 );
+	for(size_t card_index(first_card); card_index < first_card + num_cards; ++card_index)
+	{
+		sum += hypotheses.getMarginal( card_index );
+	}
+
+	return sum;
+
+} //end routine sumMarginals()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Checks Case File probabilities and card marginals follow what a
+///  notebook has deduced.
+////////////////////////////////////////////////////////////////////////////////
+static void
+testCaseFileHypotheses()
+{
+	const size_t CASE_FILE( DeductionMatrix::CASE_FILE );
+	const size_t MUSTARD( clueless::COLONEL_MUSTARD );
+
+	const size_t scarlet_card( clueless::determineCardIndex(clueless::MISS_SCARLET) );
+	const size_t white_card( clueless::determineCardIndex(clueless::MRS_WHITE) );
+	const size_t plum_card( clueless::determineCardIndex(clueless::PROFESSOR_PLUM) );
+	const size_t rope_card( clueless::determineCardIndex(clueless::ROPE) );
+	const size_t kitchen_card( clueless::determineCardIndex(clueless::KITCHEN) );
+
+	//--------------------------------------------------------------------------
+	// nothing known: every card of a type equally likely
+	//--------------------------------------------------------------------------
+	{
+		CaseFileHypotheses hypotheses;
+		hypotheses.update( makeThreePlayerMatrix() );
+
+		double total( 0.0 );
+		for(size_t hypothesis(0); hypothesis < CaseFileHypotheses::NUM_HYPOTHESES; ++hypothesis)
+		{
+			total += hypotheses.getProbability( hypothesis );
+		}
+		CHECK( isNear(total, 1.0, 1e-4) );
+
+		CHECK( isNear(hypotheses.getMarginal(scarlet_card), 1.0 / 6.0) );
+		CHECK( isNear(hypotheses.getMarginal(rope_card), 1.0 / 6.0) );
+		CHECK( isNear(hypotheses.getMarginal(kitchen_card), 1.0 / 9.0) );
+	}
+
+	//--------------------------------------------------------------------------
+	// card seen in a hand: out of Case File, rest of its type share its chance
+	//--------------------------------------------------------------------------
+	{
+		DeductionMatrix deductions( makeThreePlayerMatrix() );
+		deductions.recordCardHeld( plum_card, MUSTARD );
+		deductions.propagate();
+
+		CaseFileHypotheses hypotheses;
+		hypotheses.update( deductions );
+
+		CHECK( 0.0f == hypotheses.getMarginal(plum_card) );
+		CHECK( isNear(hypotheses.getMarginal(scarlet_card), 1.0 / 5.0) );
+		CHECK( isNear(sumMarginals(hypotheses, CaseFileHypotheses::FIRST_PERSON_CARD, clueless::PROFESSOR_PLUM), 1.0) );
+		CHECK( isNear(sumMarginals(hypotheses, CaseFileHypotheses::FIRST_WEAPON_CARD, clueless::WRENCH), 1.0) );
+		CHECK( isNear(sumMarginals(hypotheses, CaseFileHypotheses::FIRST_ROOM_CARD, clueless::KITCHEN), 1.0) );
+		CHECK( 0.0f == hypotheses.getProbability(CaseFileHypotheses::determineHypothesis(
+			SolutionCardSet(clueless::PROFESSOR_PLUM, clueless::ROPE, clueless::KITCHEN))) );
+	}
+
+	//--------------------------------------------------------------------------
+	// refutation: Mustard holds Scarlet or rope, so not both in Case File,
+	// and each less likely there than an unconstrained card
+	//--------------------------------------------------------------------------
+	{
+		DeductionMatrix deductions( makeThreePlayerMatrix() );
+		deductions.recordHoldsOneOf( MUSTARD, (1u << scarlet_card) | (1u << rope_card) );
+		deductions.propagate();
+
+		CaseFileHypotheses hypotheses;
+		hypotheses.update( deductions );
+
+		CHECK( 0.0f == hypotheses.getProbability(CaseFileHypotheses::determineHypothesis(
+			SolutionCardSet(clueless::MISS_SCARLET, clueless::ROPE, clueless::KITCHEN))) );
+		CHECK( hypotheses.getMarginal(scarlet_card) < hypotheses.getMarginal(white_card) );
+		CHECK( isNear(sumMarginals(hypotheses, CaseFileHypotheses::FIRST_PERSON_CARD, clueless::PROFESSOR_PLUM), 1.0) );
+	}
+
+	//--------------------------------------------------------------------------
+	// Case File deduced: its cards certain, and most likely
+	//--------------------------------------------------------------------------
+	{
+		DeductionMatrix deductions( makeThreePlayerMatrix() );
+		deductions.recordCardHeld( scarlet_card, CASE_FILE );
+		deductions.recordCardHeld( rope_card, CASE_FILE );
+		deductions.recordCardHeld( kitchen_card, CASE_FILE );
+		CHECK( deductions.propagate() );
+
+		CaseFileHypotheses hypotheses;
+		hypotheses.update( deductions );
+
+		CHECK( isNear(hypotheses.getMarginal(scarlet_card), 1.0) );
+		CHECK( isNear(hypotheses.getMarginal(kitchen_card), 1.0) );
+		CHECK( 0.0f == hypotheses.getMarginal(white_card) );
+		CHECK( isNear(hypotheses.getMaxProbability(), 1.0) );
+		CHECK( SolutionCardSet(clueless::MISS_SCARLET, clueless::ROPE, clueless::KITCHEN) ==
+			hypotheses.findMostLikely() );
+	}
+
+} //end routine testCaseFileHypotheses()
+
+
+//------------------------------------------------------------------------------
+// Tournament Ratings
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Tournament whose Bradley-Terry fit can be given wins directly.
+////////////////////////////////////////////////////////////////////////////////
+class RatingFit : public Tournament
+{
+public:
+	RatingFit(size_t numEntrants)
+		: Tournament( GameSimulator::MIN_NUM_PLAYERS )
+		, _strategies( numEntrants )
+	{
+		for(size_t entrant(0); entrant < numEntrants; ++entrant)
+		{
+			addEntrant( &_strategies[entrant] );
+		}
+	}
+
+	std::vector<double> fit(const std::vector<double>& wins) const
+	{
+		std::vector<double> ratings;
+		fitRatings( wins, &ratings );
+
+		return ratings;
+	}
+
+protected:
+	std::vector<PlayerStrategy> _strategies;
+
+}; //end class RatingFit defn
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Returns mean of ratings.
+////////////////////////////////////////////////////////////////////////////////
+static double
+computeMeanRating(
+	const std::vector<double>& ratings) //i - rating per entrant
+{
+	double sum( 0.0 );
+	for(size_t entrant(0); entrant < ratings.size(); ++entrant)
+	{
+		sum += ratings[entrant];
+	}
+
+	return( ratings.empty() ? 0.0 : sum / (double)ratings.size() );
+
+} //end routine computeMeanRating()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Checks Bradley-Terry ratings against closed-form and ordering
+///  results.
+/// \note
+/// - Each pair of entrants is credited half a win each way (the fit's
+///   prior), so two entrants winning a and b games are rated
+///   400 log10((a + 0.5) / (b + 0.5)) apart.
+////////////////////////////////////////////////////////////////////////////////
+static void
+testRatings()
+{
+	//--------------------------------------------------------------------------
+	// even record: everyone at base rating
+	//--------------------------------------------------------------------------
+	{
+		RatingFit tournament( 3 );
+		std::vector<double> wins( 9, 12.0 );
+
+		std::vector<double> ratings( tournament.fit(wins) );
+		for(size_t entrant(0); entrant < ratings.size(); ++entrant)
+		{
+			CHECK( isNear(ratings[entrant], Tournament::BASE_RATING, 1e-6) );
+		}
+	}
+
+	//--------------------------------------------------------------------------
+	// two entrants: closed form
+	//--------------------------------------------------------------------------
+	{
+		RatingFit tournament( 2 );
+		std::vector<double> wins( 4, 0.0 );
+		wins[0 * 2 + 1] = 30.0; //first beat second
+		wins[1 * 2 + 0] = 10.0;
+
+		std::vector<double> ratings( tournament.fit(wins) );
+		CHECK( 2 == ratings.size() );
+		CHECK( isNear(ratings[0] - ratings[1], 400.0 * std::log10(30.5 / 10.5), 1e-3) );
+		CHECK( isNear(computeMeanRating(ratings), Tournament::BASE_RATING, 1e-6) );
+	}
+
+	//--------------------------------------------------------------------------
+	// transitive record: ratings in order, averaging base rating
+	//--------------------------------------------------------------------------
+	{
+		RatingFit tournament( 3 );
+		std::vector<double> wins( 9, 0.0 );
+		wins[0 * 3 + 1] = 20.0; wins[1 * 3 + 0] = 10.0;
+		wins[1 * 3 + 2] = 20.0; wins[2 * 3 + 1] = 10.0;
+		wins[0 * 3 + 2] = 25.0; wins[2 * 3 + 0] = 5.0;
+
+		std::vector<double> ratings( tournament.fit(wins) );
+		CHECK( ratings[0] > ratings[1] );
+		CHECK( ratings[1] > ratings[2] );
+		CHECK( isNear(computeMeanRating(ratings), Tournament::BASE_RATING, 1e-6) );
+	}
+
+} //end routine testRatings()
+
+
+//------------------------------------------------------------------------------
+// Game State
+//------------------------------------------------------------------------------
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Plays every choice of a live game on a GameState as well, through
+///  GameState::step(), checking each suggestion is refuted alike.
+/// \note
+/// - Choices are applied once their outcome is known: moves when the token
+///   moves, suggestions once notebooks are updated, accusations once
+///   judged.
+/// - A live refuter holding several matching cards may show any of them
+///   (see DetectiveNotebook::decideWhichCardToShowOpponent()), so shown
+///   cards need only both refute.
+////////////////////////////////////////////////////////////////////////////////
+class StepReplaySink : public NullEventSink
+{
+public:
+	StepReplaySink(const GameState& initialState, const BoardLayout& layout)
+		: _state( initialState )
+		, _layout( layout )
+		, _refuter( clueless::UNKNOWN_PERSON )
+		, _shownCard( GameState::NO_CARD )
+		, _numSuggestions( 0 )
+		, _numSelfRefutations( 0 )
+	{
+	}
+
+	const GameState& getState() const { return _state; }
+	size_t getNumSuggestions() const { return _numSuggestions; }
+	size_t getNumSelfRefutations() const { return _numSelfRefutations; }
+
+	virtual void turnOptionChosen(const Player*, clueless::TurnOptionType choice) override
+	{
+		if( clueless::DO_NOTHING_ELSE_THIS_TURN == choice )
+		{
+			_state = GameState::step( _state, GameState::Action(), _layout );
+		}
+	}
+
+	virtual void playerMoved(const Player*, const Location* destination, bool) override
+	{
+		_state = GameState::step( _state, GameState::Action::move(destination->getId()), _layout );
+	}
+
+	virtual void suggestionMade(const Player*, const SolutionCardSet& suggestion) override
+	{
+		_suggestion = suggestion;
+		_refuter = clueless::UNKNOWN_PERSON;
+		_shownCard = GameState::NO_CARD;
+	}
+
+	virtual void counterEvidenceShown(const Player* refuter, const Player* suggestor, const Card* counterEvidence) override
+	{
+		_refuter = refuter->getCharacter();
+		_shownCard = counterEvidence->getIndex();
+
+		if( refuter == suggestor )
+		{
+			++_numSelfRefutations;
+		}
+	}
+
+	virtual void notebooksUpdated(const Player*) override
+	{
+		_state = GameState::step( _state,
+			GameState::Action::suggest(_suggestion.getPersonType(), _suggestion.getWeaponType()),
+			_layout );
+		++_numSuggestions;
+
+		const size_t refuter_seat( _state._lastRefuterSeat );
+		CHECK( _refuter == ((GameState::NO_SEAT == refuter_seat)
+			? clueless::UNKNOWN_PERSON
+			: clueless::PersonType(_state._seats[refuter_seat]._character)) );
+
+		if( GameState::NO_SEAT == refuter_seat )
+		{
+			CHECK( GameState::NO_CARD == _shownCard );
+		}
+		else
+		{
+			const unsigned int matching_cards( _state._seats[refuter_seat]._hand &
+				((1u << clueless::determineCardIndex(_suggestion.getPersonType())) |
+				 (1u << clueless::determineCardIndex(_suggestion.getWeaponType())) |
+				 (1u << clueless::determineCardIndex(_suggestion.getRoomType()))) );
+
+			CHECK( 0 != (matching_cards & (1u << _shownCard)) );
+			CHECK( 0 != (matching_cards & (1u << _state._lastShownCard)) );
+		}
+	}
+
+	virtual void gameWon(const Player*, const SolutionCardSet& caseFile) override
+	{
+		_state = GameState::step( _state, GameState::Action::accuse(caseFile), _layout );
+	}
+
+	virtual void falseAccusationMade(const Player*, const SolutionCardSet& accusation) override
+	{
+		_state = GameState::step( _state, GameState::Action::accuse(accusation), _layout );
+	}
+
+protected:
+	GameState _state;
+	const BoardLayout& _layout;
+
+	SolutionCardSet _suggestion;  //being refuted
+	clueless::PersonType _refuter; //live refuter; unknown if none
+	size_t _shownCard;             //card index; NO_CARD if none
+
+	size_t _numSuggestions;
+	size_t _numSelfRefutations; //suggestor showed own card
+
+}; //end class StepReplaySink defn
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Checks replayed state matches live game's snapshot.
+/// \note
+/// - Only public notebooks are compared: what a suggestor learns, and what
+///   its refuter records as shown, depend on which matching card is shown.
+////////////////////////////////////////////////////////////////////////////////
+static void
+checkStateMatches(
+	const GameState& replayed, //i - state advanced by GameState::step()
+	const GameState& live) //i - snapshot of live game
+{
+	CHECK( replayed._numSeats == live._numSeats );
+	CHECK( replayed._winnerSeat == live._winnerSeat );
+	CHECK( replayed._numFalseAccusers == live._numFalseAccusers );
+
+	CHECK( std::equal(live._personLocations, live._personLocations + clueless::PROFESSOR_PLUM,
+		replayed._personLocations) );
+	CHECK( std::equal(live._weaponLocations, live._weaponLocations + clueless::WRENCH,
+		replayed._weaponLocations) );
+
+	bool is_same_notebook( true );
+	for(size_t card_index(0); card_index < clueless::NUM_CARDS; ++card_index)
+	{
+		is_same_notebook &= (live._publicNotebook.getPossibleHolders(card_index) ==
+			replayed._publicNotebook.getPossibleHolders(card_index));
+	}
+	CHECK( is_same_notebook );
+
+	for(size_t seat(0); seat < live._numSeats; ++seat)
+	{
+		CHECK( live._seats[seat]._character == replayed._seats[seat]._character );
+		CHECK( live._seats[seat]._flags == replayed._seats[seat]._flags );
+	}
+
+} //end routine checkStateMatches()
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Checks seeded games replayed through GameState::step() match live
+///  play, turn by turn.
+/// \note
+/// - Games are driven as GameSimulator::playGame() drives them, so live
+///   state (see Game::snapshot()) can be compared after every turn.
+/// - Some suggestions must be refuted by their suggestor, who is asked last.
+////////////////////////////////////////////////////////////////////////////////
+static void
+testGameState()
+{
+	const unsigned long NUM_GAMES( 40 );
+	const unsigned int MAX_NUM_TURNS( GameSimulator::DEFAULT_MAX_NUM_TURNS );
+
+	size_t num_suggestions( 0 );
+	size_t num_self_refutations( 0 );
+
+	for(unsigned long seed(1); seed <= NUM_GAMES; ++seed)
+	{
+		const size_t num_players( GameSimulator::MIN_NUM_PLAYERS + seed % 4 );
+
+		std::list<Player*> players;
+		for(size_t seat(0); seat < num_players; ++seat)
+		{
+			players.push_back(
+				new Player("Player", GameSimulator::determineSeatCharacter(seat), (0 == seat)) );
+		}
+
+		Game game( seed );
+		game.setup( &players );
+
+		const BoardLayout& layout( *game._board.getLayout() );
+		StepReplaySink replay( game.snapshot(players.front()), layout );
+		game.setEventSink( &replay );
+
+		try
+		{
+			for(unsigned int turn(0); ! game.hasWinner() &&
+				(game._numFalseAccusers < players.size()) &&
+				(turn < MAX_NUM_TURNS); ++turn)
+			{
+				for(std::list<Player*>::iterator player_iter(players.begin());
+					! game.hasWinner() && (players.end() != player_iter);
+					++player_iter)
+				{
+					game.executePlayerTurn( *player_iter );
+
+					checkStateMatches( replay.getState(), game.snapshot(*player_iter) );
+				}
+			}
+		}
+		catch( const std::exception& ex ) //step() refused a live choice
+		{
+			recordCheck( false, ex.what(), __FILE__, __LINE__ );
+		}
+
+		num_suggestions += replay.getNumSuggestions();
+		num_self_refutations += replay.getNumSelfRefutations();
+
+		for(std::list<Player*>::iterator player_iter(players.begin()); players.end() != player_iter; ++player_iter)
+		{
+			delete *player_iter;
+		}
+	}
+
+	CHECK( 0 < num_suggestions );
+	CHECK( 0 < num_self_refutations );
+
+} //end routine testGameState()
+
+
+//------------------------------------------------------------------------------
+// Test Groups
+//------------------------------------------------------------------------------
+struct TestGroup
+{
+	const char* _name;
+	void (*_run)();
+
+}; //end struct TestGroup defn
+
+
+static const TestGroup TEST_GROUPS[] = {
+	{ "deduction",   testDeductionMatrix },
+	{ "lzcodec",     testLzCodec },
+	{ "replaylog",   testReplayLog },
+	{ "random",      testUniformInt },
+	{ "dealsampler", testDealSampler },
+	{ "hypotheses",  testCaseFileHypotheses },
+	{ "ratings",     testRatings },
+	{ "layout",      testBoardLayout },
+	{ "paths",       testShortestPaths },
+	{ "gamestate",   testGameState } };
+
+static const size_t NUM_TEST_GROUPS = sizeof(TEST_GROUPS) / sizeof(TEST_GROUPS[0]);
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Runs test group, reporting its failed checks.
+/// \param TestGroup: group to run
+/// \return bool: whether every check passed
+/// \throw None
+/// \note
+/// - An exception ends the group and counts as a failed check.
+////////////////////////////////////////////////////////////////////////////////
+static bool
+runTestGroup(
+	const TestGroup& group) //i - group to run
+{
+	const size_t num_failed_before( num_failed_checks );
+
+	try
+	{
+		group._run();
+	}
+	catch( const std::exception& ex )
+	{
+		++num_failed_checks;
+		std::cout << "  FAILED with exception:\n" << ex.what() << "\n";
+	}
+
+	const bool has_passed( num_failed_before == num_failed_checks );
+	std::cout << (has_passed ? "passed " : "FAILED ") << group._name << "\n";
+
+	return has_passed;
+
+} //end routine runTestGroup()
+
+
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, const char* argv[])
+{
+	bool has_passed( true );
+
+	if( 1 == argc )
+	{
+		for(size_t group_index(0); group_index < NUM_TEST_GROUPS; ++group_index)
+		{
+			has_passed &= runTestGroup( TEST_GROUPS[group_index] );
+		}
+	}
+
+	for(int arg_index(1); arg_index < argc; ++arg_index)
+	{
+		size_t group_index( 0 );
+		while( (group_index < NUM_TEST_GROUPS) &&
+			(0 != std::strcmp(argv[arg_index], TEST_GROUPS[group_index]._name)) )
+		{
+			++group_index;
+		}
+
+		if( NUM_TEST_GROUPS == group_index )
+		{
+			std::cout << "unknown test group: " << argv[arg_index] << "\n";
+			has_passed = false;
+			continue;
+		}
+
+		has_passed &= runTestGroup( TEST_GROUPS[group_index] );
+	}
+
+	return( has_passed ? 0 : 1 );
+
+} //end routine main()